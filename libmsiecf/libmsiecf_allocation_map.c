@@ -0,0 +1,689 @@
+/*
+ * Allocation map functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmsiecf_allocation_map.h"
+#include "libmsiecf_libcdata.h"
+#include "libmsiecf_libcerror.h"
+
+#if defined( __GNUC__ )
+
+#define libmsiecf_allocation_map_count_trailing_zeros( value_64bit ) \
+	(uint32_t) __builtin_ctzll( (unsigned long long) value_64bit )
+
+#define libmsiecf_allocation_map_count_bits( value_64bit ) \
+	(uint32_t) __builtin_popcountll( (unsigned long long) value_64bit )
+
+#else
+
+/* Determines the number of trailing zero bits of a non-zero 64-bit value
+ * Returns the number of trailing zero bits
+ */
+static uint32_t libmsiecf_allocation_map_count_trailing_zeros(
+                 uint64_t value_64bit )
+{
+	uint32_t number_of_bits = 0;
+
+	if( ( value_64bit & 0x00000000ffffffffULL ) == 0 )
+	{
+		value_64bit   >>= 32;
+		number_of_bits += 32;
+	}
+	if( ( value_64bit & 0x0000ffffULL ) == 0 )
+	{
+		value_64bit   >>= 16;
+		number_of_bits += 16;
+	}
+	if( ( value_64bit & 0x00ffULL ) == 0 )
+	{
+		value_64bit   >>= 8;
+		number_of_bits += 8;
+	}
+	if( ( value_64bit & 0x0fULL ) == 0 )
+	{
+		value_64bit   >>= 4;
+		number_of_bits += 4;
+	}
+	if( ( value_64bit & 0x03ULL ) == 0 )
+	{
+		value_64bit   >>= 2;
+		number_of_bits += 2;
+	}
+	if( ( value_64bit & 0x01ULL ) == 0 )
+	{
+		number_of_bits += 1;
+	}
+	return( number_of_bits );
+}
+
+/* Determines the number of bits set in a 64-bit value
+ * Returns the number of bits set
+ */
+static uint32_t libmsiecf_allocation_map_count_bits(
+                 uint64_t value_64bit )
+{
+	value_64bit = value_64bit - ( ( value_64bit >> 1 ) & 0x5555555555555555ULL );
+	value_64bit = ( value_64bit & 0x3333333333333333ULL ) + ( ( value_64bit >> 2 ) & 0x3333333333333333ULL );
+	value_64bit = ( value_64bit + ( value_64bit >> 4 ) ) & 0x0f0f0f0f0f0f0f0fULL;
+
+	return( (uint32_t) ( ( value_64bit * 0x0101010101010101ULL ) >> 56 ) );
+}
+
+#endif /* defined( __GNUC__ ) */
+
+/* Creates an allocation map
+ * Make sure the value allocation_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_allocation_map_initialize(
+     libmsiecf_allocation_map_t **allocation_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_allocation_map_initialize";
+
+	if( allocation_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *allocation_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid allocation map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*allocation_map = memory_allocate_structure(
+	                   libmsiecf_allocation_map_t );
+
+	if( *allocation_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create allocation map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *allocation_map,
+	     0,
+	     sizeof( libmsiecf_allocation_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear allocation map.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *allocation_map != NULL )
+	{
+		memory_free(
+		 *allocation_map );
+
+		*allocation_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an allocation map
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_allocation_map_free(
+     libmsiecf_allocation_map_t **allocation_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_allocation_map_free";
+
+	if( allocation_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *allocation_map != NULL )
+	{
+		if( ( *allocation_map )->words != NULL )
+		{
+			memory_free(
+			 ( *allocation_map )->words );
+		}
+		memory_free(
+		 *allocation_map );
+
+		*allocation_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the allocation map from allocation table data
+ * Every bit in the data represents one block, the least significant bit first,
+ * where a set bit indicates the block is allocated
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_allocation_map_set_data(
+     libmsiecf_allocation_map_t *allocation_map,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t number_of_blocks,
+     off64_t base_offset,
+     uint16_t block_size,
+     libcerror_error_t **error )
+{
+	uint64_t *words          = NULL;
+	static char *function    = "libmsiecf_allocation_map_set_data";
+	size_t data_offset       = 0;
+	size_t number_of_bytes   = 0;
+	uint32_t bit_index       = 0;
+	uint32_t number_of_words = 0;
+	uint32_t word_index      = 0;
+
+	if( allocation_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation map.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_bytes = ( (size_t) number_of_blocks + 7 ) / 8;
+
+	if( number_of_bytes > data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid base offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid block size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_words = ( number_of_blocks / 64 ) + ( ( number_of_blocks % 64 ) != 0 ? 1 : 0 );
+
+	if( number_of_words > 0 )
+	{
+		words = (uint64_t *) memory_allocate(
+		                      sizeof( uint64_t ) * number_of_words );
+
+		if( words == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create words.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     words,
+		     0,
+		     sizeof( uint64_t ) * number_of_words ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear words.",
+			 function );
+
+			memory_free(
+			 words );
+
+			return( -1 );
+		}
+	}
+	for( data_offset = 0;
+	     data_offset < number_of_bytes;
+	     data_offset++ )
+	{
+		words[ data_offset / 8 ] |= (uint64_t) data[ data_offset ] << ( ( data_offset % 8 ) * 8 );
+	}
+	bit_index = number_of_blocks % 64;
+
+	if( bit_index != 0 )
+	{
+		/* Ignore the bits beyond the last block
+		 */
+		words[ number_of_words - 1 ] &= ( (uint64_t) 1 << bit_index ) - 1;
+	}
+	allocation_map->number_of_allocated_blocks = 0;
+
+	for( word_index = 0;
+	     word_index < number_of_words;
+	     word_index++ )
+	{
+		allocation_map->number_of_allocated_blocks += libmsiecf_allocation_map_count_bits(
+		                                               words[ word_index ] );
+	}
+	if( bit_index != 0 )
+	{
+		/* Mark the bits beyond the last block as allocated so that
+		 * an unallocated range ends at the last block
+		 */
+		words[ number_of_words - 1 ] |= ~( ( (uint64_t) 1 << bit_index ) - 1 );
+	}
+	if( allocation_map->words != NULL )
+	{
+		memory_free(
+		 allocation_map->words );
+	}
+	allocation_map->words            = words;
+	allocation_map->number_of_words  = number_of_words;
+	allocation_map->number_of_blocks = number_of_blocks;
+	allocation_map->base_offset      = base_offset;
+	allocation_map->block_size       = block_size;
+
+	return( 1 );
+}
+
+/* Determines if the block containing a specific offset is unallocated
+ * Returns 1 if unallocated, 0 if not or -1 on error
+ */
+int libmsiecf_allocation_map_is_unallocated_offset(
+     libmsiecf_allocation_map_t *allocation_map,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_allocation_map_is_unallocated_offset";
+	uint64_t block_index  = 0;
+
+	if( allocation_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( allocation_map->words == NULL )
+	 || ( offset < allocation_map->base_offset ) )
+	{
+		return( 0 );
+	}
+	block_index = (uint64_t) ( offset - allocation_map->base_offset ) / allocation_map->block_size;
+
+	if( block_index >= (uint64_t) allocation_map->number_of_blocks )
+	{
+		return( 0 );
+	}
+	if( ( ( allocation_map->words[ block_index / 64 ] >> ( block_index % 64 ) ) & 0x01 ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the unallocated ranges
+ * The unallocated ranges are inserted into the unallocated block list
+ * Runs of unallocated blocks are determined a 64-bit word at a time
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_allocation_map_get_unallocated_ranges(
+     libmsiecf_allocation_map_t *allocation_map,
+     libcdata_range_list_t *unallocated_block_list,
+     libcerror_error_t **error )
+{
+	static char *function      = "libmsiecf_allocation_map_get_unallocated_ranges";
+	uint64_t bits              = 0;
+	uint64_t unallocated_bits  = 0;
+	uint32_t bit_index         = 0;
+	uint32_t first_block_index = 0;
+	uint32_t last_block_index  = 0;
+	uint32_t word_index        = 0;
+	uint8_t in_range           = 0;
+
+	if( allocation_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation map.",
+		 function );
+
+		return( -1 );
+	}
+	if( unallocated_block_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid unallocated block list.",
+		 function );
+
+		return( -1 );
+	}
+	for( word_index = 0;
+	     word_index < allocation_map->number_of_words;
+	     word_index++ )
+	{
+		unallocated_bits = ~( allocation_map->words[ word_index ] );
+		bit_index        = 0;
+
+		while( bit_index < 64 )
+		{
+			if( in_range == 0 )
+			{
+				bits = unallocated_bits & ( ~( (uint64_t) 0 ) << bit_index );
+			}
+			else
+			{
+				bits = ~unallocated_bits & ( ~( (uint64_t) 0 ) << bit_index );
+			}
+			if( bits == 0 )
+			{
+				break;
+			}
+			bit_index = libmsiecf_allocation_map_count_trailing_zeros(
+			             bits );
+
+			if( in_range == 0 )
+			{
+				first_block_index = ( word_index * 64 ) + bit_index;
+				in_range          = 1;
+
+				continue;
+			}
+			last_block_index = ( word_index * 64 ) + bit_index;
+			in_range         = 0;
+
+			if( libcdata_range_list_insert_range(
+			     unallocated_block_list,
+			     (uint64_t) allocation_map->base_offset + ( (uint64_t) first_block_index * allocation_map->block_size ),
+			     (uint64_t) ( last_block_index - first_block_index ) * allocation_map->block_size,
+			     NULL,
+			     NULL,
+			     NULL,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert unallocated block in offset list.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( in_range != 0 )
+	{
+		last_block_index = allocation_map->number_of_blocks;
+
+		if( libcdata_range_list_insert_range(
+		     unallocated_block_list,
+		     (uint64_t) allocation_map->base_offset + ( (uint64_t) first_block_index * allocation_map->block_size ),
+		     (uint64_t) ( last_block_index - first_block_index ) * allocation_map->block_size,
+		     NULL,
+		     NULL,
+		     NULL,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert unallocated block in offset list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the ranges of blocks whose allocation state differs from a previous allocation map
+ * Blocks that are not contained in the previous allocation map are considered changed
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_allocation_map_get_changed_ranges(
+     libmsiecf_allocation_map_t *allocation_map,
+     libmsiecf_allocation_map_t *previous_allocation_map,
+     libcdata_range_list_t *changed_block_list,
+     libcerror_error_t **error )
+{
+	static char *function      = "libmsiecf_allocation_map_get_changed_ranges";
+	uint64_t bits              = 0;
+	uint64_t changed_bits      = 0;
+	uint32_t bit_index         = 0;
+	uint32_t first_block_index = 0;
+	uint32_t last_block_index  = 0;
+	uint32_t word_block_index  = 0;
+	uint32_t word_index        = 0;
+	uint8_t in_range           = 0;
+
+	if( allocation_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocation map.",
+		 function );
+
+		return( -1 );
+	}
+	if( previous_allocation_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid previous allocation map.",
+		 function );
+
+		return( -1 );
+	}
+	if( changed_block_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid changed block list.",
+		 function );
+
+		return( -1 );
+	}
+	for( word_index = 0;
+	     word_index < allocation_map->number_of_words;
+	     word_index++ )
+	{
+		word_block_index = word_index * 64;
+
+		/* Blocks beyond the previous allocation map or of a differently laid out
+		 * previous allocation map are always considered changed
+		 */
+		if( ( previous_allocation_map->base_offset != allocation_map->base_offset )
+		 || ( previous_allocation_map->block_size != allocation_map->block_size )
+		 || ( previous_allocation_map->number_of_blocks <= word_block_index ) )
+		{
+			changed_bits = ~( (uint64_t) 0 );
+		}
+		else
+		{
+			changed_bits = allocation_map->words[ word_index ] ^ previous_allocation_map->words[ word_index ];
+
+			if( ( previous_allocation_map->number_of_blocks - word_block_index ) < 64 )
+			{
+				changed_bits |= ~( (uint64_t) 0 ) << ( previous_allocation_map->number_of_blocks - word_block_index );
+			}
+		}
+		if( ( allocation_map->number_of_blocks - word_block_index ) < 64 )
+		{
+			changed_bits &= ~( ~( (uint64_t) 0 ) << ( allocation_map->number_of_blocks - word_block_index ) );
+		}
+		bit_index = 0;
+
+		while( bit_index < 64 )
+		{
+			if( in_range == 0 )
+			{
+				bits = changed_bits & ( ~( (uint64_t) 0 ) << bit_index );
+			}
+			else
+			{
+				bits = ~changed_bits & ( ~( (uint64_t) 0 ) << bit_index );
+			}
+			if( bits == 0 )
+			{
+				break;
+			}
+			bit_index = libmsiecf_allocation_map_count_trailing_zeros(
+			             bits );
+
+			if( in_range == 0 )
+			{
+				first_block_index = word_block_index + bit_index;
+				in_range          = 1;
+
+				continue;
+			}
+			last_block_index = word_block_index + bit_index;
+			in_range         = 0;
+
+			if( libcdata_range_list_insert_range(
+			     changed_block_list,
+			     (uint64_t) allocation_map->base_offset + ( (uint64_t) first_block_index * allocation_map->block_size ),
+			     (uint64_t) ( last_block_index - first_block_index ) * allocation_map->block_size,
+			     NULL,
+			     NULL,
+			     NULL,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert changed block in offset list.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( in_range != 0 )
+	{
+		last_block_index = allocation_map->number_of_blocks;
+
+		if( libcdata_range_list_insert_range(
+		     changed_block_list,
+		     (uint64_t) allocation_map->base_offset + ( (uint64_t) first_block_index * allocation_map->block_size ),
+		     (uint64_t) ( last_block_index - first_block_index ) * allocation_map->block_size,
+		     NULL,
+		     NULL,
+		     NULL,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert changed block in offset list.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,102 @@
+/*
+ * Allocation map functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMSIECF_ALLOCATION_MAP_H )
+#define _LIBMSIECF_ALLOCATION_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmsiecf_libcdata.h"
+#include "libmsiecf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmsiecf_allocation_map libmsiecf_allocation_map_t;
+
+struct libmsiecf_allocation_map
+{
+	/* The base offset
+	 */
+	off64_t base_offset;
+
+	/* The block size
+	 */
+	uint16_t block_size;
+
+	/* The number of blocks
+	 */
+	uint32_t number_of_blocks;
+
+	/* The number of allocated blocks
+	 */
+	uint32_t number_of_allocated_blocks;
+
+	/* The bitmap words, where bit 0 of word 0 represents the first block
+	 */
+	uint64_t *words;
+
+	/* The number of bitmap words
+	 */
+	uint32_t number_of_words;
+};
+
+int libmsiecf_allocation_map_initialize(
+     libmsiecf_allocation_map_t **allocation_map,
+     libcerror_error_t **error );
+
+int libmsiecf_allocation_map_free(
+     libmsiecf_allocation_map_t **allocation_map,
+     libcerror_error_t **error );
+
+int libmsiecf_allocation_map_set_data(
+     libmsiecf_allocation_map_t *allocation_map,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t number_of_blocks,
+     off64_t base_offset,
+     uint16_t block_size,
+     libcerror_error_t **error );
+
+int libmsiecf_allocation_map_is_unallocated_offset(
+     libmsiecf_allocation_map_t *allocation_map,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libmsiecf_allocation_map_get_unallocated_ranges(
+     libmsiecf_allocation_map_t *allocation_map,
+     libcdata_range_list_t *unallocated_block_list,
+     libcerror_error_t **error );
+
+int libmsiecf_allocation_map_get_changed_ranges(
+     libmsiecf_allocation_map_t *allocation_map,
+     libmsiecf_allocation_map_t *previous_allocation_map,
+     libcdata_range_list_t *changed_block_list,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMSIECF_ALLOCATION_MAP_H ) */
+
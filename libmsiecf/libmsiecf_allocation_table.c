@@ -23,18 +23,18 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libmsiecf_allocation_map.h"
 #include "libmsiecf_allocation_table.h"
 #include "libmsiecf_definitions.h"
 #include "libmsiecf_libbfio.h"
-#include "libmsiecf_libcdata.h"
 #include "libmsiecf_libcerror.h"
 #include "libmsiecf_libcnotify.h"
 
-/* Reads an allocation table
+/* Reads an allocation table into an allocation map
  * Returns 1 if successful or -1 on error
  */
 int libmsiecf_allocation_table_read_file_io_handle(
-     libcdata_range_list_t *unallocated_block_list,
+     libmsiecf_allocation_map_t *allocation_map,
      libbfio_handle_t *file_io_handle,
      off64_t allocation_table_offset,
      size64_t file_size,
@@ -44,26 +44,19 @@ int libmsiecf_allocation_table_read_file_io_handle(
      uint32_t number_of_allocated_blocks,
      libcerror_error_t **error )
 {
-	uint8_t *allocation_table_data                 = NULL;
-	static char *function                          = "libmsiecf_allocation_table_read_file_io_handle";
-	size_t read_size                               = 0;
-	size_t table_iterator                          = 0;
-	size_t unallocated_size                        = 0;
-	ssize_t read_count                             = 0;
-	off64_t offset                                 = 0;
-	off64_t unallocated_offset                     = 0;
-	uint32_t calculated_number_of_allocated_blocks = 0;
-	uint8_t allocation_table_entry                 = 0;
-	uint8_t bit_iterator                           = 0;
-	int result                                     = 0;
+	uint8_t *allocation_table_data = NULL;
+	static char *function          = "libmsiecf_allocation_table_read_file_io_handle";
+	size_t read_size               = 0;
+	ssize_t read_count             = 0;
+	uint32_t number_of_file_blocks = 0;
 
-	if( unallocated_block_list == NULL )
+	if( allocation_map == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid unallocated block list.",
+		 "%s: invalid allocation map.",
 		 function );
 
 		return( -1 );
@@ -199,89 +192,31 @@ int libmsiecf_allocation_table_read_file_io_handle(
 		 0 );
 	}
 #endif
-	for( table_iterator = 0;
-	     table_iterator < read_size;
-	     table_iterator++ )
-	{
-		allocation_table_entry = allocation_table_data[ table_iterator ];
-
-		for( bit_iterator = 0;
-		     bit_iterator < 8;
-		     bit_iterator++ )
-		{
-			if( ( allocation_table_entry & 0x01 ) == 0 )
-			{
-				if( unallocated_size == 0 )
-				{
-					unallocated_offset = offset;
-				}
-				unallocated_size += block_size;
-			}
-			else if( unallocated_size > 0 )
-			{
-				result = libcdata_range_list_insert_range(
-				          unallocated_block_list,
-				          (uint64_t) ( base_offset + unallocated_offset ),
-				          (uint64_t) unallocated_size,
-				          NULL,
-				          NULL,
-				          NULL,
-				          error );
-
-				if( result == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to insert unallocated block in offset list.",
-					 function );
-
-					goto on_error;
-				}
-				unallocated_size = 0;
-			}
-			if( ( allocation_table_entry & 0x01 ) != 0 )
-			{
-				calculated_number_of_allocated_blocks++;
-			}
-			allocation_table_entry >>= 1;
-
-			offset += block_size;
+	/* Only the blocks that start before the end of the file are mapped
+	 */
+	number_of_file_blocks = (uint32_t) ( ( file_size + block_size - 1 ) / block_size );
 
-			if( offset >= (off64_t) file_size )
-			{
-				break;
-			}
-		}
-		if( offset >= (off64_t) file_size )
-		{
-			break;
-		}
+	if( number_of_file_blocks > (uint32_t) ( read_size * 8 ) )
+	{
+		number_of_file_blocks = (uint32_t) ( read_size * 8 );
 	}
-	if( unallocated_size > 0 )
+	if( libmsiecf_allocation_map_set_data(
+	     allocation_map,
+	     allocation_table_data,
+	     read_size,
+	     number_of_file_blocks,
+	     base_offset,
+	     block_size,
+	     error ) != 1 )
 	{
-		result = libcdata_range_list_insert_range(
-		          unallocated_block_list,
-		          (uint64_t) ( base_offset + unallocated_offset ),
-		          (uint64_t) unallocated_size,
-		          NULL,
-		          NULL,
-		          NULL,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to insert unallocated block in offset list.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set allocation map data.",
+		 function );
 
-			goto on_error;
-		}
-		unallocated_size = 0;
+		goto on_error;
 	}
 	memory_free(
 	 allocation_table_data );
@@ -291,13 +226,13 @@ int libmsiecf_allocation_table_read_file_io_handle(
 #if defined( HAVE_VERBOSE_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		if( number_of_allocated_blocks != calculated_number_of_allocated_blocks )
+		if( number_of_allocated_blocks != allocation_map->number_of_allocated_blocks )
 		{
 			libcnotify_printf(
 			 "%s: mismatch in number of allocated blocks (stored: %" PRIu32 ", calculated: %" PRIu32 ")\n",
 			 function,
 			 number_of_allocated_blocks,
-			 calculated_number_of_allocated_blocks );
+			 allocation_map->number_of_allocated_blocks );
 		}
 	}
 #endif
@@ -25,8 +25,8 @@
 #include <common.h>
 #include <types.h>
 
+#include "libmsiecf_allocation_map.h"
 #include "libmsiecf_libbfio.h"
-#include "libmsiecf_libcdata.h"
 #include "libmsiecf_libcerror.h"
 
 #if defined( __cplusplus )
@@ -34,7 +34,7 @@ extern "C" {
 #endif
 
 int libmsiecf_allocation_table_read_file_io_handle(
-     libcdata_range_list_t *unallocated_block_list,
+     libmsiecf_allocation_map_t *allocation_map,
      libbfio_handle_t *file_io_handle,
      off64_t allocation_table_offset,
      size64_t file_size,
@@ -0,0 +1,95 @@
+/*
+ * Atomic operations
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMSIECF_ATOMIC_H )
+#define _LIBMSIECF_ATOMIC_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmsiecf_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The atomic operations are used to publish values that are written once
+ * and to maintain reference counts without grabbing a read/write lock
+ *
+ * LIBMSIECF_ATOMIC_LOAD_POINTER loads a pointer with acquire semantics
+ * LIBMSIECF_ATOMIC_COMPARE_AND_SWAP_POINTER stores the desired pointer if the current
+ * pointer is the expected pointer, with release semantics, and returns non-zero if stored
+ * LIBMSIECF_ATOMIC_INCREMENT and LIBMSIECF_ATOMIC_DECREMENT return the resulting 32-bit value
+ */
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT ) && defined( _MSC_VER )
+
+#define LIBMSIECF_ATOMIC_LOAD_POINTER( pointer ) \
+	InterlockedCompareExchangePointer( (PVOID volatile *) ( pointer ), NULL, NULL )
+
+#define LIBMSIECF_ATOMIC_COMPARE_AND_SWAP_POINTER( pointer, expected, desired ) \
+	( InterlockedCompareExchangePointer( (PVOID volatile *) ( pointer ), (PVOID) ( desired ), (PVOID) ( expected ) ) == (PVOID) ( expected ) )
+
+#define LIBMSIECF_ATOMIC_INCREMENT( value ) \
+	(int32_t) InterlockedIncrement( (LONG volatile *) ( value ) )
+
+#define LIBMSIECF_ATOMIC_DECREMENT( value ) \
+	(int32_t) InterlockedDecrement( (LONG volatile *) ( value ) )
+
+#elif defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ )
+
+#define LIBMSIECF_ATOMIC_LOAD_POINTER( pointer ) \
+	__atomic_load_n( pointer, __ATOMIC_ACQUIRE )
+
+#define LIBMSIECF_ATOMIC_COMPARE_AND_SWAP_POINTER( pointer, expected, desired ) \
+	__sync_bool_compare_and_swap( pointer, expected, desired )
+
+#define LIBMSIECF_ATOMIC_INCREMENT( value ) \
+	__sync_add_and_fetch( value, 1 )
+
+#define LIBMSIECF_ATOMIC_DECREMENT( value ) \
+	__sync_sub_and_fetch( value, 1 )
+
+#elif defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+
+#error Missing atomic operations for multi-threading support
+
+#else
+
+#define LIBMSIECF_ATOMIC_LOAD_POINTER( pointer ) \
+	*( pointer )
+
+#define LIBMSIECF_ATOMIC_COMPARE_AND_SWAP_POINTER( pointer, expected, desired ) \
+	( ( *( pointer ) == ( expected ) ) ? ( *( pointer ) = ( desired ), 1 ) : 0 )
+
+#define LIBMSIECF_ATOMIC_INCREMENT( value ) \
+	++( *( value ) )
+
+#define LIBMSIECF_ATOMIC_DECREMENT( value ) \
+	--( *( value ) )
+
+#endif
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMSIECF_ATOMIC_H ) */
+
@@ -0,0 +1,926 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmsiecf_block_cache.h"
+#include "libmsiecf_definitions.h"
+#include "libmsiecf_libbfio.h"
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_libcthreads.h"
+
+/* Creates a block cache
+ * Make sure the value block_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_block_cache_initialize(
+     libmsiecf_block_cache_t **block_cache,
+     size_t maximum_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_block_cache_initialize";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*block_cache = memory_allocate_structure(
+	                libmsiecf_block_cache_t );
+
+	if( *block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_cache,
+	     0,
+	     sizeof( libmsiecf_block_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block cache.",
+		 function );
+
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *block_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *block_cache )->maximum_size = maximum_size;
+
+	return( 1 );
+
+on_error:
+	if( *block_cache != NULL )
+	{
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_block_cache_free(
+     libmsiecf_block_cache_t **block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_block_cache_free";
+	int result            = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_cache != NULL )
+	{
+		if( libmsiecf_block_cache_remove_least_recently_used_entries(
+		     *block_cache,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entries.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *block_cache )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *block_cache );
+
+		*block_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_block_cache_empty(
+     libmsiecf_block_cache_t *block_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_block_cache_empty";
+	int result            = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libmsiecf_block_cache_remove_least_recently_used_entries(
+	     block_cache,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the entry of a specific page offset
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libmsiecf_block_cache_get_entry(
+     libmsiecf_block_cache_t *block_cache,
+     off64_t page_offset,
+     libmsiecf_block_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	libmsiecf_block_cache_entry_t *safe_entry = NULL;
+	static char *function                     = "libmsiecf_block_cache_get_entry";
+	int bucket_index                          = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_offset < 0 )
+	 || ( ( page_offset % LIBMSIECF_BLOCK_CACHE_PAGE_SIZE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( ( (uint64_t) page_offset / LIBMSIECF_BLOCK_CACHE_PAGE_SIZE ) & ( LIBMSIECF_BLOCK_CACHE_NUMBER_OF_BUCKETS - 1 ) );
+
+	for( safe_entry = block_cache->buckets[ bucket_index ];
+	     safe_entry != NULL;
+	     safe_entry = safe_entry->next_bucket_entry )
+	{
+		if( safe_entry->page_offset == page_offset )
+		{
+			*entry = safe_entry;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Reads the page at a specific page offset into a new entry
+ * The entry becomes the most recently used entry
+ * Returns 1 if successful, 0 if the page offset is beyond the end of the file or -1 on error
+ */
+int libmsiecf_block_cache_read_entry(
+     libmsiecf_block_cache_t *block_cache,
+     libbfio_handle_t *file_io_handle,
+     off64_t page_offset,
+     libmsiecf_block_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	libmsiecf_block_cache_entry_t *safe_entry = NULL;
+	static char *function                     = "libmsiecf_block_cache_read_entry";
+	ssize_t read_count                        = 0;
+	int bucket_index                          = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_offset < 0 )
+	 || ( ( page_offset % LIBMSIECF_BLOCK_CACHE_PAGE_SIZE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	safe_entry = memory_allocate_structure(
+	              libmsiecf_block_cache_entry_t );
+
+	if( safe_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     safe_entry,
+	     0,
+	     sizeof( libmsiecf_block_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		goto on_error;
+	}
+	safe_entry->page_data = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * LIBMSIECF_BLOCK_CACHE_PAGE_SIZE );
+
+	if( safe_entry->page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              safe_entry->page_data,
+	              LIBMSIECF_BLOCK_CACHE_PAGE_SIZE,
+	              page_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 page_offset,
+		 page_offset );
+
+		goto on_error;
+	}
+	if( read_count == 0 )
+	{
+		memory_free(
+		 safe_entry->page_data );
+
+		memory_free(
+		 safe_entry );
+
+		return( 0 );
+	}
+	safe_entry->page_offset    = page_offset;
+	safe_entry->page_data_size = (size_t) read_count;
+
+	bucket_index = (int) ( ( (uint64_t) page_offset / LIBMSIECF_BLOCK_CACHE_PAGE_SIZE ) & ( LIBMSIECF_BLOCK_CACHE_NUMBER_OF_BUCKETS - 1 ) );
+
+	safe_entry->next_bucket_entry        = block_cache->buckets[ bucket_index ];
+	block_cache->buckets[ bucket_index ] = safe_entry;
+
+	safe_entry->next_entry = block_cache->first_entry;
+
+	if( block_cache->first_entry != NULL )
+	{
+		block_cache->first_entry->previous_entry = safe_entry;
+	}
+	else
+	{
+		block_cache->last_entry = safe_entry;
+	}
+	block_cache->first_entry = safe_entry;
+
+	block_cache->size              += LIBMSIECF_BLOCK_CACHE_PAGE_SIZE;
+	block_cache->number_of_entries += 1;
+
+	*entry = safe_entry;
+
+	return( 1 );
+
+on_error:
+	if( safe_entry != NULL )
+	{
+		if( safe_entry->page_data != NULL )
+		{
+			memory_free(
+			 safe_entry->page_data );
+		}
+		memory_free(
+		 safe_entry );
+	}
+	return( -1 );
+}
+
+/* Removes the least recently used entries until the size of the cached pages
+ * no longer exceeds the maximum size, a maximum size of 0 removes all entries
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_block_cache_remove_least_recently_used_entries(
+     libmsiecf_block_cache_t *block_cache,
+     size_t maximum_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_block_cache_entry_t **bucket_entry = NULL;
+	libmsiecf_block_cache_entry_t *entry         = NULL;
+	static char *function                        = "libmsiecf_block_cache_remove_least_recently_used_entries";
+	int bucket_index                             = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( block_cache->last_entry != NULL )
+	    && ( block_cache->size > maximum_size ) )
+	{
+		entry = block_cache->last_entry;
+
+		bucket_index = (int) ( ( (uint64_t) entry->page_offset / LIBMSIECF_BLOCK_CACHE_PAGE_SIZE ) & ( LIBMSIECF_BLOCK_CACHE_NUMBER_OF_BUCKETS - 1 ) );
+
+		bucket_entry = &( block_cache->buckets[ bucket_index ] );
+
+		while( ( *bucket_entry != NULL )
+		    && ( *bucket_entry != entry ) )
+		{
+			bucket_entry = &( ( *bucket_entry )->next_bucket_entry );
+		}
+		if( *bucket_entry == entry )
+		{
+			*bucket_entry = entry->next_bucket_entry;
+		}
+		block_cache->last_entry = entry->previous_entry;
+
+		if( block_cache->last_entry != NULL )
+		{
+			block_cache->last_entry->next_entry = NULL;
+		}
+		else
+		{
+			block_cache->first_entry = NULL;
+		}
+		block_cache->size              -= LIBMSIECF_BLOCK_CACHE_PAGE_SIZE;
+		block_cache->number_of_entries -= 1;
+
+		memory_free(
+		 entry->page_data );
+
+		memory_free(
+		 entry );
+	}
+	return( 1 );
+}
+
+/* Retrieves the maximum size of the cached pages
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_block_cache_get_maximum_size(
+     libmsiecf_block_cache_t *block_cache,
+     size_t *maximum_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_block_cache_get_maximum_size";
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_size = block_cache->maximum_size;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum size of the cached pages
+ * A maximum size of 0 disables the cache
+ * Entries are removed until the size of the cached pages no longer exceeds the maximum size
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_block_cache_set_maximum_size(
+     libmsiecf_block_cache_t *block_cache,
+     size_t maximum_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_block_cache_set_maximum_size";
+	int result            = 1;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	block_cache->maximum_size = maximum_size;
+
+	if( libmsiecf_block_cache_remove_least_recently_used_entries(
+	     block_cache,
+	     maximum_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove least recently used entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads a buffer at a specific offset using the cached pages
+ * The pages that are not cached are read from the file IO handle, the pages
+ * become the most recently used entries and the least recently used entries
+ * are removed when the size of the cached pages exceeds the maximum size
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libmsiecf_block_cache_read_buffer_at_offset(
+         libmsiecf_block_cache_t *block_cache,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libmsiecf_block_cache_entry_t *entry = NULL;
+	static char *function                = "libmsiecf_block_cache_read_buffer_at_offset";
+	size_t buffer_offset                 = 0;
+	size_t page_data_offset              = 0;
+	size_t read_size                     = 0;
+	off64_t page_offset                  = 0;
+	int result                           = 0;
+
+	if( block_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	/* The entries are moved in the least recently used list and pages are
+	 * read from the file IO handle hence the write lock
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( buffer_offset < size )
+	{
+		page_data_offset = (size_t) ( offset % LIBMSIECF_BLOCK_CACHE_PAGE_SIZE );
+		page_offset      = offset - (off64_t) page_data_offset;
+
+		result = libmsiecf_block_cache_get_entry(
+		          block_cache,
+		          page_offset,
+		          &entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			result = libmsiecf_block_cache_read_entry(
+			          block_cache,
+			          file_io_handle,
+			          page_offset,
+			          &entry,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read entry.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+		}
+		else if( entry != block_cache->first_entry )
+		{
+			entry->previous_entry->next_entry = entry->next_entry;
+
+			if( entry->next_entry != NULL )
+			{
+				entry->next_entry->previous_entry = entry->previous_entry;
+			}
+			else
+			{
+				block_cache->last_entry = entry->previous_entry;
+			}
+			entry->previous_entry                    = NULL;
+			entry->next_entry                        = block_cache->first_entry;
+			block_cache->first_entry->previous_entry = entry;
+			block_cache->first_entry                 = entry;
+		}
+		if( page_data_offset >= entry->page_data_size )
+		{
+			break;
+		}
+		read_size = entry->page_data_size - page_data_offset;
+
+		if( read_size > ( size - buffer_offset ) )
+		{
+			read_size = size - buffer_offset;
+		}
+		if( memory_copy(
+		     &( buffer[ buffer_offset ] ),
+		     &( entry->page_data[ page_data_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy page data.",
+			 function );
+
+			goto on_error;
+		}
+		buffer_offset += read_size;
+		offset        += (off64_t) read_size;
+
+		/* A page that is smaller than the page size contains the end of the file
+		 */
+		if( entry->page_data_size < LIBMSIECF_BLOCK_CACHE_PAGE_SIZE )
+		{
+			break;
+		}
+		/* The entries are removed after the page data was copied so that
+		 * a maximum size smaller than the page size does not remove the entry
+		 * before it is used
+		 */
+		if( libmsiecf_block_cache_remove_least_recently_used_entries(
+		     block_cache,
+		     block_cache->maximum_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libmsiecf_block_cache_remove_least_recently_used_entries(
+	     block_cache,
+	     block_cache->maximum_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove least recently used entries.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     block_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( (ssize_t) buffer_offset );
+
+on_error:
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 block_cache->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,155 @@
+/*
+ * Block cache functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMSIECF_BLOCK_CACHE_H )
+#define _LIBMSIECF_BLOCK_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmsiecf_definitions.h"
+#include "libmsiecf_libbfio.h"
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmsiecf_block_cache_entry libmsiecf_block_cache_entry_t;
+
+struct libmsiecf_block_cache_entry
+{
+	/* The page offset
+	 */
+	off64_t page_offset;
+
+	/* The page data
+	 */
+	uint8_t *page_data;
+
+	/* The page data size, which is smaller than the page size at the end of the file
+	 */
+	size_t page_data_size;
+
+	/* The previous entry in the least recently used list
+	 */
+	libmsiecf_block_cache_entry_t *previous_entry;
+
+	/* The next entry in the least recently used list
+	 */
+	libmsiecf_block_cache_entry_t *next_entry;
+
+	/* The next entry in the same bucket
+	 */
+	libmsiecf_block_cache_entry_t *next_bucket_entry;
+};
+
+typedef struct libmsiecf_block_cache libmsiecf_block_cache_t;
+
+struct libmsiecf_block_cache
+{
+	/* The maximum size of the cached pages
+	 */
+	size_t maximum_size;
+
+	/* The size of the cached pages
+	 */
+	size_t size;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The buckets
+	 */
+	libmsiecf_block_cache_entry_t *buckets[ LIBMSIECF_BLOCK_CACHE_NUMBER_OF_BUCKETS ];
+
+	/* The most recently used entry
+	 */
+	libmsiecf_block_cache_entry_t *first_entry;
+
+	/* The least recently used entry
+	 */
+	libmsiecf_block_cache_entry_t *last_entry;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libmsiecf_block_cache_initialize(
+     libmsiecf_block_cache_t **block_cache,
+     size_t maximum_size,
+     libcerror_error_t **error );
+
+int libmsiecf_block_cache_free(
+     libmsiecf_block_cache_t **block_cache,
+     libcerror_error_t **error );
+
+int libmsiecf_block_cache_empty(
+     libmsiecf_block_cache_t *block_cache,
+     libcerror_error_t **error );
+
+int libmsiecf_block_cache_get_entry(
+     libmsiecf_block_cache_t *block_cache,
+     off64_t page_offset,
+     libmsiecf_block_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int libmsiecf_block_cache_read_entry(
+     libmsiecf_block_cache_t *block_cache,
+     libbfio_handle_t *file_io_handle,
+     off64_t page_offset,
+     libmsiecf_block_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int libmsiecf_block_cache_remove_least_recently_used_entries(
+     libmsiecf_block_cache_t *block_cache,
+     size_t maximum_size,
+     libcerror_error_t **error );
+
+int libmsiecf_block_cache_get_maximum_size(
+     libmsiecf_block_cache_t *block_cache,
+     size_t *maximum_size,
+     libcerror_error_t **error );
+
+int libmsiecf_block_cache_set_maximum_size(
+     libmsiecf_block_cache_t *block_cache,
+     size_t maximum_size,
+     libcerror_error_t **error );
+
+ssize_t libmsiecf_block_cache_read_buffer_at_offset(
+         libmsiecf_block_cache_t *block_cache,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMSIECF_BLOCK_CACHE_H ) */
+
@@ -25,23 +25,38 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libmsiecf_allocation_map.h"
 #include "libmsiecf_allocation_table.h"
+#include "libmsiecf_block_cache.h"
 #include "libmsiecf_cache_directory_table.h"
 #include "libmsiecf_codepage.h"
 #include "libmsiecf_debug.h"
 #include "libmsiecf_definitions.h"
 #include "libmsiecf_file_header.h"
+#include "libmsiecf_hash.h"
+#include "libmsiecf_hash_map.h"
 #include "libmsiecf_io_handle.h"
 #include "libmsiecf_item.h"
+#include "libmsiecf_item_cache.h"
 #include "libmsiecf_item_descriptor.h"
+#include "libmsiecf_item_descriptor_arena.h"
+#include "libmsiecf_item_view.h"
 #include "libmsiecf_file.h"
+#include "libmsiecf_file_io_handle_pool.h"
 #include "libmsiecf_libbfio.h"
 #include "libmsiecf_libcdata.h"
 #include "libmsiecf_libcerror.h"
 #include "libmsiecf_libcnotify.h"
 #include "libmsiecf_libcthreads.h"
+#include "libmsiecf_libuna.h"
+#include "libmsiecf_read_batch.h"
+#include "libmsiecf_record_scan_chunk.h"
+#include "libmsiecf_redirected.h"
+#include "libmsiecf_url.h"
+#include "libmsiecf_url_columns.h"
 
 #include "msiecf_file_header.h"
+#include "msiecf_url_record.h"
 
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
@@ -120,6 +135,34 @@ int libmsiecf_file_initialize(
 
 		goto on_error;
 	}
+	if( libmsiecf_item_cache_initialize(
+	     &( internal_file->item_cache ),
+	     LIBMSIECF_DEFAULT_MAXIMUM_ITEM_CACHE_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_file_io_handle_pool_initialize(
+	     &( internal_file->file_io_handle_pool ),
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle pool.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_initialize(
 	     &( internal_file->read_write_lock ),
@@ -142,6 +185,18 @@ int libmsiecf_file_initialize(
 on_error:
 	if( internal_file != NULL )
 	{
+		if( internal_file->file_io_handle_pool != NULL )
+		{
+			libmsiecf_file_io_handle_pool_free(
+			 &( internal_file->file_io_handle_pool ),
+			 NULL );
+		}
+		if( internal_file->item_cache != NULL )
+		{
+			libmsiecf_item_cache_free(
+			 &( internal_file->item_cache ),
+			 NULL );
+		}
 		if( internal_file->io_handle != NULL )
 		{
 			libmsiecf_io_handle_free(
@@ -213,6 +268,32 @@ int libmsiecf_file_free(
 			result = -1;
 		}
 #endif
+		if( libmsiecf_file_io_handle_pool_free(
+		     &( internal_file->file_io_handle_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle pool.",
+			 function );
+
+			result = -1;
+		}
+		if( libmsiecf_item_cache_free(
+		     &( internal_file->item_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free item cache.",
+			 function );
+
+			result = -1;
+		}
 		if( libmsiecf_io_handle_free(
 		     &( internal_file->io_handle ),
 		     error ) != 1 )
@@ -226,6 +307,22 @@ int libmsiecf_file_free(
 
 			result = -1;
 		}
+		if( internal_file->index_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( internal_file->index_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free index file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_file );
 	}
@@ -725,6 +822,8 @@ int libmsiecf_file_open_file_io_handle(
 		}
 		file_io_handle_opened_in_library = 1;
 	}
+	internal_file->io_handle->access_flags = access_flags;
+
 	if( libmsiecf_internal_file_open_read(
 	     internal_file,
 	     file_io_handle,
@@ -739,6 +838,20 @@ int libmsiecf_file_open_file_io_handle(
 
 		goto on_error;
 	}
+	if( libmsiecf_file_io_handle_pool_set_file_io_handle(
+	     internal_file->file_io_handle_pool,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file IO handle in file IO handle pool.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file->read_write_lock,
@@ -778,6 +891,11 @@ int libmsiecf_file_open_file_io_handle(
 	return( 1 );
 
 on_error:
+	libmsiecf_file_io_handle_pool_set_file_io_handle(
+	 internal_file->file_io_handle_pool,
+	 NULL,
+	 NULL );
+
 	if( file_io_handle_opened_in_library != 0 )
 	{
 		libbfio_handle_close(
@@ -856,6 +974,20 @@ int libmsiecf_file_close(
 		}
 	}
 #endif
+	if( libmsiecf_file_io_handle_pool_set_file_io_handle(
+	     internal_file->file_io_handle_pool,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handle in file IO handle pool.",
+		 function );
+
+		result = -1;
+	}
 	if( internal_file->file_io_handle_opened_in_library != 0 )
 	{
 		if( libbfio_handle_close(
@@ -937,11 +1069,44 @@ int libmsiecf_file_close(
 			result = -1;
 		}
 	}
+	/* The cached values reference the item descriptors
+	 */
+	if( libmsiecf_item_cache_empty(
+	     internal_file->item_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty item cache.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_file->hash_map != NULL )
+	{
+		if( libmsiecf_hash_map_free(
+		     &( internal_file->hash_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hash map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* The item descriptors are managed by the item descriptor arena
+	 */
 	if( internal_file->item_array != NULL )
 	{
 		if( libcdata_array_free(
 		     &( internal_file->item_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libmsiecf_item_descriptor_free,
+		     NULL,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -958,7 +1123,7 @@ int libmsiecf_file_close(
 	{
 		if( libcdata_array_free(
 		     &( internal_file->recovered_item_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libmsiecf_item_descriptor_free,
+		     NULL,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -971,6 +1136,22 @@ int libmsiecf_file_close(
 			result = -1;
 		}
 	}
+	if( internal_file->item_descriptor_arena != NULL )
+	{
+		if( libmsiecf_item_descriptor_arena_free(
+		     &( internal_file->item_descriptor_arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free item descriptor arena.",
+			 function );
+
+			result = -1;
+		}
+	}
 	if( internal_file->unallocated_block_list != NULL )
 	{
 		if( libcdata_range_list_free(
@@ -988,6 +1169,41 @@ int libmsiecf_file_close(
 			result = -1;
 		}
 	}
+	if( internal_file->allocation_map != NULL )
+	{
+		if( libmsiecf_allocation_map_free(
+		     &( internal_file->allocation_map ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free allocation map.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->index_file != NULL )
+	{
+		if( libmsiecf_index_file_free(
+		     &( internal_file->index_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_file->record_scan_performed  = 0;
+	internal_file->number_of_sorted_items = 0;
+
 #if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file->read_write_lock,
@@ -1015,6 +1231,7 @@ int libmsiecf_internal_file_open_read(
      libcerror_error_t **error )
 {
 	static char *function = "libmsiecf_internal_file_open_read";
+	int result            = 0;
 
 	if( internal_file == NULL )
 	{
@@ -1060,6 +1277,28 @@ int libmsiecf_internal_file_open_read(
 
 		return( -1 );
 	}
+	if( internal_file->hash_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - hash map already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->item_descriptor_arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - item descriptor arena already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( internal_file->item_array != NULL )
 	{
 		libcerror_error_set(
@@ -1093,6 +1332,17 @@ int libmsiecf_internal_file_open_read(
 
 		return( -1 );
 	}
+	if( internal_file->allocation_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - allocation map already set.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1132,6 +1382,31 @@ int libmsiecf_internal_file_open_read(
 	internal_file->io_handle->minor_version = internal_file->file_header->minor_version;
 	internal_file->io_handle->file_size     = internal_file->file_header->file_size;
 
+	if( ( internal_file->io_handle->access_flags & LIBMSIECF_ACCESS_FLAG_READ_INTO_MEMORY ) != 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading file data into memory:\n" );
+		}
+#endif
+		if( libmsiecf_io_handle_read_file_data(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file data into memory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1174,21 +1449,21 @@ int libmsiecf_internal_file_open_read(
 		 "Reading allocation table:\n" );
 	}
 #endif
-	if( libcdata_range_list_initialize(
-	     &( internal_file->unallocated_block_list ),
+	if( libmsiecf_allocation_map_initialize(
+	     &( internal_file->allocation_map ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create unallocated data block list.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create allocation map.",
 		 function );
 
 		goto on_error;
 	}
 	if( libmsiecf_allocation_table_read_file_io_handle(
-	     internal_file->unallocated_block_list,
+	     internal_file->allocation_map,
 	     file_io_handle,
 	     0x250,
 	     internal_file->file_header->file_size,
@@ -1207,50 +1482,62 @@ int libmsiecf_internal_file_open_read(
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading hash table:\n" );
-	}
-#endif
-	if( libcdata_array_initialize(
-	     &( internal_file->item_array ),
-	     0,
+	/* The unallocated block list is derived from the allocation map
+	 */
+	if( libcdata_range_list_initialize(
+	     &( internal_file->unallocated_block_list ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
 		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create item array.",
+		 "%s: unable to create unallocated data block list.",
 		 function );
 
 		goto on_error;
 	}
-	if( libmsiecf_io_handle_read_hash_table(
-	     internal_file->item_array,
-	     internal_file->io_handle,
-	     file_io_handle,
-	     internal_file->file_header->hash_table_offset,
+	if( libmsiecf_allocation_map_get_unallocated_ranges(
+	     internal_file->allocation_map,
+	     internal_file->unallocated_block_list,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read hash table.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve unallocated ranges from allocation map.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( libmsiecf_item_descriptor_arena_initialize(
+	     &( internal_file->item_descriptor_arena ),
+	     error ) != 1 )
 	{
-		libcnotify_printf(
-		 "Scanning for records:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item descriptor arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_file->item_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item array.",
+		 function );
+
+		goto on_error;
 	}
-#endif
 	if( libcdata_array_initialize(
 	     &( internal_file->recovered_item_array ),
 	     0,
@@ -1265,39 +1552,148 @@ int libmsiecf_internal_file_open_read(
 
 		goto on_error;
 	}
-	if( libmsiecf_io_handle_read_record_scan(
-	     internal_file->item_array,
-	     internal_file->recovered_item_array,
-	     internal_file->io_handle,
-	     file_io_handle,
-	     internal_file->file_header->hash_table_offset,
-	     internal_file->unallocated_block_list,
+	if( libmsiecf_hash_map_initialize(
+	     &( internal_file->hash_map ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to perform record scan.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hash map.",
 		 function );
 
 		goto on_error;
 	}
+	internal_file->record_scan_performed = 0;
+
+	if( internal_file->index_file_io_handle != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading index file:\n" );
+		}
+#endif
+		result = libmsiecf_internal_file_read_index_file(
+		          internal_file,
+		          file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read index file.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			/* The index file provides the items, recovered items and hash map
+			 * hence the hash table and the record scan do not need to be read
+			 */
+			if( libcdata_array_get_number_of_entries(
+			     internal_file->item_array,
+			     &( internal_file->number_of_sorted_items ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of items.",
+				 function );
+
+				goto on_error;
+			}
+			internal_file->record_scan_performed = 1;
+
+			return( 1 );
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading hash table:\n" );
+	}
+#endif
+	if( libmsiecf_io_handle_read_hash_table(
+	     internal_file->hash_map,
+	     internal_file->io_handle,
+	     file_io_handle,
+	     internal_file->file_header->hash_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( internal_file->io_handle->access_flags & LIBMSIECF_ACCESS_FLAG_DEFER_RECORD_SCAN ) == 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Scanning for records:\n" );
+		}
+#endif
+		if( libmsiecf_internal_file_read_record_scan(
+		     internal_file,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record scan.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
 
 on_error:
+	libmsiecf_io_handle_free_file_data(
+	 internal_file->io_handle,
+	 NULL );
+
 	if( internal_file->recovered_item_array != NULL )
 	{
 		libcdata_array_free(
 		 &( internal_file->recovered_item_array ),
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libmsiecf_item_descriptor_free,
+		 NULL,
 		 NULL );
 	}
 	if( internal_file->item_array != NULL )
 	{
 		libcdata_array_free(
 		 &( internal_file->item_array ),
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libmsiecf_item_descriptor_free,
+		 NULL,
+		 NULL );
+	}
+	if( internal_file->item_descriptor_arena != NULL )
+	{
+		libmsiecf_item_descriptor_arena_free(
+		 &( internal_file->item_descriptor_arena ),
+		 NULL );
+	}
+	if( internal_file->hash_map != NULL )
+	{
+		libmsiecf_hash_map_free(
+		 &( internal_file->hash_map ),
 		 NULL );
 	}
 	if( internal_file->unallocated_block_list != NULL )
@@ -1307,6 +1703,18 @@ on_error:
 		 NULL,
 		 NULL );
 	}
+	if( internal_file->index_file != NULL )
+	{
+		libmsiecf_index_file_free(
+		 &( internal_file->index_file ),
+		 NULL );
+	}
+	if( internal_file->allocation_map != NULL )
+	{
+		libmsiecf_allocation_map_free(
+		 &( internal_file->allocation_map ),
+		 NULL );
+	}
 	if( internal_file->cache_directory_table != NULL )
 	{
 		libmsiecf_cache_directory_table_free(
@@ -1322,18 +1730,19 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the file size
- * Returns 1 if successful or -1 on error
+/* Reads the items, recovered items and hash map from the index file
+ * Returns 1 if successful, 0 if the index file is missing, stale or invalid or -1 on error
  */
-int libmsiecf_file_get_size(
-     libmsiecf_file_t *file,
-     size64_t *size,
+int libmsiecf_internal_file_read_index_file(
+     libmsiecf_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libmsiecf_internal_file_t *internal_file = NULL;
-	static char *function                    = "libmsiecf_file_get_size";
+	libcerror_error_t *open_error = NULL;
+	static char *function         = "libmsiecf_internal_file_read_index_file";
+	int result                    = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1344,8 +1753,17 @@ int libmsiecf_file_get_size(
 
 		return( -1 );
 	}
-	internal_file = (libmsiecf_internal_file_t *) file;
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
 
+		return( -1 );
+	}
 	if( internal_file->file_header == NULL )
 	{
 		libcerror_error_set(
@@ -1357,64 +1775,149 @@ int libmsiecf_file_get_size(
 
 		return( -1 );
 	}
-	if( size == NULL )
+	if( internal_file->index_file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing index file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( internal_file->index_file != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - index file value already set.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	*size = internal_file->file_header->file_size;
+	if( libmsiecf_index_file_initialize(
+	     &( internal_file->index_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file.",
+		 function );
 
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+		return( -1 );
+	}
+	if( libmsiecf_index_file_set_key(
+	     internal_file->index_file,
+	     internal_file->file_header,
+	     internal_file->io_handle->block_size,
+	     file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to set index file key.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          internal_file->index_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if index file exists.",
 		 function );
 
 		return( -1 );
 	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* An index file that cannot be opened is handled as a missing index file
+	 */
+	if( libbfio_handle_open(
+	     internal_file->index_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     &open_error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to open index file.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 open_error );
+		}
 #endif
-	return( 1 );
+		libcerror_error_free(
+		 &open_error );
+
+		return( 0 );
+	}
+	result = libmsiecf_index_file_read_file_io_handle(
+	          internal_file->index_file,
+	          internal_file->index_file_io_handle,
+	          internal_file->item_array,
+	          internal_file->recovered_item_array,
+	          internal_file->item_descriptor_arena,
+	          internal_file->hash_map,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file.",
+		 function );
+
+		libbfio_handle_close(
+		 internal_file->index_file_io_handle,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libbfio_handle_close(
+	     internal_file->index_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
 }
 
-/* Retrieves the file ASCII codepage
+/* Writes the items, recovered items and hash map to the index file
  * Returns 1 if successful or -1 on error
  */
-int libmsiecf_file_get_ascii_codepage(
-     libmsiecf_file_t *file,
-     int *ascii_codepage,
+int libmsiecf_internal_file_write_index_file(
+     libmsiecf_internal_file_t *internal_file,
      libcerror_error_t **error )
 {
-	libmsiecf_internal_file_t *internal_file = NULL;
-	static char *function                    = "libmsiecf_file_get_ascii_codepage";
+	static char *function = "libmsiecf_internal_file_write_index_file";
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1425,77 +1928,81 @@ int libmsiecf_file_get_ascii_codepage(
 
 		return( -1 );
 	}
-	internal_file = (libmsiecf_internal_file_t *) file;
-
-	if( internal_file->io_handle == NULL )
+	if( internal_file->index_file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 "%s: invalid file - missing index file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( ascii_codepage == NULL )
+	if( libbfio_handle_open(
+	     internal_file->index_file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid ASCII codepage.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
+	if( libmsiecf_index_file_write_file_io_handle(
+	     internal_file->index_file,
+	     internal_file->index_file_io_handle,
+	     internal_file->item_array,
+	     internal_file->recovered_item_array,
+	     internal_file->hash_map,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file.",
 		 function );
 
+		libbfio_handle_close(
+		 internal_file->index_file_io_handle,
+		 NULL );
+
 		return( -1 );
 	}
-#endif
-	*ascii_codepage = internal_file->io_handle->ascii_codepage;
-
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( libbfio_handle_close(
+	     internal_file->index_file_io_handle,
+	     error ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
 		 function );
 
 		return( -1 );
 	}
-#endif
 	return( 1 );
 }
 
-/* Sets the file ASCII codepage
+/* Reads the items using a record scan
+ * The record scan fills both the item and recovered item arrays
  * Returns 1 if successful or -1 on error
  */
-int libmsiecf_file_set_ascii_codepage(
-     libmsiecf_file_t *file,
-     int ascii_codepage,
+int libmsiecf_internal_file_read_record_scan(
+     libmsiecf_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libmsiecf_internal_file_t *internal_file = NULL;
-	static char *function                    = "libmsiecf_file_set_ascii_codepage";
+	libcerror_error_t *index_file_error = NULL;
+	static char *function               = "libmsiecf_internal_file_read_record_scan";
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1506,92 +2013,106 @@ int libmsiecf_file_set_ascii_codepage(
 
 		return( -1 );
 	}
-	internal_file = (libmsiecf_internal_file_t *) file;
-
-	if( internal_file->io_handle == NULL )
+	if( internal_file->file_header == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 "%s: invalid file - missing file header.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ascii_codepage != LIBMSIECF_CODEPAGE_ASCII )
-	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_874 )
-	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_932 )
-	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_936 )
-	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_949 )
-	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_950 )
-	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1250 )
-	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1251 )
-	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1252 )
-	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1253 )
-	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1254 )
-	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1255 )
-	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1256 )
-	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1257 )
-	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1258 ) )
+	if( internal_file->record_scan_performed != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported ASCII codepage.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - record scan already performed.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file->read_write_lock,
+	if( libmsiecf_io_handle_read_record_scan(
+	     internal_file->item_array,
+	     internal_file->recovered_item_array,
+	     internal_file->item_descriptor_arena,
+	     internal_file->io_handle,
+	     file_io_handle,
+	     internal_file->file_header->hash_table_offset,
+	     internal_file->allocation_map,
+	     internal_file->number_of_scan_threads,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to perform record scan.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	internal_file->io_handle->ascii_codepage = ascii_codepage;
-
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file->read_write_lock,
+	/* The record scan stores the items in ascending file offset order
+	 */
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->item_array,
+	     &( internal_file->number_of_sorted_items ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items.",
 		 function );
 
 		return( -1 );
 	}
+	internal_file->record_scan_performed = 1;
+
+	/* The index file is an optimization hence failing to write it
+	 * does not cause the record scan to fail
+	 */
+	if( internal_file->index_file != NULL )
+	{
+		if( libmsiecf_internal_file_write_index_file(
+		     internal_file,
+		     &index_file_error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to write index file.\n",
+				 function );
+
+				libcnotify_print_error_backtrace(
+				 index_file_error );
+			}
 #endif
+			libcerror_error_free(
+			 &index_file_error );
+		}
+	}
 	return( 1 );
 }
 
-/* Retrieves the format version
+/* Makes sure the record scan was performed
+ * The record scan is performed on first use if it was deferred on open
  * Returns 1 if successful or -1 on error
  */
-int libmsiecf_file_get_format_version(
-     libmsiecf_file_t *file,
-     uint8_t *major_version,
-     uint8_t *minor_version,
+int libmsiecf_internal_file_get_record_scan(
+     libmsiecf_internal_file_t *internal_file,
      libcerror_error_t **error )
 {
-	libmsiecf_internal_file_t *internal_file = NULL;
-	static char *function                    = "libmsiecf_file_get_format_version";
+	static char *function         = "libmsiecf_internal_file_get_record_scan";
+	int result                    = 1;
+	uint8_t record_scan_performed = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1602,41 +2123,6 @@ int libmsiecf_file_get_format_version(
 
 		return( -1 );
 	}
-	internal_file = (libmsiecf_internal_file_t *) file;
-
-	if( internal_file->file_header == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file header.",
-		 function );
-
-		return( -1 );
-	}
-	if( major_version == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid major version.",
-		 function );
-
-		return( -1 );
-	}
-	if( minor_version == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid minor version.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
@@ -1652,8 +2138,7 @@ int libmsiecf_file_get_format_version(
 		return( -1 );
 	}
 #endif
-	*major_version = internal_file->file_header->major_version;
-	*minor_version = internal_file->file_header->minor_version;
+	record_scan_performed = internal_file->record_scan_performed;
 
 #if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -1670,36 +2155,12 @@ int libmsiecf_file_get_format_version(
 		return( -1 );
 	}
 #endif
-	return( 1 );
-}
-
-/* Retrieves the number of unallocated blocks
- * Returns 1 if successful or -1 on error
- */
-int libmsiecf_file_get_number_of_unallocated_blocks(
-     libmsiecf_file_t *file,
-     int *number_of_unallocated_blocks,
-     libcerror_error_t **error )
-{
-	libmsiecf_internal_file_t *internal_file = NULL;
-	static char *function                    = "libmsiecf_file_get_number_of_unallocated_blocks";
-	int result                               = 1;
-
-	if( file == NULL )
+	if( record_scan_performed != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
-		 function );
-
-		return( -1 );
+		return( 1 );
 	}
-	internal_file = (libmsiecf_internal_file_t *) file;
-
 #if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1707,30 +2168,44 @@ int libmsiecf_file_get_number_of_unallocated_blocks(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = libcdata_range_list_get_number_of_elements(
-	          internal_file->unallocated_block_list,
-	          number_of_unallocated_blocks,
-	          error );
-
-	if( result != 1 )
+	/* Another thread could have performed the record scan in the meantime
+	 */
+	if( internal_file->record_scan_performed == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements.",
-		 function );
+		if( internal_file->file_io_handle == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid file - missing file IO handle.",
+			 function );
 
-		result = -1;
+			result = -1;
+		}
+		else if( libmsiecf_internal_file_read_record_scan(
+		          internal_file,
+		          internal_file->file_io_handle,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record scan.",
+			 function );
+
+			result = -1;
+		}
 	}
 #if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1738,7 +2213,7 @@ int libmsiecf_file_get_number_of_unallocated_blocks(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -1747,19 +2222,17 @@ int libmsiecf_file_get_number_of_unallocated_blocks(
 	return( result );
 }
 
-/* Retrieves a specific unallocated block
+/* Refreshes a file that is modified by another process
+ * Items found in blocks of which the allocation state changed are appended
+ * to the items and recovered items, hence existing item indexes remain valid
  * Returns 1 if successful or -1 on error
  */
-int libmsiecf_file_get_unallocated_block(
+int libmsiecf_file_refresh(
      libmsiecf_file_t *file,
-     int unallocated_block_index,
-     off64_t *offset,
-     size64_t *size,
      libcerror_error_t **error )
 {
 	libmsiecf_internal_file_t *internal_file = NULL;
-	intptr_t *value                          = NULL;
-	static char *function                    = "libmsiecf_file_get_unallocated_block";
+	static char *function                    = "libmsiecf_file_refresh";
 	int result                               = 1;
 
 	if( file == NULL )
@@ -1775,8 +2248,19 @@ int libmsiecf_file_get_unallocated_block(
 	}
 	internal_file = (libmsiecf_internal_file_t *) file;
 
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1784,34 +2268,28 @@ int libmsiecf_file_get_unallocated_block(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	result = libcdata_range_list_get_range_by_index(
-	          internal_file->unallocated_block_list,
-	          unallocated_block_index,
-	          (uint64_t *) offset,
-	          (uint64_t *) size,
-	          &value,
-	          error );
-
-	if( result != 1 )
+	if( libmsiecf_internal_file_refresh(
+	     internal_file,
+	     internal_file->file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve unallocated block range: %d.",
-		 function,
-		 unallocated_block_index );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to refresh file.",
+		 function );
 
 		result = -1;
 	}
 #if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1819,7 +2297,7 @@ int libmsiecf_file_get_unallocated_block(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
@@ -1828,19 +2306,41 @@ int libmsiecf_file_get_unallocated_block(
 	return( result );
 }
 
-/* Retrieves the number of cache directories
+/* Refreshes a file that is modified by another process
+ * The file header, cache directory table, allocation table and hash table are re-read.
+ * If the record scan was performed only the blocks of which the allocation state changed
+ * or that lie beyond the previous end of the file are scanned for records.
+ * The refreshed file structures, file data in memory and scanned items are read into
+ * temporary values that only replace those of the file after all of them were read successfully
+ * This function does not grab the read/write lock
  * Returns 1 if successful or -1 on error
  */
-int libmsiecf_file_get_number_of_cache_directories(
-     libmsiecf_file_t *file,
-     int *number_of_cache_directories,
+int libmsiecf_internal_file_refresh(
+     libmsiecf_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libmsiecf_internal_file_t *internal_file = NULL;
-	static char *function                    = "libmsiecf_file_get_number_of_cache_directories";
-	int result                               = 1;
+	libcdata_array_t *scanned_item_array                     = NULL;
+	libcdata_array_t *scanned_recovered_item_array           = NULL;
+	libcdata_range_list_t *changed_block_list                = NULL;
+	libcdata_range_list_t *unallocated_block_list            = NULL;
+	libmsiecf_allocation_map_t *allocation_map               = NULL;
+	libmsiecf_cache_directory_table_t *cache_directory_table = NULL;
+	libmsiecf_file_header_t *file_header                     = NULL;
+	libmsiecf_hash_map_t *hash_map                           = NULL;
+	libmsiecf_io_handle_t *refresh_io_handle                 = NULL;
+	libmsiecf_item_descriptor_arena_t *item_descriptor_arena = NULL;
+	libmsiecf_record_scan_chunk_t *record_scan_chunk         = NULL;
+	intptr_t *value                                          = NULL;
+	uint8_t *file_data                                       = NULL;
+	static char *function                                    = "libmsiecf_internal_file_refresh";
+	size_t file_data_size                                    = 0;
+	uint64_t range_offset                                    = 0;
+	uint64_t range_size                                      = 0;
+	int number_of_ranges                                     = 0;
+	int range_index                                          = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1851,120 +2351,5720 @@ int libmsiecf_file_get_number_of_cache_directories(
 
 		return( -1 );
 	}
-	internal_file = (libmsiecf_internal_file_t *) file;
-
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = libmsiecf_cache_directory_table_get_number_of_cache_directories(
-	          internal_file->cache_directory_table,
-	          number_of_cache_directories,
-	          error );
-
-	if( result != 1 )
+	if( internal_file->file_header == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements from directory array.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( internal_file->allocation_map == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing allocation map.",
 		 function );
 
 		return( -1 );
 	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Refreshing file header:\n" );
+	}
 #endif
-	return( result );
-}
+	if( libmsiecf_file_header_initialize(
+	     &file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file header.",
+		 function );
 
-/* Retrieves the extended ASCII encoded name of a certain cache directory
- * The size should include the end of string character
- * The cache directory name consists of 8 characters + end of string character
- * Returns 1 if successful or -1 on error
- */
-int libmsiecf_file_get_cache_directory_name(
+		goto on_error;
+	}
+	if( libmsiecf_file_header_read_file_io_handle(
+	     file_header,
+	     file_io_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_header->major_version != internal_file->file_header->major_version )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported change of major version from: %" PRIu8 " to: %" PRIu8 ".",
+		 function,
+		 internal_file->file_header->major_version,
+		 file_header->major_version );
+
+		goto on_error;
+	}
+	if( libmsiecf_cache_directory_table_initialize(
+	     &cache_directory_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache directory table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_cache_directory_table_read_file_io_handle(
+	     cache_directory_table,
+	     file_io_handle,
+	     sizeof( msiecf_file_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read cache directory table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_allocation_map_initialize(
+	     &allocation_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create allocation map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_allocation_table_read_file_io_handle(
+	     allocation_map,
+	     file_io_handle,
+	     0x250,
+	     file_header->file_size,
+	     0x4000,
+	     internal_file->io_handle->block_size,
+	     file_header->number_of_blocks,
+	     file_header->number_of_allocated_blocks,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read allocation table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_range_list_initialize(
+	     &unallocated_block_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create unallocated data block list.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_allocation_map_get_unallocated_ranges(
+	     allocation_map,
+	     unallocated_block_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve unallocated ranges from allocation map.",
+		 function );
+
+		goto on_error;
+	}
+	/* The refreshed file is read using a separate IO handle, with the refreshed file size
+	 * and file data in memory, that replaces the file data of the IO handle at the end.
+	 * If the file is too large the file data is read using the file IO handle
+	 */
+	if( libmsiecf_io_handle_initialize(
+	     &refresh_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create refresh IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	refresh_io_handle->major_version  = file_header->major_version;
+	refresh_io_handle->minor_version  = file_header->minor_version;
+	refresh_io_handle->file_size      = file_header->file_size;
+	refresh_io_handle->block_size     = internal_file->io_handle->block_size;
+	refresh_io_handle->ascii_codepage = internal_file->io_handle->ascii_codepage;
+	refresh_io_handle->access_pattern = internal_file->io_handle->access_pattern;
+	refresh_io_handle->access_flags   = internal_file->io_handle->access_flags;
+
+	if( ( refresh_io_handle->access_flags & LIBMSIECF_ACCESS_FLAG_READ_INTO_MEMORY ) != 0 )
+	{
+		if( libmsiecf_io_handle_read_file_data(
+		     refresh_io_handle,
+		     file_io_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read file data into memory.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libmsiecf_hash_map_initialize(
+	     &hash_map,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hash map.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_io_handle_read_hash_table(
+	     hash_map,
+	     refresh_io_handle,
+	     file_io_handle,
+	     file_header->hash_table_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_file->record_scan_performed != 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Scanning changed blocks for records:\n" );
+		}
+#endif
+		if( libcdata_range_list_initialize(
+		     &changed_block_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create changed block list.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmsiecf_allocation_map_get_changed_ranges(
+		     allocation_map,
+		     internal_file->allocation_map,
+		     changed_block_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve changed ranges from allocation map.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_range_list_get_number_of_elements(
+		     changed_block_list,
+		     &number_of_ranges,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of changed ranges.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmsiecf_item_descriptor_arena_initialize(
+		     &item_descriptor_arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create item descriptor arena.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_initialize(
+		     &scanned_item_array,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create scanned item array.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_initialize(
+		     &scanned_recovered_item_array,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create scanned recovered item array.",
+			 function );
+
+			goto on_error;
+		}
+		for( range_index = 0;
+		     range_index < number_of_ranges;
+		     range_index++ )
+		{
+			if( libcdata_range_list_get_range_by_index(
+			     changed_block_list,
+			     range_index,
+			     &range_offset,
+			     &range_size,
+			     &value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve changed range: %d.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+			if( range_offset >= refresh_io_handle->file_size )
+			{
+				break;
+			}
+			if( range_size > ( refresh_io_handle->file_size - range_offset ) )
+			{
+				range_size = refresh_io_handle->file_size - range_offset;
+			}
+			if( libmsiecf_record_scan_chunk_initialize(
+			     &record_scan_chunk,
+			     (off64_t) range_offset,
+			     (off64_t) ( range_offset + range_size ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create record scan chunk.",
+				 function );
+
+				goto on_error;
+			}
+			if( libmsiecf_io_handle_read_record_scan_chunk(
+			     refresh_io_handle,
+			     file_io_handle,
+			     allocation_map,
+			     record_scan_chunk,
+			     scanned_item_array,
+			     scanned_recovered_item_array,
+			     item_descriptor_arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to scan changed range: %d for records.",
+				 function,
+				 range_index );
+
+				goto on_error;
+			}
+			if( libmsiecf_record_scan_chunk_free(
+			     &record_scan_chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record scan chunk.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libcdata_range_list_free(
+		     &changed_block_list,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free changed block list.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The cached items were read from the previous version of the records
+	 */
+	if( libmsiecf_item_cache_empty(
+	     internal_file->item_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty item cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_block_cache_empty(
+	     internal_file->io_handle->block_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty block cache.",
+		 function );
+
+		goto on_error;
+	}
+	/* The cloned file IO handles are reopened on demand so that they see the refreshed file size
+	 */
+	if( libmsiecf_file_io_handle_pool_empty(
+	     internal_file->file_io_handle_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty file IO handle pool.",
+		 function );
+
+		goto on_error;
+	}
+	/* The scanned items are merged after all the file structures were read successfully,
+	 * the merge either adds all the scanned items or leaves the item arrays unchanged
+	 */
+	if( scanned_item_array != NULL )
+	{
+		if( libmsiecf_internal_file_merge_scanned_items(
+		     internal_file,
+		     scanned_item_array,
+		     scanned_recovered_item_array,
+		     item_descriptor_arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to merge scanned items.",
+			 function );
+
+			goto on_error;
+		}
+		/* The item descriptors are managed by the item descriptor arena of the file
+		 */
+		libcdata_array_free(
+		 &scanned_recovered_item_array,
+		 NULL,
+		 NULL );
+
+		libcdata_array_free(
+		 &scanned_item_array,
+		 NULL,
+		 NULL );
+
+		libmsiecf_item_descriptor_arena_free(
+		 &item_descriptor_arena,
+		 NULL );
+	}
+	/* The file data in memory of the IO handle is replaced by that of the refresh IO handle
+	 */
+	file_data      = internal_file->io_handle->file_data;
+	file_data_size = internal_file->io_handle->file_data_size;
+
+	internal_file->io_handle->file_data      = refresh_io_handle->file_data;
+	internal_file->io_handle->file_data_size = refresh_io_handle->file_data_size;
+	internal_file->io_handle->file_size      = refresh_io_handle->file_size;
+	internal_file->io_handle->major_version  = refresh_io_handle->major_version;
+	internal_file->io_handle->minor_version  = refresh_io_handle->minor_version;
+
+	refresh_io_handle->file_data      = file_data;
+	refresh_io_handle->file_data_size = file_data_size;
+
+	libmsiecf_io_handle_free(
+	 &refresh_io_handle,
+	 NULL );
+
+	libmsiecf_file_header_free(
+	 &( internal_file->file_header ),
+	 NULL );
+
+	libmsiecf_cache_directory_table_free(
+	 &( internal_file->cache_directory_table ),
+	 NULL );
+
+	libmsiecf_allocation_map_free(
+	 &( internal_file->allocation_map ),
+	 NULL );
+
+	libcdata_range_list_free(
+	 &( internal_file->unallocated_block_list ),
+	 NULL,
+	 NULL );
+
+	libmsiecf_hash_map_free(
+	 &( internal_file->hash_map ),
+	 NULL );
+
+	internal_file->file_header            = file_header;
+	internal_file->cache_directory_table  = cache_directory_table;
+	internal_file->allocation_map         = allocation_map;
+	internal_file->unallocated_block_list = unallocated_block_list;
+	internal_file->hash_map               = hash_map;
+
+	return( 1 );
+
+on_error:
+	if( record_scan_chunk != NULL )
+	{
+		libmsiecf_record_scan_chunk_free(
+		 &record_scan_chunk,
+		 NULL );
+	}
+	if( scanned_recovered_item_array != NULL )
+	{
+		libcdata_array_free(
+		 &scanned_recovered_item_array,
+		 NULL,
+		 NULL );
+	}
+	if( scanned_item_array != NULL )
+	{
+		libcdata_array_free(
+		 &scanned_item_array,
+		 NULL,
+		 NULL );
+	}
+	if( item_descriptor_arena != NULL )
+	{
+		libmsiecf_item_descriptor_arena_free(
+		 &item_descriptor_arena,
+		 NULL );
+	}
+	if( changed_block_list != NULL )
+	{
+		libcdata_range_list_free(
+		 &changed_block_list,
+		 NULL,
+		 NULL );
+	}
+	if( hash_map != NULL )
+	{
+		libmsiecf_hash_map_free(
+		 &hash_map,
+		 NULL );
+	}
+	if( refresh_io_handle != NULL )
+	{
+		libmsiecf_io_handle_free(
+		 &refresh_io_handle,
+		 NULL );
+	}
+	if( unallocated_block_list != NULL )
+	{
+		libcdata_range_list_free(
+		 &unallocated_block_list,
+		 NULL,
+		 NULL );
+	}
+	if( allocation_map != NULL )
+	{
+		libmsiecf_allocation_map_free(
+		 &allocation_map,
+		 NULL );
+	}
+	if( cache_directory_table != NULL )
+	{
+		libmsiecf_cache_directory_table_free(
+		 &cache_directory_table,
+		 NULL );
+	}
+	if( file_header != NULL )
+	{
+		libmsiecf_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines the states of the scanned item descriptors of which the record offset is used by an item descriptor in an array
+ * A scanned item descriptor that matches an item descriptor of the same kind replaces it if the record was changed,
+ * otherwise the scanned item descriptor is new if the record was overwritten. The index of the matching item descriptor
+ * is stored in the known item indexes. Scanned item descriptors of which the state was already determined are skipped.
+ * The scanned item descriptors must be sorted by record offset since a binary search is used
+ * Returns 1 if successful or -1 on error
+ */
+static int libmsiecf_internal_file_mark_known_scanned_items(
+            libcdata_array_t *item_array,
+            libcdata_array_t *scanned_item_array,
+            int number_of_scanned_items,
+            uint8_t is_same_kind,
+            uint8_t *scanned_item_states,
+            int *known_item_indexes,
+            libcerror_error_t **error )
+{
+	libmsiecf_item_descriptor_t *item_descriptor         = NULL;
+	libmsiecf_item_descriptor_t *scanned_item_descriptor = NULL;
+	static char *function                                = "libmsiecf_internal_file_mark_known_scanned_items";
+	int first_item_index                                 = 0;
+	int item_index                                       = 0;
+	int last_item_index                                  = 0;
+	int number_of_items                                  = 0;
+	int scanned_item_index                               = 0;
+
+	if( scanned_item_states == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanned item states.",
+		 function );
+
+		return( -1 );
+	}
+	if( known_item_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid known item indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     item_array,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items.",
+		 function );
+
+		return( -1 );
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     item_array,
+		     item_index,
+		     (intptr_t **) &item_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item descriptor: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		if( item_descriptor == NULL )
+		{
+			continue;
+		}
+		first_item_index = 0;
+		last_item_index  = number_of_scanned_items - 1;
+
+		while( first_item_index <= last_item_index )
+		{
+			scanned_item_index = first_item_index + ( ( last_item_index - first_item_index ) / 2 );
+
+			if( libcdata_array_get_entry_by_index(
+			     scanned_item_array,
+			     scanned_item_index,
+			     (intptr_t **) &scanned_item_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve scanned item descriptor: %d.",
+				 function,
+				 scanned_item_index );
+
+				return( -1 );
+			}
+			if( scanned_item_descriptor == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing scanned item descriptor: %d.",
+				 function,
+				 scanned_item_index );
+
+				return( -1 );
+			}
+			if( item_descriptor->file_offset == scanned_item_descriptor->file_offset )
+			{
+				if( scanned_item_states[ scanned_item_index ] != LIBMSIECF_SCANNED_ITEM_STATE_NEW )
+				{
+					break;
+				}
+				/* The record was overwritten in place by another record
+				 */
+				if( ( item_descriptor->type != scanned_item_descriptor->type )
+				 || ( item_descriptor->record_size != scanned_item_descriptor->record_size ) )
+				{
+					if( is_same_kind != 0 )
+					{
+						scanned_item_states[ scanned_item_index ] = LIBMSIECF_SCANNED_ITEM_STATE_OVERWRITTEN;
+					}
+					else
+					{
+						scanned_item_states[ scanned_item_index ] = LIBMSIECF_SCANNED_ITEM_STATE_NEW_OVERWRITTEN;
+					}
+					known_item_indexes[ scanned_item_index ] = item_index;
+				}
+				/* The record was changed, for example the next record was overwritten
+				 * which changes the tainted flag
+				 */
+				else if( ( is_same_kind != 0 )
+				      && ( item_descriptor->flags != scanned_item_descriptor->flags ) )
+				{
+					scanned_item_states[ scanned_item_index ] = LIBMSIECF_SCANNED_ITEM_STATE_CHANGED;
+					known_item_indexes[ scanned_item_index ]  = item_index;
+				}
+				else
+				{
+					scanned_item_states[ scanned_item_index ] = LIBMSIECF_SCANNED_ITEM_STATE_KNOWN;
+				}
+				break;
+			}
+			else if( item_descriptor->file_offset < scanned_item_descriptor->file_offset )
+			{
+				last_item_index = scanned_item_index - 1;
+			}
+			else
+			{
+				first_item_index = scanned_item_index + 1;
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of scanned item descriptors that are new
+ * The scanned item descriptors are checked to be sorted by record offset
+ * Returns 1 if successful or -1 on error
+ */
+static int libmsiecf_internal_file_get_number_of_new_scanned_items(
+            libcdata_array_t *scanned_item_array,
+            int number_of_scanned_items,
+            const uint8_t *scanned_item_states,
+            int *number_of_new_items,
+            libcerror_error_t **error )
+{
+	libmsiecf_item_descriptor_t *scanned_item_descriptor = NULL;
+	static char *function                                = "libmsiecf_internal_file_get_number_of_new_scanned_items";
+	off64_t previous_file_offset                         = -1;
+	int scanned_item_index                               = 0;
+	int safe_number_of_new_items                         = 0;
+
+	if( scanned_item_states == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanned item states.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_new_items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of new items.",
+		 function );
+
+		return( -1 );
+	}
+	for( scanned_item_index = 0;
+	     scanned_item_index < number_of_scanned_items;
+	     scanned_item_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     scanned_item_array,
+		     scanned_item_index,
+		     (intptr_t **) &scanned_item_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scanned item descriptor: %d.",
+			 function,
+			 scanned_item_index );
+
+			return( -1 );
+		}
+		if( scanned_item_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing scanned item descriptor: %d.",
+			 function,
+			 scanned_item_index );
+
+			return( -1 );
+		}
+		if( scanned_item_descriptor->file_offset <= previous_file_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid scanned item descriptor: %d - record offset value out of bounds.",
+			 function,
+			 scanned_item_index );
+
+			return( -1 );
+		}
+		previous_file_offset = scanned_item_descriptor->file_offset;
+
+		if( ( scanned_item_states[ scanned_item_index ] == LIBMSIECF_SCANNED_ITEM_STATE_NEW )
+		 || ( scanned_item_states[ scanned_item_index ] == LIBMSIECF_SCANNED_ITEM_STATE_NEW_OVERWRITTEN ) )
+		{
+			safe_number_of_new_items++;
+		}
+	}
+	*number_of_new_items = safe_number_of_new_items;
+
+	return( 1 );
+}
+
+/* Sets the scanned item descriptors that are new in an array
+ * starting at a specific entry index
+ * Returns 1 if successful or -1 on error
+ */
+static int libmsiecf_internal_file_set_new_scanned_items(
+            libcdata_array_t *item_array,
+            int entry_index,
+            libcdata_array_t *scanned_item_array,
+            int number_of_scanned_items,
+            const uint8_t *scanned_item_states,
+            libcerror_error_t **error )
+{
+	libmsiecf_item_descriptor_t *scanned_item_descriptor = NULL;
+	static char *function                                = "libmsiecf_internal_file_set_new_scanned_items";
+	int scanned_item_index                               = 0;
+
+	for( scanned_item_index = 0;
+	     scanned_item_index < number_of_scanned_items;
+	     scanned_item_index++ )
+	{
+		if( ( scanned_item_states[ scanned_item_index ] != LIBMSIECF_SCANNED_ITEM_STATE_NEW )
+		 && ( scanned_item_states[ scanned_item_index ] != LIBMSIECF_SCANNED_ITEM_STATE_NEW_OVERWRITTEN ) )
+		{
+			continue;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     scanned_item_array,
+		     scanned_item_index,
+		     (intptr_t **) &scanned_item_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve scanned item descriptor: %d.",
+			 function,
+			 scanned_item_index );
+
+			return( -1 );
+		}
+		if( libcdata_array_set_entry_by_index(
+		     item_array,
+		     entry_index,
+		     (intptr_t *) scanned_item_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set item descriptor: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		entry_index++;
+	}
+	return( 1 );
+}
+
+/* Swaps the item descriptors of which the record was changed or overwritten with the corresponding
+ * scanned item descriptors and marks the item descriptors of which the record was overwritten as stale
+ * The item descriptors of which the record was overwritten by a new scanned item descriptor are
+ * in the overwritten item array. Since the swapped out item descriptors are stored in the scanned item array
+ * calling this function again restores the item arrays. On error the item arrays are restored
+ * Returns 1 if successful or -1 on error
+ */
+static int libmsiecf_internal_file_swap_changed_scanned_items(
+            libcdata_array_t *item_array,
+            libcdata_array_t *overwritten_item_array,
+            libcdata_array_t *scanned_item_array,
+            int number_of_scanned_items,
+            const uint8_t *scanned_item_states,
+            const int *known_item_indexes,
+            libcerror_error_t **error )
+{
+	libmsiecf_item_descriptor_t *item_descriptor         = NULL;
+	libmsiecf_item_descriptor_t *scanned_item_descriptor = NULL;
+	static char *function                                = "libmsiecf_internal_file_swap_changed_scanned_items";
+	int scanned_item_index                               = 0;
+
+	if( scanned_item_states == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scanned item states.",
+		 function );
+
+		return( -1 );
+	}
+	if( known_item_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid known item indexes.",
+		 function );
+
+		return( -1 );
+	}
+	for( scanned_item_index = 0;
+	     scanned_item_index < number_of_scanned_items;
+	     scanned_item_index++ )
+	{
+		if( scanned_item_states[ scanned_item_index ] == LIBMSIECF_SCANNED_ITEM_STATE_NEW_OVERWRITTEN )
+		{
+			if( overwritten_item_array == NULL )
+			{
+				continue;
+			}
+			if( libcdata_array_get_entry_by_index(
+			     overwritten_item_array,
+			     known_item_indexes[ scanned_item_index ],
+			     (intptr_t **) &item_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve item descriptor: %d.",
+				 function,
+				 known_item_indexes[ scanned_item_index ] );
+
+				goto on_error;
+			}
+			/* Toggled hence a second call clears the value
+			 */
+			item_descriptor->is_stale = (uint8_t) ( item_descriptor->is_stale == 0 );
+		}
+		else if( ( scanned_item_states[ scanned_item_index ] == LIBMSIECF_SCANNED_ITEM_STATE_CHANGED )
+		      || ( scanned_item_states[ scanned_item_index ] == LIBMSIECF_SCANNED_ITEM_STATE_OVERWRITTEN ) )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     item_array,
+			     known_item_indexes[ scanned_item_index ],
+			     (intptr_t **) &item_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve item descriptor: %d.",
+				 function,
+				 known_item_indexes[ scanned_item_index ] );
+
+				goto on_error;
+			}
+			if( libcdata_array_get_entry_by_index(
+			     scanned_item_array,
+			     scanned_item_index,
+			     (intptr_t **) &scanned_item_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve scanned item descriptor: %d.",
+				 function,
+				 scanned_item_index );
+
+				goto on_error;
+			}
+			if( libcdata_array_set_entry_by_index(
+			     item_array,
+			     known_item_indexes[ scanned_item_index ],
+			     (intptr_t *) scanned_item_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set item descriptor: %d.",
+				 function,
+				 known_item_indexes[ scanned_item_index ] );
+
+				goto on_error;
+			}
+			if( libcdata_array_set_entry_by_index(
+			     scanned_item_array,
+			     scanned_item_index,
+			     (intptr_t *) item_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set scanned item descriptor: %d.",
+				 function,
+				 scanned_item_index );
+
+				libcdata_array_set_entry_by_index(
+				 item_array,
+				 known_item_indexes[ scanned_item_index ],
+				 (intptr_t *) item_descriptor,
+				 NULL );
+
+				goto on_error;
+			}
+			/* The item descriptor that is swapped in is used for new items, items that still
+			 * reference the item descriptor that is swapped out fail to read if it is stale
+			 */
+			scanned_item_descriptor->is_stale = 0;
+
+			if( scanned_item_states[ scanned_item_index ] == LIBMSIECF_SCANNED_ITEM_STATE_OVERWRITTEN )
+			{
+				item_descriptor->is_stale = 1;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( scanned_item_index > 0 )
+	{
+		libmsiecf_internal_file_swap_changed_scanned_items(
+		 item_array,
+		 overwritten_item_array,
+		 scanned_item_array,
+		 scanned_item_index,
+		 scanned_item_states,
+		 known_item_indexes,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Merges the items found by scanning the changed blocks into the item and recovered item arrays
+ * Items of which the record offset is already known are skipped. The scanned item descriptors
+ * are sorted by record offset, hence every known record offset is looked up using a binary search
+ * in the scanned item descriptors instead of searching every known item descriptor per scanned item.
+ * An item descriptor of which the record was changed is replaced by the scanned item descriptor.
+ * If the record was overwritten by another record the item descriptor is marked as stale,
+ * so that items that still reference it fail to read their values.
+ * The item arrays are resized before any of the scanned item descriptors are set,
+ * hence on error the item arrays are restored to their previous number of entries
+ * This function does not grab the read/write lock
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_internal_file_merge_scanned_items(
+     libmsiecf_internal_file_t *internal_file,
+     libcdata_array_t *scanned_item_array,
+     libcdata_array_t *scanned_recovered_item_array,
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     libcerror_error_t **error )
+{
+	uint8_t *scanned_item_states           = NULL;
+	uint8_t *scanned_recovered_item_states = NULL;
+	static char *function                  = "libmsiecf_internal_file_merge_scanned_items";
+	int *known_item_indexes                = NULL;
+	int *known_recovered_item_indexes      = NULL;
+	int entry_index                        = 0;
+	int item_array_resized                 = 0;
+	int number_of_items                    = 0;
+	int number_of_new_items                = 0;
+	int number_of_new_recovered_items      = 0;
+	int number_of_recovered_items          = 0;
+	int number_of_scanned_items            = 0;
+	int number_of_scanned_recovered_items  = 0;
+	int recovered_item_array_resized       = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->item_array,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->recovered_item_array,
+	     &number_of_recovered_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered items.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     scanned_item_array,
+	     &number_of_scanned_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of scanned items.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     scanned_recovered_item_array,
+	     &number_of_scanned_recovered_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of scanned recovered items.",
+		 function );
+
+		goto on_error;
+	}
+	/* An additional entry is allocated so that the allocation size is never 0
+	 */
+	scanned_item_states = (uint8_t *) memory_allocate(
+	                                   sizeof( uint8_t ) * ( (size_t) number_of_scanned_items + 1 ) );
+
+	if( scanned_item_states == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scanned item states.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     scanned_item_states,
+	     LIBMSIECF_SCANNED_ITEM_STATE_NEW,
+	     sizeof( uint8_t ) * ( (size_t) number_of_scanned_items + 1 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scanned item states.",
+		 function );
+
+		goto on_error;
+	}
+	known_item_indexes = (int *) memory_allocate(
+	                              sizeof( int ) * ( (size_t) number_of_scanned_items + 1 ) );
+
+	if( known_item_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create known item indexes.",
+		 function );
+
+		goto on_error;
+	}
+	scanned_recovered_item_states = (uint8_t *) memory_allocate(
+	                                             sizeof( uint8_t ) * ( (size_t) number_of_scanned_recovered_items + 1 ) );
+
+	if( scanned_recovered_item_states == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scanned recovered item states.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     scanned_recovered_item_states,
+	     LIBMSIECF_SCANNED_ITEM_STATE_NEW,
+	     sizeof( uint8_t ) * ( (size_t) number_of_scanned_recovered_items + 1 ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scanned recovered item states.",
+		 function );
+
+		goto on_error;
+	}
+	known_recovered_item_indexes = (int *) memory_allocate(
+	                                        sizeof( int ) * ( (size_t) number_of_scanned_recovered_items + 1 ) );
+
+	if( known_recovered_item_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create known recovered item indexes.",
+		 function );
+
+		goto on_error;
+	}
+	/* The scanned items are compared with the items, the scanned recovered items
+	 * are compared with both the items and the recovered items
+	 */
+	if( libmsiecf_internal_file_mark_known_scanned_items(
+	     internal_file->item_array,
+	     scanned_item_array,
+	     number_of_scanned_items,
+	     1,
+	     scanned_item_states,
+	     known_item_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to mark known scanned items.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_internal_file_mark_known_scanned_items(
+	     internal_file->item_array,
+	     scanned_recovered_item_array,
+	     number_of_scanned_recovered_items,
+	     0,
+	     scanned_recovered_item_states,
+	     known_recovered_item_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to mark known scanned recovered items.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_internal_file_mark_known_scanned_items(
+	     internal_file->recovered_item_array,
+	     scanned_recovered_item_array,
+	     number_of_scanned_recovered_items,
+	     1,
+	     scanned_recovered_item_states,
+	     known_recovered_item_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to mark known scanned recovered items.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_internal_file_get_number_of_new_scanned_items(
+	     scanned_item_array,
+	     number_of_scanned_items,
+	     scanned_item_states,
+	     &number_of_new_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of new items.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_internal_file_get_number_of_new_scanned_items(
+	     scanned_recovered_item_array,
+	     number_of_scanned_recovered_items,
+	     scanned_recovered_item_states,
+	     &number_of_new_recovered_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of new recovered items.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_new_items > ( (int) INT_MAX - number_of_items ) )
+	 || ( number_of_new_recovered_items > ( (int) INT_MAX - number_of_recovered_items ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of new items value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	/* The item arrays are resized before any of the item descriptors are set
+	 * hence the new entries are empty if the item arrays need to be restored
+	 */
+	if( number_of_new_items > 0 )
+	{
+		if( libcdata_array_resize(
+		     internal_file->item_array,
+		     number_of_items + number_of_new_items,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize item array.",
+			 function );
+
+			goto on_error;
+		}
+		item_array_resized = 1;
+	}
+	if( number_of_new_recovered_items > 0 )
+	{
+		if( libcdata_array_resize(
+		     internal_file->recovered_item_array,
+		     number_of_recovered_items + number_of_new_recovered_items,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize recovered item array.",
+			 function );
+
+			goto on_error;
+		}
+		recovered_item_array_resized = 1;
+	}
+	/* The scanned item descriptors are moved to the arena of the file
+	 * before they are referenced by the item arrays of the file
+	 */
+	if( libmsiecf_item_descriptor_arena_move(
+	     internal_file->item_descriptor_arena,
+	     item_descriptor_arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to move item descriptors to item descriptor arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_internal_file_set_new_scanned_items(
+	     internal_file->item_array,
+	     number_of_items,
+	     scanned_item_array,
+	     number_of_scanned_items,
+	     scanned_item_states,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set new items.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_internal_file_set_new_scanned_items(
+	     internal_file->recovered_item_array,
+	     number_of_recovered_items,
+	     scanned_recovered_item_array,
+	     number_of_scanned_recovered_items,
+	     scanned_recovered_item_states,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set new recovered items.",
+		 function );
+
+		goto on_error;
+	}
+	/* The item descriptors are swapped last since the swap can be undone
+	 */
+	if( libmsiecf_internal_file_swap_changed_scanned_items(
+	     internal_file->item_array,
+	     NULL,
+	     scanned_item_array,
+	     number_of_scanned_items,
+	     scanned_item_states,
+	     known_item_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to swap changed items.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_internal_file_swap_changed_scanned_items(
+	     internal_file->recovered_item_array,
+	     internal_file->item_array,
+	     scanned_recovered_item_array,
+	     number_of_scanned_recovered_items,
+	     scanned_recovered_item_states,
+	     known_recovered_item_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to swap changed recovered items.",
+		 function );
+
+		libmsiecf_internal_file_swap_changed_scanned_items(
+		 internal_file->item_array,
+		 NULL,
+		 scanned_item_array,
+		 number_of_scanned_items,
+		 scanned_item_states,
+		 known_item_indexes,
+		 NULL );
+
+		goto on_error;
+	}
+	memory_free(
+	 known_recovered_item_indexes );
+
+	memory_free(
+	 scanned_recovered_item_states );
+
+	memory_free(
+	 known_item_indexes );
+
+	memory_free(
+	 scanned_item_states );
+
+	return( 1 );
+
+on_error:
+	/* The new entries are cleared so that the item arrays can be restored
+	 * without freeing the item descriptors
+	 */
+	if( recovered_item_array_resized != 0 )
+	{
+		for( entry_index = number_of_recovered_items;
+		     entry_index < ( number_of_recovered_items + number_of_new_recovered_items );
+		     entry_index++ )
+		{
+			libcdata_array_set_entry_by_index(
+			 internal_file->recovered_item_array,
+			 entry_index,
+			 NULL,
+			 NULL );
+		}
+		libcdata_array_resize(
+		 internal_file->recovered_item_array,
+		 number_of_recovered_items,
+		 NULL,
+		 NULL );
+	}
+	if( item_array_resized != 0 )
+	{
+		for( entry_index = number_of_items;
+		     entry_index < ( number_of_items + number_of_new_items );
+		     entry_index++ )
+		{
+			libcdata_array_set_entry_by_index(
+			 internal_file->item_array,
+			 entry_index,
+			 NULL,
+			 NULL );
+		}
+		libcdata_array_resize(
+		 internal_file->item_array,
+		 number_of_items,
+		 NULL,
+		 NULL );
+	}
+	if( known_recovered_item_indexes != NULL )
+	{
+		memory_free(
+		 known_recovered_item_indexes );
+	}
+	if( scanned_recovered_item_states != NULL )
+	{
+		memory_free(
+		 scanned_recovered_item_states );
+	}
+	if( known_item_indexes != NULL )
+	{
+		memory_free(
+		 known_item_indexes );
+	}
+	if( scanned_item_states != NULL )
+	{
+		memory_free(
+		 scanned_item_states );
+	}
+	return( -1 );
+}
+
+/* Retrieves the file size
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_size(
+     libmsiecf_file_t *file,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_get_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*size = internal_file->file_header->file_size;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_ascii_codepage(
+     libmsiecf_file_t *file,
+     int *ascii_codepage,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_get_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_set_ascii_codepage(
+     libmsiecf_file_t *file,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_set_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBMSIECF_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBMSIECF_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->io_handle->ascii_codepage = ascii_codepage;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of threads used by the record scan
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_number_of_scan_threads(
+     libmsiecf_file_t *file,
+     int *number_of_scan_threads,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_get_number_of_scan_threads";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( number_of_scan_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of scan threads.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_scan_threads = internal_file->number_of_scan_threads;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the number of threads used by the record scan
+ * A value of 0 or 1 represents a single threaded record scan
+ * The record scan only uses multiple threads if the library was built
+ * with multi-thread support
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_set_number_of_scan_threads(
+     libmsiecf_file_t *file,
+     int number_of_scan_threads,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_set_number_of_scan_threads";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( ( number_of_scan_threads < 0 )
+	 || ( number_of_scan_threads > LIBMSIECF_MAXIMUM_NUMBER_OF_SCAN_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of scan threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->number_of_scan_threads = number_of_scan_threads;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the access pattern
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_access_pattern(
+     libmsiecf_file_t *file,
+     int *access_pattern,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_get_access_pattern";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( access_pattern == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid access pattern.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*access_pattern = internal_file->io_handle->access_pattern;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the access pattern
+ * The access pattern only determines the internal read-ahead of the record scan, the size
+ * of the gaps between records that are read rather than skipped and if decoded item values
+ * are retained in the item cache. No access advice is passed to the operating system.
+ * Setting the no reuse access pattern also empties the item cache
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_set_access_pattern(
+     libmsiecf_file_t *file,
+     int access_pattern,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_set_access_pattern";
+	int result                               = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_pattern != LIBMSIECF_ACCESS_PATTERN_NORMAL )
+	 && ( access_pattern != LIBMSIECF_ACCESS_PATTERN_SEQUENTIAL )
+	 && ( access_pattern != LIBMSIECF_ACCESS_PATTERN_RANDOM )
+	 && ( access_pattern != LIBMSIECF_ACCESS_PATTERN_NO_REUSE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access pattern.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->io_handle->access_pattern = access_pattern;
+
+	if( access_pattern == LIBMSIECF_ACCESS_PATTERN_NO_REUSE )
+	{
+		if( libmsiecf_item_cache_empty(
+		     internal_file->item_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty item cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the index filename
+ * The index file is used to store the result of the record scan so that
+ * the record scan can be skipped when the same file is opened again
+ * The index filename must be set before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_set_index_filename(
+     libmsiecf_file_t *file,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle          = NULL;
+	libbfio_handle_t *previous_index_file_io_handle = NULL;
+	libmsiecf_internal_file_t *internal_file        = NULL;
+	static char *function                           = "libmsiecf_file_set_index_filename";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name(
+	     index_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The previous index file IO handle, if any, is freed on return
+	 */
+	previous_index_file_io_handle       = internal_file->index_file_io_handle;
+	internal_file->index_file_io_handle = index_file_io_handle;
+	index_file_io_handle                = previous_index_file_io_handle;
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( index_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &index_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free previous index file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the index filename
+ * The index file is used to store the result of the record scan so that
+ * the record scan can be skipped when the same file is opened again
+ * The index filename must be set before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_set_index_filename_wide(
+     libmsiecf_file_t *file,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle          = NULL;
+	libbfio_handle_t *previous_index_file_io_handle = NULL;
+	libmsiecf_internal_file_t *internal_file        = NULL;
+	static char *function                           = "libmsiecf_file_set_index_filename_wide";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_set_name_wide(
+	     index_file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The previous index file IO handle, if any, is freed on return
+	 */
+	previous_index_file_io_handle       = internal_file->index_file_io_handle;
+	internal_file->index_file_io_handle = index_file_io_handle;
+	index_file_io_handle                = previous_index_file_io_handle;
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( index_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &index_file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free previous index file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Retrieves the maximum size of the decoded item values cache
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_maximum_item_cache_size(
+     libmsiecf_file_t *file,
+     size_t *maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_get_maximum_item_cache_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( libmsiecf_item_cache_get_maximum_size(
+	     internal_file->item_cache,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum item cache size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the maximum size of the decoded item values cache
+ * The size of the values of an item is accounted as the size of its record data
+ * A value of 0 disables the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_set_maximum_item_cache_size(
+     libmsiecf_file_t *file,
+     size_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_set_maximum_item_cache_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( maximum_cache_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum cache size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_item_cache_set_maximum_size(
+	     internal_file->item_cache,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum item cache size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the maximum size of the block cache
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_maximum_block_cache_size(
+     libmsiecf_file_t *file,
+     size_t *maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_get_maximum_block_cache_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( libmsiecf_block_cache_get_maximum_size(
+	     internal_file->io_handle->block_cache,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum block cache size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the maximum size of the block cache
+ * The block cache retains the pages of the file that contain the records
+ * read by the item functions, which reduces the number of small reads
+ * of file IO handles that are expensive to read from
+ * A value of 0 disables the cache, which is the default
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_set_maximum_block_cache_size(
+     libmsiecf_file_t *file,
+     size_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_set_maximum_block_cache_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( maximum_cache_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum cache size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_block_cache_set_maximum_size(
+	     internal_file->io_handle->block_cache,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum block cache size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the maximum number of file IO handles used by concurrent readers
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_maximum_number_of_file_io_handles(
+     libmsiecf_file_t *file,
+     int *maximum_number_of_file_io_handles,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_get_maximum_number_of_file_io_handles";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( libmsiecf_file_io_handle_pool_get_maximum_number_of_handles(
+	     internal_file->file_io_handle_pool,
+	     maximum_number_of_file_io_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum number of file IO handles.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the maximum number of file IO handles used by concurrent readers
+ * When multiple threads read items of the same file, a thread that finds the
+ * file IO handles in use clones the file IO handle of the file, up to the maximum,
+ * so that the reads do not serialize on a single file IO handle
+ * If the file IO handle cannot be cloned the readers share the file IO handle of the file
+ * A value of 0 or 1 represents a single file IO handle, which is the default
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_set_maximum_number_of_file_io_handles(
+     libmsiecf_file_t *file,
+     int maximum_number_of_file_io_handles,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_set_maximum_number_of_file_io_handles";
+	int result                               = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( ( maximum_number_of_file_io_handles < 0 )
+	 || ( maximum_number_of_file_io_handles > LIBMSIECF_MAXIMUM_NUMBER_OF_FILE_IO_HANDLES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of file IO handles value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The write lock guarantees none of the cloned file IO handles are in use
+	 */
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libmsiecf_file_io_handle_pool_set_maximum_number_of_handles(
+	     internal_file->file_io_handle_pool,
+	     maximum_number_of_file_io_handles,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of file IO handles.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the format version
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_format_version(
+     libmsiecf_file_t *file,
+     uint8_t *major_version,
+     uint8_t *minor_version,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_get_format_version";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( major_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid major version.",
+		 function );
+
+		return( -1 );
+	}
+	if( minor_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minor version.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*major_version = internal_file->file_header->major_version;
+	*minor_version = internal_file->file_header->minor_version;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of unallocated blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_number_of_unallocated_blocks(
+     libmsiecf_file_t *file,
+     int *number_of_unallocated_blocks,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_get_number_of_unallocated_blocks";
+	int result                               = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcdata_range_list_get_number_of_elements(
+	          internal_file->unallocated_block_list,
+	          number_of_unallocated_blocks,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific unallocated block
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_unallocated_block(
+     libmsiecf_file_t *file,
+     int unallocated_block_index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	intptr_t *value                          = NULL;
+	static char *function                    = "libmsiecf_file_get_unallocated_block";
+	int result                               = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcdata_range_list_get_range_by_index(
+	          internal_file->unallocated_block_list,
+	          unallocated_block_index,
+	          (uint64_t *) offset,
+	          (uint64_t *) size,
+	          &value,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve unallocated block range: %d.",
+		 function,
+		 unallocated_block_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of cache directories
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_number_of_cache_directories(
+     libmsiecf_file_t *file,
+     int *number_of_cache_directories,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_get_number_of_cache_directories";
+	int result                               = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libmsiecf_cache_directory_table_get_number_of_cache_directories(
+	          internal_file->cache_directory_table,
+	          number_of_cache_directories,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from directory array.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the extended ASCII encoded name of a certain cache directory
+ * The size should include the end of string character
+ * The cache directory name consists of 8 characters + end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_cache_directory_name(
+     libmsiecf_file_t *file,
+     int cache_directory_index,
+     char *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_get_cache_directory_name";
+	int result                               = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libmsiecf_cache_directory_table_get_directory_name_by_index(
+	          internal_file->cache_directory_table,
+	          cache_directory_index,
+	          string,
+	          string_size,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache directory: %d name.",
+		 function,
+		 cache_directory_index );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the number of items
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_number_of_items(
+     libmsiecf_file_t *file,
+     int *number_of_items,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_get_number_of_items";
+	int result                               = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( libmsiecf_internal_file_get_record_scan(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record scan.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcdata_array_get_number_of_entries(
+	          internal_file->item_array,
+	          number_of_items,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from item array.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Grabs a file IO handle to read item records from
+ * If the file data is read into memory the records are not read from the file IO handle
+ * and the file IO handle of the file is used, otherwise a file IO handle
+ * that is not in use by another reader is taken from the file IO handle pool
+ * The file IO handle must be released with libmsiecf_internal_file_release_file_io_handle
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_internal_file_grab_file_io_handle(
+     libmsiecf_internal_file_t *internal_file,
+     libbfio_handle_t **file_io_handle,
+     int *file_io_handle_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_internal_file_grab_file_io_handle";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle->file_data != NULL )
+	{
+		*file_io_handle       = internal_file->file_io_handle;
+		*file_io_handle_index = -1;
+
+		return( 1 );
+	}
+	if( libmsiecf_file_io_handle_pool_grab_handle(
+	     internal_file->file_io_handle_pool,
+	     file_io_handle,
+	     file_io_handle_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle from file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Releases a file IO handle grabbed by libmsiecf_internal_file_grab_file_io_handle
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_internal_file_release_file_io_handle(
+     libmsiecf_internal_file_t *internal_file,
+     int file_io_handle_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_internal_file_release_file_io_handle";
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_file_io_handle_pool_release_handle(
+	     internal_file->file_io_handle_pool,
+	     file_io_handle_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle to file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the item for the specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_item_by_index(
+     libmsiecf_file_t *file,
+     int item_index,
+     libmsiecf_item_t **item,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle             = NULL;
+	libmsiecf_internal_file_t *internal_file     = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor = NULL;
+	static char *function                        = "libmsiecf_file_get_item_by_index";
+	int file_io_handle_index                     = -1;
+	int result                                   = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( internal_file->item_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing item array.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: item already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_internal_file_get_record_scan(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record scan.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libmsiecf_internal_file_grab_file_io_handle(
+	     internal_file,
+	     &file_io_handle,
+	     &file_io_handle_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_array_get_entry_by_index(
+	          internal_file->item_array,
+	          item_index,
+	          (intptr_t **) &item_descriptor,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item descriptor.",
+		 function );
+
+		result = -1;
+	}
+	else if( libmsiecf_item_initialize(
+	          item,
+	          item_descriptor,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item.",
+		 function );
+
+		result = -1;
+	}
+/* TODO make more error tollerant for corrupt items */
+	else if( libmsiecf_internal_item_read_values(
+	          (libmsiecf_internal_item_t *) *item,
+	          internal_file->io_handle,
+	          file_io_handle,
+	          NULL,
+	          0,
+	          internal_file->item_cache,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read item values.",
+		 function );
+
+		libmsiecf_item_free(
+		 item,
+		 NULL );
+
+		result = -1;
+	}
+	if( file_io_handle != NULL )
+	{
+		if( libmsiecf_internal_file_release_file_io_handle(
+		     internal_file,
+		     file_io_handle_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO handle.",
+			 function );
+
+			libmsiecf_item_free(
+			 item,
+			 NULL );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a range of items
+ * The records of the items are read in file offset order and adjacent records are read at once
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_items_by_range(
+     libmsiecf_file_t *file,
+     int first_item_index,
+     int number_of_items,
+     libmsiecf_item_t **items,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_get_items_by_range";
+	int item_index                           = 0;
+	int result                               = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( internal_file->item_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing item array.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_item_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first item index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of items value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid items.",
+		 function );
+
+		return( -1 );
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( items[ item_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: item: %d already set.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+	}
+	if( libmsiecf_internal_file_get_record_scan(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record scan.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libmsiecf_internal_file_get_items_by_range(
+	     internal_file,
+	     first_item_index,
+	     number_of_items,
+	     items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read items: %d to %d.",
+		 function,
+		 first_item_index,
+		 first_item_index + number_of_items );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			libmsiecf_item_free(
+			 &( items[ item_index ] ),
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a range of items
+ * The item array is sorted by file offset, except for items appended by a refresh,
+ * the records are read using a read batch so that adjacent records are read at once
+ * This function does not grab the read/write lock
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_internal_file_get_items_by_range(
+     libmsiecf_internal_file_t *internal_file,
+     int first_item_index,
+     int number_of_items,
+     libmsiecf_item_t **items,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle             = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor = NULL;
+	libmsiecf_read_batch_t *read_batch           = NULL;
+	static char *function                        = "libmsiecf_internal_file_get_items_by_range";
+	int file_io_handle_index                     = -1;
+	int item_index                               = 0;
+	int number_of_entries                        = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid items.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->item_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_item_index < 0 )
+	 || ( first_item_index > number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first item index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_items < 0 )
+	 || ( number_of_items > ( number_of_entries - first_item_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of items value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_read_batch_initialize(
+	     &read_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read batch.",
+		 function );
+
+		goto on_error;
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->item_array,
+		     first_item_index + item_index,
+		     (intptr_t **) &item_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item descriptor: %d.",
+			 function,
+			 first_item_index + item_index );
+
+			goto on_error;
+		}
+		if( libmsiecf_read_batch_append_item_descriptor(
+		     read_batch,
+		     item_descriptor,
+		     item_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append item descriptor: %d to read batch.",
+			 function,
+			 first_item_index + item_index );
+
+			goto on_error;
+		}
+	}
+	if( libmsiecf_internal_file_grab_file_io_handle(
+	     internal_file,
+	     &file_io_handle,
+	     &file_io_handle_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_read_batch_read_items(
+	     read_batch,
+	     internal_file->io_handle,
+	     file_io_handle,
+	     internal_file->item_cache,
+	     items,
+	     number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read items.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle = NULL;
+
+	if( libmsiecf_internal_file_release_file_io_handle(
+	     internal_file,
+	     file_io_handle_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_read_batch_free(
+	     &read_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read batch.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libmsiecf_internal_file_release_file_io_handle(
+		 internal_file,
+		 file_io_handle_index,
+		 NULL );
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( items[ item_index ] != NULL )
+		{
+			libmsiecf_item_free(
+			 &( items[ item_index ] ),
+			 NULL );
+		}
+	}
+	if( read_batch != NULL )
+	{
+		libmsiecf_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves specific items
+ * The records of the items are read in file offset order and adjacent records are read at once
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_items_by_indexes(
+     libmsiecf_file_t *file,
+     const int *item_indexes,
+     int number_of_items,
+     libmsiecf_item_t **items,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	static char *function                    = "libmsiecf_file_get_items_by_indexes";
+	int item_index                           = 0;
+	int result                               = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( internal_file->item_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing item array.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of items value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid items.",
+		 function );
+
+		return( -1 );
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( items[ item_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: item: %d already set.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+	}
+	if( libmsiecf_internal_file_get_record_scan(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record scan.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libmsiecf_internal_file_get_items_by_indexes(
+	     internal_file,
+	     item_indexes,
+	     number_of_items,
+	     items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read items.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			libmsiecf_item_free(
+			 &( items[ item_index ] ),
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves specific items
+ * The records are read in file offset order, independent of the order of the item indexes,
+ * and adjacent records are read at once
+ * This function does not grab the read/write lock
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_internal_file_get_items_by_indexes(
+     libmsiecf_internal_file_t *internal_file,
+     const int *item_indexes,
+     int number_of_items,
+     libmsiecf_item_t **items,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle             = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor = NULL;
+	libmsiecf_read_batch_t *read_batch           = NULL;
+	static char *function                        = "libmsiecf_internal_file_get_items_by_indexes";
+	int file_io_handle_index                     = -1;
+	int item_index                               = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of items value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid items.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_read_batch_initialize(
+	     &read_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read batch.",
+		 function );
+
+		goto on_error;
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->item_array,
+		     item_indexes[ item_index ],
+		     (intptr_t **) &item_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item descriptor: %d.",
+			 function,
+			 item_indexes[ item_index ] );
+
+			goto on_error;
+		}
+		if( libmsiecf_read_batch_append_item_descriptor(
+		     read_batch,
+		     item_descriptor,
+		     item_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append item descriptor: %d to read batch.",
+			 function,
+			 item_indexes[ item_index ] );
+
+			goto on_error;
+		}
+	}
+	if( libmsiecf_internal_file_grab_file_io_handle(
+	     internal_file,
+	     &file_io_handle,
+	     &file_io_handle_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_read_batch_read_items(
+	     read_batch,
+	     internal_file->io_handle,
+	     file_io_handle,
+	     internal_file->item_cache,
+	     items,
+	     number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read items.",
+		 function );
+
+		goto on_error;
+	}
+	file_io_handle = NULL;
+
+	if( libmsiecf_internal_file_release_file_io_handle(
+	     internal_file,
+	     file_io_handle_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_read_batch_free(
+	     &read_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read batch.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libmsiecf_internal_file_release_file_io_handle(
+		 internal_file,
+		 file_io_handle_index,
+		 NULL );
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( items[ item_index ] != NULL )
+		{
+			libmsiecf_item_free(
+			 &( items[ item_index ] ),
+			 NULL );
+		}
+	}
+	if( read_batch != NULL )
+	{
+		libmsiecf_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the item descriptor of a specific record offset
+ * The sorted items of the item array are searched using a binary search,
+ * the items appended by a refresh are searched linearly
+ * Returns 1 if successful, 0 if no such item descriptor or -1 on error
+ */
+int libmsiecf_internal_file_get_item_descriptor_by_offset(
+     libmsiecf_internal_file_t *internal_file,
+     off64_t file_offset,
+     libmsiecf_item_descriptor_t **item_descriptor,
+     libcerror_error_t **error )
+{
+	libmsiecf_item_descriptor_t *safe_item_descriptor = NULL;
+	static char *function                             = "libmsiecf_internal_file_get_item_descriptor_by_offset";
+	int first_item_index                              = 0;
+	int item_index                                    = 0;
+	int last_item_index                               = 0;
+	int number_of_items                               = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->item_array,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->number_of_sorted_items < 0 )
+	 || ( internal_file->number_of_sorted_items > number_of_items ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file - number of sorted items value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	last_item_index = internal_file->number_of_sorted_items - 1;
+
+	while( first_item_index <= last_item_index )
+	{
+		item_index = first_item_index + ( ( last_item_index - first_item_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->item_array,
+		     item_index,
+		     (intptr_t **) &safe_item_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item descriptor: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		if( safe_item_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing item descriptor: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		if( file_offset == safe_item_descriptor->file_offset )
+		{
+			*item_descriptor = safe_item_descriptor;
+
+			return( 1 );
+		}
+		else if( file_offset < safe_item_descriptor->file_offset )
+		{
+			last_item_index = item_index - 1;
+		}
+		else
+		{
+			first_item_index = item_index + 1;
+		}
+	}
+	for( item_index = internal_file->number_of_sorted_items;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->item_array,
+		     item_index,
+		     (intptr_t **) &safe_item_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item descriptor: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		if( safe_item_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing item descriptor: %d.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+		if( file_offset == safe_item_descriptor->file_offset )
+		{
+			*item_descriptor = safe_item_descriptor;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the item of a specific location
+ * The location is a byte stream encoded in the ASCII codepage, the size includes
+ * the end-of-string character and must be at least 5 since the hash uses the first 4 bytes
+ * The HASH record entries are used to find candidate records, the location of
+ * every candidate is compared to make sure hash collisions are not returned
+ * Returns 1 if successful, 0 if no such item or -1 on error
+ */
+int libmsiecf_internal_file_get_item_by_location(
+     libmsiecf_internal_file_t *internal_file,
+     const uint8_t *location,
+     size_t location_size,
+     libmsiecf_item_t **item,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle             = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor = NULL;
+	libmsiecf_item_t *safe_item                  = NULL;
+	uint8_t *item_location                       = NULL;
+	static char *function                        = "libmsiecf_internal_file_get_item_by_location";
+	size_t item_location_length                  = 0;
+	size_t item_location_size                    = 0;
+	size_t location_length                       = 0;
+	uint32_t hash_value                          = 0;
+	uint32_t probe_index                         = 0;
+	uint32_t record_offset                       = 0;
+	int file_io_handle_index                     = -1;
+	int result                                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( location == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( location_size < 5 )
+	 || ( location_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid location size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( location[ location_size - 1 ] != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported unterminated location.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	location_length = location_size - 1;
+
+	while( ( location_length > 0 )
+	    && ( location[ location_length - 1 ] == 0 ) )
+	{
+		location_length--;
+	}
+	if( location_length == 0 )
+	{
+		return( 0 );
+	}
+	if( libmsiecf_hash_calculate(
+	     &hash_value,
+	     location,
+	     location_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate location hash.",
+		 function );
+
+		goto on_error;
+	}
+	do
+	{
+		result = libmsiecf_hash_map_get_record_offset(
+		          internal_file->hash_map,
+		          hash_value,
+		          &probe_index,
+		          &record_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record offset from hash map.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		result = libmsiecf_internal_file_get_item_descriptor_by_offset(
+		          internal_file,
+		          (off64_t) record_offset,
+		          &item_descriptor,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item descriptor at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 record_offset,
+			 record_offset );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( ( item_descriptor->type != LIBMSIECF_ITEM_TYPE_URL )
+		 && ( item_descriptor->type != LIBMSIECF_ITEM_TYPE_REDIRECTED ) )
+		{
+			result = 0;
+
+			continue;
+		}
+		if( libmsiecf_item_initialize(
+		     &safe_item,
+		     item_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create item.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmsiecf_internal_file_grab_file_io_handle(
+		     internal_file,
+		     &file_io_handle,
+		     &file_io_handle_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to grab file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmsiecf_internal_item_read_values(
+		     (libmsiecf_internal_item_t *) safe_item,
+		     internal_file->io_handle,
+		     file_io_handle,
+		     NULL,
+		     0,
+		     internal_file->item_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read item values.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle = NULL;
+
+		if( libmsiecf_internal_file_release_file_io_handle(
+		     internal_file,
+		     file_io_handle_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( item_descriptor->type == LIBMSIECF_ITEM_TYPE_URL )
+		{
+			result = libmsiecf_url_get_location_size(
+			          safe_item,
+			          &item_location_size,
+			          error );
+		}
+		else
+		{
+			result = libmsiecf_redirected_get_location_size(
+			          safe_item,
+			          &item_location_size,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve location size.",
+			 function );
+
+			goto on_error;
+		}
+		/* A location that is shorter than the requested location cannot match
+		 */
+		if( ( result != 0 )
+		 && ( item_location_size > location_length ) )
+		{
+			item_location = (uint8_t *) memory_allocate(
+			                             sizeof( uint8_t ) * item_location_size );
+
+			if( item_location == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create location.",
+				 function );
+
+				goto on_error;
+			}
+			if( item_descriptor->type == LIBMSIECF_ITEM_TYPE_URL )
+			{
+				result = libmsiecf_url_get_location(
+				          safe_item,
+				          (char *) item_location,
+				          item_location_size,
+				          error );
+			}
+			else
+			{
+				result = libmsiecf_redirected_get_location(
+				          safe_item,
+				          (char *) item_location,
+				          item_location_size,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve location.",
+				 function );
+
+				goto on_error;
+			}
+			item_location_length = item_location_size;
+
+			while( ( item_location_length > 0 )
+			    && ( item_location[ item_location_length - 1 ] == 0 ) )
+			{
+				item_location_length--;
+			}
+			result = 0;
+
+			if( ( item_location_length == location_length )
+			 && ( memory_compare(
+			       item_location,
+			       location,
+			       location_length ) == 0 ) )
+			{
+				result = 1;
+			}
+			memory_free(
+			 item_location );
+
+			item_location = NULL;
+		}
+		else
+		{
+			result = 0;
+		}
+		if( result != 0 )
+		{
+			*item = safe_item;
+
+			return( 1 );
+		}
+		if( libmsiecf_item_free(
+		     &safe_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free item.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( result == 0 );
+
+	return( 0 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libmsiecf_internal_file_release_file_io_handle(
+		 internal_file,
+		 file_io_handle_index,
+		 NULL );
+	}
+	if( item_location != NULL )
+	{
+		memory_free(
+		 item_location );
+	}
+	if( safe_item != NULL )
+	{
+		libmsiecf_item_free(
+		 &safe_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the item for the specific UTF-8 encoded location
+ * The location is matched case-sensitive against the URL and redirected items
+ * Returns 1 if successful, 0 if no such item or -1 on error
+ */
+int libmsiecf_file_get_item_by_utf8_location(
+     libmsiecf_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libmsiecf_item_t **item,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	uint8_t *location                        = NULL;
+	static char *function                    = "libmsiecf_file_get_item_by_utf8_location";
+	size_t location_size                     = 0;
+	int result                               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->item_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing item array.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) ( SSIZE_MAX - 5 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: item already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length == 0 )
+	{
+		return( 0 );
+	}
+	if( libmsiecf_internal_file_get_record_scan(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_byte_stream_size_from_utf8(
+	     utf8_string,
+	     utf8_string_length,
+	     internal_file->io_handle->ascii_codepage,
+	     &location_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine location size.",
+		 function );
+
+		goto on_error;
+	}
+	/* Add space for the end-of-string character and make sure
+	 * the location contains at least the 4 bytes used by the hash
+	 */
+	location_size += 1;
+
+	if( location_size < 5 )
+	{
+		location_size = 5;
+	}
+	location = (uint8_t *) memory_allocate(
+	                        sizeof( uint8_t ) * location_size );
+
+	if( location == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create location.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     location,
+	     0,
+	     sizeof( uint8_t ) * location_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear location.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_byte_stream_copy_from_utf8(
+	     location,
+	     location_size - 1,
+	     internal_file->io_handle->ascii_codepage,
+	     utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to copy UTF-8 string to location.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libmsiecf_internal_file_get_item_by_location(
+	          internal_file,
+	          location,
+	          location_size,
+	          item,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item by location.",
+		 function );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		libmsiecf_item_free(
+		 item,
+		 NULL );
+
+		goto on_error;
+	}
+#endif
+	memory_free(
+	 location );
+
+	return( result );
+
+on_error:
+	if( location != NULL )
+	{
+		memory_free(
+		 location );
+	}
+	return( -1 );
+}
+
+/* Retrieves the item for the specific UTF-16 encoded location
+ * The location is matched case-sensitive against the URL and redirected items
+ * Returns 1 if successful, 0 if no such item or -1 on error
+ */
+int libmsiecf_file_get_item_by_utf16_location(
+     libmsiecf_file_t *file,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libmsiecf_item_t **item,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_file_t *internal_file = NULL;
+	uint8_t *location                        = NULL;
+	static char *function                    = "libmsiecf_file_get_item_by_utf16_location";
+	size_t location_size                     = 0;
+	int result                               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->item_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing item array.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) ( SSIZE_MAX - 5 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: item already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length == 0 )
+	{
+		return( 0 );
+	}
+	if( libmsiecf_internal_file_get_record_scan(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record scan.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_byte_stream_size_from_utf16(
+	     utf16_string,
+	     utf16_string_length,
+	     internal_file->io_handle->ascii_codepage,
+	     &location_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine location size.",
+		 function );
+
+		goto on_error;
+	}
+	/* Add space for the end-of-string character and make sure
+	 * the location contains at least the 4 bytes used by the hash
+	 */
+	location_size += 1;
+
+	if( location_size < 5 )
+	{
+		location_size = 5;
+	}
+	location = (uint8_t *) memory_allocate(
+	                        sizeof( uint8_t ) * location_size );
+
+	if( location == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create location.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     location,
+	     0,
+	     sizeof( uint8_t ) * location_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear location.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_byte_stream_copy_from_utf16(
+	     location,
+	     location_size - 1,
+	     internal_file->io_handle->ascii_codepage,
+	     utf16_string,
+	     utf16_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+		 LIBCERROR_CONVERSION_ERROR_GENERIC,
+		 "%s: unable to copy UTF-16 string to location.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libmsiecf_internal_file_get_item_by_location(
+	          internal_file,
+	          location,
+	          location_size,
+	          item,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve item by location.",
+		 function );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		libmsiecf_item_free(
+		 item,
+		 NULL );
+
+		goto on_error;
+	}
+#endif
+	memory_free(
+	 location );
+
+	return( result );
+
+on_error:
+	if( location != NULL )
+	{
+		memory_free(
+		 location );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of recovered items
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_number_of_recovered_items(
      libmsiecf_file_t *file,
-     int cache_directory_index,
-     char *string,
-     size_t string_size,
+     int *number_of_recovered_items,
      libcerror_error_t **error )
 {
 	libmsiecf_internal_file_t *internal_file = NULL;
-	static char *function                    = "libmsiecf_file_get_cache_directory_name";
+	static char *function                    = "libmsiecf_file_get_number_of_recovered_items";
 	int result                               = 1;
 
-	if( file == NULL )
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( libmsiecf_internal_file_get_record_scan(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record scan.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcdata_array_get_number_of_entries(
+	          internal_file->recovered_item_array,
+	          number_of_recovered_items,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from recovered item array.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the recovered item for the specific index
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_get_recovered_item_by_index(
+     libmsiecf_file_t *file,
+     int recovered_item_index,
+     libmsiecf_item_t **recovered_item,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle             = NULL;
+	libmsiecf_internal_file_t *internal_file     = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor = NULL;
+	static char *function                        = "libmsiecf_file_get_recovered_item_by_index";
+	int file_io_handle_index                     = -1;
+	int result                                   = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	if( internal_file->recovered_item_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing recovered item array.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered item.",
+		 function );
+
+		return( -1 );
+	}
+	if( *recovered_item != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: recovered item already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_internal_file_get_record_scan(
+	     internal_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record scan.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libmsiecf_internal_file_grab_file_io_handle(
+	     internal_file,
+	     &file_io_handle,
+	     &file_io_handle_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_array_get_entry_by_index(
+	          internal_file->recovered_item_array,
+	          recovered_item_index,
+	          (intptr_t **) &item_descriptor,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve recovered item descriptor.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	internal_file = (libmsiecf_internal_file_t *) file;
-
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	else if( libmsiecf_item_initialize(
+	          recovered_item,
+	          item_descriptor,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered item.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-#endif
-	result = libmsiecf_cache_directory_table_get_directory_name_by_index(
-	          internal_file->cache_directory_table,
-	          cache_directory_index,
-	          string,
-	          string_size,
-	          error );
-
-	if( result != 1 )
+/* TODO make more error tollerant for corrupt items */
+	else if( libmsiecf_internal_item_read_values(
+	          (libmsiecf_internal_item_t *) *recovered_item,
+	          internal_file->io_handle,
+	          file_io_handle,
+	          NULL,
+	          0,
+	          internal_file->item_cache,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve cache directory: %d name.",
-		 function,
-		 cache_directory_index );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read recovered item values.",
+		 function );
+
+		libmsiecf_item_free(
+		 recovered_item,
+		 NULL );
 
 		result = -1;
 	}
+	if( file_io_handle != NULL )
+	{
+		if( libmsiecf_internal_file_release_file_io_handle(
+		     internal_file,
+		     file_io_handle_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO handle.",
+			 function );
+
+			libmsiecf_item_free(
+			 recovered_item,
+			 NULL );
+
+			result = -1;
+		}
+	}
 #if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
@@ -1983,17 +8083,38 @@ int libmsiecf_file_get_cache_directory_name(
 	return( result );
 }
 
-/* Retrieves the number of items
+
+/* Iterates the items and invokes a callback function with a view of each item
+ * The iterate flags control whether the items, the recovered items or both are iterated
+ * and whether they are iterated in file offset order instead of index order
+ * The item view is reused for every item, and the callback function must not retain it
+ * or call other functions of the file since the file is locked during the iteration
+ * The callback function should return 1 to continue, 0 to stop or -1 on error
  * Returns 1 if successful or -1 on error
  */
-int libmsiecf_file_get_number_of_items(
+int libmsiecf_file_iterate_items(
      libmsiecf_file_t *file,
-     int *number_of_items,
+     int iterate_flags,
+     int (*callback_function)(
+            libmsiecf_item_view_t *item_view,
+            void *user_data ),
+     void *user_data,
      libcerror_error_t **error )
 {
-	libmsiecf_internal_file_t *internal_file = NULL;
-	static char *function                    = "libmsiecf_file_get_number_of_items";
-	int result                               = 1;
+	libbfio_handle_t *file_io_handle             = NULL;
+	libcdata_array_t *item_arrays[ 2 ]           = { NULL, NULL };
+	libmsiecf_internal_file_t *internal_file     = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor = NULL;
+	libmsiecf_item_view_t *item_view             = NULL;
+	libmsiecf_read_batch_t *read_batch           = NULL;
+	static char *function                        = "libmsiecf_file_iterate_items";
+	int array_index                              = 0;
+	int callback_result                          = 1;
+	int entry_index                              = 0;
+	int file_io_handle_index                     = -1;
+	int item_index                               = 0;
+	int number_of_items                          = 0;
+	int result                                   = 1;
 
 	if( file == NULL )
 	{
@@ -2008,113 +8129,100 @@ int libmsiecf_file_get_number_of_items(
 	}
 	internal_file = (libmsiecf_internal_file_t *) file;
 
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( internal_file->item_array == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing item array.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = libcdata_array_get_number_of_entries(
-	          internal_file->item_array,
-	          number_of_items,
-	          error );
-
-	if( result != 1 )
+	if( internal_file->recovered_item_array == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements from item array.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing recovered item array.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( ( iterate_flags & ~( LIBMSIECF_ITERATE_FLAG_ITEMS | LIBMSIECF_ITERATE_FLAG_RECOVERED_ITEMS | LIBMSIECF_ITERATE_FLAG_OFFSET_ORDER ) ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported iterate flags: 0x%08x.",
+		 function,
+		 iterate_flags );
 
 		return( -1 );
 	}
-#endif
-	return( result );
-}
-
-/* Retrieves the item for the specific index
- * Returns 1 if successful or -1 on error
- */
-int libmsiecf_file_get_item_by_index(
-     libmsiecf_file_t *file,
-     int item_index,
-     libmsiecf_item_t **item,
-     libcerror_error_t **error )
-{
-	libmsiecf_internal_file_t *internal_file     = NULL;
-	libmsiecf_item_descriptor_t *item_descriptor = NULL;
-	static char *function                        = "libmsiecf_file_get_item_by_index";
-	int result                               = 1;
-
-	if( file == NULL )
+	if( callback_function == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid callback function.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libmsiecf_internal_file_t *) file;
-
-	if( internal_file->item_array == NULL )
+	if( ( iterate_flags & LIBMSIECF_ITERATE_FLAG_ITEMS ) != 0 )
+	{
+		item_arrays[ 0 ] = internal_file->item_array;
+	}
+	if( ( iterate_flags & LIBMSIECF_ITERATE_FLAG_RECOVERED_ITEMS ) != 0 )
+	{
+		item_arrays[ 1 ] = internal_file->recovered_item_array;
+	}
+	if( libmsiecf_internal_file_get_record_scan(
+	     internal_file,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing item array.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record scan.",
 		 function );
 
 		return( -1 );
 	}
-	if( item == NULL )
+	if( libmsiecf_item_view_initialize(
+	     &item_view,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item view.",
 		 function );
 
 		return( -1 );
 	}
-	if( *item != NULL )
+	if( libmsiecf_read_batch_initialize(
+	     &read_batch,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: item already set.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read batch.",
 		 function );
 
+		libmsiecf_item_view_free(
+		 &item_view,
+		 NULL );
+
 		return( -1 );
 	}
 #if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
@@ -2129,87 +8237,262 @@ int libmsiecf_file_get_item_by_index(
 		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
+		libmsiecf_read_batch_free(
+		 &read_batch,
+		 NULL );
+		libmsiecf_item_view_free(
+		 &item_view,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
-	if( libcdata_array_get_entry_by_index(
-	     internal_file->item_array,
-	     item_index,
-	     (intptr_t **) &item_descriptor,
+	for( array_index = 0;
+	     array_index < 2;
+	     array_index++ )
+	{
+		if( item_arrays[ array_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcdata_array_get_number_of_entries(
+		     item_arrays[ array_index ],
+		     &number_of_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of items.",
+			 function );
+
+			goto on_error;
+		}
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     item_arrays[ array_index ],
+			     item_index,
+			     (intptr_t **) &item_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve item descriptor: %d.",
+				 function,
+				 item_index );
+
+				goto on_error;
+			}
+			if( libmsiecf_read_batch_append_item_descriptor(
+			     read_batch,
+			     item_descriptor,
+			     item_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append item descriptor: %d to read batch.",
+				 function,
+				 item_index );
+
+				goto on_error;
+			}
+		}
+	}
+	/* The items and recovered items are each mostly stored in file offset order,
+	 * the sort merges them and moves the items added by a refresh into place
+	 */
+	if( ( iterate_flags & LIBMSIECF_ITERATE_FLAG_OFFSET_ORDER ) != 0 )
+	{
+		if( libmsiecf_read_batch_sort(
+		     read_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to sort read batch.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libmsiecf_internal_file_grab_file_io_handle(
+	     internal_file,
+	     &file_io_handle,
+	     &file_io_handle_index,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve item descriptor.",
+		 "%s: unable to grab file IO handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	else if( libmsiecf_item_initialize(
-	          item,
-	          item_descriptor,
-	          error ) != 1 )
+	for( entry_index = 0;
+	     entry_index < read_batch->number_of_entries;
+	     entry_index++ )
+	{
+		item_index = read_batch->entries[ entry_index ].item_index;
+
+		if( libmsiecf_internal_item_view_read_file_io_handle(
+		     (libmsiecf_internal_item_view_t *) item_view,
+		     internal_file->io_handle,
+		     file_io_handle,
+		     read_batch->entries[ entry_index ].item_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read item view: %d.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		callback_result = callback_function(
+		                   item_view,
+		                   user_data );
+
+		if( callback_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: callback function failed for item: %d.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		else if( callback_result == 0 )
+		{
+			break;
+		}
+	}
+	file_io_handle = NULL;
+
+	if( libmsiecf_internal_file_release_file_io_handle(
+	     internal_file,
+	     file_io_handle_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create item.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		result = -1;
 	}
-/* TODO make more error tollerant for corrupt items */
-	else if( libmsiecf_internal_item_read_values(
-	          (libmsiecf_internal_item_t *) *item,
-	          internal_file->io_handle,
-	          internal_file->file_io_handle,
-	          error ) != 1 )
+#endif
+	if( libmsiecf_read_batch_free(
+	     &read_batch,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read item values.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read batch.",
 		 function );
 
-		libmsiecf_item_free(
-		 item,
-		 NULL );
-
 		result = -1;
 	}
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
+	if( libmsiecf_item_view_free(
+	     &item_view,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free item view.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-#endif
 	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libmsiecf_internal_file_release_file_io_handle(
+		 internal_file,
+		 file_io_handle_index,
+		 NULL );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	libmsiecf_read_batch_free(
+	 &read_batch,
+	 NULL );
+
+	libmsiecf_item_view_free(
+	 &item_view,
+	 NULL );
+
+	return( -1 );
 }
 
-/* Retrieves the number of recovered items
+/* Reads the fixed record header values of the URL items into columns
+ * The iterate flags control whether the items, the recovered items or both are read
+ * and whether the rows are stored in file offset order instead of index order
+ * Partial URL items without a complete record header are skipped
  * Returns 1 if successful or -1 on error
  */
-int libmsiecf_file_get_number_of_recovered_items(
+int libmsiecf_file_read_url_columns(
      libmsiecf_file_t *file,
-     int *number_of_recovered_items,
+     int iterate_flags,
+     libmsiecf_url_columns_t *url_columns,
      libcerror_error_t **error )
 {
-	libmsiecf_internal_file_t *internal_file = NULL;
-	static char *function                    = "libmsiecf_file_get_number_of_recovered_items";
-	int result                               = 1;
+	libbfio_handle_t *file_io_handle             = NULL;
+	libcdata_array_t *item_arrays[ 2 ]           = { NULL, NULL };
+	libmsiecf_internal_file_t *internal_file     = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor = NULL;
+	libmsiecf_read_batch_t *read_batch           = NULL;
+	static char *function                        = "libmsiecf_file_read_url_columns";
+	size_t record_header_size                    = 0;
+	int array_index                              = 0;
+	int entry_index                              = 0;
+	int file_io_handle_index                     = -1;
+	int item_index                               = 0;
+	int number_of_items                          = 0;
+	int result                                   = 1;
 
 	if( file == NULL )
 	{
@@ -2224,111 +8507,115 @@ int libmsiecf_file_get_number_of_recovered_items(
 	}
 	internal_file = (libmsiecf_internal_file_t *) file;
 
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	result = libcdata_array_get_number_of_entries(
-	          internal_file->recovered_item_array,
-	          number_of_recovered_items,
-	          error );
-
-	if( result != 1 )
+	if( internal_file->item_array == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements from recovered item array.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing item array.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( internal_file->recovered_item_array == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing recovered item array.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( result );
-}
-
-/* Retrieves the recovered item for the specific index
- * Returns 1 if successful or -1 on error
- */
-int libmsiecf_file_get_recovered_item_by_index(
-     libmsiecf_file_t *file,
-     int recovered_item_index,
-     libmsiecf_item_t **recovered_item,
-     libcerror_error_t **error )
-{
-	libmsiecf_internal_file_t *internal_file     = NULL;
-	libmsiecf_item_descriptor_t *item_descriptor = NULL;
-	static char *function                        = "libmsiecf_file_get_recovered_item_by_index";
-	int result                               = 1;
+	if( ( iterate_flags & ~( LIBMSIECF_ITERATE_FLAG_ITEMS | LIBMSIECF_ITERATE_FLAG_RECOVERED_ITEMS | LIBMSIECF_ITERATE_FLAG_OFFSET_ORDER ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported iterate flags: 0x%08x.",
+		 function,
+		 iterate_flags );
 
-	if( file == NULL )
+		return( -1 );
+	}
+	if( url_columns == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid URL columns.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libmsiecf_internal_file_t *) file;
-
-	if( internal_file->recovered_item_array == NULL )
+	if( ( internal_file->io_handle->major_version == 4 )
+	 && ( internal_file->io_handle->minor_version == 7 ) )
+	{
+		record_header_size = sizeof( msiecf_url_record_header_v47_t );
+	}
+	else if( ( internal_file->io_handle->major_version == 5 )
+	      && ( internal_file->io_handle->minor_version == 2 ) )
+	{
+		record_header_size = sizeof( msiecf_url_record_header_v52_t );
+	}
+	else
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing recovered item array.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %d.%d.",
+		 function,
+		 internal_file->io_handle->major_version,
+		 internal_file->io_handle->minor_version );
 
 		return( -1 );
 	}
-	if( recovered_item == NULL )
+	if( ( iterate_flags & LIBMSIECF_ITERATE_FLAG_ITEMS ) != 0 )
+	{
+		item_arrays[ 0 ] = internal_file->item_array;
+	}
+	if( ( iterate_flags & LIBMSIECF_ITERATE_FLAG_RECOVERED_ITEMS ) != 0 )
+	{
+		item_arrays[ 1 ] = internal_file->recovered_item_array;
+	}
+	if( libmsiecf_internal_file_get_record_scan(
+	     internal_file,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid recovered item.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record scan.",
 		 function );
 
 		return( -1 );
 	}
-	if( *recovered_item != NULL )
+	if( libmsiecf_read_batch_initialize(
+	     &read_batch,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: recovered item already set.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read batch.",
 		 function );
 
 		return( -1 );
@@ -2345,57 +8632,168 @@ int libmsiecf_file_get_recovered_item_by_index(
 		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
+		libmsiecf_read_batch_free(
+		 &read_batch,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
-	if( libcdata_array_get_entry_by_index(
-	     internal_file->recovered_item_array,
-	     recovered_item_index,
-	     (intptr_t **) &item_descriptor,
+	for( array_index = 0;
+	     array_index < 2;
+	     array_index++ )
+	{
+		if( item_arrays[ array_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcdata_array_get_number_of_entries(
+		     item_arrays[ array_index ],
+		     &number_of_items,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of items.",
+			 function );
+
+			goto on_error;
+		}
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     item_arrays[ array_index ],
+			     item_index,
+			     (intptr_t **) &item_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve item descriptor: %d.",
+				 function,
+				 item_index );
+
+				goto on_error;
+			}
+			if( ( item_descriptor == NULL )
+			 || ( item_descriptor->type != LIBMSIECF_ITEM_TYPE_URL )
+			 || ( (size_t) item_descriptor->record_size < record_header_size ) )
+			{
+				continue;
+			}
+			if( libmsiecf_read_batch_append_item_descriptor(
+			     read_batch,
+			     item_descriptor,
+			     item_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append item descriptor: %d to read batch.",
+				 function,
+				 item_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( ( iterate_flags & LIBMSIECF_ITERATE_FLAG_OFFSET_ORDER ) != 0 )
+	{
+		if( libmsiecf_read_batch_sort(
+		     read_batch,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to sort read batch.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libmsiecf_internal_url_columns_resize(
+	     (libmsiecf_internal_url_columns_t *) url_columns,
+	     read_batch->number_of_entries,
+	     record_header_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve recovered item descriptor.",
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize URL columns.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	else if( libmsiecf_item_initialize(
-	          recovered_item,
-	          item_descriptor,
-	          error ) != 1 )
+	if( libmsiecf_internal_file_grab_file_io_handle(
+	     internal_file,
+	     &file_io_handle,
+	     &file_io_handle_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create recovered item.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-/* TODO make more error tollerant for corrupt items */
-	else if( libmsiecf_internal_item_read_values(
-	          (libmsiecf_internal_item_t *) *recovered_item,
-	          internal_file->io_handle,
-	          internal_file->file_io_handle,
-	          error ) != 1 )
+	/* Only the record headers are read while the file is locked,
+	 * they are decoded into the columns afterwards in a single pass
+	 */
+	for( entry_index = 0;
+	     entry_index < read_batch->number_of_entries;
+	     entry_index++ )
+	{
+		item_index = read_batch->entries[ entry_index ].item_index;
+
+		if( libmsiecf_internal_url_columns_read_record_header(
+		     (libmsiecf_internal_url_columns_t *) url_columns,
+		     internal_file->io_handle,
+		     file_io_handle,
+		     read_batch->entries[ entry_index ].item_descriptor,
+		     item_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record header of item: %d.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+	}
+	file_io_handle = NULL;
+
+	if( libmsiecf_internal_file_release_file_io_handle(
+	     internal_file,
+	     file_io_handle_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read recovered item values.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle.",
 		 function );
 
-		libmsiecf_item_free(
-		 recovered_item,
-		 NULL );
-
-		result = -1;
+		goto on_error;
 	}
 #if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -2409,9 +8807,59 @@ int libmsiecf_file_get_recovered_item_by_index(
 		 "%s: unable to release read/write lock for reading.",
 		 function );
 
+		libmsiecf_read_batch_free(
+		 &read_batch,
+		 NULL );
+
 		return( -1 );
 	}
 #endif
+	if( libmsiecf_internal_url_columns_decode_record_headers(
+	     (libmsiecf_internal_url_columns_t *) url_columns,
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode record headers.",
+		 function );
+
+		result = -1;
+	}
+	if( libmsiecf_read_batch_free(
+	     &read_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free read batch.",
+		 function );
+
+		result = -1;
+	}
 	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libmsiecf_internal_file_release_file_io_handle(
+		 internal_file,
+		 file_io_handle_index,
+		 NULL );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 internal_file->read_write_lock,
+	 NULL );
+#endif
+	libmsiecf_read_batch_free(
+	 &read_batch,
+	 NULL );
+
+	return( -1 );
 }
 
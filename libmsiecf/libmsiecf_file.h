@@ -25,10 +25,17 @@
 #include <common.h>
 #include <types.h>
 
+#include "libmsiecf_allocation_map.h"
 #include "libmsiecf_cache_directory_table.h"
 #include "libmsiecf_extern.h"
+#include "libmsiecf_file_io_handle_pool.h"
 #include "libmsiecf_file_header.h"
+#include "libmsiecf_hash_map.h"
+#include "libmsiecf_index_file.h"
 #include "libmsiecf_io_handle.h"
+#include "libmsiecf_item_cache.h"
+#include "libmsiecf_item_descriptor.h"
+#include "libmsiecf_item_descriptor_arena.h"
 #include "libmsiecf_libbfio.h"
 #include "libmsiecf_libcdata.h"
 #include "libmsiecf_libcerror.h"
@@ -62,10 +69,26 @@ struct libmsiecf_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The pool of file IO handles used by concurrent readers
+	 */
+	libmsiecf_file_io_handle_pool_t *file_io_handle_pool;
+
 	/* The cache directory table
 	 */
 	libmsiecf_cache_directory_table_t *cache_directory_table;
 
+	/* The hash map of the HASH record entries
+	 */
+	libmsiecf_hash_map_t *hash_map;
+
+	/* The decoded item values cache
+	 */
+	libmsiecf_item_cache_t *item_cache;
+
+	/* The arena the item descriptors are allocated from
+	 */
+	libmsiecf_item_descriptor_arena_t *item_descriptor_arena;
+
 	/* The item descriptors array
 	 */
 	libcdata_array_t *item_array;
@@ -74,10 +97,35 @@ struct libmsiecf_internal_file
 	 */
 	libcdata_array_t *recovered_item_array;
 
-	/* The unallocated block list
+	/* The allocation map
+	 */
+	libmsiecf_allocation_map_t *allocation_map;
+
+	/* The unallocated block list, derived from the allocation map
 	 */
 	libcdata_range_list_t *unallocated_block_list;
 
+	/* Value to indicate if the record scan was performed
+	 */
+	uint8_t record_scan_performed;
+
+	/* The number of items in the item array that are sorted by file offset
+	 * items appended by a refresh follow the sorted items
+	 */
+	int number_of_sorted_items;
+
+	/* The number of threads used by the record scan
+	 */
+	int number_of_scan_threads;
+
+	/* The index file IO handle
+	 */
+	libbfio_handle_t *index_file_io_handle;
+
+	/* The index file
+	 */
+	libmsiecf_index_file_t *index_file;
+
 #if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -135,6 +183,41 @@ int libmsiecf_internal_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libmsiecf_internal_file_read_index_file(
+     libmsiecf_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_file_write_index_file(
+     libmsiecf_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_file_read_record_scan(
+     libmsiecf_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_file_get_record_scan(
+     libmsiecf_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_refresh(
+     libmsiecf_file_t *file,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_file_refresh(
+     libmsiecf_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_file_merge_scanned_items(
+     libmsiecf_internal_file_t *internal_file,
+     libcdata_array_t *scanned_item_array,
+     libcdata_array_t *scanned_recovered_item_array,
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     libcerror_error_t **error );
+
 LIBMSIECF_EXTERN \
 int libmsiecf_file_get_size(
      libmsiecf_file_t *file,
@@ -153,6 +236,84 @@ int libmsiecf_file_set_ascii_codepage(
      int ascii_codepage,
      libcerror_error_t **error );
 
+LIBMSIECF_EXTERN \
+int libmsiecf_file_get_number_of_scan_threads(
+     libmsiecf_file_t *file,
+     int *number_of_scan_threads,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_set_number_of_scan_threads(
+     libmsiecf_file_t *file,
+     int number_of_scan_threads,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_get_access_pattern(
+     libmsiecf_file_t *file,
+     int *access_pattern,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_set_access_pattern(
+     libmsiecf_file_t *file,
+     int access_pattern,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_set_index_filename(
+     libmsiecf_file_t *file,
+     const char *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_set_index_filename_wide(
+     libmsiecf_file_t *file,
+     const wchar_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_get_maximum_item_cache_size(
+     libmsiecf_file_t *file,
+     size_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_set_maximum_item_cache_size(
+     libmsiecf_file_t *file,
+     size_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_get_maximum_block_cache_size(
+     libmsiecf_file_t *file,
+     size_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_set_maximum_block_cache_size(
+     libmsiecf_file_t *file,
+     size_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_get_maximum_number_of_file_io_handles(
+     libmsiecf_file_t *file,
+     int *maximum_number_of_file_io_handles,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_set_maximum_number_of_file_io_handles(
+     libmsiecf_file_t *file,
+     int maximum_number_of_file_io_handles,
+     libcerror_error_t **error );
+
 LIBMSIECF_EXTERN \
 int libmsiecf_file_get_format_version(
      libmsiecf_file_t *file,
@@ -194,6 +355,17 @@ int libmsiecf_file_get_number_of_items(
      int *number_of_items,
      libcerror_error_t **error );
 
+int libmsiecf_internal_file_grab_file_io_handle(
+     libmsiecf_internal_file_t *internal_file,
+     libbfio_handle_t **file_io_handle,
+     int *file_io_handle_index,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_file_release_file_io_handle(
+     libmsiecf_internal_file_t *internal_file,
+     int file_io_handle_index,
+     libcerror_error_t **error );
+
 LIBMSIECF_EXTERN \
 int libmsiecf_file_get_item_by_index(
      libmsiecf_file_t *file,
@@ -201,6 +373,65 @@ int libmsiecf_file_get_item_by_index(
      libmsiecf_item_t **item,
      libcerror_error_t **error );
 
+LIBMSIECF_EXTERN \
+int libmsiecf_file_get_items_by_range(
+     libmsiecf_file_t *file,
+     int first_item_index,
+     int number_of_items,
+     libmsiecf_item_t **items,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_file_get_items_by_range(
+     libmsiecf_internal_file_t *internal_file,
+     int first_item_index,
+     int number_of_items,
+     libmsiecf_item_t **items,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_get_items_by_indexes(
+     libmsiecf_file_t *file,
+     const int *item_indexes,
+     int number_of_items,
+     libmsiecf_item_t **items,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_file_get_items_by_indexes(
+     libmsiecf_internal_file_t *internal_file,
+     const int *item_indexes,
+     int number_of_items,
+     libmsiecf_item_t **items,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_file_get_item_descriptor_by_offset(
+     libmsiecf_internal_file_t *internal_file,
+     off64_t file_offset,
+     libmsiecf_item_descriptor_t **item_descriptor,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_file_get_item_by_location(
+     libmsiecf_internal_file_t *internal_file,
+     const uint8_t *location,
+     size_t location_length,
+     libmsiecf_item_t **item,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_get_item_by_utf8_location(
+     libmsiecf_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libmsiecf_item_t **item,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_get_item_by_utf16_location(
+     libmsiecf_file_t *file,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libmsiecf_item_t **item,
+     libcerror_error_t **error );
+
 LIBMSIECF_EXTERN \
 int libmsiecf_file_get_number_of_recovered_items(
      libmsiecf_file_t *file,
@@ -214,6 +445,23 @@ int libmsiecf_file_get_recovered_item_by_index(
      libmsiecf_item_t **recovered_item,
      libcerror_error_t **error );
 
+LIBMSIECF_EXTERN \
+int libmsiecf_file_iterate_items(
+     libmsiecf_file_t *file,
+     int iterate_flags,
+     int (*callback_function)(
+            libmsiecf_item_view_t *item_view,
+            void *user_data ),
+     void *user_data,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_file_read_url_columns(
+     libmsiecf_file_t *file,
+     int iterate_flags,
+     libmsiecf_url_columns_t *url_columns,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
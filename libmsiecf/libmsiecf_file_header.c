@@ -28,6 +28,7 @@
 #include "libmsiecf_libbfio.h"
 #include "libmsiecf_libcerror.h"
 #include "libmsiecf_libcnotify.h"
+#include "libmsiecf_record_decoders.h"
 
 #include "msiecf_file_header.h"
 
@@ -143,6 +144,8 @@ int libmsiecf_file_header_read_data(
      size_t data_size,
      libcerror_error_t **error )
 {
+	libmsiecf_file_header_values_t file_header_values;
+
 	static char *function = "libmsiecf_file_header_read_data";
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -218,21 +221,25 @@ int libmsiecf_file_header_read_data(
 	file_header->major_version = ( (msiecf_file_header_t *) data )->signature[ 24 ] - (uint8_t) '0';
 	file_header->minor_version = ( (msiecf_file_header_t *) data )->signature[ 26 ] - (uint8_t) '0';
 
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (msiecf_file_header_t *) data )->file_size,
-	 file_header->file_size );
-
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (msiecf_file_header_t *) data )->hash_table_offset,
-	 file_header->hash_table_offset );
-
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (msiecf_file_header_t *) data )->number_of_blocks,
-	 file_header->number_of_blocks );
+	if( libmsiecf_file_header_values_decode(
+	     &file_header_values,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode file header values.",
+		 function );
 
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (msiecf_file_header_t *) data )->number_of_allocated_blocks,
-	 file_header->number_of_allocated_blocks );
+		return( -1 );
+	}
+	file_header->file_size                  = file_header_values.file_size;
+	file_header->hash_table_offset          = file_header_values.hash_table_offset;
+	file_header->number_of_blocks           = file_header_values.number_of_blocks;
+	file_header->number_of_allocated_blocks = file_header_values.number_of_allocated_blocks;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -0,0 +1,788 @@
+/*
+ * File IO handle pool functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmsiecf_definitions.h"
+#include "libmsiecf_file_io_handle_pool.h"
+#include "libmsiecf_libbfio.h"
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_libcthreads.h"
+
+/* Creates a file IO handle pool
+ * Make sure the value file_io_handle_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_io_handle_pool_initialize(
+     libmsiecf_file_io_handle_pool_t **file_io_handle_pool,
+     int maximum_number_of_handles,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_file_io_handle_pool_initialize";
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file IO handle pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_handles < 0 )
+	 || ( maximum_number_of_handles > LIBMSIECF_MAXIMUM_NUMBER_OF_FILE_IO_HANDLES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of handles value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*file_io_handle_pool = memory_allocate_structure(
+	                        libmsiecf_file_io_handle_pool_t );
+
+	if( *file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handle pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_io_handle_pool,
+	     0,
+	     sizeof( libmsiecf_file_io_handle_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handle pool.",
+		 function );
+
+		memory_free(
+		 *file_io_handle_pool );
+
+		*file_io_handle_pool = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *file_io_handle_pool )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *file_io_handle_pool )->maximum_number_of_handles = maximum_number_of_handles;
+
+	return( 1 );
+
+on_error:
+	if( *file_io_handle_pool != NULL )
+	{
+		memory_free(
+		 *file_io_handle_pool );
+
+		*file_io_handle_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a file IO handle pool
+ * The file IO handle of the file is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_io_handle_pool_free(
+     libmsiecf_file_io_handle_pool_t **file_io_handle_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_file_io_handle_pool_free";
+	int result            = 1;
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_io_handle_pool != NULL )
+	{
+		if( libmsiecf_file_io_handle_pool_free_cloned_handles(
+		     *file_io_handle_pool,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cloned file IO handles.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *file_io_handle_pool )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *file_io_handle_pool );
+
+		*file_io_handle_pool = NULL;
+	}
+	return( result );
+}
+
+/* Closes and frees the cloned file IO handles from a specific handle index
+ * This function does not grab the read/write lock
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_io_handle_pool_free_cloned_handles(
+     libmsiecf_file_io_handle_pool_t *file_io_handle_pool,
+     int first_handle_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_file_io_handle_pool_free_cloned_handles";
+	int handle_index      = 0;
+	int result            = 1;
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_handle_index < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first handle index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( handle_index = first_handle_index;
+	     handle_index < file_io_handle_pool->number_of_handles;
+	     handle_index++ )
+	{
+		if( file_io_handle_pool->handles[ handle_index ] == NULL )
+		{
+			continue;
+		}
+		if( libbfio_handle_close(
+		     file_io_handle_pool->handles[ handle_index ],
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle: %d.",
+			 function,
+			 handle_index );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( file_io_handle_pool->handles[ handle_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle: %d.",
+			 function,
+			 handle_index );
+
+			result = -1;
+		}
+		file_io_handle_pool->handles_in_use[ handle_index ] = 0;
+	}
+	if( file_io_handle_pool->number_of_handles > first_handle_index )
+	{
+		file_io_handle_pool->number_of_handles = first_handle_index;
+	}
+	return( result );
+}
+
+/* Empties a file IO handle pool
+ * Closes and frees the cloned file IO handles, the file IO handle of the file is retained
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_io_handle_pool_empty(
+     libmsiecf_file_io_handle_pool_t *file_io_handle_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_file_io_handle_pool_empty";
+	int result            = 1;
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_io_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libmsiecf_file_io_handle_pool_free_cloned_handles(
+	     file_io_handle_pool,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free cloned file IO handles.",
+		 function );
+
+		result = -1;
+	}
+	file_io_handle_pool->handles_in_use[ 0 ] = 0;
+	file_io_handle_pool->clone_failed        = 0;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_io_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the file IO handle of the file
+ * The cloned file IO handles of a previous file IO handle are closed and freed
+ * The file IO handle can be NULL to clear the file IO handle of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_io_handle_pool_set_file_io_handle(
+     libmsiecf_file_io_handle_pool_t *file_io_handle_pool,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_file_io_handle_pool_set_file_io_handle";
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_file_io_handle_pool_empty(
+	     file_io_handle_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to empty file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_pool->handles[ 0 ] = file_io_handle;
+
+	if( file_io_handle != NULL )
+	{
+		file_io_handle_pool->number_of_handles = 1;
+	}
+	else
+	{
+		file_io_handle_pool->number_of_handles = 0;
+	}
+	return( 1 );
+}
+
+/* Retrieves the maximum number of file IO handles
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_io_handle_pool_get_maximum_number_of_handles(
+     libmsiecf_file_io_handle_pool_t *file_io_handle_pool,
+     int *maximum_number_of_handles,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_file_io_handle_pool_get_maximum_number_of_handles";
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of handles.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     file_io_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_number_of_handles = file_io_handle_pool->maximum_number_of_handles;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     file_io_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum number of file IO handles
+ * The cloned file IO handles that exceed the maximum are closed and freed,
+ * these must not be in use
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_io_handle_pool_set_maximum_number_of_handles(
+     libmsiecf_file_io_handle_pool_t *file_io_handle_pool,
+     int maximum_number_of_handles,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_file_io_handle_pool_set_maximum_number_of_handles";
+	int result            = 1;
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_handles < 0 )
+	 || ( maximum_number_of_handles > LIBMSIECF_MAXIMUM_NUMBER_OF_FILE_IO_HANDLES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of handles value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_io_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( maximum_number_of_handles < file_io_handle_pool->number_of_handles )
+	{
+		if( libmsiecf_file_io_handle_pool_free_cloned_handles(
+		     file_io_handle_pool,
+		     ( maximum_number_of_handles > 1 ) ? maximum_number_of_handles : 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free cloned file IO handles.",
+			 function );
+
+			result = -1;
+		}
+	}
+	file_io_handle_pool->maximum_number_of_handles = maximum_number_of_handles;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_io_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Grabs a file IO handle that is not in use by another reader
+ * If all file IO handles are in use and the maximum number of file IO handles
+ * is not reached the file IO handle of the file is cloned and opened for reading
+ * Otherwise the file IO handle of the file is shared, which is safe since
+ * libbfio serializes reads from the same file IO handle, and the handle index is set to -1
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_io_handle_pool_grab_handle(
+     libmsiecf_file_io_handle_pool_t *file_io_handle_pool,
+     libbfio_handle_t **file_io_handle,
+     int *handle_index,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *cloned_file_io_handle = NULL;
+	static char *function                   = "libmsiecf_file_io_handle_pool_grab_handle";
+	int result                              = 0;
+	int safe_handle_index                   = 0;
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle_pool->handles[ 0 ] == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file IO handle pool - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_io_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( safe_handle_index = 0;
+	     safe_handle_index < file_io_handle_pool->number_of_handles;
+	     safe_handle_index++ )
+	{
+		if( file_io_handle_pool->handles_in_use[ safe_handle_index ] == 0 )
+		{
+			break;
+		}
+	}
+	if( ( safe_handle_index >= file_io_handle_pool->number_of_handles )
+	 && ( safe_handle_index < file_io_handle_pool->maximum_number_of_handles )
+	 && ( file_io_handle_pool->clone_failed == 0 ) )
+	{
+		/* A file IO handle that cannot be cloned or opened is not considered an error,
+		 * the readers then share the file IO handle of the file
+		 */
+		result = libbfio_handle_clone(
+		          &cloned_file_io_handle,
+		          file_io_handle_pool->handles[ 0 ],
+		          NULL );
+
+		if( result == 1 )
+		{
+			result = libbfio_handle_is_open(
+			          cloned_file_io_handle,
+			          NULL );
+
+			if( result == 0 )
+			{
+				result = libbfio_handle_open(
+				          cloned_file_io_handle,
+				          LIBBFIO_OPEN_READ,
+				          NULL );
+			}
+		}
+		if( result == 1 )
+		{
+			file_io_handle_pool->handles[ safe_handle_index ] = cloned_file_io_handle;
+
+			file_io_handle_pool->number_of_handles += 1;
+		}
+		else
+		{
+			if( cloned_file_io_handle != NULL )
+			{
+				libbfio_handle_free(
+				 &cloned_file_io_handle,
+				 NULL );
+			}
+			file_io_handle_pool->clone_failed = 1;
+		}
+	}
+	if( safe_handle_index < file_io_handle_pool->number_of_handles )
+	{
+		file_io_handle_pool->handles_in_use[ safe_handle_index ] = 1;
+
+		*file_io_handle = file_io_handle_pool->handles[ safe_handle_index ];
+		*handle_index   = safe_handle_index;
+	}
+	else
+	{
+		*file_io_handle = file_io_handle_pool->handles[ 0 ];
+		*handle_index   = -1;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_io_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Releases a file IO handle grabbed by libmsiecf_file_io_handle_pool_grab_handle
+ * A handle index of -1 represents the shared file IO handle of the file
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_io_handle_pool_release_handle(
+     libmsiecf_file_io_handle_pool_t *file_io_handle_pool,
+     int handle_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_file_io_handle_pool_release_handle";
+
+	if( file_io_handle_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( handle_index < -1 )
+	 || ( handle_index >= LIBMSIECF_MAXIMUM_NUMBER_OF_FILE_IO_HANDLES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid handle index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( handle_index == -1 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     file_io_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	file_io_handle_pool->handles_in_use[ handle_index ] = 0;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     file_io_handle_pool->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,119 @@
+/*
+ * File IO handle pool functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMSIECF_FILE_IO_HANDLE_POOL_H )
+#define _LIBMSIECF_FILE_IO_HANDLE_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmsiecf_definitions.h"
+#include "libmsiecf_libbfio.h"
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmsiecf_file_io_handle_pool libmsiecf_file_io_handle_pool_t;
+
+struct libmsiecf_file_io_handle_pool
+{
+	/* The file IO handles
+	 * the first file IO handle is the file IO handle of the file
+	 * the other file IO handles are cloned from it
+	 */
+	libbfio_handle_t *handles[ LIBMSIECF_MAXIMUM_NUMBER_OF_FILE_IO_HANDLES ];
+
+	/* Values to indicate the file IO handles are in use
+	 */
+	uint8_t handles_in_use[ LIBMSIECF_MAXIMUM_NUMBER_OF_FILE_IO_HANDLES ];
+
+	/* The number of file IO handles
+	 */
+	int number_of_handles;
+
+	/* The maximum number of file IO handles
+	 */
+	int maximum_number_of_handles;
+
+	/* Value to indicate cloning the file IO handle failed
+	 */
+	uint8_t clone_failed;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libmsiecf_file_io_handle_pool_initialize(
+     libmsiecf_file_io_handle_pool_t **file_io_handle_pool,
+     int maximum_number_of_handles,
+     libcerror_error_t **error );
+
+int libmsiecf_file_io_handle_pool_free(
+     libmsiecf_file_io_handle_pool_t **file_io_handle_pool,
+     libcerror_error_t **error );
+
+int libmsiecf_file_io_handle_pool_free_cloned_handles(
+     libmsiecf_file_io_handle_pool_t *file_io_handle_pool,
+     int first_handle_index,
+     libcerror_error_t **error );
+
+int libmsiecf_file_io_handle_pool_empty(
+     libmsiecf_file_io_handle_pool_t *file_io_handle_pool,
+     libcerror_error_t **error );
+
+int libmsiecf_file_io_handle_pool_set_file_io_handle(
+     libmsiecf_file_io_handle_pool_t *file_io_handle_pool,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libmsiecf_file_io_handle_pool_get_maximum_number_of_handles(
+     libmsiecf_file_io_handle_pool_t *file_io_handle_pool,
+     int *maximum_number_of_handles,
+     libcerror_error_t **error );
+
+int libmsiecf_file_io_handle_pool_set_maximum_number_of_handles(
+     libmsiecf_file_io_handle_pool_t *file_io_handle_pool,
+     int maximum_number_of_handles,
+     libcerror_error_t **error );
+
+int libmsiecf_file_io_handle_pool_grab_handle(
+     libmsiecf_file_io_handle_pool_t *file_io_handle_pool,
+     libbfio_handle_t **file_io_handle,
+     int *handle_index,
+     libcerror_error_t **error );
+
+int libmsiecf_file_io_handle_pool_release_handle(
+     libmsiecf_file_io_handle_pool_t *file_io_handle_pool,
+     int handle_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMSIECF_FILE_IO_HANDLE_POOL_H ) */
+
@@ -0,0 +1,440 @@
+/*
+ * Hash map functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmsiecf_definitions.h"
+#include "libmsiecf_hash_map.h"
+#include "libmsiecf_libcerror.h"
+
+/* Creates a hash map
+ * Make sure the value hash_map is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_hash_map_initialize(
+     libmsiecf_hash_map_t **hash_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_hash_map_initialize";
+
+	if( hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_map != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash map value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*hash_map = memory_allocate_structure(
+	             libmsiecf_hash_map_t );
+
+	if( *hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash map.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *hash_map,
+	     0,
+	     sizeof( libmsiecf_hash_map_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash map.",
+		 function );
+
+		memory_free(
+		 *hash_map );
+
+		*hash_map = NULL;
+
+		return( -1 );
+	}
+	if( libmsiecf_hash_map_resize(
+	     *hash_map,
+	     LIBMSIECF_HASH_MAP_MINIMUM_NUMBER_OF_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize hash map.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *hash_map != NULL )
+	{
+		memory_free(
+		 *hash_map );
+
+		*hash_map = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a hash map
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_hash_map_free(
+     libmsiecf_hash_map_t **hash_map,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_hash_map_free";
+
+	if( hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_map != NULL )
+	{
+		if( ( *hash_map )->buckets != NULL )
+		{
+			memory_free(
+			 ( *hash_map )->buckets );
+		}
+		memory_free(
+		 *hash_map );
+
+		*hash_map = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the hash map
+ * The number of buckets must be a power of 2 and large enough to contain the current entries
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_hash_map_resize(
+     libmsiecf_hash_map_t *hash_map,
+     uint32_t number_of_buckets,
+     libcerror_error_t **error )
+{
+	uint32_t *buckets         = NULL;
+	static char *function     = "libmsiecf_hash_map_resize";
+	size_t buckets_size       = 0;
+	uint32_t bucket_index     = 0;
+	uint32_t bucket_mask      = 0;
+	uint32_t hash_value       = 0;
+	uint32_t old_bucket_index = 0;
+	uint32_t record_offset    = 0;
+
+	if( hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets < LIBMSIECF_HASH_MAP_MINIMUM_NUMBER_OF_BUCKETS )
+	 || ( number_of_buckets > LIBMSIECF_HASH_MAP_MAXIMUM_NUMBER_OF_BUCKETS )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 )
+	 || ( number_of_buckets <= hash_map->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets_size = sizeof( uint32_t ) * 2 * (size_t) number_of_buckets;
+
+	buckets = (uint32_t *) memory_allocate(
+	                        buckets_size );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buckets,
+	     0,
+	     buckets_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		memory_free(
+		 buckets );
+
+		return( -1 );
+	}
+	bucket_mask = number_of_buckets - 1;
+
+	if( hash_map->buckets != NULL )
+	{
+		for( old_bucket_index = 0;
+		     old_bucket_index < hash_map->number_of_buckets;
+		     old_bucket_index++ )
+		{
+			hash_value    = hash_map->buckets[ 2 * old_bucket_index ];
+			record_offset = hash_map->buckets[ ( 2 * old_bucket_index ) + 1 ];
+
+			if( record_offset == 0 )
+			{
+				continue;
+			}
+			bucket_index = ( hash_value >> 6 ) & bucket_mask;
+
+			while( buckets[ ( 2 * bucket_index ) + 1 ] != 0 )
+			{
+				bucket_index = ( bucket_index + 1 ) & bucket_mask;
+			}
+			buckets[ 2 * bucket_index ]         = hash_value;
+			buckets[ ( 2 * bucket_index ) + 1 ] = record_offset;
+		}
+		memory_free(
+		 hash_map->buckets );
+	}
+	hash_map->buckets           = buckets;
+	hash_map->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Inserts a hash value and record offset pair into the hash map
+ * The hash value is the value stored in the hash table entry, the lower 6 bits are ignored
+ * A pair that is already stored in the hash map is not inserted a second time
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_hash_map_insert(
+     libmsiecf_hash_map_t *hash_map,
+     uint32_t hash_value,
+     uint32_t record_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_hash_map_insert";
+	uint32_t bucket_index = 0;
+	uint32_t bucket_mask  = 0;
+
+	if( hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_map->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hash map - missing buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_offset == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid record offset value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	hash_value &= 0xffffffc0UL;
+
+	/* Keep the load factor at or below 0.5 so the probe sequences stay short
+	 */
+	if( ( 2 * ( hash_map->number_of_entries + 1 ) ) > hash_map->number_of_buckets )
+	{
+		if( libmsiecf_hash_map_resize(
+		     hash_map,
+		     hash_map->number_of_buckets * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize hash map.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	bucket_mask  = hash_map->number_of_buckets - 1;
+	bucket_index = ( hash_value >> 6 ) & bucket_mask;
+
+	while( hash_map->buckets[ ( 2 * bucket_index ) + 1 ] != 0 )
+	{
+		if( ( hash_map->buckets[ 2 * bucket_index ] == hash_value )
+		 && ( hash_map->buckets[ ( 2 * bucket_index ) + 1 ] == record_offset ) )
+		{
+			return( 1 );
+		}
+		bucket_index = ( bucket_index + 1 ) & bucket_mask;
+	}
+	hash_map->buckets[ 2 * bucket_index ]         = hash_value;
+	hash_map->buckets[ ( 2 * bucket_index ) + 1 ] = record_offset;
+
+	hash_map->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the next record offset of a specific hash value
+ * The probe index should be set to 0 for the first call and is updated
+ * so that successive calls return the remaining record offsets of the hash value
+ * Returns 1 if successful, 0 if no such record offset or -1 on error
+ */
+int libmsiecf_hash_map_get_record_offset(
+     libmsiecf_hash_map_t *hash_map,
+     uint32_t hash_value,
+     uint32_t *probe_index,
+     uint32_t *record_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_hash_map_get_record_offset";
+	uint32_t bucket_index = 0;
+	uint32_t bucket_mask  = 0;
+
+	if( hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_map->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hash map - missing buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( probe_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid probe index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record offset.",
+		 function );
+
+		return( -1 );
+	}
+	hash_value &= 0xffffffc0UL;
+
+	bucket_mask = hash_map->number_of_buckets - 1;
+
+	while( *probe_index < hash_map->number_of_buckets )
+	{
+		bucket_index = ( ( hash_value >> 6 ) + *probe_index ) & bucket_mask;
+
+		*probe_index += 1;
+
+		if( hash_map->buckets[ ( 2 * bucket_index ) + 1 ] == 0 )
+		{
+			break;
+		}
+		if( hash_map->buckets[ 2 * bucket_index ] == hash_value )
+		{
+			*record_offset = hash_map->buckets[ ( 2 * bucket_index ) + 1 ];
+
+			return( 1 );
+		}
+	}
+	*probe_index = hash_map->number_of_buckets;
+
+	return( 0 );
+}
+
@@ -0,0 +1,83 @@
+/*
+ * Hash map functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMSIECF_HASH_MAP_H )
+#define _LIBMSIECF_HASH_MAP_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmsiecf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmsiecf_hash_map libmsiecf_hash_map_t;
+
+struct libmsiecf_hash_map
+{
+	/* The buckets, where every bucket consists of
+	 * a 32-bit hash value and a 32-bit record offset
+	 */
+	uint32_t *buckets;
+
+	/* The number of buckets
+	 */
+	uint32_t number_of_buckets;
+
+	/* The number of entries
+	 */
+	uint32_t number_of_entries;
+};
+
+int libmsiecf_hash_map_initialize(
+     libmsiecf_hash_map_t **hash_map,
+     libcerror_error_t **error );
+
+int libmsiecf_hash_map_free(
+     libmsiecf_hash_map_t **hash_map,
+     libcerror_error_t **error );
+
+int libmsiecf_hash_map_resize(
+     libmsiecf_hash_map_t *hash_map,
+     uint32_t number_of_buckets,
+     libcerror_error_t **error );
+
+int libmsiecf_hash_map_insert(
+     libmsiecf_hash_map_t *hash_map,
+     uint32_t hash_value,
+     uint32_t record_offset,
+     libcerror_error_t **error );
+
+int libmsiecf_hash_map_get_record_offset(
+     libmsiecf_hash_map_t *hash_map,
+     uint32_t hash_value,
+     uint32_t *probe_index,
+     uint32_t *record_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMSIECF_HASH_MAP_H ) */
+
@@ -25,6 +25,7 @@
 #include <types.h>
 
 #include "libmsiecf_definitions.h"
+#include "libmsiecf_hash_map.h"
 #include "libmsiecf_hash_table.h"
 #include "libmsiecf_item_descriptor.h"
 #include "libmsiecf_libbfio.h"
@@ -35,40 +36,39 @@
 #include "msiecf_hash_record.h"
 
 /* Reads a hash table
+ * The data must contain at least the HASH record, trailing data is ignored
  * Returns 1 if successful or -1 on error
  */
-int libmsiecf_hash_table_read_file_io_handle(
-     libcdata_array_t *hash_table,
+int libmsiecf_hash_table_read_data(
+     libmsiecf_hash_map_t *hash_map,
      off64_t *next_hash_table_offset,
-     libbfio_handle_t *file_io_handle,
-     off64_t hash_table_offset,
+     const uint8_t *data,
+     size_t data_size,
      size32_t block_size,
      libcerror_error_t **error )
 {
-	msiecf_hash_record_header_t hash_record_header;
-
-	uint8_t *hash_record_data                    = NULL;
-	uint8_t *entry_data                          = NULL;
-	static char *function                        = "libmsiecf_hash_table_read_file_io_handle";
-	size_t read_size                             = 0;
-	size_t table_iterator                        = 0;
-	ssize_t read_count                           = 0;
-	uint32_t entry_hash                          = 0;
-	uint32_t entry_offset                        = 0;
-	uint32_t number_of_blocks                    = 0;
+	const msiecf_hash_record_header_t *hash_record_header = NULL;
+	const uint8_t *hash_record_data                       = NULL;
+	const uint8_t *entry_data                             = NULL;
+	static char *function                                 = "libmsiecf_hash_table_read_data";
+	size_t hash_record_data_size                          = 0;
+	size_t table_iterator                                 = 0;
+	uint32_t entry_hash                                   = 0;
+	uint32_t entry_offset                                 = 0;
+	uint32_t number_of_blocks                             = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint32_t value_32bit                         = 0;
-	int number_of_items                          = 0;
+	uint32_t value_32bit                                  = 0;
+	int number_of_items                                   = 0;
 #endif
 
-	if( hash_table == NULL )
+	if( hash_map == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hash table.",
+		 "%s: invalid hash map.",
 		 function );
 
 		return( -1 );
@@ -84,58 +84,42 @@ int libmsiecf_hash_table_read_file_io_handle(
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
-	if( block_size == 0 )
+	if( ( data_size < sizeof( msiecf_hash_record_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
-		 "%s: invalid block size value zero or less.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading HASH record at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 hash_table_offset,
-		 hash_table_offset );
-	}
-#endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              (uint8_t *) &hash_record_header,
-	              sizeof( msiecf_hash_record_header_t ),
-	              hash_table_offset,
-	              error );
-
-	if( read_count != (ssize_t) sizeof( msiecf_hash_record_header_t ) )
+	if( block_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read HASH record header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 hash_table_offset,
-		 hash_table_offset );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid block size value zero or less.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
+	hash_record_header = (const msiecf_hash_record_header_t *) data;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -143,13 +127,13 @@ int libmsiecf_hash_table_read_file_io_handle(
 		 "%s: HASH record header:\n",
 		 function );
 		libcnotify_print_data(
-		 (uint8_t *) &hash_record_header,
+		 data,
 		 sizeof( msiecf_hash_record_header_t ),
 		 0 );
 	}
 #endif
 	if( memory_compare(
-	     hash_record_header.signature,
+	     hash_record_header->signature,
 	     "HASH",
 	     4 ) != 0 )
 	{
@@ -160,14 +144,14 @@ int libmsiecf_hash_table_read_file_io_handle(
 		 "%s: unsupported signature.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	byte_stream_copy_to_uint32_little_endian(
-	 hash_record_header.number_of_blocks,
+	 hash_record_header->number_of_blocks,
 	 number_of_blocks );
 
 	byte_stream_copy_to_uint32_little_endian(
-	 hash_record_header.next_offset,
+	 hash_record_header->next_offset,
 	 *next_hash_table_offset );
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -176,10 +160,10 @@ int libmsiecf_hash_table_read_file_io_handle(
 		libcnotify_printf(
 		 "%s: signature\t\t\t\t\t: %c%c%c%c\n",
 		 function,
-		 hash_record_header.signature[ 0 ],
-		 hash_record_header.signature[ 1 ],
-		 hash_record_header.signature[ 2 ],
-		 hash_record_header.signature[ 3 ] );
+		 hash_record_header->signature[ 0 ],
+		 hash_record_header->signature[ 1 ],
+		 hash_record_header->signature[ 2 ],
+		 hash_record_header->signature[ 3 ] );
 
 		libcnotify_printf(
 		 "%s: number of blocks\t\t\t\t: %" PRIu32 "\n",
@@ -193,7 +177,7 @@ int libmsiecf_hash_table_read_file_io_handle(
 		 *next_hash_table_offset );
 
 		byte_stream_copy_to_uint32_little_endian(
-		 hash_record_header.sequence_number,
+		 hash_record_header->sequence_number,
 		 value_32bit );
 		libcnotify_printf(
 		 "%s: sequence number\t\t\t\t: %" PRIu32 "\n",
@@ -205,9 +189,9 @@ int libmsiecf_hash_table_read_file_io_handle(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	read_size = ( number_of_blocks * block_size ) - sizeof( msiecf_hash_record_header_t );
+	hash_record_data_size = ( number_of_blocks * block_size ) - sizeof( msiecf_hash_record_header_t );
 
-	if( read_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	if( hash_record_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 	{
 		libcerror_error_set(
 		 error,
@@ -216,10 +200,10 @@ int libmsiecf_hash_table_read_file_io_handle(
 		 "%s: invalid HASH record data size value exceeds maximum allocation size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( read_size == 0 )
-	 || ( ( read_size % 8 ) != 0 ) )
+	if( ( hash_record_data_size == 0 )
+	 || ( ( hash_record_data_size % 8 ) != 0 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -228,39 +212,21 @@ int libmsiecf_hash_table_read_file_io_handle(
 		 "%s: unsupported HASH record data size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	hash_record_data = (uint8_t *) memory_allocate(
-	                                read_size );
-
-	if( hash_record_data == NULL )
+	if( hash_record_data_size > ( data_size - sizeof( msiecf_hash_record_header_t ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create HASH record data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              hash_record_data,
-	              read_size,
-	              error );
+	hash_record_data = &( data[ sizeof( msiecf_hash_record_header_t ) ] );
 
-	if( read_count != (ssize_t) read_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read HASH record data.",
-		 function );
-
-		goto on_error;
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -269,16 +235,16 @@ int libmsiecf_hash_table_read_file_io_handle(
 		 function );
 		libcnotify_print_data(
 		 hash_record_data,
-		 read_size,
+		 hash_record_data_size,
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
-	read_size /= 8;
+	hash_record_data_size /= 8;
 
 	entry_data = hash_record_data;
 
 	for( table_iterator = 0;
-	     table_iterator < read_size;
+	     table_iterator < hash_record_data_size;
 	     table_iterator++ )
 	{
 		byte_stream_copy_to_uint32_little_endian(
@@ -330,22 +296,31 @@ int libmsiecf_hash_table_read_file_io_handle(
 		}
 		/* Check if the entry record offset is block aligned
 		 */
-		if( ( entry_offset % block_size ) != 0 )
+		if( ( entry_offset == 0 )
+		 || ( ( entry_offset % block_size ) != 0 ) )
 		{
 			continue;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		number_of_items++;
 #endif
-		/* TODO flag hashed items
-		 */
+		if( libmsiecf_hash_map_insert(
+		     hash_map,
+		     entry_hash,
+		     entry_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert entry: %" PRIzd " into hash map.",
+			 function,
+			 (ssize_t) table_iterator );
 
+			return( -1 );
+		}
 	}
-	memory_free(
-	 hash_record_data );
-
-	hash_record_data = NULL;
-
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -358,6 +333,185 @@ int libmsiecf_hash_table_read_file_io_handle(
 	}
 #endif
 	return( 1 );
+}
+
+/* Reads a hash table
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_hash_table_read_file_io_handle(
+     libmsiecf_hash_map_t *hash_map,
+     off64_t *next_hash_table_offset,
+     libbfio_handle_t *file_io_handle,
+     off64_t hash_table_offset,
+     size32_t block_size,
+     libcerror_error_t **error )
+{
+	msiecf_hash_record_header_t hash_record_header;
+
+	uint8_t *hash_record_data = NULL;
+	static char *function     = "libmsiecf_hash_table_read_file_io_handle";
+	size_t read_size          = 0;
+	ssize_t read_count        = 0;
+	uint32_t number_of_blocks = 0;
+
+	if( hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( next_hash_table_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid next hash table offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid block size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: reading HASH record at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+		 function,
+		 hash_table_offset,
+		 hash_table_offset );
+	}
+#endif
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              (uint8_t *) &hash_record_header,
+	              sizeof( msiecf_hash_record_header_t ),
+	              hash_table_offset,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( msiecf_hash_record_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read HASH record header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 hash_table_offset,
+		 hash_table_offset );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 hash_record_header.number_of_blocks,
+	 number_of_blocks );
+
+	read_size = number_of_blocks * block_size;
+
+	if( ( read_size <= sizeof( msiecf_hash_record_header_t ) )
+	 || ( read_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid HASH record size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	hash_record_data = (uint8_t *) memory_allocate(
+	                                read_size );
+
+	if( hash_record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create HASH record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     hash_record_data,
+	     &hash_record_header,
+	     sizeof( msiecf_hash_record_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy HASH record header.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              &( hash_record_data[ sizeof( msiecf_hash_record_header_t ) ] ),
+	              read_size - sizeof( msiecf_hash_record_header_t ),
+	              error );
+
+	if( read_count != (ssize_t) ( read_size - sizeof( msiecf_hash_record_header_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read HASH record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_hash_table_read_data(
+	     hash_map,
+	     next_hash_table_offset,
+	     hash_record_data,
+	     read_size,
+	     block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read HASH record.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 hash_record_data );
+
+	return( 1 );
 
 on_error:
 	if( hash_record_data != NULL )
@@ -367,4 +521,3 @@ on_error:
 	}
 	return( -1 );
 }
-
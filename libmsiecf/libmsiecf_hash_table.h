@@ -25,16 +25,24 @@
 #include <common.h>
 #include <types.h>
 
+#include "libmsiecf_hash_map.h"
 #include "libmsiecf_libbfio.h"
-#include "libmsiecf_libcdata.h"
 #include "libmsiecf_libcerror.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+int libmsiecf_hash_table_read_data(
+     libmsiecf_hash_map_t *hash_map,
+     off64_t *next_hash_table_offset,
+     const uint8_t *data,
+     size_t data_size,
+     size32_t block_size,
+     libcerror_error_t **error );
+
 int libmsiecf_hash_table_read_file_io_handle(
-     libcdata_array_t *hash_table,
+     libmsiecf_hash_map_t *hash_map,
      off64_t *next_hash_table_offset,
      libbfio_handle_t *file_io_handle,
      off64_t hash_table_offset,
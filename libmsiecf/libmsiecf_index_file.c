@@ -0,0 +1,1172 @@
+/*
+ * Index file functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmsiecf_definitions.h"
+#include "libmsiecf_file_header.h"
+#include "libmsiecf_hash_map.h"
+#include "libmsiecf_index_file.h"
+#include "libmsiecf_item_descriptor.h"
+#include "libmsiecf_item_descriptor_arena.h"
+#include "libmsiecf_libbfio.h"
+#include "libmsiecf_libcdata.h"
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_libcnotify.h"
+
+#include "msiecf_index_file.h"
+
+const char *msiecf_index_file_signature = "MSIECFIX";
+
+/* Calculates an Adler-32 checksum of the data
+ * Returns the checksum
+ */
+static uint32_t libmsiecf_index_file_calculate_adler32(
+                 const uint8_t *data,
+                 size_t data_size,
+                 uint32_t initial_value )
+{
+	size_t block_size = 0;
+	uint32_t lower_word = initial_value & 0x0000ffffUL;
+	uint32_t upper_word = ( initial_value >> 16 ) & 0x0000ffffUL;
+
+	while( data_size > 0 )
+	{
+		/* 5552 is the largest number of bytes that can be added
+		 * before the upper word needs to be reduced to prevent an overflow
+		 */
+		block_size = data_size;
+
+		if( block_size > 5552 )
+		{
+			block_size = 5552;
+		}
+		data_size -= block_size;
+
+		while( block_size > 0 )
+		{
+			lower_word += *data;
+			upper_word += lower_word;
+
+			data++;
+			block_size--;
+		}
+		lower_word %= 65521;
+		upper_word %= 65521;
+	}
+	return( ( upper_word << 16 ) | lower_word );
+}
+
+/* Creates an index file
+ * Make sure the value index_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_index_file_initialize(
+     libmsiecf_index_file_t **index_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_index_file_initialize";
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*index_file = memory_allocate_structure(
+	               libmsiecf_index_file_t );
+
+	if( *index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *index_file,
+	     0,
+	     sizeof( libmsiecf_index_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *index_file != NULL )
+	{
+		memory_free(
+		 *index_file );
+
+		*index_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an index file
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_index_file_free(
+     libmsiecf_index_file_t **index_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_index_file_free";
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_file != NULL )
+	{
+		memory_free(
+		 *index_file );
+
+		*index_file = NULL;
+	}
+	return( 1 );
+}
+
+/* Updates the key checksum with the data of the file at a specific offset
+ * The data is read in chunks of LIBMSIECF_INDEX_FILE_KEY_DATA_SIZE bytes
+ * Returns 1 if successful or -1 on error
+ */
+static int libmsiecf_index_file_update_key_checksum(
+            libmsiecf_index_file_t *index_file,
+            libbfio_handle_t *file_io_handle,
+            off64_t file_offset,
+            size64_t data_size,
+            libcerror_error_t **error )
+{
+	uint8_t *key_data     = NULL;
+	static char *function = "libmsiecf_index_file_update_key_checksum";
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	key_data = (uint8_t *) memory_allocate(
+	                        sizeof( uint8_t ) * LIBMSIECF_INDEX_FILE_KEY_DATA_SIZE );
+
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key data.",
+		 function );
+
+		goto on_error;
+	}
+	while( data_size > 0 )
+	{
+		read_size = LIBMSIECF_INDEX_FILE_KEY_DATA_SIZE;
+
+		if( (size64_t) read_size > data_size )
+		{
+			read_size = (size_t) data_size;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              key_data,
+		              read_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read key data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		index_file->key_checksum = libmsiecf_index_file_calculate_adler32(
+		                            key_data,
+		                            read_size,
+		                            index_file->key_checksum );
+
+		file_offset += (off64_t) read_size;
+		data_size   -= (size64_t) read_size;
+	}
+	memory_free(
+	 key_data );
+
+	return( 1 );
+
+on_error:
+	if( key_data != NULL )
+	{
+		memory_free(
+		 key_data );
+	}
+	return( -1 );
+}
+
+/* Sets the values that identify the file the index file belongs to
+ * These consist of the file size, the file header values and a checksum of the entire file.
+ *
+ * Since every byte of the file is covered by the key, an index file is detected as stale
+ * when any data of the file is modified, including the data of records in the middle
+ * of the file that does not change the allocation and hash tables.
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_index_file_set_key(
+     libmsiecf_index_file_t *index_file,
+     libmsiecf_file_header_t *file_header,
+     uint16_t block_size,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_index_file_set_key";
+	size64_t file_size    = 0;
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	index_file->key_checksum = libmsiecf_index_file_calculate_adler32(
+	                            NULL,
+	                            0,
+	                            1 );
+
+	if( file_size > 0 )
+	{
+		if( libmsiecf_index_file_update_key_checksum(
+		     index_file,
+		     file_io_handle,
+		     0,
+		     file_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update key checksum with file data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	index_file->file_size                  = file_size;
+	index_file->hash_table_offset          = file_header->hash_table_offset;
+	index_file->number_of_blocks           = file_header->number_of_blocks;
+	index_file->number_of_allocated_blocks = file_header->number_of_allocated_blocks;
+	index_file->block_size                 = block_size;
+	index_file->major_version              = file_header->major_version;
+	index_file->minor_version              = file_header->minor_version;
+
+	return( 1 );
+}
+
+/* Appends item descriptors read from index file data to an array
+ * Returns 1 if successful or -1 on error
+ */
+static int libmsiecf_index_file_append_item_descriptors(
+            const uint8_t *data,
+            uint32_t number_of_item_descriptors,
+            libcdata_array_t *item_array,
+            libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+            libcerror_error_t **error )
+{
+	const msiecf_index_file_item_descriptor_t *index_item_descriptor = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor                     = NULL;
+	static char *function                                            = "libmsiecf_index_file_append_item_descriptors";
+	uint64_t value_64bit                                             = 0;
+	uint32_t item_descriptor_index                                   = 0;
+	int entry_index                                                  = 0;
+
+	for( item_descriptor_index = 0;
+	     item_descriptor_index < number_of_item_descriptors;
+	     item_descriptor_index++ )
+	{
+		index_item_descriptor = (msiecf_index_file_item_descriptor_t *) &( data[ item_descriptor_index * sizeof( msiecf_index_file_item_descriptor_t ) ] );
+
+		if( libmsiecf_item_descriptor_arena_allocate(
+		     item_descriptor_arena,
+		     &item_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create item descriptor: %" PRIu32 ".",
+			 function,
+			 item_descriptor_index );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 index_item_descriptor->file_offset,
+		 value_64bit );
+
+		item_descriptor->file_offset = (off64_t) value_64bit;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 index_item_descriptor->record_size,
+		 item_descriptor->record_size );
+
+		item_descriptor->type  = index_item_descriptor->type;
+		item_descriptor->flags = index_item_descriptor->flags;
+
+		if( libcdata_array_append_entry(
+		     item_array,
+		     &entry_index,
+		     (intptr_t *) item_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append item descriptor: %" PRIu32 " to array.",
+			 function,
+			 item_descriptor_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads an index file
+ * The item descriptors and hash map are only filled if the index file
+ * is valid and matches the key values of the index file
+ * Returns 1 if successful, 0 if the index file is missing, stale or invalid or -1 on error
+ */
+int libmsiecf_index_file_read_file_io_handle(
+     libmsiecf_index_file_t *index_file,
+     libbfio_handle_t *index_file_io_handle,
+     libcdata_array_t *item_array,
+     libcdata_array_t *recovered_item_array,
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     libmsiecf_hash_map_t *hash_map,
+     libcerror_error_t **error )
+{
+	uint8_t header_data[ sizeof( msiecf_index_file_header_t ) ];
+
+	const msiecf_index_file_header_t *header                         = NULL;
+	const msiecf_index_file_item_descriptor_t *index_item_descriptor = NULL;
+	uint8_t *index_data                                              = NULL;
+	static char *function                                            = "libmsiecf_index_file_read_file_io_handle";
+	size64_t index_file_size                                         = 0;
+	size64_t data_size                                               = 0;
+	ssize_t read_count                                               = 0;
+	uint64_t value_64bit                                             = 0;
+	uint32_t bucket_index                                            = 0;
+	uint32_t data_checksum                                           = 0;
+	uint32_t item_descriptor_index                                   = 0;
+	uint32_t number_of_hash_map_buckets                              = 0;
+	uint32_t number_of_hash_map_entries                              = 0;
+	uint32_t number_of_items                                         = 0;
+	uint32_t number_of_recovered_items                               = 0;
+	uint32_t value_32bit                                             = 0;
+	uint16_t value_16bit                                             = 0;
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item array.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_item_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered item array.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_map->number_of_entries != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash map - entries already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     index_file_io_handle,
+	     &index_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( index_file_size < (size64_t) sizeof( msiecf_index_file_header_t ) )
+	{
+		return( 0 );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              index_file_io_handle,
+	              header_data,
+	              sizeof( msiecf_index_file_header_t ),
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) sizeof( msiecf_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file header at offset: 0 (0x00000000).",
+		 function );
+
+		goto on_error;
+	}
+	header = (msiecf_index_file_header_t *) header_data;
+
+	if( memory_compare(
+	     header->signature,
+	     msiecf_index_file_signature,
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->format_version,
+	 value_32bit );
+
+	if( value_32bit != LIBMSIECF_INDEX_FILE_FORMAT_VERSION )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->key_checksum,
+	 value_32bit );
+
+	if( value_32bit != index_file->key_checksum )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 header->file_size,
+	 value_64bit );
+
+	if( value_64bit != (uint64_t) index_file->file_size )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->hash_table_offset,
+	 value_32bit );
+
+	if( value_32bit != index_file->hash_table_offset )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->number_of_blocks,
+	 value_32bit );
+
+	if( value_32bit != index_file->number_of_blocks )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->number_of_allocated_blocks,
+	 value_32bit );
+
+	if( value_32bit != index_file->number_of_allocated_blocks )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 header->block_size,
+	 value_16bit );
+
+	if( ( value_16bit != index_file->block_size )
+	 || ( header->major_version != index_file->major_version )
+	 || ( header->minor_version != index_file->minor_version ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->number_of_items,
+	 number_of_items );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 header->number_of_recovered_items,
+	 number_of_recovered_items );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 header->number_of_hash_map_buckets,
+	 number_of_hash_map_buckets );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 header->number_of_hash_map_entries,
+	 number_of_hash_map_entries );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 header->data_checksum,
+	 data_checksum );
+
+	if( ( number_of_items > (uint32_t) INT_MAX )
+	 || ( number_of_recovered_items > (uint32_t) INT_MAX ) )
+	{
+		return( 0 );
+	}
+	if( ( number_of_hash_map_buckets < LIBMSIECF_HASH_MAP_MINIMUM_NUMBER_OF_BUCKETS )
+	 || ( number_of_hash_map_buckets > LIBMSIECF_HASH_MAP_MAXIMUM_NUMBER_OF_BUCKETS )
+	 || ( ( number_of_hash_map_buckets & ( number_of_hash_map_buckets - 1 ) ) != 0 )
+	 || ( number_of_hash_map_entries >= number_of_hash_map_buckets ) )
+	{
+		return( 0 );
+	}
+	data_size = ( ( (size64_t) number_of_items + number_of_recovered_items ) * sizeof( msiecf_index_file_item_descriptor_t ) )
+	          + ( (size64_t) number_of_hash_map_buckets * sizeof( msiecf_index_file_hash_map_bucket_t ) );
+
+	if( ( data_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( index_file_size != ( sizeof( msiecf_index_file_header_t ) + data_size ) ) )
+	{
+		return( 0 );
+	}
+	index_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * (size_t) data_size );
+
+	if( index_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              index_file_io_handle,
+	              index_data,
+	              (size_t) data_size,
+	              (off64_t) sizeof( msiecf_index_file_header_t ),
+	              error );
+
+	if( read_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_index_file_calculate_adler32(
+	     index_data,
+	     (size_t) data_size,
+	     1 ) != data_checksum )
+	{
+		memory_free(
+		 index_data );
+
+		return( 0 );
+	}
+	/* Validate all the item descriptors before any of them are appended
+	 */
+	for( item_descriptor_index = 0;
+	     item_descriptor_index < ( number_of_items + number_of_recovered_items );
+	     item_descriptor_index++ )
+	{
+		index_item_descriptor = (msiecf_index_file_item_descriptor_t *) &( index_data[ item_descriptor_index * sizeof( msiecf_index_file_item_descriptor_t ) ] );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 index_item_descriptor->file_offset,
+		 value_64bit );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 index_item_descriptor->record_size,
+		 value_32bit );
+
+		if( ( index_item_descriptor->type == LIBMSIECF_ITEM_TYPE_UNDEFINED )
+		 || ( index_item_descriptor->type > LIBMSIECF_ITEM_TYPE_UNKNOWN )
+		 || ( value_64bit >= (uint64_t) index_file->file_size )
+		 || ( value_32bit == 0 ) )
+		{
+			memory_free(
+			 index_data );
+
+			return( 0 );
+		}
+	}
+	if( libmsiecf_index_file_append_item_descriptors(
+	     index_data,
+	     number_of_items,
+	     item_array,
+	     item_descriptor_arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append item descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_index_file_append_item_descriptors(
+	     &( index_data[ number_of_items * sizeof( msiecf_index_file_item_descriptor_t ) ] ),
+	     number_of_recovered_items,
+	     recovered_item_array,
+	     item_descriptor_arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append recovered item descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_hash_map_buckets != hash_map->number_of_buckets )
+	{
+		if( libmsiecf_hash_map_resize(
+		     hash_map,
+		     number_of_hash_map_buckets,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize hash map.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	value_64bit = ( (uint64_t) number_of_items + number_of_recovered_items ) * sizeof( msiecf_index_file_item_descriptor_t );
+
+	for( bucket_index = 0;
+	     bucket_index < number_of_hash_map_buckets;
+	     bucket_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( index_data[ value_64bit ] ),
+		 hash_map->buckets[ 2 * bucket_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( index_data[ value_64bit + 4 ] ),
+		 hash_map->buckets[ ( 2 * bucket_index ) + 1 ] );
+
+		value_64bit += sizeof( msiecf_index_file_hash_map_bucket_t );
+	}
+	hash_map->number_of_entries = number_of_hash_map_entries;
+
+	memory_free(
+	 index_data );
+
+	return( 1 );
+
+on_error:
+	if( index_data != NULL )
+	{
+		memory_free(
+		 index_data );
+	}
+	return( -1 );
+}
+
+/* Copies the item descriptors of an array to index file data
+ * Returns 1 if successful or -1 on error
+ */
+static int libmsiecf_index_file_copy_item_descriptors(
+            libcdata_array_t *item_array,
+            int number_of_item_descriptors,
+            uint8_t *data,
+            libcerror_error_t **error )
+{
+	msiecf_index_file_item_descriptor_t *index_item_descriptor = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor               = NULL;
+	static char *function                                      = "libmsiecf_index_file_copy_item_descriptors";
+	int item_descriptor_index                                  = 0;
+
+	for( item_descriptor_index = 0;
+	     item_descriptor_index < number_of_item_descriptors;
+	     item_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     item_array,
+		     item_descriptor_index,
+		     (intptr_t **) &item_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item descriptor: %d.",
+			 function,
+			 item_descriptor_index );
+
+			return( -1 );
+		}
+		if( item_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing item descriptor: %d.",
+			 function,
+			 item_descriptor_index );
+
+			return( -1 );
+		}
+		index_item_descriptor = (msiecf_index_file_item_descriptor_t *) &( data[ (size_t) item_descriptor_index * sizeof( msiecf_index_file_item_descriptor_t ) ] );
+
+		byte_stream_copy_from_uint64_little_endian(
+		 index_item_descriptor->file_offset,
+		 (uint64_t) item_descriptor->file_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 index_item_descriptor->record_size,
+		 item_descriptor->record_size );
+
+		index_item_descriptor->type  = item_descriptor->type;
+		index_item_descriptor->flags = item_descriptor->flags;
+	}
+	return( 1 );
+}
+
+/* Writes an index file
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_index_file_write_file_io_handle(
+     libmsiecf_index_file_t *index_file,
+     libbfio_handle_t *index_file_io_handle,
+     libcdata_array_t *item_array,
+     libcdata_array_t *recovered_item_array,
+     libmsiecf_hash_map_t *hash_map,
+     libcerror_error_t **error )
+{
+	msiecf_index_file_header_t *header = NULL;
+	uint8_t *index_data                = NULL;
+	static char *function              = "libmsiecf_index_file_write_file_io_handle";
+	size_t data_offset                 = 0;
+	size_t data_size                   = 0;
+	size64_t index_data_size           = 0;
+	ssize_t write_count                = 0;
+	uint32_t bucket_index              = 0;
+	uint32_t data_checksum             = 0;
+	int number_of_items                = 0;
+	int number_of_recovered_items      = 0;
+
+	if( index_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_map == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash map.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     item_array,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_get_number_of_entries(
+	     recovered_item_array,
+	     &number_of_recovered_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered items.",
+		 function );
+
+		goto on_error;
+	}
+	index_data_size = sizeof( msiecf_index_file_header_t )
+	                + ( ( (size64_t) number_of_items + number_of_recovered_items ) * sizeof( msiecf_index_file_item_descriptor_t ) )
+	                + ( (size64_t) hash_map->number_of_buckets * sizeof( msiecf_index_file_hash_map_bucket_t ) );
+
+	if( index_data_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid index data size value exceeds maximum allocation size.",
+		 function );
+
+		goto on_error;
+	}
+	data_size = (size_t) index_data_size;
+
+	index_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * data_size );
+
+	if( index_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     index_data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index data.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset = sizeof( msiecf_index_file_header_t );
+
+	if( libmsiecf_index_file_copy_item_descriptors(
+	     item_array,
+	     number_of_items,
+	     &( index_data[ data_offset ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy item descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset += (size_t) number_of_items * sizeof( msiecf_index_file_item_descriptor_t );
+
+	if( libmsiecf_index_file_copy_item_descriptors(
+	     recovered_item_array,
+	     number_of_recovered_items,
+	     &( index_data[ data_offset ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy recovered item descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset += (size_t) number_of_recovered_items * sizeof( msiecf_index_file_item_descriptor_t );
+
+	for( bucket_index = 0;
+	     bucket_index < hash_map->number_of_buckets;
+	     bucket_index++ )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 &( index_data[ data_offset ] ),
+		 hash_map->buckets[ 2 * bucket_index ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( index_data[ data_offset + 4 ] ),
+		 hash_map->buckets[ ( 2 * bucket_index ) + 1 ] );
+
+		data_offset += sizeof( msiecf_index_file_hash_map_bucket_t );
+	}
+	data_checksum = libmsiecf_index_file_calculate_adler32(
+	                 &( index_data[ sizeof( msiecf_index_file_header_t ) ] ),
+	                 data_size - sizeof( msiecf_index_file_header_t ),
+	                 1 );
+
+	header = (msiecf_index_file_header_t *) index_data;
+
+	if( memory_copy(
+	     header->signature,
+	     msiecf_index_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 header->format_version,
+	 LIBMSIECF_INDEX_FILE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header->key_checksum,
+	 index_file->key_checksum );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 header->file_size,
+	 (uint64_t) index_file->file_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header->hash_table_offset,
+	 index_file->hash_table_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header->number_of_blocks,
+	 index_file->number_of_blocks );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header->number_of_allocated_blocks,
+	 index_file->number_of_allocated_blocks );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 header->block_size,
+	 index_file->block_size );
+
+	header->major_version = index_file->major_version;
+	header->minor_version = index_file->minor_version;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header->number_of_items,
+	 (uint32_t) number_of_items );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header->number_of_recovered_items,
+	 (uint32_t) number_of_recovered_items );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header->number_of_hash_map_buckets,
+	 hash_map->number_of_buckets );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header->number_of_hash_map_entries,
+	 hash_map->number_of_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header->data_checksum,
+	 data_checksum );
+
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               index_file_io_handle,
+	               index_data,
+	               data_size,
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 index_data );
+
+	return( 1 );
+
+on_error:
+	if( index_data != NULL )
+	{
+		memory_free(
+		 index_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,115 @@
+/*
+ * Index file functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMSIECF_INDEX_FILE_H )
+#define _LIBMSIECF_INDEX_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmsiecf_file_header.h"
+#include "libmsiecf_hash_map.h"
+#include "libmsiecf_item_descriptor_arena.h"
+#include "libmsiecf_libbfio.h"
+#include "libmsiecf_libcdata.h"
+#include "libmsiecf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const char *msiecf_index_file_signature;
+
+typedef struct libmsiecf_index_file libmsiecf_index_file_t;
+
+struct libmsiecf_index_file
+{
+	/* The checksum of the file data
+	 */
+	uint32_t key_checksum;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The hash table offset
+	 */
+	uint32_t hash_table_offset;
+
+	/* The number of blocks
+	 */
+	uint32_t number_of_blocks;
+
+	/* The number of allocated blocks
+	 */
+	uint32_t number_of_allocated_blocks;
+
+	/* The block size
+	 */
+	uint16_t block_size;
+
+	/* The major version
+	 */
+	uint8_t major_version;
+
+	/* The minor version
+	 */
+	uint8_t minor_version;
+};
+
+int libmsiecf_index_file_initialize(
+     libmsiecf_index_file_t **index_file,
+     libcerror_error_t **error );
+
+int libmsiecf_index_file_free(
+     libmsiecf_index_file_t **index_file,
+     libcerror_error_t **error );
+
+int libmsiecf_index_file_set_key(
+     libmsiecf_index_file_t *index_file,
+     libmsiecf_file_header_t *file_header,
+     uint16_t block_size,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libmsiecf_index_file_read_file_io_handle(
+     libmsiecf_index_file_t *index_file,
+     libbfio_handle_t *index_file_io_handle,
+     libcdata_array_t *item_array,
+     libcdata_array_t *recovered_item_array,
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     libmsiecf_hash_map_t *hash_map,
+     libcerror_error_t **error );
+
+int libmsiecf_index_file_write_file_io_handle(
+     libmsiecf_index_file_t *index_file,
+     libbfio_handle_t *index_file_io_handle,
+     libcdata_array_t *item_array,
+     libcdata_array_t *recovered_item_array,
+     libmsiecf_hash_map_t *hash_map,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMSIECF_INDEX_FILE_H ) */
+
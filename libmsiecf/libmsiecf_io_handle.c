@@ -24,9 +24,12 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libmsiecf_allocation_map.h"
+#include "libmsiecf_block_cache.h"
 #include "libmsiecf_codepage.h"
 #include "libmsiecf_debug.h"
 #include "libmsiecf_definitions.h"
+#include "libmsiecf_file_io_handle_pool.h"
 #include "libmsiecf_hash_table.h"
 #include "libmsiecf_io_handle.h"
 #include "libmsiecf_item_descriptor.h"
@@ -34,7 +37,10 @@
 #include "libmsiecf_libcdata.h"
 #include "libmsiecf_libcerror.h"
 #include "libmsiecf_libcnotify.h"
+#include "libmsiecf_libcthreads.h"
+#include "libmsiecf_record_scan_chunk.h"
 #include "libmsiecf_redirected_values.h"
+#include "libmsiecf_signature.h"
 #include "libmsiecf_url_values.h"
 
 #include "msiecf_record.h"
@@ -101,6 +107,22 @@ int libmsiecf_io_handle_initialize(
 
 		goto on_error;
 	}
+	/* The block cache is disabled by default
+	 */
+	if( libmsiecf_block_cache_initialize(
+	     &( ( *io_handle )->block_cache ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block cache.",
+		 function );
+
+		goto on_error;
+	}
 	( *io_handle )->block_size     = LIBMSIECF_DEFAULT_BLOCK_SIZE;
 	( *io_handle )->ascii_codepage = LIBMSIECF_CODEPAGE_WINDOWS_1252;
 
@@ -140,6 +162,24 @@ int libmsiecf_io_handle_free(
 	}
 	if( *io_handle != NULL )
 	{
+		if( ( *io_handle )->file_data != NULL )
+		{
+			memory_free(
+			 ( *io_handle )->file_data );
+		}
+		if( libmsiecf_block_cache_free(
+		     &( ( *io_handle )->block_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block cache.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *io_handle );
 
@@ -155,7 +195,8 @@ int libmsiecf_io_handle_clear(
      libmsiecf_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libmsiecf_io_handle_clear";
+	libmsiecf_block_cache_t *block_cache = NULL;
+	static char *function                = "libmsiecf_io_handle_clear";
 
 	if( io_handle == NULL )
 	{
@@ -168,6 +209,36 @@ int libmsiecf_io_handle_clear(
 
 		return( -1 );
 	}
+	if( libmsiecf_io_handle_free_file_data(
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_block_cache_empty(
+	     io_handle->block_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to empty block cache.",
+		 function );
+
+		return( -1 );
+	}
+	/* The block cache and its maximum size are retained
+	 */
+	block_cache = io_handle->block_cache;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -184,22 +255,26 @@ int libmsiecf_io_handle_clear(
 	}
 	io_handle->block_size     = LIBMSIECF_DEFAULT_BLOCK_SIZE;
 	io_handle->ascii_codepage = LIBMSIECF_CODEPAGE_WINDOWS_1252;
+	io_handle->block_cache    = block_cache;
 
 	return( 1 );
 }
 
-/* Reads the hash table from the HASH record blocks
- * Returns 1 if successful or -1 on error
+/* Reads the file data into memory
+ * The data is read once into a heap buffer so that the parsing functions can use it
+ * directly instead of reading from the file IO handle
+ * The buffer is a copy of the entire file in addition to the page cache, hence
+ * files larger than LIBMSIECF_MAXIMUM_IN_MEMORY_FILE_SIZE are not read into memory
+ * Returns 1 if successful, 0 if the file is empty or -1 on error
  */
-int libmsiecf_io_handle_read_hash_table(
-     libcdata_array_t *hash_table,
+int libmsiecf_io_handle_read_file_data(
      libmsiecf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
-     off64_t hash_table_offset,
      libcerror_error_t **error )
 {
-	static char *function = "libmsiecf_io_handle_read_hash_table";
-	int recursion_depth   = 0;
+	static char *function = "libmsiecf_io_handle_read_file_data";
+	size64_t file_size    = 0;
+	ssize_t read_count    = 0;
 
 	if( io_handle == NULL )
 	{
@@ -212,102 +287,214 @@ int libmsiecf_io_handle_read_hash_table(
 
 		return( -1 );
 	}
-	while( hash_table_offset != 0 )
+	if( io_handle->file_data != NULL )
 	{
-		if( recursion_depth >= LIBMSIECF_MAXIMUM_BTREE_NODE_RECURSION_DEPTH )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid recursion depth value out of bounds.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid IO handle - file data value already set.",
+		 function );
 
-			return( -1 );
-		}
-		if( libmsiecf_hash_table_read_file_io_handle(
-		     hash_table,
-		     &hash_table_offset,
-		     file_io_handle,
-		     hash_table_offset,
-		     io_handle->block_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read hash table at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 hash_table_offset,
-			 hash_table_offset );
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
 
-			return( -1 );
-		}
-		recursion_depth++;
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_size == 0 )
+	{
+		return( 0 );
+	}
+	if( ( file_size > (size64_t) LIBMSIECF_MAXIMUM_IN_MEMORY_FILE_SIZE )
+	 || ( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid file size: %" PRIu64 " value exceeds maximum size of file data in memory: %" PRIu64 ".",
+		 function,
+		 file_size,
+		 (size64_t) LIBMSIECF_MAXIMUM_IN_MEMORY_FILE_SIZE );
+
+		return( -1 );
+	}
+	io_handle->file_data = (uint8_t *) memory_allocate(
+	                                      sizeof( uint8_t ) * (size_t) file_size );
+
+	if( io_handle->file_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              io_handle->file_data,
+	              (size_t) file_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file data.",
+		 function );
+
+		goto on_error;
 	}
+	io_handle->file_data_size = (size_t) file_size;
+
 	return( 1 );
+
+on_error:
+	if( io_handle->file_data != NULL )
+	{
+		memory_free(
+		 io_handle->file_data );
+
+		io_handle->file_data = NULL;
+	}
+	return( -1 );
 }
 
-/* Scans the allocated part of the file for records
+/* Frees the file data in memory
  * Returns 1 if successful or -1 on error
  */
-int libmsiecf_io_handle_read_record_scan(
-     libcdata_array_t *item_table,
-     libcdata_array_t *recovered_item_table,
+int libmsiecf_io_handle_free_file_data(
      libmsiecf_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
-     libcdata_range_list_t *unallocated_block_list,
      libcerror_error_t **error )
 {
-	msiecf_record_header_t record_header;
-
-	libmsiecf_item_descriptor_t *item_descriptor      = NULL;
-	libmsiecf_item_descriptor_t *last_item_descriptor = NULL;
-	static char *function                             = "libmsiecf_io_handle_read_record_scan";
-	intptr_t *value                                   = NULL;
-	uint64_t range_offset                             = 0;
-	uint64_t range_size                               = 0;
-	size32_t remaining_record_size                    = 0;
-	size32_t record_size                              = 0;
-	ssize_t read_count                                = 0;
-	uint32_t number_of_blocks                         = 0;
-	int item_table_entry_index                        = 0;
-	int detected_new_record                           = 0;
-	int result                                        = 0;
-	uint8_t item_type                                 = 0;
-	uint8_t new_item_type                             = 0;
+	static char *function = "libmsiecf_io_handle_free_file_data";
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	const char *record_type                           = NULL;
-	int number_of_items                               = 0;
-	int number_of_recovered_items                     = 0;
-	int number_of_partial_recovered_items             = 0;
-#endif
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
 
-	if( item_table == NULL )
+		return( -1 );
+	}
+	if( io_handle->file_data != NULL )
+	{
+		memory_free(
+		 io_handle->file_data );
+
+		io_handle->file_data = NULL;
+	}
+	io_handle->file_data_size = 0;
+
+	return( 1 );
+}
+
+/* Retrieves a pointer to the file data in memory
+ * Returns 1 if successful, 0 if the data is not in memory or -1 on error
+ */
+int libmsiecf_io_handle_get_file_data(
+     libmsiecf_io_handle_t *io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_io_handle_get_file_data";
+
+	if( io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid item table.",
+		 "%s: invalid IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( recovered_item_table == NULL )
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid recovered item table.",
+		 "%s: invalid data.",
 		 function );
 
 		return( -1 );
 	}
+	if( io_handle->file_data == NULL )
+	{
+		return( 0 );
+	}
+	if( ( (size64_t) offset > (size64_t) io_handle->file_data_size )
+	 || ( size > ( io_handle->file_data_size - (size_t) offset ) ) )
+	{
+		return( 0 );
+	}
+	*data = &( io_handle->file_data[ offset ] );
+
+	return( 1 );
+}
+
+/* Reads a buffer at a specific offset
+ * With the block cache enabled the data is read from the cached pages
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libmsiecf_io_handle_read_buffer_at_offset(
+         libmsiecf_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	static char *function     = "libmsiecf_io_handle_read_buffer_at_offset";
+	size_t maximum_cache_size = 0;
+	ssize_t read_count        = 0;
+
 	if( io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -319,77 +506,522 @@ int libmsiecf_io_handle_read_record_scan(
 
 		return( -1 );
 	}
-	while( file_offset < (off64_t) io_handle->file_size )
+	if( buffer == NULL )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_cache != NULL )
+	{
+		if( libmsiecf_block_cache_get_maximum_size(
+		     io_handle->block_cache,
+		     &maximum_cache_size,
+		     error ) != 1 )
 		{
-			libcnotify_printf(
-			 "%s: scanning for record at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-			 function,
-			 file_offset,
-			 file_offset );
-		}
-#endif
-		read_count = libbfio_handle_read_buffer_at_offset(
-			      file_io_handle,
-			      (uint8_t *) &record_header,
-			      sizeof( msiecf_record_header_t ),
-			      file_offset,
-			      error );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve maximum block cache size.",
+			 function );
 
-		if( read_count != (ssize_t) sizeof( msiecf_record_header_t ) )
+			return( -1 );
+		}
+	}
+	if( maximum_cache_size > 0 )
+	{
+		read_count = libmsiecf_block_cache_read_buffer_at_offset(
+		              io_handle->block_cache,
+		              file_io_handle,
+		              buffer,
+		              size,
+		              offset,
+		              error );
+
+		if( read_count < 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read record header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ") from block cache.",
 			 function,
-			 file_offset,
-			 file_offset );
+			 offset,
+			 offset );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: record header:\n",
-			 function );
-			libcnotify_print_data(
-			 (uint8_t *) &record_header,
-			 sizeof( msiecf_record_header_t ),
-			 0 );
+			return( -1 );
 		}
-#endif
-		detected_new_record = 0;
-
-		/* The most common record type is checked first
-		 */
-		if( ( record_header.signature[ 0 ] == (uint8_t) 'U' )
-		 && ( record_header.signature[ 1 ] == (uint8_t) 'R' )
-		 && ( record_header.signature[ 2 ] == (uint8_t) 'L' )
-		 && ( record_header.signature[ 3 ] == (uint8_t) ' ' ) )
-		{
-			byte_stream_copy_to_uint32_little_endian(
-			 record_header.number_of_blocks,
-			 number_of_blocks );
+		return( read_count );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              buffer,
+	              size,
+	              offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 offset,
+		 offset );
 
-			new_item_type       = LIBMSIECF_ITEM_TYPE_URL;
-			detected_new_record = 1;
+		return( -1 );
+	}
+	return( read_count );
+}
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			record_type = "URL";
+/* Reads the hash table from the HASH record blocks
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_io_handle_read_hash_table(
+     libmsiecf_hash_map_t *hash_map,
+     libmsiecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t hash_table_offset,
+     libcerror_error_t **error )
+{
+	const uint8_t *file_data       = NULL;
+	static char *function          = "libmsiecf_io_handle_read_hash_table";
+	off64_t next_hash_table_offset = 0;
+	int recursion_depth            = 0;
+	int result                     = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	while( hash_table_offset != 0 )
+	{
+		if( recursion_depth >= LIBMSIECF_MAXIMUM_BTREE_NODE_RECURSION_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid recursion depth value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		result = libmsiecf_io_handle_get_file_data(
+		          io_handle,
+		          hash_table_offset,
+		          0,
+		          &file_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hash table data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 hash_table_offset,
+			 hash_table_offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			result = libmsiecf_hash_table_read_data(
+			          hash_map,
+			          &next_hash_table_offset,
+			          file_data,
+			          io_handle->file_data_size - (size_t) hash_table_offset,
+			          io_handle->block_size,
+			          error );
+		}
+		else
+		{
+			result = libmsiecf_hash_table_read_file_io_handle(
+			          hash_map,
+			          &next_hash_table_offset,
+			          file_io_handle,
+			          hash_table_offset,
+			          io_handle->block_size,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hash table at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 hash_table_offset,
+			 hash_table_offset );
+
+			return( -1 );
+		}
+		hash_table_offset = next_hash_table_offset;
+
+		recursion_depth++;
+	}
+	return( 1 );
+}
+
+/* Scans a chunk of the file for records
+ * The scan starts at the current offset and state of the record scan chunk
+ * and continues until the current offset reaches the end offset of the chunk,
+ * afterwards the record scan chunk contains the state at the current offset
+ * If a synchronization chunk is set the scan stops at the first synchronization
+ * point of the synchronization chunk with the same state, otherwise the scan
+ * records the synchronization points of the record scan chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_io_handle_read_record_scan_chunk(
+     libmsiecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmsiecf_allocation_map_t *allocation_map,
+     libmsiecf_record_scan_chunk_t *record_scan_chunk,
+     libcdata_array_t *item_table,
+     libcdata_array_t *recovered_item_table,
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     libcerror_error_t **error )
+{
+	libmsiecf_item_descriptor_t *item_descriptor                         = NULL;
+	libmsiecf_item_descriptor_t *last_item_descriptor                    = NULL;
+	libmsiecf_record_scan_chunk_t *synchronization_chunk                 = NULL;
+	libmsiecf_record_scan_synchronization_point_t *synchronization_point = NULL;
+	const msiecf_record_header_t *record_header                          = NULL;
+	const uint8_t *scan_data                                             = NULL;
+	uint8_t *scan_buffer                                                 = NULL;
+	static char *function                                                = "libmsiecf_io_handle_read_record_scan_chunk";
+	off64_t end_offset                                                   = 0;
+	off64_t file_offset                                                  = 0;
+	off64_t scan_data_offset                                             = 0;
+	size_t number_of_skipped_blocks                                      = 0;
+	size_t read_size                                                     = 0;
+	size_t scan_buffer_size                                              = LIBMSIECF_RECORD_SCAN_BUFFER_SIZE;
+	size_t scan_data_size                                                = 0;
+	size_t skip_data_size                                                = 0;
+	size32_t remaining_record_size                                       = 0;
+	size32_t record_size                                                 = 0;
+	ssize_t read_count                                                   = 0;
+	uint32_t number_of_blocks                                            = 0;
+	int item_table_entry_index                                           = 0;
+	int detected_new_record                                              = 0;
+	int result                                                           = 0;
+	int synchronization_point_index                                      = 0;
+	uint8_t item_type                                                    = 0;
+	uint8_t new_item_type                                                = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	const char *record_type                                              = NULL;
+	int number_of_items                                                  = 0;
+	int number_of_recovered_items                                        = 0;
+	int number_of_partial_recovered_items                                = 0;
+#endif
+
+	if( item_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item table.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_item_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered item table.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_descriptor_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item descriptor arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record scan chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_scan_chunk->end_offset > (off64_t) io_handle->file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record scan chunk - end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_offset           = record_scan_chunk->file_offset;
+	end_offset            = record_scan_chunk->end_offset;
+	record_size           = record_scan_chunk->record_size;
+	remaining_record_size = record_scan_chunk->remaining_record_size;
+	item_type             = record_scan_chunk->item_type;
+	last_item_descriptor  = record_scan_chunk->last_item_descriptor;
+	synchronization_chunk = record_scan_chunk->synchronization_chunk;
+
+	record_scan_chunk->synchronization_point_index = -1;
+
+	/* The record headers are read from the file data in memory if available
+	 * otherwise the file is read in chunks of the scan buffer size
+	 */
+	if( io_handle->file_data != NULL )
+	{
+		scan_data      = io_handle->file_data;
+		scan_data_size = io_handle->file_data_size;
+	}
+	else if( io_handle->access_pattern == LIBMSIECF_ACCESS_PATTERN_SEQUENTIAL )
+	{
+		scan_buffer_size = LIBMSIECF_SEQUENTIAL_RECORD_SCAN_BUFFER_SIZE;
+	}
+	while( file_offset < end_offset )
+	{
+		/* At a record boundary without a pending record the remainder of the scan
+		 * only depends on the offset and on whether there is a last item
+		 */
+		if( ( remaining_record_size == 0 )
+		 && ( item_type == LIBMSIECF_ITEM_TYPE_UNDEFINED ) )
+		{
+			if( synchronization_chunk != NULL )
+			{
+				while( synchronization_point_index < synchronization_chunk->number_of_synchronization_points )
+				{
+					synchronization_point = &( synchronization_chunk->synchronization_points[ synchronization_point_index ] );
+
+					if( synchronization_point->file_offset >= file_offset )
+					{
+						break;
+					}
+					synchronization_point_index++;
+				}
+				/* The scan of the synchronization chunk can continue from here if it has
+				 * a last item whenever this scan has one, the last item of this scan
+				 * is then marked as tainted if that of the synchronization chunk was
+				 */
+				if( ( synchronization_point_index < synchronization_chunk->number_of_synchronization_points )
+				 && ( synchronization_point->file_offset == file_offset )
+				 && ( ( synchronization_point->last_item_descriptor != NULL )
+				  || ( last_item_descriptor == NULL ) ) )
+				{
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: synchronized with chunk at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+						 function,
+						 file_offset,
+						 file_offset );
+					}
+#endif
+					record_scan_chunk->synchronization_point_index = synchronization_point_index;
+
+					break;
+				}
+			}
+			else if( ( last_item_descriptor != NULL )
+			      || ( file_offset == record_scan_chunk->start_offset ) )
+			{
+				if( libmsiecf_record_scan_chunk_append_synchronization_point(
+				     record_scan_chunk,
+				     file_offset,
+				     last_item_descriptor,
+				     item_table,
+				     recovered_item_table,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append synchronization point at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 file_offset,
+					 file_offset );
+
+					goto on_error;
+				}
+			}
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: scanning for record at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 file_offset,
+			 file_offset );
+		}
+#endif
+		/* Refill the scan buffer when the record header is not contained
+		 * in the scan data
+		 */
+		if( ( file_offset < scan_data_offset )
+		 || ( ( (size64_t) ( file_offset - scan_data_offset ) + sizeof( msiecf_record_header_t ) ) > (size64_t) scan_data_size ) )
+		{
+			if( scan_buffer == NULL )
+			{
+				scan_buffer = (uint8_t *) memory_allocate(
+				                           sizeof( uint8_t ) * scan_buffer_size );
+
+				if( scan_buffer == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create scan buffer.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			read_size = scan_buffer_size;
+
+			if( (size64_t) read_size > ( io_handle->file_size - file_offset ) )
+			{
+				read_size = (size_t) ( io_handle->file_size - file_offset );
+			}
+			if( read_size < sizeof( msiecf_record_header_t ) )
+			{
+				read_size = sizeof( msiecf_record_header_t );
+			}
+			read_count = libbfio_handle_read_buffer_at_offset(
+				      file_io_handle,
+				      scan_buffer,
+				      read_size,
+				      file_offset,
+				      error );
+
+			if( ( read_count < 0 )
+			 || ( (size_t) read_count < sizeof( msiecf_record_header_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			scan_data        = scan_buffer;
+			scan_data_offset = file_offset;
+			scan_data_size   = (size_t) read_count;
+		}
+		record_header = (const msiecf_record_header_t *) &( scan_data[ file_offset - scan_data_offset ] );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: record header:\n",
+			 function );
+			libcnotify_print_data(
+			 (uint8_t *) record_header,
+			 sizeof( msiecf_record_header_t ),
+			 0 );
+		}
+#endif
+		detected_new_record = 0;
+
+		/* The most common record type is checked first
+		 */
+		if( ( record_header->signature[ 0 ] == (uint8_t) 'U' )
+		 && ( record_header->signature[ 1 ] == (uint8_t) 'R' )
+		 && ( record_header->signature[ 2 ] == (uint8_t) 'L' )
+		 && ( record_header->signature[ 3 ] == (uint8_t) ' ' ) )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 record_header->number_of_blocks,
+			 number_of_blocks );
+
+			new_item_type       = LIBMSIECF_ITEM_TYPE_URL;
+			detected_new_record = 1;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			record_type = "URL";
 #endif
 		}
-		else if( ( record_header.signature[ 0 ] == (uint8_t) 'H' )
-		      && ( record_header.signature[ 1 ] == (uint8_t) 'A' )
-		      && ( record_header.signature[ 2 ] == (uint8_t) 'S' )
-		      && ( record_header.signature[ 3 ] == (uint8_t) 'H' ) )
+		else if( ( record_header->signature[ 0 ] == (uint8_t) 'H' )
+		      && ( record_header->signature[ 1 ] == (uint8_t) 'A' )
+		      && ( record_header->signature[ 2 ] == (uint8_t) 'S' )
+		      && ( record_header->signature[ 3 ] == (uint8_t) 'H' ) )
 		{
 			byte_stream_copy_to_uint32_little_endian(
-			 record_header.number_of_blocks,
+			 record_header->number_of_blocks,
 			 number_of_blocks );
 
 			new_item_type       = LIBMSIECF_ITEM_TYPE_UNDEFINED;
@@ -399,13 +1031,13 @@ int libmsiecf_io_handle_read_record_scan(
 			record_type = "HASH";
 #endif
 		}
-		else if( ( record_header.signature[ 0 ] == (uint8_t) 'R' )
-		      && ( record_header.signature[ 1 ] == (uint8_t) 'E' )
-		      && ( record_header.signature[ 2 ] == (uint8_t) 'D' )
-		      && ( record_header.signature[ 3 ] == (uint8_t) 'R' ) )
+		else if( ( record_header->signature[ 0 ] == (uint8_t) 'R' )
+		      && ( record_header->signature[ 1 ] == (uint8_t) 'E' )
+		      && ( record_header->signature[ 2 ] == (uint8_t) 'D' )
+		      && ( record_header->signature[ 3 ] == (uint8_t) 'R' ) )
 		{
 			byte_stream_copy_to_uint32_little_endian(
-			 record_header.number_of_blocks,
+			 record_header->number_of_blocks,
 			 number_of_blocks );
 
 			new_item_type       = LIBMSIECF_ITEM_TYPE_REDIRECTED;
@@ -415,13 +1047,13 @@ int libmsiecf_io_handle_read_record_scan(
 			record_type = "REDR";
 #endif
 		}
-		else if( ( record_header.signature[ 0 ] == (uint8_t) 'L' )
-		      && ( record_header.signature[ 1 ] == (uint8_t) 'E' )
-		      && ( record_header.signature[ 2 ] == (uint8_t) 'A' )
-		      && ( record_header.signature[ 3 ] == (uint8_t) 'K' ) )
+		else if( ( record_header->signature[ 0 ] == (uint8_t) 'L' )
+		      && ( record_header->signature[ 1 ] == (uint8_t) 'E' )
+		      && ( record_header->signature[ 2 ] == (uint8_t) 'A' )
+		      && ( record_header->signature[ 3 ] == (uint8_t) 'K' ) )
 		{
 			byte_stream_copy_to_uint32_little_endian(
-			 record_header.number_of_blocks,
+			 record_header->number_of_blocks,
 			 number_of_blocks );
 
 			new_item_type       = LIBMSIECF_ITEM_TYPE_LEAK;
@@ -432,19 +1064,19 @@ int libmsiecf_io_handle_read_record_scan(
 #endif
 		}
 #ifdef INVALIDDATARESET
-		else if( ( record_header.signature[ 0 ] == 0x0d )
-		      && ( record_header.signature[ 1 ] == 0xf0 )
-		      && ( record_header.signature[ 2 ] == 0xad )
-		      && ( record_header.signature[ 3 ] == 0x0b ) )
+		else if( ( record_header->signature[ 0 ] == 0x0d )
+		      && ( record_header->signature[ 1 ] == 0xf0 )
+		      && ( record_header->signature[ 2 ] == 0xad )
+		      && ( record_header->signature[ 3 ] == 0x0b ) )
 		{
 			number_of_blocks    = 1;
 			new_item_type       = LIBMSIECF_ITEM_TYPE_UNDEFINED;
 			detected_new_record = 1;
 		}
-		else if( ( record_header.signature[ 0 ] == 0xef )
-		      && ( record_header.signature[ 1 ] == 0xbe )
-		      && ( record_header.signature[ 2 ] == 0xad )
-		      && ( record_header.signature[ 3 ] == 0xde ) )
+		else if( ( record_header->signature[ 0 ] == 0xef )
+		      && ( record_header->signature[ 1 ] == 0xbe )
+		      && ( record_header->signature[ 2 ] == 0xad )
+		      && ( record_header->signature[ 3 ] == 0xde ) )
 		{
 			number_of_blocks    = 1;
 			new_item_type       = LIBMSIECF_ITEM_TYPE_UNDEFINED;
@@ -487,7 +1119,8 @@ int libmsiecf_io_handle_read_record_scan(
 			 */
 			if( remaining_record_size != 0 )
 			{
-				if( libmsiecf_item_descriptor_initialize(
+				if( libmsiecf_item_descriptor_arena_allocate(
+				     item_descriptor_arena,
 				     &item_descriptor,
 				     error ) != 1 )
 				{
@@ -556,12 +1189,9 @@ int libmsiecf_io_handle_read_record_scan(
 		{
 			record_size = number_of_blocks * io_handle->block_size;
 
-			result = libcdata_range_list_get_range_at_offset(
-				  unallocated_block_list,
-				  (uint64_t) file_offset,
-				  &range_offset,
-				  &range_size,
-				  &value,
+			result = libmsiecf_allocation_map_is_unallocated_offset(
+				  allocation_map,
+				  file_offset,
 				  error );
 
 			if( result == -1 )
@@ -608,7 +1238,8 @@ int libmsiecf_io_handle_read_record_scan(
 				 */
 				if( result == 0 )
 				{
-					if( libmsiecf_item_descriptor_initialize(
+					if( libmsiecf_item_descriptor_arena_allocate(
+					     item_descriptor_arena,
 					     &item_descriptor,
 					     error ) != 1 )
 					{
@@ -684,7 +1315,8 @@ int libmsiecf_io_handle_read_record_scan(
 			 */
 			if( remaining_record_size == 0 )
 			{
-				if( libmsiecf_item_descriptor_initialize(
+				if( libmsiecf_item_descriptor_arena_allocate(
+				     item_descriptor_arena,
 				     &item_descriptor,
 				     error ) != 1 )
 				{
@@ -740,34 +1372,816 @@ int libmsiecf_io_handle_read_record_scan(
 #endif
 			}
 		}
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: found %d items.\n",
-		 function,
-		 number_of_items );
-
-		libcnotify_printf(
-		 "%s: recovered %d items (partial recovered items %d).\n",
-		 function,
-		 number_of_recovered_items + number_of_partial_recovered_items,
-		 number_of_partial_recovered_items );
+		/* Skip the blocks that do not start with a record signature, these
+		 * do not affect the classification of the surrounding records
+		 * The skip stops at the end of the chunk so that a chunk that directly
+		 * follows starts at a record boundary
+		 */
+		if( ( detected_new_record == 0 )
+		 && ( last_item_descriptor == NULL )
+		 && ( file_offset < end_offset )
+		 && ( file_offset >= scan_data_offset )
+		 && ( (size64_t) ( file_offset - scan_data_offset ) < (size64_t) scan_data_size ) )
+		{
+			skip_data_size = scan_data_size - (size_t) ( file_offset - scan_data_offset );
 
-		libcnotify_printf(
-		 "\n" );
-	}
+			if( (size64_t) skip_data_size > (size64_t) ( end_offset - file_offset ) )
+			{
+				skip_data_size = (size_t) ( end_offset - file_offset );
+			}
+			if( libmsiecf_signature_find_record(
+			     &( scan_data[ file_offset - scan_data_offset ] ),
+			     skip_data_size,
+			     (size_t) io_handle->block_size,
+			     &number_of_skipped_blocks,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to find record signature at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				goto on_error;
+			}
+			/* The last block of an unallocated record is processed by the scan
+			 */
+			if( remaining_record_size != 0 )
+			{
+				if( number_of_skipped_blocks >= (size_t) ( remaining_record_size / io_handle->block_size ) )
+				{
+					number_of_skipped_blocks = (size_t) ( remaining_record_size / io_handle->block_size ) - 1;
+				}
+				remaining_record_size -= (size32_t) ( number_of_skipped_blocks * io_handle->block_size );
+			}
+			file_offset += (off64_t) ( number_of_skipped_blocks * io_handle->block_size );
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: found %d items.\n",
+		 function,
+		 number_of_items );
+
+		libcnotify_printf(
+		 "%s: recovered %d items (partial recovered items %d).\n",
+		 function,
+		 number_of_recovered_items + number_of_partial_recovered_items,
+		 number_of_partial_recovered_items );
+
+		libcnotify_printf(
+		 "\n" );
+	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
+	if( scan_buffer != NULL )
+	{
+		memory_free(
+		 scan_buffer );
+	}
+	record_scan_chunk->file_offset           = file_offset;
+	record_scan_chunk->record_size           = record_size;
+	record_scan_chunk->remaining_record_size = remaining_record_size;
+	record_scan_chunk->item_type             = item_type;
+	record_scan_chunk->last_item_descriptor  = last_item_descriptor;
+
+	return( 1 );
+
+on_error:
+	if( scan_buffer != NULL )
+	{
+		memory_free(
+		 scan_buffer );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+
+/* Scans a chunk of the file for records from a thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_io_handle_read_record_scan_chunk_callback(
+     libmsiecf_record_scan_chunk_t *record_scan_chunk,
+     libmsiecf_io_handle_t *io_handle )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	static char *function            = "libmsiecf_io_handle_read_record_scan_chunk_callback";
+	int handle_index                 = -1;
+
+	if( record_scan_chunk == NULL )
+	{
+		return( -1 );
+	}
+	file_io_handle = record_scan_chunk->file_io_handle;
+
+	/* Each thread reads from its own file IO handle if available, since
+	 * libbfio serializes reads from the same file IO handle
+	 */
+	if( record_scan_chunk->file_io_handle_pool != NULL )
+	{
+		record_scan_chunk->result = libmsiecf_file_io_handle_pool_grab_handle(
+		                             record_scan_chunk->file_io_handle_pool,
+		                             &file_io_handle,
+		                             &handle_index,
+		                             &error );
+
+		if( record_scan_chunk->result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to grab file IO handle from pool.",
+			 function );
+		}
+	}
+	else
+	{
+		record_scan_chunk->result = 1;
+	}
+	if( record_scan_chunk->result == 1 )
+	{
+		record_scan_chunk->result = libmsiecf_io_handle_read_record_scan_chunk(
+		                             io_handle,
+		                             file_io_handle,
+		                             record_scan_chunk->allocation_map,
+		                             record_scan_chunk,
+		                             record_scan_chunk->item_array,
+		                             record_scan_chunk->recovered_item_array,
+		                             record_scan_chunk->item_descriptor_arena,
+		                             &error );
+
+		if( record_scan_chunk->file_io_handle_pool != NULL )
+		{
+			if( libmsiecf_file_io_handle_pool_release_handle(
+			     record_scan_chunk->file_io_handle_pool,
+			     handle_index,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release file IO handle: %d to pool.",
+				 function,
+				 handle_index );
+
+				record_scan_chunk->result = -1;
+			}
+		}
+	}
+	if( record_scan_chunk->result != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to scan chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 function,
+			 record_scan_chunk->start_offset,
+			 record_scan_chunk->start_offset );
+
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( record_scan_chunk->result );
+}
+
+/* Scans the allocated part of the file for records using multiple threads
+ * The file is divided into chunks that are scanned independently, starting
+ * with no preceding record, where each thread reads from its own file IO handle.
+ * The chunks are stitched together in order, where the scan continuing from
+ * the preceding chunk is only repeated up to the first synchronization point
+ * of the chunk it reaches with the same state, from which the items of the chunk
+ * are used. This makes the result identical to that of a single threaded scan.
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_io_handle_read_record_scan_parallel(
+     libcdata_array_t *item_table,
+     libcdata_array_t *recovered_item_table,
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     libmsiecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libmsiecf_allocation_map_t *allocation_map,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *record_scan_chunks_array                           = NULL;
+	libcthreads_thread_pool_t *thread_pool                               = NULL;
+	libmsiecf_file_io_handle_pool_t *file_io_handle_pool                 = NULL;
+	libmsiecf_record_scan_chunk_t *record_scan_chunk                     = NULL;
+	libmsiecf_record_scan_chunk_t *scan_state                            = NULL;
+	libmsiecf_record_scan_synchronization_point_t *synchronization_point = NULL;
+	static char *function                                                = "libmsiecf_io_handle_read_record_scan_parallel";
+	size64_t chunk_size                                                  = 0;
+	off64_t chunk_end_offset                                             = 0;
+	int chunk_index                                                      = 0;
+	int entry_index                                                      = 0;
+	int maximum_number_of_handles                                        = 0;
+	int number_of_chunks                                                 = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid number of threads value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	/* The chunk boundaries are aligned with the blocks
+	 */
+	chunk_size = ( LIBMSIECF_RECORD_SCAN_CHUNK_SIZE / io_handle->block_size ) * io_handle->block_size;
+
+	if( chunk_size == 0 )
+	{
+		chunk_size = io_handle->block_size;
+	}
+	if( libcdata_array_initialize(
+	     &record_scan_chunks_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record scan chunks array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_record_scan_chunk_initialize(
+	     &scan_state,
+	     file_offset,
+	     (off64_t) io_handle->file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create scan state.",
+		 function );
+
+		goto on_error;
+	}
+	while( file_offset < (off64_t) io_handle->file_size )
+	{
+		chunk_end_offset = file_offset + (off64_t) chunk_size;
+
+		if( chunk_end_offset > (off64_t) io_handle->file_size )
+		{
+			chunk_end_offset = (off64_t) io_handle->file_size;
+		}
+		if( libmsiecf_record_scan_chunk_initialize(
+		     &record_scan_chunk,
+		     file_offset,
+		     chunk_end_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record scan chunk.",
+			 function );
+
+			goto on_error;
+		}
+		record_scan_chunk->file_io_handle = file_io_handle;
+		record_scan_chunk->allocation_map = allocation_map;
+
+		/* The boundary item descriptor is used to determine if the last item
+		 * of the preceding chunk needs to be marked as tainted
+		 */
+		if( number_of_chunks > 0 )
+		{
+			record_scan_chunk->last_item_descriptor = &( record_scan_chunk->boundary_item_descriptor );
+		}
+		if( libcdata_array_append_entry(
+		     record_scan_chunks_array,
+		     &entry_index,
+		     (intptr_t *) record_scan_chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append record scan chunk to array.",
+			 function );
+
+			goto on_error;
+		}
+		record_scan_chunk = NULL;
+
+		number_of_chunks++;
+
+		file_offset = chunk_end_offset;
+	}
+	if( number_of_threads > number_of_chunks )
+	{
+		number_of_threads = number_of_chunks;
+	}
+	/* The file data in memory is shared by the threads otherwise
+	 * the threads read from file IO handles cloned from that of the file
+	 */
+	if( io_handle->file_data == NULL )
+	{
+		maximum_number_of_handles = number_of_threads;
+
+		if( maximum_number_of_handles > LIBMSIECF_MAXIMUM_NUMBER_OF_FILE_IO_HANDLES )
+		{
+			maximum_number_of_handles = LIBMSIECF_MAXIMUM_NUMBER_OF_FILE_IO_HANDLES;
+		}
+		if( libmsiecf_file_io_handle_pool_initialize(
+		     &file_io_handle_pool,
+		     maximum_number_of_handles,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle pool.",
+			 function );
+
+			goto on_error;
+		}
+		if( libmsiecf_file_io_handle_pool_set_file_io_handle(
+		     file_io_handle_pool,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set file IO handle in pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_thread_pool_create(
+	     &thread_pool,
+	     NULL,
+	     number_of_threads,
+	     number_of_chunks,
+	     (int (*)(intptr_t *, void *)) &libmsiecf_io_handle_read_record_scan_chunk_callback,
+	     (void *) io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     record_scan_chunks_array,
+		     chunk_index,
+		     (intptr_t **) &record_scan_chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record scan chunk: %d.",
+			 function,
+			 chunk_index );
+
+			record_scan_chunk = NULL;
+
+			goto on_error;
+		}
+		record_scan_chunk->file_io_handle_pool = file_io_handle_pool;
+
+		if( libcthreads_thread_pool_push(
+		     thread_pool,
+		     (intptr_t *) record_scan_chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to push record scan chunk: %d onto thread pool.",
+			 function,
+			 chunk_index );
+
+			record_scan_chunk = NULL;
+
+			goto on_error;
+		}
+	}
+	record_scan_chunk = NULL;
+
+	if( libcthreads_thread_pool_join(
+	     &thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     record_scan_chunks_array,
+		     chunk_index,
+		     (intptr_t **) &record_scan_chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record scan chunk: %d.",
+			 function,
+			 chunk_index );
+
+			record_scan_chunk = NULL;
+
+			goto on_error;
+		}
+		if( record_scan_chunk == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing record scan chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( record_scan_chunk->result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 record_scan_chunk->start_offset,
+			 record_scan_chunk->start_offset );
+
+			record_scan_chunk = NULL;
+
+			goto on_error;
+		}
+		if( scan_state->file_offset >= record_scan_chunk->end_offset )
+		{
+			continue;
+		}
+		/* The scan continues from the preceding chunk until it reaches a synchronization
+		 * point of the chunk, from which the chunk was scanned with the same state
+		 */
+		scan_state->end_offset            = record_scan_chunk->end_offset;
+		scan_state->synchronization_chunk = record_scan_chunk;
+
+		if( libmsiecf_io_handle_read_record_scan_chunk(
+		     io_handle,
+		     file_io_handle,
+		     allocation_map,
+		     scan_state,
+		     item_table,
+		     recovered_item_table,
+		     item_descriptor_arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 scan_state->file_offset,
+			 scan_state->file_offset );
+
+			record_scan_chunk = NULL;
+
+			goto on_error;
+		}
+		scan_state->synchronization_chunk = NULL;
+
+		if( scan_state->synchronization_point_index >= 0 )
+		{
+			synchronization_point = &( record_scan_chunk->synchronization_points[ scan_state->synchronization_point_index ] );
+
+			if( ( scan_state->last_item_descriptor != NULL )
+			 && ( synchronization_point->last_item_descriptor != NULL )
+			 && ( ( synchronization_point->last_item_descriptor->flags & LIBMSIECF_ITEM_FLAG_TAINTED ) != 0 ) )
+			{
+				scan_state->last_item_descriptor->flags |= LIBMSIECF_ITEM_FLAG_TAINTED;
+			}
+			if( libmsiecf_record_scan_chunk_move_items(
+			     record_scan_chunk,
+			     synchronization_point->number_of_items,
+			     synchronization_point->number_of_recovered_items,
+			     item_table,
+			     recovered_item_table,
+			     item_descriptor_arena,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to move items of record scan chunk: %d.",
+				 function,
+				 chunk_index );
+
+				record_scan_chunk = NULL;
+
+				goto on_error;
+			}
+			scan_state->file_offset           = record_scan_chunk->file_offset;
+			scan_state->record_size           = record_scan_chunk->record_size;
+			scan_state->remaining_record_size = record_scan_chunk->remaining_record_size;
+			scan_state->item_type             = record_scan_chunk->item_type;
+			scan_state->last_item_descriptor  = record_scan_chunk->last_item_descriptor;
+		}
+	}
+	record_scan_chunk = NULL;
+
+	if( libmsiecf_record_scan_chunk_free(
+	     &scan_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scan state.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_pool != NULL )
+	{
+		if( libmsiecf_file_io_handle_pool_free(
+		     &file_io_handle_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcdata_array_free(
+	     &record_scan_chunks_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libmsiecf_record_scan_chunk_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record scan chunks array.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	/* Make sure the threads no longer reference the record scan chunks
+	 */
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( record_scan_chunk != NULL )
+	{
+		libmsiecf_record_scan_chunk_free(
+		 &record_scan_chunk,
+		 NULL );
+	}
+	if( scan_state != NULL )
+	{
+		libmsiecf_record_scan_chunk_free(
+		 &scan_state,
+		 NULL );
+	}
+	if( file_io_handle_pool != NULL )
+	{
+		libmsiecf_file_io_handle_pool_free(
+		 &file_io_handle_pool,
+		 NULL );
+	}
+	if( record_scan_chunks_array != NULL )
+	{
+		libcdata_array_free(
+		 &record_scan_chunks_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libmsiecf_record_scan_chunk_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT ) */
+
+/* Scans the allocated part of the file for records
+ * If multi-thread support is available and number of threads is more than 1
+ * the scan is divided over multiple threads
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_io_handle_read_record_scan(
+     libcdata_array_t *item_table,
+     libcdata_array_t *recovered_item_table,
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     libmsiecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libmsiecf_allocation_map_t *allocation_map,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libmsiecf_record_scan_chunk_t *record_scan_chunk = NULL;
+	static char *function                            = "libmsiecf_io_handle_read_record_scan";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_threads < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of threads value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset >= (off64_t) io_handle->file_size )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( ( number_of_threads > 1 )
+	 && ( ( io_handle->file_size - file_offset ) > LIBMSIECF_RECORD_SCAN_CHUNK_SIZE ) )
+	{
+		if( libmsiecf_io_handle_read_record_scan_parallel(
+		     item_table,
+		     recovered_item_table,
+		     item_descriptor_arena,
+		     io_handle,
+		     file_io_handle,
+		     file_offset,
+		     allocation_map,
+		     number_of_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to perform multi-threaded record scan.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+#endif /* defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT ) */
+
+	if( libmsiecf_record_scan_chunk_initialize(
+	     &record_scan_chunk,
+	     file_offset,
+	     (off64_t) io_handle->file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record scan chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_io_handle_read_record_scan_chunk(
+	     io_handle,
+	     file_io_handle,
+	     allocation_map,
+	     record_scan_chunk,
+	     item_table,
+	     recovered_item_table,
+	     item_descriptor_arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan for records.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_record_scan_chunk_free(
+	     &record_scan_chunk,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record scan chunk.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
-	if( item_descriptor != NULL )
+	if( record_scan_chunk != NULL )
 	{
-		libmsiecf_item_descriptor_free(
-		 &item_descriptor,
-	 	 NULL );
+		libmsiecf_record_scan_chunk_free(
+		 &record_scan_chunk,
+		 NULL );
 	}
 	return( -1 );
 }
@@ -25,9 +25,15 @@
 #include <common.h>
 #include <types.h>
 
+#include "libmsiecf_allocation_map.h"
+#include "libmsiecf_block_cache.h"
+#include "libmsiecf_hash_map.h"
+#include "libmsiecf_item_descriptor_arena.h"
 #include "libmsiecf_libbfio.h"
 #include "libmsiecf_libcdata.h"
 #include "libmsiecf_libcerror.h"
+#include "libmsiecf_libcthreads.h"
+#include "libmsiecf_record_scan_chunk.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -59,6 +65,26 @@ struct libmsiecf_io_handle
 	 */
 	int ascii_codepage;
 
+	/* The access pattern
+	 */
+	int access_pattern;
+
+	/* The access flags
+	 */
+	int access_flags;
+
+	/* The file data in memory
+	 */
+	uint8_t *file_data;
+
+	/* The size of the file data in memory
+	 */
+	size_t file_data_size;
+
+	/* The block cache
+	 */
+	libmsiecf_block_cache_t *block_cache;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -76,20 +102,75 @@ int libmsiecf_io_handle_clear(
      libmsiecf_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libmsiecf_io_handle_read_file_data(
+     libmsiecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libmsiecf_io_handle_free_file_data(
+     libmsiecf_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libmsiecf_io_handle_get_file_data(
+     libmsiecf_io_handle_t *io_handle,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+ssize_t libmsiecf_io_handle_read_buffer_at_offset(
+         libmsiecf_io_handle_t *io_handle,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         off64_t offset,
+         libcerror_error_t **error );
+
 int libmsiecf_io_handle_read_hash_table(
-     libcdata_array_t *hash_table,
+     libmsiecf_hash_map_t *hash_map,
      libmsiecf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      off64_t hash_table_offset,
      libcerror_error_t **error );
 
+int libmsiecf_io_handle_read_record_scan_chunk(
+     libmsiecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmsiecf_allocation_map_t *allocation_map,
+     libmsiecf_record_scan_chunk_t *record_scan_chunk,
+     libcdata_array_t *item_table,
+     libcdata_array_t *recovered_item_table,
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+
+int libmsiecf_io_handle_read_record_scan_chunk_callback(
+     libmsiecf_record_scan_chunk_t *record_scan_chunk,
+     libmsiecf_io_handle_t *io_handle );
+
+int libmsiecf_io_handle_read_record_scan_parallel(
+     libcdata_array_t *item_table,
+     libcdata_array_t *recovered_item_table,
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     libmsiecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libmsiecf_allocation_map_t *allocation_map,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT ) */
+
 int libmsiecf_io_handle_read_record_scan(
      libcdata_array_t *item_table,
      libcdata_array_t *recovered_item_table,
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
      libmsiecf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
-     libcdata_range_list_t *unallocated_block_list,
+     libmsiecf_allocation_map_t *allocation_map,
+     int number_of_threads,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
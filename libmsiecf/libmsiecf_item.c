@@ -23,8 +23,10 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libmsiecf_block_cache.h"
 #include "libmsiecf_definitions.h"
 #include "libmsiecf_item.h"
+#include "libmsiecf_item_cache.h"
 #include "libmsiecf_io_handle.h"
 #include "libmsiecf_leak_values.h"
 #include "libmsiecf_libcerror.h"
@@ -108,21 +110,6 @@ int libmsiecf_item_initialize(
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_initialize(
-	     &( internal_item->read_write_lock ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize read/write lock.",
-		 function );
-
-		goto on_error;
-	}
-#endif
 	internal_item->item_descriptor = item_descriptor;
 
 	*item = (libmsiecf_item_t *) internal_item;
@@ -165,21 +152,6 @@ int libmsiecf_item_free(
 		internal_item = (libmsiecf_internal_item_t *) *item;
 		*item         = NULL;
 
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-		if( libcthreads_read_write_lock_free(
-		     &( internal_item->read_write_lock ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free read/write lock.",
-			 function );
-
-			result = -1;
-		}
-#endif
                 /* The item_descriptor reference is freed elsewhere
 		 */
 		if( internal_item->value != NULL )
@@ -254,38 +226,7 @@ int libmsiecf_item_get_type(
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_item->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
-
-		return( -1 );
-	}
-#endif
 	*item_type = internal_item->item_descriptor->type;
-
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_item->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
-
-		return( -1 );
-	}
-#endif
 	return( 1 );
 }
 
@@ -335,38 +276,7 @@ int libmsiecf_item_get_flags(
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_item->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
-
-		return( -1 );
-	}
-#endif
 	*item_flags = internal_item->item_descriptor->flags;
-
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_item->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
-
-		return( -1 );
-	}
-#endif
 	return( 1 );
 }
 
@@ -416,38 +326,7 @@ int libmsiecf_item_get_offset(
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_item->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
-
-		return( -1 );
-	}
-#endif
 	*offset = internal_item->item_descriptor->file_offset;
-
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_item->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
-
-		return( -1 );
-	}
-#endif
 	return( 1 );
 }
 
@@ -509,55 +388,39 @@ int libmsiecf_item_get_offset_range(
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_item->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
-
-		return( -1 );
-	}
-#endif
 	*offset = internal_item->item_descriptor->file_offset;
 	*size   = (size64_t) internal_item->item_descriptor->record_size;
-
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_item->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
-
-		return( -1 );
-	}
-#endif
 	return( 1 );
 }
 
 /* Reads the item values
+ * The record data is optional, when set it must contain the data at the item offset,
+ * otherwise the data is retrieved from the file data in memory or read from the file IO handle
+ * The item cache is optional, when set the decoded values are retrieved from and stored in the cache
  * Returns 1 if successful or -1 on error
  */
 int libmsiecf_internal_item_read_values(
      libmsiecf_internal_item_t *internal_item,
      libmsiecf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libmsiecf_item_cache_t *item_cache,
      libcerror_error_t **error )
 {
+	uint8_t *read_record_data    = NULL;
 	const char *item_type_string = NULL;
 	static char *function        = "libmsiecf_internal_item_read_values";
+	size_t maximum_cache_size    = 0;
+	size_t read_size             = 0;
+	size_t values_size           = 0;
+	ssize_t read_count           = 0;
 	int result                   = 0;
 
+	int (*reference_value)(
+	       intptr_t *value,
+	       libcerror_error_t **error ) = NULL;
+
 	if( internal_item == NULL )
 	{
 		libcerror_error_set(
@@ -591,6 +454,42 @@ int libmsiecf_internal_item_read_values(
 
 		return( -1 );
 	}
+	if( internal_item->item_descriptor->is_stale != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item - item descriptor is stale since the record was overwritten.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_cache != NULL )
+	{
+		result = libmsiecf_item_cache_get_value(
+		          item_cache,
+		          internal_item->item_descriptor,
+		          &( internal_item->value ),
+		          &( internal_item->free_value ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve values from item cache.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
 	switch( internal_item->item_descriptor->type )
 	{
 		case LIBMSIECF_ITEM_TYPE_LEAK:
@@ -601,6 +500,8 @@ int libmsiecf_internal_item_read_values(
 			          error );
 
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libmsiecf_leak_values_free;
+			reference_value           = (int (*)(intptr_t *, libcerror_error_t **)) &libmsiecf_leak_values_reference;
+			values_size               = sizeof( libmsiecf_leak_values_t );
 
 			break;
 
@@ -612,6 +513,8 @@ int libmsiecf_internal_item_read_values(
 			          error );
 
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libmsiecf_redirected_values_free;
+			reference_value           = (int (*)(intptr_t *, libcerror_error_t **)) &libmsiecf_redirected_values_reference;
+			values_size               = sizeof( libmsiecf_redirected_values_t );
 
 			break;
 
@@ -623,6 +526,8 @@ int libmsiecf_internal_item_read_values(
 			          error );
 
 			internal_item->free_value = (int (*)(intptr_t **, libcerror_error_t **)) &libmsiecf_url_values_free;
+			reference_value           = (int (*)(intptr_t *, libcerror_error_t **)) &libmsiecf_url_values_reference;
+			values_size               = sizeof( libmsiecf_url_values_t );
 
 			break;
 
@@ -649,40 +554,209 @@ int libmsiecf_internal_item_read_values(
 
 		goto on_error;
 	}
-	switch( internal_item->item_descriptor->type )
+	read_size = (size_t) internal_item->item_descriptor->record_size;
+
+	/* Tainted URL records are read with one additional block
+	 */
+	if( ( internal_item->item_descriptor->type == LIBMSIECF_ITEM_TYPE_URL )
+	 && ( ( internal_item->item_descriptor->flags & LIBMSIECF_ITEM_FLAG_TAINTED ) != 0 ) )
 	{
-		case LIBMSIECF_ITEM_TYPE_LEAK:
-			result = libmsiecf_leak_values_read_file_io_handle(
-			          (libmsiecf_leak_values_t *) internal_item->value,
-			          file_io_handle,
-			          internal_item->item_descriptor->file_offset,
-			          internal_item->item_descriptor->record_size,
-			          io_handle->ascii_codepage,
-			          internal_item->item_descriptor->flags,
-			          error );
-			break;
+		read_size += LIBMSIECF_DEFAULT_BLOCK_SIZE;
+	}
+	if( record_data != NULL )
+	{
+		if( record_data_size < read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid record data size value too small.",
+			 function );
 
-		case LIBMSIECF_ITEM_TYPE_REDIRECTED:
-			result = libmsiecf_redirected_values_read_file_io_handle(
-			          (libmsiecf_redirected_values_t *) internal_item->value,
-			          file_io_handle,
-			          internal_item->item_descriptor->file_offset,
-			          internal_item->item_descriptor->record_size,
-			          io_handle->ascii_codepage,
-			          internal_item->item_descriptor->flags,
-			          error );
-			break;
+			goto on_error;
+		}
+		result = 1;
+	}
+	else
+	{
+		result = libmsiecf_io_handle_get_file_data(
+		          io_handle,
+		          internal_item->item_descriptor->file_offset,
+		          read_size,
+		          &record_data,
+		          error );
 
-		case LIBMSIECF_ITEM_TYPE_URL:
-			result = libmsiecf_url_values_read_file_io_handle(
-			          (libmsiecf_url_values_t *) internal_item->value,
-			          io_handle,
-			          file_io_handle,
-			          internal_item->item_descriptor->file_offset,
-			          internal_item->item_descriptor->record_size,
-			          internal_item->item_descriptor->flags,
-			          error );
-			break;
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve %s record data.",
+			 function,
+			 item_type_string );
+
+			goto on_error;
+		}
+		else if( ( result == 0 )
+		      && ( io_handle->block_cache != NULL ) )
+		{
+			if( libmsiecf_block_cache_get_maximum_size(
+			     io_handle->block_cache,
+			     &maximum_cache_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve maximum block cache size.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* With the block cache enabled the record data is read using the IO handle
+		 */
+		if( ( result == 0 )
+		 && ( maximum_cache_size > 0 ) )
+		{
+			read_record_data = (uint8_t *) memory_allocate(
+			                                sizeof( uint8_t ) * read_size );
+
+			if( read_record_data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create %s record data.",
+				 function,
+				 item_type_string );
+
+				goto on_error;
+			}
+			read_count = libmsiecf_io_handle_read_buffer_at_offset(
+			              io_handle,
+			              file_io_handle,
+			              read_record_data,
+			              read_size,
+			              internal_item->item_descriptor->file_offset,
+			              error );
+
+			if( read_count != (ssize_t) read_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read %s record data.",
+				 function,
+				 item_type_string );
+
+				goto on_error;
+			}
+			record_data = read_record_data;
+			result      = 1;
+		}
+	}
+	if( result != 0 )
+	{
+		/* The values take ownership of the record data read into a buffer
+		 * otherwise they copy the record data once
+		 */
+		switch( internal_item->item_descriptor->type )
+		{
+			case LIBMSIECF_ITEM_TYPE_LEAK:
+				if( read_record_data != NULL )
+				{
+					( (libmsiecf_leak_values_t *) internal_item->value )->record_data      = read_record_data;
+					( (libmsiecf_leak_values_t *) internal_item->value )->record_data_size = read_size;
+
+					read_record_data = NULL;
+				}
+				result = libmsiecf_leak_values_read_data(
+				          (libmsiecf_leak_values_t *) internal_item->value,
+				          record_data,
+				          read_size,
+				          io_handle->ascii_codepage,
+				          internal_item->item_descriptor->flags,
+				          error );
+				break;
+
+			case LIBMSIECF_ITEM_TYPE_REDIRECTED:
+				if( read_record_data != NULL )
+				{
+					( (libmsiecf_redirected_values_t *) internal_item->value )->record_data      = read_record_data;
+					( (libmsiecf_redirected_values_t *) internal_item->value )->record_data_size = read_size;
+
+					read_record_data = NULL;
+				}
+				result = libmsiecf_redirected_values_read_data(
+				          (libmsiecf_redirected_values_t *) internal_item->value,
+				          record_data,
+				          read_size,
+				          io_handle->ascii_codepage,
+				          internal_item->item_descriptor->flags,
+				          error );
+				break;
+
+			case LIBMSIECF_ITEM_TYPE_URL:
+				if( read_record_data != NULL )
+				{
+					( (libmsiecf_url_values_t *) internal_item->value )->record_data      = read_record_data;
+					( (libmsiecf_url_values_t *) internal_item->value )->record_data_size = read_size;
+
+					read_record_data = NULL;
+				}
+				result = libmsiecf_url_values_read_data(
+				          (libmsiecf_url_values_t *) internal_item->value,
+				          io_handle,
+				          record_data,
+				          read_size,
+				          internal_item->item_descriptor->flags,
+				          error );
+				break;
+		}
+	}
+	else
+	{
+		switch( internal_item->item_descriptor->type )
+		{
+			case LIBMSIECF_ITEM_TYPE_LEAK:
+				result = libmsiecf_leak_values_read_file_io_handle(
+				          (libmsiecf_leak_values_t *) internal_item->value,
+				          file_io_handle,
+				          internal_item->item_descriptor->file_offset,
+				          internal_item->item_descriptor->record_size,
+				          io_handle->ascii_codepage,
+				          internal_item->item_descriptor->flags,
+				          error );
+				break;
+
+			case LIBMSIECF_ITEM_TYPE_REDIRECTED:
+				result = libmsiecf_redirected_values_read_file_io_handle(
+				          (libmsiecf_redirected_values_t *) internal_item->value,
+				          file_io_handle,
+				          internal_item->item_descriptor->file_offset,
+				          internal_item->item_descriptor->record_size,
+				          io_handle->ascii_codepage,
+				          internal_item->item_descriptor->flags,
+				          error );
+				break;
+
+			case LIBMSIECF_ITEM_TYPE_URL:
+				result = libmsiecf_url_values_read_file_io_handle(
+				          (libmsiecf_url_values_t *) internal_item->value,
+				          io_handle,
+				          file_io_handle,
+				          internal_item->item_descriptor->file_offset,
+				          internal_item->item_descriptor->record_size,
+				          internal_item->item_descriptor->flags,
+				          error );
+				break;
+		}
 	}
 	if( result != 1 )
 	{
@@ -697,9 +771,48 @@ int libmsiecf_internal_item_read_values(
 
 		goto on_error;
 	}
+	if( read_record_data != NULL )
+	{
+		memory_free(
+		 read_record_data );
+
+		read_record_data = NULL;
+	}
+	/* Values read with the no reuse access pattern are not retained in the item cache
+	 */
+	if( ( item_cache != NULL )
+	 && ( io_handle->access_pattern != LIBMSIECF_ACCESS_PATTERN_NO_REUSE ) )
+	{
+		/* The size of the decoded values is bounded by the size of the record data
+		 */
+		if( libmsiecf_item_cache_set_value(
+		     item_cache,
+		     internal_item->item_descriptor,
+		     internal_item->value,
+		     internal_item->free_value,
+		     reference_value,
+		     values_size + read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set %s values in item cache.",
+			 function,
+			 item_type_string );
+
+			goto on_error;
+		}
+	}
 	return( 1 );
 
 on_error:
+	if( read_record_data != NULL )
+	{
+		memory_free(
+		 read_record_data );
+	}
 	if( internal_item->value != NULL )
 	{
 		if( internal_item->free_value != NULL )
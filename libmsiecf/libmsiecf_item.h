@@ -26,11 +26,11 @@
 #include <types.h>
 
 #include "libmsiecf_extern.h"
+#include "libmsiecf_item_cache.h"
 #include "libmsiecf_item_descriptor.h"
 #include "libmsiecf_io_handle.h"
 #include "libmsiecf_libbfio.h"
 #include "libmsiecf_libcerror.h"
-#include "libmsiecf_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -38,6 +38,11 @@ extern "C" {
 
 typedef struct libmsiecf_internal_item libmsiecf_internal_item_t;
 
+/* The item values are read by libmsiecf_internal_item_read_values before the item
+ * is returned and are not changed afterwards, hence the item is read without locking
+ * The only exception are the URL location and filename strings, which are decoded
+ * on first access and published once without locking, see libmsiecf_url_values_read_strings
+ */
 struct libmsiecf_internal_item
 {
 	/* The item descriptor
@@ -53,12 +58,6 @@ struct libmsiecf_internal_item
 	int (*free_value)(
 	       intptr_t **value,
 	       libcerror_error_t **error );
-
-#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
-	/* The read/write lock
-	 */
-	libcthreads_read_write_lock_t *read_write_lock;
-#endif
 };
 
 int libmsiecf_item_initialize(
@@ -100,6 +99,9 @@ int libmsiecf_internal_item_read_values(
      libmsiecf_internal_item_t *internal_item,
      libmsiecf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libmsiecf_item_cache_t *item_cache,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
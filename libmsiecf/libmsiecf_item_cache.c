@@ -0,0 +1,1085 @@
+/*
+ * Item cache functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmsiecf_definitions.h"
+#include "libmsiecf_item_cache.h"
+#include "libmsiecf_item_descriptor.h"
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_libcthreads.h"
+
+/* Creates an item cache
+ * Make sure the value item_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_cache_initialize(
+     libmsiecf_item_cache_t **item_cache,
+     size_t maximum_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_item_cache_initialize";
+
+	if( item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*item_cache = memory_allocate_structure(
+	               libmsiecf_item_cache_t );
+
+	if( *item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *item_cache,
+	     0,
+	     sizeof( libmsiecf_item_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear item cache.",
+		 function );
+
+		memory_free(
+		 *item_cache );
+
+		*item_cache = NULL;
+
+		return( -1 );
+	}
+	if( libmsiecf_item_cache_resize_buckets(
+	     *item_cache,
+	     LIBMSIECF_ITEM_CACHE_MINIMUM_NUMBER_OF_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buckets.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *item_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *item_cache )->maximum_size = maximum_size;
+
+	return( 1 );
+
+on_error:
+	if( *item_cache != NULL )
+	{
+		if( ( *item_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *item_cache )->buckets );
+		}
+		memory_free(
+		 *item_cache );
+
+		*item_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an item cache
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_cache_free(
+     libmsiecf_item_cache_t **item_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_item_cache_free";
+	int result            = 1;
+
+	if( item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item_cache != NULL )
+	{
+		if( libmsiecf_item_cache_remove_least_recently_used_entries(
+		     *item_cache,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entries.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *item_cache )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *item_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *item_cache )->buckets );
+		}
+		memory_free(
+		 *item_cache );
+
+		*item_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties an item cache
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_cache_empty(
+     libmsiecf_item_cache_t *item_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_item_cache_empty";
+	int result            = 1;
+
+	if( item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libmsiecf_item_cache_remove_least_recently_used_entries(
+	     item_cache,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Resizes the buckets
+ * The number of buckets must be a power of 2
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_cache_resize_buckets(
+     libmsiecf_item_cache_t *item_cache,
+     int number_of_buckets,
+     libcerror_error_t **error )
+{
+	libmsiecf_item_cache_entry_t **buckets = NULL;
+	libmsiecf_item_cache_entry_t *entry    = NULL;
+	static char *function                  = "libmsiecf_item_cache_resize_buckets";
+	size_t buckets_size                    = 0;
+	int bucket_index                       = 0;
+
+	if( item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets < LIBMSIECF_ITEM_CACHE_MINIMUM_NUMBER_OF_BUCKETS )
+	 || ( number_of_buckets > LIBMSIECF_ITEM_CACHE_MAXIMUM_NUMBER_OF_BUCKETS )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets_size = sizeof( libmsiecf_item_cache_entry_t * ) * (size_t) number_of_buckets;
+
+	buckets = (libmsiecf_item_cache_entry_t **) memory_allocate(
+	                                             buckets_size );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buckets,
+	     0,
+	     buckets_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		memory_free(
+		 buckets );
+
+		return( -1 );
+	}
+	/* The least recently used list contains all the entries
+	 */
+	for( entry = item_cache->first_entry;
+	     entry != NULL;
+	     entry = entry->next_entry )
+	{
+		bucket_index = (int) ( ( (uint64_t) entry->item_descriptor->file_offset / LIBMSIECF_DEFAULT_BLOCK_SIZE ) & (uint64_t) ( number_of_buckets - 1 ) );
+
+		entry->next_bucket_entry = buckets[ bucket_index ];
+		buckets[ bucket_index ]  = entry;
+	}
+	if( item_cache->buckets != NULL )
+	{
+		memory_free(
+		 item_cache->buckets );
+	}
+	item_cache->buckets           = buckets;
+	item_cache->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Retrieves the entry of a specific item descriptor
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libmsiecf_item_cache_get_entry(
+     libmsiecf_item_cache_t *item_cache,
+     libmsiecf_item_descriptor_t *item_descriptor,
+     libmsiecf_item_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	libmsiecf_item_cache_entry_t *safe_entry = NULL;
+	static char *function                    = "libmsiecf_item_cache_get_entry";
+	int bucket_index                         = 0;
+
+	if( item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_cache->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item cache - missing buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = (int) ( ( (uint64_t) item_descriptor->file_offset / LIBMSIECF_DEFAULT_BLOCK_SIZE ) & (uint64_t) ( item_cache->number_of_buckets - 1 ) );
+
+	for( safe_entry = item_cache->buckets[ bucket_index ];
+	     safe_entry != NULL;
+	     safe_entry = safe_entry->next_bucket_entry )
+	{
+		if( safe_entry->item_descriptor == item_descriptor )
+		{
+			*entry = safe_entry;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Removes the least recently used entries until the size of the cached values
+ * no longer exceeds the maximum size, a maximum size of 0 removes all entries
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_cache_remove_least_recently_used_entries(
+     libmsiecf_item_cache_t *item_cache,
+     size_t maximum_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_item_cache_entry_t **bucket_entry = NULL;
+	libmsiecf_item_cache_entry_t *entry         = NULL;
+	static char *function                       = "libmsiecf_item_cache_remove_least_recently_used_entries";
+	int bucket_index                            = 0;
+	int result                                  = 1;
+
+	if( item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( item_cache->last_entry != NULL )
+	    && ( item_cache->size > maximum_size ) )
+	{
+		entry = item_cache->last_entry;
+
+		bucket_index = (int) ( ( (uint64_t) entry->item_descriptor->file_offset / LIBMSIECF_DEFAULT_BLOCK_SIZE ) & (uint64_t) ( item_cache->number_of_buckets - 1 ) );
+
+		bucket_entry = &( item_cache->buckets[ bucket_index ] );
+
+		while( ( *bucket_entry != NULL )
+		    && ( *bucket_entry != entry ) )
+		{
+			bucket_entry = &( ( *bucket_entry )->next_bucket_entry );
+		}
+		if( *bucket_entry == entry )
+		{
+			*bucket_entry = entry->next_bucket_entry;
+		}
+		item_cache->last_entry = entry->previous_entry;
+
+		if( item_cache->last_entry != NULL )
+		{
+			item_cache->last_entry->next_entry = NULL;
+		}
+		else
+		{
+			item_cache->first_entry = NULL;
+		}
+		item_cache->size              -= entry->value_size;
+		item_cache->number_of_entries -= 1;
+
+		if( entry->free_value(
+		     &( entry->value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 entry );
+	}
+	return( result );
+}
+
+/* Retrieves the maximum size of the cached values
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_cache_get_maximum_size(
+     libmsiecf_item_cache_t *item_cache,
+     size_t *maximum_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_item_cache_get_maximum_size";
+
+	if( item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_size = item_cache->maximum_size;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum size of the cached values
+ * A maximum size of 0 disables the cache
+ * Entries are removed until the size of the cached values no longer exceeds the maximum size
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_cache_set_maximum_size(
+     libmsiecf_item_cache_t *item_cache,
+     size_t maximum_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_item_cache_set_maximum_size";
+	int result            = 1;
+
+	if( item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	item_cache->maximum_size = maximum_size;
+
+	if( libmsiecf_item_cache_remove_least_recently_used_entries(
+	     item_cache,
+	     maximum_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove least recently used entries.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a reference to the cached value of a specific item descriptor
+ * The value is shared with the cache and must be released with the free value function
+ * The entry becomes the most recently used entry
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libmsiecf_item_cache_get_value(
+     libmsiecf_item_cache_t *item_cache,
+     libmsiecf_item_descriptor_t *item_descriptor,
+     intptr_t **value,
+     int (**free_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	libmsiecf_item_cache_entry_t *entry = NULL;
+	static char *function               = "libmsiecf_item_cache_get_value";
+	int result                          = 0;
+
+	if( item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid value value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( free_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free value function.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	/* The entry is moved in the least recently used list hence the write lock
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libmsiecf_item_cache_get_entry(
+	          item_cache,
+	          item_descriptor,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		if( entry->reference_value(
+		     entry->value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reference value.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			*value      = entry->value;
+			*free_value = entry->free_value;
+
+			if( entry != item_cache->first_entry )
+			{
+				entry->previous_entry->next_entry = entry->next_entry;
+
+				if( entry->next_entry != NULL )
+				{
+					entry->next_entry->previous_entry = entry->previous_entry;
+				}
+				else
+				{
+					item_cache->last_entry = entry->previous_entry;
+				}
+				entry->previous_entry                   = NULL;
+				entry->next_entry                       = item_cache->first_entry;
+				item_cache->first_entry->previous_entry = entry;
+				item_cache->first_entry                 = entry;
+			}
+		}
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		if( ( result == 1 )
+		 && ( *value != NULL ) )
+		{
+			( *free_value )(
+			 value,
+			 NULL );
+		}
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets a reference to the value of a specific item descriptor in the cache
+ * The entry becomes the most recently used entry and the least recently used
+ * entries are removed when the size of the cached values exceeds the maximum size
+ * Values that are larger than the maximum size are not cached
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_cache_set_value(
+     libmsiecf_item_cache_t *item_cache,
+     libmsiecf_item_descriptor_t *item_descriptor,
+     intptr_t *value,
+     int (*free_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     int (*reference_value)(
+            intptr_t *value,
+            libcerror_error_t **error ),
+     size_t value_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_item_cache_entry_t *entry = NULL;
+	static char *function               = "libmsiecf_item_cache_set_value";
+	int bucket_index                    = 0;
+	int result                          = 0;
+
+	if( item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( free_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free value function.",
+		 function );
+
+		return( -1 );
+	}
+	if( reference_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid reference value function.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Values that do not fit in the cache are not cached
+	 */
+	if( ( value_size == 0 )
+	 || ( value_size > item_cache->maximum_size ) )
+	{
+		result = 1;
+	}
+	else
+	{
+		/* Another thread could have set the value in the meantime
+		 */
+		result = libmsiecf_item_cache_get_entry(
+		          item_cache,
+		          item_descriptor,
+		          &entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry.",
+			 function );
+
+			goto on_error;
+		}
+		entry = NULL;
+	}
+	if( result == 0 )
+	{
+		if( ( item_cache->number_of_entries >= item_cache->number_of_buckets )
+		 && ( item_cache->number_of_buckets < LIBMSIECF_ITEM_CACHE_MAXIMUM_NUMBER_OF_BUCKETS ) )
+		{
+			if( libmsiecf_item_cache_resize_buckets(
+			     item_cache,
+			     item_cache->number_of_buckets * 2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize buckets.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		entry = memory_allocate_structure(
+		         libmsiecf_item_cache_entry_t );
+
+		if( entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     entry,
+		     0,
+		     sizeof( libmsiecf_item_cache_entry_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( reference_value(
+		     value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reference value.",
+			 function );
+
+			goto on_error;
+		}
+		entry->item_descriptor = item_descriptor;
+		entry->value           = value;
+		entry->free_value      = free_value;
+		entry->reference_value = reference_value;
+		entry->value_size      = value_size;
+
+		bucket_index = (int) ( ( (uint64_t) item_descriptor->file_offset / LIBMSIECF_DEFAULT_BLOCK_SIZE ) & (uint64_t) ( item_cache->number_of_buckets - 1 ) );
+
+		entry->next_bucket_entry            = item_cache->buckets[ bucket_index ];
+		item_cache->buckets[ bucket_index ] = entry;
+
+		entry->next_entry = item_cache->first_entry;
+
+		if( item_cache->first_entry != NULL )
+		{
+			item_cache->first_entry->previous_entry = entry;
+		}
+		else
+		{
+			item_cache->last_entry = entry;
+		}
+		item_cache->first_entry = entry;
+
+		item_cache->size              += value_size;
+		item_cache->number_of_entries += 1;
+
+		entry = NULL;
+
+		if( libmsiecf_item_cache_remove_least_recently_used_entries(
+		     item_cache,
+		     item_cache->maximum_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     item_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( entry != NULL )
+	{
+		if( entry->value != NULL )
+		{
+			free_value(
+			 &( entry->value ),
+			 NULL );
+		}
+		memory_free(
+		 entry );
+	}
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 item_cache->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
@@ -0,0 +1,182 @@
+/*
+ * Item cache functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMSIECF_ITEM_CACHE_H )
+#define _LIBMSIECF_ITEM_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmsiecf_item_descriptor.h"
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmsiecf_item_cache_entry libmsiecf_item_cache_entry_t;
+
+struct libmsiecf_item_cache_entry
+{
+	/* The item descriptor
+	 */
+	libmsiecf_item_descriptor_t *item_descriptor;
+
+	/* The value, which is shared with the items by reference count
+	 */
+	intptr_t *value;
+
+	/* The free value function
+	 */
+	int (*free_value)(
+	       intptr_t **value,
+	       libcerror_error_t **error );
+
+	/* The reference value function
+	 */
+	int (*reference_value)(
+	       intptr_t *value,
+	       libcerror_error_t **error );
+
+	/* The value size
+	 */
+	size_t value_size;
+
+	/* The previous entry in the least recently used list
+	 */
+	libmsiecf_item_cache_entry_t *previous_entry;
+
+	/* The next entry in the least recently used list
+	 */
+	libmsiecf_item_cache_entry_t *next_entry;
+
+	/* The next entry in the same bucket
+	 */
+	libmsiecf_item_cache_entry_t *next_bucket_entry;
+};
+
+typedef struct libmsiecf_item_cache libmsiecf_item_cache_t;
+
+struct libmsiecf_item_cache
+{
+	/* The maximum size of the cached values
+	 */
+	size_t maximum_size;
+
+	/* The size of the cached values
+	 */
+	size_t size;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The buckets
+	 */
+	libmsiecf_item_cache_entry_t **buckets;
+
+	/* The number of buckets
+	 */
+	int number_of_buckets;
+
+	/* The most recently used entry
+	 */
+	libmsiecf_item_cache_entry_t *first_entry;
+
+	/* The least recently used entry
+	 */
+	libmsiecf_item_cache_entry_t *last_entry;
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libmsiecf_item_cache_initialize(
+     libmsiecf_item_cache_t **item_cache,
+     size_t maximum_size,
+     libcerror_error_t **error );
+
+int libmsiecf_item_cache_free(
+     libmsiecf_item_cache_t **item_cache,
+     libcerror_error_t **error );
+
+int libmsiecf_item_cache_empty(
+     libmsiecf_item_cache_t *item_cache,
+     libcerror_error_t **error );
+
+int libmsiecf_item_cache_resize_buckets(
+     libmsiecf_item_cache_t *item_cache,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+int libmsiecf_item_cache_get_entry(
+     libmsiecf_item_cache_t *item_cache,
+     libmsiecf_item_descriptor_t *item_descriptor,
+     libmsiecf_item_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int libmsiecf_item_cache_remove_least_recently_used_entries(
+     libmsiecf_item_cache_t *item_cache,
+     size_t maximum_size,
+     libcerror_error_t **error );
+
+int libmsiecf_item_cache_get_maximum_size(
+     libmsiecf_item_cache_t *item_cache,
+     size_t *maximum_size,
+     libcerror_error_t **error );
+
+int libmsiecf_item_cache_set_maximum_size(
+     libmsiecf_item_cache_t *item_cache,
+     size_t maximum_size,
+     libcerror_error_t **error );
+
+int libmsiecf_item_cache_get_value(
+     libmsiecf_item_cache_t *item_cache,
+     libmsiecf_item_descriptor_t *item_descriptor,
+     intptr_t **value,
+     int (**free_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libmsiecf_item_cache_set_value(
+     libmsiecf_item_cache_t *item_cache,
+     libmsiecf_item_descriptor_t *item_descriptor,
+     intptr_t *value,
+     int (*free_value)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     int (*reference_value)(
+            intptr_t *value,
+            libcerror_error_t **error ),
+     size_t value_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMSIECF_ITEM_CACHE_H ) */
+
@@ -50,6 +50,11 @@ struct libmsiecf_item_descriptor
 	/* Item descriptor flags
 	 */
 	uint8_t flags;
+
+	/* Value to indicate the item descriptor is stale
+	 * since a refresh found its record overwritten by another record
+	 */
+	uint8_t is_stale;
 };
 
 int libmsiecf_item_descriptor_initialize(
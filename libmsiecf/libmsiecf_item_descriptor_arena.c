@@ -0,0 +1,449 @@
+/*
+ * Item descriptor arena functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmsiecf_definitions.h"
+#include "libmsiecf_item_descriptor.h"
+#include "libmsiecf_item_descriptor_arena.h"
+#include "libmsiecf_libcerror.h"
+
+/* Creates an item descriptor arena
+ * Make sure the value item_descriptor_arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_descriptor_arena_initialize(
+     libmsiecf_item_descriptor_arena_t **item_descriptor_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_item_descriptor_arena_initialize";
+
+	if( item_descriptor_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item descriptor arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item_descriptor_arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item descriptor arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*item_descriptor_arena = memory_allocate_structure(
+	                          libmsiecf_item_descriptor_arena_t );
+
+	if( *item_descriptor_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item descriptor arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *item_descriptor_arena,
+	     0,
+	     sizeof( libmsiecf_item_descriptor_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear item descriptor arena.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *item_descriptor_arena != NULL )
+	{
+		memory_free(
+		 *item_descriptor_arena );
+
+		*item_descriptor_arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an item descriptor arena
+ * This also frees the item descriptors allocated from the arena
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_descriptor_arena_free(
+     libmsiecf_item_descriptor_arena_t **item_descriptor_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_item_descriptor_arena_free";
+	int result            = 1;
+
+	if( item_descriptor_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item descriptor arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item_descriptor_arena != NULL )
+	{
+		if( libmsiecf_item_descriptor_arena_empty(
+		     *item_descriptor_arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty item descriptor arena.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *item_descriptor_arena );
+
+		*item_descriptor_arena = NULL;
+	}
+	return( result );
+}
+
+/* Empties an item descriptor arena
+ * This frees the item descriptors allocated from the arena
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_descriptor_arena_empty(
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     libcerror_error_t **error )
+{
+	libmsiecf_item_descriptor_slab_t *next_slab = NULL;
+	libmsiecf_item_descriptor_slab_t *slab      = NULL;
+	static char *function                       = "libmsiecf_item_descriptor_arena_empty";
+
+	if( item_descriptor_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item descriptor arena.",
+		 function );
+
+		return( -1 );
+	}
+	slab = item_descriptor_arena->first_slab;
+
+	while( slab != NULL )
+	{
+		next_slab = slab->next_slab;
+
+		if( slab->item_descriptors != NULL )
+		{
+			memory_free(
+			 slab->item_descriptors );
+		}
+		memory_free(
+		 slab );
+
+		slab = next_slab;
+	}
+	item_descriptor_arena->first_slab                 = NULL;
+	item_descriptor_arena->last_slab                  = NULL;
+	item_descriptor_arena->number_of_item_descriptors = 0;
+
+	return( 1 );
+}
+
+/* Allocates an item descriptor from the arena
+ * The item descriptor is cleared and remains managed by the arena
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_descriptor_arena_allocate(
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     libmsiecf_item_descriptor_t **item_descriptor,
+     libcerror_error_t **error )
+{
+	libmsiecf_item_descriptor_slab_t *slab = NULL;
+	static char *function                  = "libmsiecf_item_descriptor_arena_allocate";
+	int maximum_number_of_item_descriptors = 0;
+
+	if( item_descriptor_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item descriptor arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_descriptor_arena->number_of_item_descriptors == (int) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item descriptor arena - number of item descriptors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slab = item_descriptor_arena->last_slab;
+
+	if( ( slab == NULL )
+	 || ( slab->number_of_item_descriptors >= slab->maximum_number_of_item_descriptors ) )
+	{
+		/* Every new slab is twice the size of the preceding slab to keep
+		 * the number of allocations low for large files
+		 */
+		if( slab == NULL )
+		{
+			maximum_number_of_item_descriptors = LIBMSIECF_ITEM_DESCRIPTOR_ARENA_MINIMUM_SLAB_SIZE;
+		}
+		else if( slab->maximum_number_of_item_descriptors < ( LIBMSIECF_ITEM_DESCRIPTOR_ARENA_MAXIMUM_SLAB_SIZE / 2 ) )
+		{
+			maximum_number_of_item_descriptors = slab->maximum_number_of_item_descriptors * 2;
+		}
+		else
+		{
+			maximum_number_of_item_descriptors = LIBMSIECF_ITEM_DESCRIPTOR_ARENA_MAXIMUM_SLAB_SIZE;
+		}
+		slab = memory_allocate_structure(
+		        libmsiecf_item_descriptor_slab_t );
+
+		if( slab == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create slab.",
+			 function );
+
+			goto on_error;
+		}
+		slab->next_slab                          = NULL;
+		slab->number_of_item_descriptors         = 0;
+		slab->maximum_number_of_item_descriptors = maximum_number_of_item_descriptors;
+
+		slab->item_descriptors = (libmsiecf_item_descriptor_t *) memory_allocate(
+		                                                          sizeof( libmsiecf_item_descriptor_t ) * maximum_number_of_item_descriptors );
+
+		if( slab->item_descriptors == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create slab item descriptors.",
+			 function );
+
+			goto on_error;
+		}
+		if( item_descriptor_arena->last_slab == NULL )
+		{
+			item_descriptor_arena->first_slab = slab;
+		}
+		else
+		{
+			item_descriptor_arena->last_slab->next_slab = slab;
+		}
+		item_descriptor_arena->last_slab = slab;
+	}
+	*item_descriptor = &( slab->item_descriptors[ slab->number_of_item_descriptors ] );
+
+	if( memory_set(
+	     *item_descriptor,
+	     0,
+	     sizeof( libmsiecf_item_descriptor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear item descriptor.",
+		 function );
+
+		*item_descriptor = NULL;
+
+		return( -1 );
+	}
+	slab->number_of_item_descriptors += 1;
+
+	item_descriptor_arena->number_of_item_descriptors += 1;
+
+	return( 1 );
+
+on_error:
+	if( slab != NULL )
+	{
+		memory_free(
+		 slab );
+	}
+	return( -1 );
+}
+
+/* Moves the item descriptors of the source arena to the destination arena
+ * The item descriptors retain their address, afterwards the source arena is empty
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_descriptor_arena_move(
+     libmsiecf_item_descriptor_arena_t *destination_item_descriptor_arena,
+     libmsiecf_item_descriptor_arena_t *source_item_descriptor_arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_item_descriptor_arena_move";
+
+	if( destination_item_descriptor_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination item descriptor arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_item_descriptor_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source item descriptor arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_item_descriptor_arena == source_item_descriptor_arena )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source item descriptor arena value same as destination.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_item_descriptor_arena->first_slab == NULL )
+	{
+		return( 1 );
+	}
+	if( source_item_descriptor_arena->number_of_item_descriptors > ( (int) INT_MAX - destination_item_descriptor_arena->number_of_item_descriptors ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source item descriptor arena - number of item descriptors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( destination_item_descriptor_arena->last_slab == NULL )
+	{
+		destination_item_descriptor_arena->first_slab = source_item_descriptor_arena->first_slab;
+	}
+	else
+	{
+		destination_item_descriptor_arena->last_slab->next_slab = source_item_descriptor_arena->first_slab;
+	}
+	destination_item_descriptor_arena->last_slab                   = source_item_descriptor_arena->last_slab;
+	destination_item_descriptor_arena->number_of_item_descriptors += source_item_descriptor_arena->number_of_item_descriptors;
+
+	source_item_descriptor_arena->first_slab                 = NULL;
+	source_item_descriptor_arena->last_slab                  = NULL;
+	source_item_descriptor_arena->number_of_item_descriptors = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the number of item descriptors allocated from the arena
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_descriptor_arena_get_number_of_item_descriptors(
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     int *number_of_item_descriptors,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_item_descriptor_arena_get_number_of_item_descriptors";
+
+	if( item_descriptor_arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item descriptor arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_item_descriptors == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of item descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_item_descriptors = item_descriptor_arena->number_of_item_descriptors;
+
+	return( 1 );
+}
+
@@ -0,0 +1,105 @@
+/*
+ * Item descriptor arena functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMSIECF_ITEM_DESCRIPTOR_ARENA_H )
+#define _LIBMSIECF_ITEM_DESCRIPTOR_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmsiecf_item_descriptor.h"
+#include "libmsiecf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmsiecf_item_descriptor_slab libmsiecf_item_descriptor_slab_t;
+
+struct libmsiecf_item_descriptor_slab
+{
+	/* The next slab
+	 */
+	libmsiecf_item_descriptor_slab_t *next_slab;
+
+	/* The item descriptors
+	 */
+	libmsiecf_item_descriptor_t *item_descriptors;
+
+	/* The number of item descriptors in use
+	 */
+	int number_of_item_descriptors;
+
+	/* The maximum number of item descriptors
+	 */
+	int maximum_number_of_item_descriptors;
+};
+
+typedef struct libmsiecf_item_descriptor_arena libmsiecf_item_descriptor_arena_t;
+
+struct libmsiecf_item_descriptor_arena
+{
+	/* The first slab
+	 */
+	libmsiecf_item_descriptor_slab_t *first_slab;
+
+	/* The last slab, from which item descriptors are allocated
+	 */
+	libmsiecf_item_descriptor_slab_t *last_slab;
+
+	/* The number of item descriptors
+	 */
+	int number_of_item_descriptors;
+};
+
+int libmsiecf_item_descriptor_arena_initialize(
+     libmsiecf_item_descriptor_arena_t **item_descriptor_arena,
+     libcerror_error_t **error );
+
+int libmsiecf_item_descriptor_arena_free(
+     libmsiecf_item_descriptor_arena_t **item_descriptor_arena,
+     libcerror_error_t **error );
+
+int libmsiecf_item_descriptor_arena_empty(
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     libcerror_error_t **error );
+
+int libmsiecf_item_descriptor_arena_allocate(
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     libmsiecf_item_descriptor_t **item_descriptor,
+     libcerror_error_t **error );
+
+int libmsiecf_item_descriptor_arena_move(
+     libmsiecf_item_descriptor_arena_t *destination_item_descriptor_arena,
+     libmsiecf_item_descriptor_arena_t *source_item_descriptor_arena,
+     libcerror_error_t **error );
+
+int libmsiecf_item_descriptor_arena_get_number_of_item_descriptors(
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     int *number_of_item_descriptors,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMSIECF_ITEM_DESCRIPTOR_ARENA_H ) */
+
@@ -0,0 +1,1251 @@
+/*
+ * Item view functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmsiecf_definitions.h"
+#include "libmsiecf_io_handle.h"
+#include "libmsiecf_item_descriptor.h"
+#include "libmsiecf_item_view.h"
+#include "libmsiecf_libbfio.h"
+#include "libmsiecf_libcerror.h"
+
+#include "msiecf_leak_record.h"
+#include "msiecf_redr_record.h"
+#include "msiecf_url_record.h"
+
+/* Creates an item view
+ * Make sure the value item_view is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_view_initialize(
+     libmsiecf_item_view_t **item_view,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_view_t *internal_item_view = NULL;
+	static char *function                              = "libmsiecf_item_view_initialize";
+
+	if( item_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item view.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item_view != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid item view value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_view = memory_allocate_structure(
+	                      libmsiecf_internal_item_view_t );
+
+	if( internal_item_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create item view.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_item_view,
+	     0,
+	     sizeof( libmsiecf_internal_item_view_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear item view.",
+		 function );
+
+		goto on_error;
+	}
+	*item_view = (libmsiecf_item_view_t *) internal_item_view;
+
+	return( 1 );
+
+on_error:
+	if( internal_item_view != NULL )
+	{
+		memory_free(
+		 internal_item_view );
+	}
+	return( -1 );
+}
+
+/* Frees an item view
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_view_free(
+     libmsiecf_item_view_t **item_view,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_view_t *internal_item_view = NULL;
+	static char *function                              = "libmsiecf_item_view_free";
+
+	if( item_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item view.",
+		 function );
+
+		return( -1 );
+	}
+	if( *item_view != NULL )
+	{
+		internal_item_view = (libmsiecf_internal_item_view_t *) *item_view;
+		*item_view         = NULL;
+
+		/* The item_descriptor reference is freed elsewhere
+		 */
+		if( internal_item_view->record_data != NULL )
+		{
+			memory_free(
+			 internal_item_view->record_data );
+		}
+		memory_free(
+		 internal_item_view );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data of a string stored in the record data
+ * The string data includes the end-of-string character if present
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmsiecf_internal_item_view_get_string_data(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t string_offset,
+     uint8_t item_flags,
+     const uint8_t **string_data,
+     size_t *string_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_internal_item_view_get_string_data";
+	size_t data_offset    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string data.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_offset == 0 )
+	{
+		return( 0 );
+	}
+	if( (size_t) string_offset >= data_size )
+	{
+		if( ( item_flags & LIBMSIECF_ITEM_FLAG_PARTIAL ) != 0 )
+		{
+			return( 0 );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: string offset exceeds size of record data.",
+		 function );
+
+		return( -1 );
+	}
+	for( data_offset = (size_t) string_offset;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		if( data[ data_offset ] == 0 )
+		{
+			data_offset++;
+
+			break;
+		}
+	}
+	*string_data      = &( data[ string_offset ] );
+	*string_data_size = data_offset - (size_t) string_offset;
+
+	return( 1 );
+}
+
+/* Reads the item view values from the record data
+ * The location and filename reference the data, which must remain valid while the view is used
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_internal_item_view_read_data(
+     libmsiecf_internal_item_view_t *internal_item_view,
+     libmsiecf_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const char *signature     = NULL;
+	static char *function     = "libmsiecf_internal_item_view_read_data";
+	size_t required_data_size = 0;
+	uint32_t filename_offset  = 0;
+	uint32_t location_offset  = 0;
+	uint8_t item_flags        = 0;
+	uint8_t item_type         = 0;
+	int result                = 0;
+
+	if( internal_item_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item view.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item_view->item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item view - missing item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	item_type  = internal_item_view->item_descriptor->type;
+	item_flags = internal_item_view->item_descriptor->flags;
+
+	internal_item_view->has_record_header_values = 0;
+	internal_item_view->primary_time             = 0;
+	internal_item_view->secondary_time           = 0;
+	internal_item_view->expiration_time          = 0;
+	internal_item_view->last_checked_time        = 0;
+	internal_item_view->number_of_hits           = 0;
+	internal_item_view->location                 = NULL;
+	internal_item_view->location_size            = 0;
+	internal_item_view->filename                 = NULL;
+	internal_item_view->filename_size            = 0;
+
+	switch( item_type )
+	{
+		case LIBMSIECF_ITEM_TYPE_URL:
+			if( ( io_handle->major_version == 4 )
+			 && ( io_handle->minor_version == 7 ) )
+			{
+				required_data_size = sizeof( msiecf_url_record_header_v47_t );
+			}
+			else if( ( io_handle->major_version == 5 )
+			      && ( io_handle->minor_version == 2 ) )
+			{
+				required_data_size = sizeof( msiecf_url_record_header_v52_t );
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported format version: %d.%d.",
+				 function,
+				 io_handle->major_version,
+				 io_handle->minor_version );
+
+				return( -1 );
+			}
+			signature = "URL ";
+
+			break;
+
+		case LIBMSIECF_ITEM_TYPE_REDIRECTED:
+			required_data_size = sizeof( msiecf_redr_record_header_t );
+			signature          = "REDR";
+
+			break;
+
+		case LIBMSIECF_ITEM_TYPE_LEAK:
+			required_data_size = sizeof( msiecf_leak_record_header_t );
+			signature          = "LEAK";
+
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported item type: %" PRIu8 ".",
+			 function,
+			 item_type );
+
+			return( -1 );
+	}
+	if( data_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     signature,
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	/* The record data of partial items can be smaller than the record header
+	 */
+	if( data_size < required_data_size )
+	{
+		if( ( item_flags & LIBMSIECF_ITEM_FLAG_PARTIAL ) != 0 )
+		{
+			return( 1 );
+		}
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_type == LIBMSIECF_ITEM_TYPE_URL )
+	{
+		if( io_handle->major_version == 4 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (msiecf_url_record_header_v47_t *) data )->secondary_filetime,
+			 internal_item_view->secondary_time );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (msiecf_url_record_header_v47_t *) data )->primary_filetime,
+			 internal_item_view->primary_time );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (msiecf_url_record_header_v47_t *) data )->expiration_time,
+			 internal_item_view->expiration_time );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (msiecf_url_record_header_v47_t *) data )->location_offset,
+			 location_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (msiecf_url_record_header_v47_t *) data )->filename_offset,
+			 filename_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (msiecf_url_record_header_v47_t *) data )->last_checked_time,
+			 internal_item_view->last_checked_time );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (msiecf_url_record_header_v47_t *) data )->number_of_hits,
+			 internal_item_view->number_of_hits );
+		}
+		else
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (msiecf_url_record_header_v52_t *) data )->secondary_filetime,
+			 internal_item_view->secondary_time );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 ( (msiecf_url_record_header_v52_t *) data )->primary_filetime,
+			 internal_item_view->primary_time );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (msiecf_url_record_header_v52_t *) data )->expiration_time,
+			 internal_item_view->expiration_time );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (msiecf_url_record_header_v52_t *) data )->location_offset,
+			 location_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (msiecf_url_record_header_v52_t *) data )->filename_offset,
+			 filename_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (msiecf_url_record_header_v52_t *) data )->last_checked_time,
+			 internal_item_view->last_checked_time );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (msiecf_url_record_header_v52_t *) data )->number_of_hits,
+			 internal_item_view->number_of_hits );
+		}
+		internal_item_view->has_record_header_values = 1;
+	}
+	else if( item_type == LIBMSIECF_ITEM_TYPE_REDIRECTED )
+	{
+		location_offset = 16;
+	}
+	else if( item_type == LIBMSIECF_ITEM_TYPE_LEAK )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (msiecf_leak_record_header_t *) data )->filename_offset,
+		 filename_offset );
+	}
+	result = libmsiecf_internal_item_view_get_string_data(
+	          data,
+	          data_size,
+	          location_offset,
+	          item_flags,
+	          &( internal_item_view->location ),
+	          &( internal_item_view->location_size ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve location data.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmsiecf_internal_item_view_get_string_data(
+	          data,
+	          data_size,
+	          filename_offset,
+	          item_flags,
+	          &( internal_item_view->filename ),
+	          &( internal_item_view->filename_size ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the item view values of a specific item descriptor
+ * The record data is referenced from the file data in memory if available,
+ * otherwise it is read into the record data buffer of the item view
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_internal_item_view_read_file_io_handle(
+     libmsiecf_internal_item_view_t *internal_item_view,
+     libmsiecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmsiecf_item_descriptor_t *item_descriptor,
+     libcerror_error_t **error )
+{
+	const uint8_t *record_data = NULL;
+	uint8_t *reallocation      = NULL;
+	static char *function      = "libmsiecf_internal_item_view_read_file_io_handle";
+	size_t record_size         = 0;
+	ssize_t read_count         = 0;
+	int result                 = 0;
+
+	if( internal_item_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item view.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( item_descriptor->record_size == 0 )
+	 || ( item_descriptor->record_size > (size32_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBMSIECF_DEFAULT_BLOCK_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item descriptor - record size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_view->item_descriptor = item_descriptor;
+
+	record_size = (size_t) item_descriptor->record_size;
+
+	/* Add one block for tainted URL records, analogous to reading the URL values
+	 */
+	if( ( item_descriptor->type == LIBMSIECF_ITEM_TYPE_URL )
+	 && ( ( item_descriptor->flags & LIBMSIECF_ITEM_FLAG_TAINTED ) != 0 ) )
+	{
+		record_size += LIBMSIECF_DEFAULT_BLOCK_SIZE;
+	}
+	result = libmsiecf_io_handle_get_file_data(
+	          io_handle,
+	          item_descriptor->file_offset,
+	          record_size,
+	          &record_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 item_descriptor->file_offset,
+		 item_descriptor->file_offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( record_size > internal_item_view->record_data_size )
+		{
+			reallocation = (uint8_t *) memory_reallocate(
+			                            internal_item_view->record_data,
+			                            sizeof( uint8_t ) * record_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize record data.",
+				 function );
+
+				return( -1 );
+			}
+			internal_item_view->record_data      = reallocation;
+			internal_item_view->record_data_size = record_size;
+		}
+		read_count = libmsiecf_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              internal_item_view->record_data,
+		              record_size,
+		              item_descriptor->file_offset,
+		              error );
+
+		if( read_count != (ssize_t) record_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 item_descriptor->file_offset,
+			 item_descriptor->file_offset );
+
+			return( -1 );
+		}
+		record_data = internal_item_view->record_data;
+	}
+	if( libmsiecf_internal_item_view_read_data(
+	     internal_item_view,
+	     io_handle,
+	     record_data,
+	     record_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read item view values.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the type
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_view_get_type(
+     libmsiecf_item_view_t *item_view,
+     uint8_t *item_type,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_view_t *internal_item_view = NULL;
+	static char *function                              = "libmsiecf_item_view_get_type";
+
+	if( item_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_view = (libmsiecf_internal_item_view_t *) item_view;
+
+	if( internal_item_view->item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item view - missing item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item type.",
+		 function );
+
+		return( -1 );
+	}
+	*item_type = internal_item_view->item_descriptor->type;
+
+	return( 1 );
+}
+
+/* Retrieves the flags
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_view_get_flags(
+     libmsiecf_item_view_t *item_view,
+     uint8_t *item_flags,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_view_t *internal_item_view = NULL;
+	static char *function                              = "libmsiecf_item_view_get_flags";
+
+	if( item_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_view = (libmsiecf_internal_item_view_t *) item_view;
+
+	if( internal_item_view->item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item view - missing item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item flags.",
+		 function );
+
+		return( -1 );
+	}
+	*item_flags = internal_item_view->item_descriptor->flags;
+
+	return( 1 );
+}
+
+/* Retrieves the offset range
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_item_view_get_offset_range(
+     libmsiecf_item_view_t *item_view,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_view_t *internal_item_view = NULL;
+	static char *function                              = "libmsiecf_item_view_get_offset_range";
+
+	if( item_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_view = (libmsiecf_internal_item_view_t *) item_view;
+
+	if( internal_item_view->item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item view - missing item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = internal_item_view->item_descriptor->file_offset;
+	*size   = (size64_t) internal_item_view->item_descriptor->record_size;
+
+	return( 1 );
+}
+
+/* Retrieves the primary date and time
+ * Contains a FILETIME
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmsiecf_item_view_get_primary_time(
+     libmsiecf_item_view_t *item_view,
+     uint64_t *primary_time,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_view_t *internal_item_view = NULL;
+	static char *function                              = "libmsiecf_item_view_get_primary_time";
+
+	if( item_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_view = (libmsiecf_internal_item_view_t *) item_view;
+
+	if( internal_item_view->item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item view - missing item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( primary_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid primary time.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_item_view->item_descriptor->type != LIBMSIECF_ITEM_TYPE_URL )
+	 || ( internal_item_view->has_record_header_values == 0 ) )
+	{
+		return( 0 );
+	}
+	*primary_time = internal_item_view->primary_time;
+
+	return( 1 );
+}
+
+/* Retrieves the secondary date and time
+ * Contains a FILETIME
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmsiecf_item_view_get_secondary_time(
+     libmsiecf_item_view_t *item_view,
+     uint64_t *secondary_time,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_view_t *internal_item_view = NULL;
+	static char *function                              = "libmsiecf_item_view_get_secondary_time";
+
+	if( item_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_view = (libmsiecf_internal_item_view_t *) item_view;
+
+	if( internal_item_view->item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item view - missing item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( secondary_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid secondary time.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_item_view->item_descriptor->type != LIBMSIECF_ITEM_TYPE_URL )
+	 || ( internal_item_view->has_record_header_values == 0 ) )
+	{
+		return( 0 );
+	}
+	*secondary_time = internal_item_view->secondary_time;
+
+	return( 1 );
+}
+
+/* Retrieves the expiration date and time
+ * Contains a FILETIME in format version 4.7 and a FAT date time in 5.2
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmsiecf_item_view_get_expiration_time(
+     libmsiecf_item_view_t *item_view,
+     uint64_t *expiration_time,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_view_t *internal_item_view = NULL;
+	static char *function                              = "libmsiecf_item_view_get_expiration_time";
+
+	if( item_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_view = (libmsiecf_internal_item_view_t *) item_view;
+
+	if( internal_item_view->item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item view - missing item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( expiration_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expiration time.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_item_view->item_descriptor->type != LIBMSIECF_ITEM_TYPE_URL )
+	 || ( internal_item_view->has_record_header_values == 0 ) )
+	{
+		return( 0 );
+	}
+	*expiration_time = internal_item_view->expiration_time;
+
+	return( 1 );
+}
+
+/* Retrieves the last checked date and time
+ * Contains a FAT date time
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmsiecf_item_view_get_last_checked_time(
+     libmsiecf_item_view_t *item_view,
+     uint32_t *last_checked_time,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_view_t *internal_item_view = NULL;
+	static char *function                              = "libmsiecf_item_view_get_last_checked_time";
+
+	if( item_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_view = (libmsiecf_internal_item_view_t *) item_view;
+
+	if( internal_item_view->item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item view - missing item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_checked_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last checked time.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_item_view->item_descriptor->type != LIBMSIECF_ITEM_TYPE_URL )
+	 || ( internal_item_view->has_record_header_values == 0 ) )
+	{
+		return( 0 );
+	}
+	*last_checked_time = internal_item_view->last_checked_time;
+
+	return( 1 );
+}
+
+/* Retrieves the number of hits
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmsiecf_item_view_get_number_of_hits(
+     libmsiecf_item_view_t *item_view,
+     uint32_t *number_of_hits,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_view_t *internal_item_view = NULL;
+	static char *function                              = "libmsiecf_item_view_get_number_of_hits";
+
+	if( item_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_view = (libmsiecf_internal_item_view_t *) item_view;
+
+	if( internal_item_view->item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item view - missing item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_item_view->item_descriptor->type != LIBMSIECF_ITEM_TYPE_URL )
+	 || ( internal_item_view->has_record_header_values == 0 ) )
+	{
+		return( 0 );
+	}
+	*number_of_hits = internal_item_view->number_of_hits;
+
+	return( 1 );
+}
+
+/* Retrieves the location
+ * The location references the record data and is only valid while the item view is not reused
+ * The location size includes the end-of-string character if present
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmsiecf_item_view_get_location(
+     libmsiecf_item_view_t *item_view,
+     const uint8_t **location,
+     size_t *location_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_view_t *internal_item_view = NULL;
+	static char *function                              = "libmsiecf_item_view_get_location";
+
+	if( item_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_view = (libmsiecf_internal_item_view_t *) item_view;
+
+	if( location == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location.",
+		 function );
+
+		return( -1 );
+	}
+	if( location_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item_view->location == NULL )
+	{
+		return( 0 );
+	}
+	*location      = internal_item_view->location;
+	*location_size = internal_item_view->location_size;
+
+	return( 1 );
+}
+
+/* Retrieves the filename
+ * The filename references the record data and is only valid while the item view is not reused
+ * The filename size includes the end-of-string character if present
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmsiecf_item_view_get_filename(
+     libmsiecf_item_view_t *item_view,
+     const uint8_t **filename,
+     size_t *filename_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_view_t *internal_item_view = NULL;
+	static char *function                              = "libmsiecf_item_view_get_filename";
+
+	if( item_view == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item view.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item_view = (libmsiecf_internal_item_view_t *) item_view;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item_view->filename == NULL )
+	{
+		return( 0 );
+	}
+	*filename      = internal_item_view->filename;
+	*filename_size = internal_item_view->filename_size;
+
+	return( 1 );
+}
@@ -0,0 +1,195 @@
+/*
+ * Item view functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMSIECF_ITEM_VIEW_H )
+#define _LIBMSIECF_ITEM_VIEW_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmsiecf_extern.h"
+#include "libmsiecf_io_handle.h"
+#include "libmsiecf_item_descriptor.h"
+#include "libmsiecf_libbfio.h"
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmsiecf_internal_item_view libmsiecf_internal_item_view_t;
+
+struct libmsiecf_internal_item_view
+{
+	/* The item descriptor
+	 */
+	libmsiecf_item_descriptor_t *item_descriptor;
+
+	/* Value to indicate the values of the record header were read
+	 */
+	uint8_t has_record_header_values;
+
+	/* The primary date and time
+	 */
+	uint64_t primary_time;
+
+	/* The secondary date and time
+	 */
+	uint64_t secondary_time;
+
+	/* The expiration date and time
+	 */
+	uint64_t expiration_time;
+
+	/* The last checked date and time
+	 */
+	uint32_t last_checked_time;
+
+	/* The number of hits
+	 */
+	uint32_t number_of_hits;
+
+	/* The location, which references the record data
+	 */
+	const uint8_t *location;
+
+	/* The location size
+	 */
+	size_t location_size;
+
+	/* The filename, which references the record data
+	 */
+	const uint8_t *filename;
+
+	/* The filename size
+	 */
+	size_t filename_size;
+
+	/* The record data buffer, used when the file data is not read into memory
+	 */
+	uint8_t *record_data;
+
+	/* The record data buffer size
+	 */
+	size_t record_data_size;
+};
+
+int libmsiecf_item_view_initialize(
+     libmsiecf_item_view_t **item_view,
+     libcerror_error_t **error );
+
+int libmsiecf_item_view_free(
+     libmsiecf_item_view_t **item_view,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_item_view_get_string_data(
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t string_offset,
+     uint8_t item_flags,
+     const uint8_t **string_data,
+     size_t *string_data_size,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_item_view_read_data(
+     libmsiecf_internal_item_view_t *internal_item_view,
+     libmsiecf_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_item_view_read_file_io_handle(
+     libmsiecf_internal_item_view_t *internal_item_view,
+     libmsiecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmsiecf_item_descriptor_t *item_descriptor,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_item_view_get_type(
+     libmsiecf_item_view_t *item_view,
+     uint8_t *item_type,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_item_view_get_flags(
+     libmsiecf_item_view_t *item_view,
+     uint8_t *item_flags,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_item_view_get_offset_range(
+     libmsiecf_item_view_t *item_view,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_item_view_get_primary_time(
+     libmsiecf_item_view_t *item_view,
+     uint64_t *primary_time,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_item_view_get_secondary_time(
+     libmsiecf_item_view_t *item_view,
+     uint64_t *secondary_time,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_item_view_get_expiration_time(
+     libmsiecf_item_view_t *item_view,
+     uint64_t *expiration_time,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_item_view_get_last_checked_time(
+     libmsiecf_item_view_t *item_view,
+     uint32_t *last_checked_time,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_item_view_get_number_of_hits(
+     libmsiecf_item_view_t *item_view,
+     uint32_t *number_of_hits,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_item_view_get_location(
+     libmsiecf_item_view_t *item_view,
+     const uint8_t **location,
+     size_t *location_size,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_item_view_get_filename(
+     libmsiecf_item_view_t *item_view,
+     const uint8_t **filename,
+     size_t *filename_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMSIECF_ITEM_VIEW_H ) */
+
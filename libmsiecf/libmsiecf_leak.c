@@ -340,6 +340,99 @@ int libmsiecf_leak_get_filename(
 	return( 1 );
 }
 
+/* Retrieves a view of the filename
+ * The view references the record data of the item and is valid for the lifetime of the item
+ * The filename is not converted and uses the ASCII codepage, including the end of string character if present
+ * Returns 1 if successful, 0 if no filename or -1 on error
+ */
+int libmsiecf_leak_get_filename_view(
+     libmsiecf_item_t *leak,
+     const uint8_t **filename,
+     size_t *filename_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_t *internal_item = NULL;
+	static char *function                    = "libmsiecf_leak_get_filename_view";
+
+	if( leak == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leak.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libmsiecf_internal_item_t *) leak;
+
+	if( internal_item->item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->item_descriptor->type != LIBMSIECF_ITEM_TYPE_LEAK )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type: %" PRIu8 ".",
+		 function,
+		 internal_item->item_descriptor->type );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing item values.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (libmsiecf_leak_values_t *) internal_item->value )->filename_data == NULL )
+	{
+		return( 0 );
+	}
+	*filename      = ( (libmsiecf_leak_values_t *) internal_item->value )->filename_data;
+	*filename_size = ( (libmsiecf_leak_values_t *) internal_item->value )->filename_data_size;
+
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-8 encoded filename
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if no filename or -1 on error
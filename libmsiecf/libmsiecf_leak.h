@@ -58,6 +58,13 @@ int libmsiecf_leak_get_filename(
      size_t string_size,
      libcerror_error_t **error );
 
+LIBMSIECF_EXTERN \
+int libmsiecf_leak_get_filename_view(
+     libmsiecf_item_t *leak,
+     const uint8_t **filename,
+     size_t *filename_size,
+     libcerror_error_t **error );
+
 LIBMSIECF_EXTERN \
 int libmsiecf_leak_get_utf8_filename_size(
      libmsiecf_item_t *leak,
@@ -25,6 +25,7 @@
 #include <system_string.h>
 #include <types.h>
 
+#include "libmsiecf_atomic.h"
 #include "libmsiecf_debug.h"
 #include "libmsiecf_definitions.h"
 #include "libmsiecf_libbfio.h"
@@ -33,6 +34,7 @@
 #include "libmsiecf_libfdatetime.h"
 #include "libmsiecf_libfvalue.h"
 #include "libmsiecf_leak_values.h"
+#include "libmsiecf_record_decoders.h"
 
 #include "msiecf_leak_record.h"
 
@@ -96,6 +98,8 @@ int libmsiecf_leak_values_initialize(
 
 		goto on_error;
 	}
+	( *leak_values )->reference_count = 1;
+
 	return( 1 );
 
 on_error:
@@ -132,6 +136,16 @@ int libmsiecf_leak_values_free(
 	}
 	if( *leak_values != NULL )
 	{
+		/* The values are shared by the item cache and the items
+		 * hence they are only freed when the last reference is released
+		 */
+		if( LIBMSIECF_ATOMIC_DECREMENT(
+		     &( ( *leak_values )->reference_count ) ) > 0 )
+		{
+			*leak_values = NULL;
+
+			return( 1 );
+		}
 		if( ( *leak_values )->filename != NULL )
 		{
 			if( libfvalue_value_free(
@@ -148,6 +162,11 @@ int libmsiecf_leak_values_free(
 				result = -1;
 			}
 		}
+		if( ( *leak_values )->record_data != NULL )
+		{
+			memory_free(
+			 ( *leak_values )->record_data );
+		}
 		memory_free(
 		 *leak_values );
 
@@ -156,6 +175,33 @@ int libmsiecf_leak_values_free(
 	return( result );
 }
 
+/* References leak values
+ * The leak values are freed when the last reference is released by libmsiecf_leak_values_free
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_leak_values_reference(
+     libmsiecf_leak_values_t *leak_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_leak_values_reference";
+
+	if( leak_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leak values.",
+		 function );
+
+		return( -1 );
+	}
+	LIBMSIECF_ATOMIC_INCREMENT(
+	 &( leak_values->reference_count ) );
+
+	return( 1 );
+}
+
 /* Reads the leak values from a LEAK record
  * Returns 1 if successful or -1 on error
  */
@@ -167,6 +213,8 @@ int libmsiecf_leak_values_read_data(
      uint8_t item_flags,
      libcerror_error_t **error )
 {
+	libmsiecf_leak_record_header_values_t record_header_values;
+
 	static char *function    = "libmsiecf_leak_values_read_data";
 	ssize_t value_size       = 0;
 	uint32_t filename_offset = 0;
@@ -219,6 +267,67 @@ int libmsiecf_leak_values_read_data(
 
 		return( -1 );
 	}
+	/* The record data is copied once and the values reference it
+	 * unless the data already is the record data of the leak values
+	 */
+	if( data != leak_values->record_data )
+	{
+		if( leak_values->record_data != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid leak values - record data value already set.",
+			 function );
+
+			return( -1 );
+		}
+		if( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid data size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		leak_values->record_data = (uint8_t *) memory_allocate(
+		                                        sizeof( uint8_t ) * data_size );
+
+		if( leak_values->record_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     leak_values->record_data,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy record data.",
+			 function );
+
+			return( -1 );
+		}
+		leak_values->record_data_size = data_size;
+
+		data = leak_values->record_data;
+	}
+	leak_values->ascii_codepage = ascii_codepage;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -245,15 +354,24 @@ int libmsiecf_leak_values_read_data(
 
 		goto on_error;
 	}
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (msiecf_leak_record_header_t *) data )->cached_file_size,
-	 leak_values->cached_file_size );
-
-	leak_values->cache_directory_index = ( (msiecf_leak_record_header_t *) data )->cache_directory_index;
+	if( libmsiecf_leak_record_header_values_decode(
+	     &record_header_values,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode LEAK record header values.",
+		 function );
 
-	byte_stream_copy_to_uint32_little_endian(
-	 ( (msiecf_leak_record_header_t *) data )->filename_offset,
-	 filename_offset );
+		goto on_error;
+	}
+	leak_values->cached_file_size      = record_header_values.cached_file_size;
+	leak_values->cache_directory_index = record_header_values.cache_directory_index;
+	filename_offset                    = record_header_values.filename_offset;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -404,7 +522,7 @@ int libmsiecf_leak_values_read_data(
 			              &( data[ filename_offset ] ),
 			              data_size - filename_offset,
 			              ascii_codepage,
-			              LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+			              LIBFVALUE_VALUE_DATA_FLAG_NON_MANAGED,
 			              error );
 
 			if( value_size == -1 )
@@ -418,6 +536,9 @@ int libmsiecf_leak_values_read_data(
 
 				goto on_error;
 			}
+			leak_values->filename_data      = &( data[ filename_offset ] );
+			leak_values->filename_data_size = (size_t) value_size;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -475,6 +596,9 @@ on_error:
 		 &( leak_values->filename ),
 		 NULL );
 	}
+	leak_values->filename_data      = NULL;
+	leak_values->filename_data_size = 0;
+
 	return( 1 );
 }
 
@@ -490,7 +614,6 @@ int libmsiecf_leak_values_read_file_io_handle(
      uint8_t item_flags,
      libcerror_error_t **error )
 {
-	uint8_t *record_data  = NULL;
 	static char *function = "libmsiecf_leak_values_read_file_io_handle";
 	ssize_t read_count    = 0;
 
@@ -505,6 +628,17 @@ int libmsiecf_leak_values_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( leak_values->record_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid leak values - record data value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( record_size > (size32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 	{
 		libcerror_error_set(
@@ -528,10 +662,12 @@ int libmsiecf_leak_values_read_file_io_handle(
 
 		return( -1 );
 	}
-	record_data = (uint8_t *) memory_allocate(
-	                           sizeof( uint8_t ) * record_size );
+	/* The record data is read into the buffer owned by the leak values
+	 */
+	leak_values->record_data = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * record_size );
 
-	if( record_data == NULL )
+	if( leak_values->record_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -542,6 +678,8 @@ int libmsiecf_leak_values_read_file_io_handle(
 
 		goto on_error;
 	}
+	leak_values->record_data_size = (size_t) record_size;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -554,7 +692,7 @@ int libmsiecf_leak_values_read_file_io_handle(
 #endif
 	read_count = libbfio_handle_read_buffer_at_offset(
 	              file_io_handle,
-	              record_data,
+	              leak_values->record_data,
 	              (size_t) record_size,
 	              leak_record_offset,
 	              error );
@@ -574,7 +712,7 @@ int libmsiecf_leak_values_read_file_io_handle(
 	}
 	if( libmsiecf_leak_values_read_data(
 	     leak_values,
-	     record_data,
+	     leak_values->record_data,
 	     (size_t) record_size,
 	     ascii_codepage,
 	     item_flags,
@@ -589,17 +727,12 @@ int libmsiecf_leak_values_read_file_io_handle(
 
 		goto on_error;
 	}
-	memory_free(
-	 record_data );
-
 	return( 1 );
 
 on_error:
-	if( record_data != NULL )
-	{
-		memory_free(
-		 record_data );
-	}
+	/* The record data can be referenced by the values read so far
+	 * and is freed together with the leak values
+	 */
 	return( -1 );
 }
 
@@ -45,9 +45,34 @@ struct libmsiecf_leak_values
 	 */
 	uint8_t cache_directory_index;
 
-	/* The filename value
+	/* The filename value, which references the record data
 	 */
 	libfvalue_value_t *filename;
+
+	/* The filename data, which references the record data
+	 */
+	const uint8_t *filename_data;
+
+	/* The filename data size
+	 */
+	size_t filename_data_size;
+
+	/* The codepage of the ASCII strings
+	 */
+	int ascii_codepage;
+
+	/* The record data
+	 * the values above reference this buffer instead of copies of the data
+	 */
+	uint8_t *record_data;
+
+	/* The record data size
+	 */
+	size_t record_data_size;
+
+	/* The reference count
+	 */
+	int32_t reference_count;
 };
 
 int libmsiecf_leak_values_initialize(
@@ -58,6 +83,10 @@ int libmsiecf_leak_values_free(
      libmsiecf_leak_values_t **leak_values,
      libcerror_error_t **error );
 
+int libmsiecf_leak_values_reference(
+     libmsiecf_leak_values_t *leak_values,
+     libcerror_error_t **error );
+
 int libmsiecf_leak_values_read_data(
      libmsiecf_leak_values_t *leak_values,
      const uint8_t *data,
@@ -0,0 +1,754 @@
+/*
+ * Read batch functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmsiecf_definitions.h"
+#include "libmsiecf_io_handle.h"
+#include "libmsiecf_item.h"
+#include "libmsiecf_item_cache.h"
+#include "libmsiecf_item_descriptor.h"
+#include "libmsiecf_libbfio.h"
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_read_batch.h"
+
+/* Creates a read batch
+ * Make sure the value read_batch is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_read_batch_initialize(
+     libmsiecf_read_batch_t **read_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_read_batch_initialize";
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_batch != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read batch value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*read_batch = memory_allocate_structure(
+	               libmsiecf_read_batch_t );
+
+	if( *read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read batch.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_batch,
+	     0,
+	     sizeof( libmsiecf_read_batch_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read batch.",
+		 function );
+
+		goto on_error;
+	}
+	( *read_batch )->is_sorted = 1;
+
+	return( 1 );
+
+on_error:
+	if( *read_batch != NULL )
+	{
+		memory_free(
+		 *read_batch );
+
+		*read_batch = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read batch
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_read_batch_free(
+     libmsiecf_read_batch_t **read_batch,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_read_batch_free";
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_batch != NULL )
+	{
+		if( ( *read_batch )->read_buffer != NULL )
+		{
+			memory_free(
+			 ( *read_batch )->read_buffer );
+		}
+		if( ( *read_batch )->entries != NULL )
+		{
+			memory_free(
+			 ( *read_batch )->entries );
+		}
+		memory_free(
+		 *read_batch );
+
+		*read_batch = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an item descriptor to the read batch
+ * The item index is the index in the items the record is read into
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_read_batch_append_item_descriptor(
+     libmsiecf_read_batch_t *read_batch,
+     libmsiecf_item_descriptor_t *item_descriptor,
+     int item_index,
+     libcerror_error_t **error )
+{
+	libmsiecf_read_batch_entry_t *entries = NULL;
+	static char *function                 = "libmsiecf_read_batch_append_item_descriptor";
+	int number_of_allocated_entries       = 0;
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid item index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_batch->number_of_entries >= read_batch->number_of_allocated_entries )
+	{
+		if( read_batch->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 64;
+		}
+		else if( read_batch->number_of_allocated_entries <= ( (int) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libmsiecf_read_batch_entry_t ) ) / 2 ) )
+		{
+			number_of_allocated_entries = read_batch->number_of_allocated_entries * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libmsiecf_read_batch_entry_t *) memory_reallocate(
+		                                            read_batch->entries,
+		                                            sizeof( libmsiecf_read_batch_entry_t ) * number_of_allocated_entries );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		read_batch->entries                     = entries;
+		read_batch->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	if( ( read_batch->number_of_entries > 0 )
+	 && ( item_descriptor->file_offset < read_batch->entries[ read_batch->number_of_entries - 1 ].item_descriptor->file_offset ) )
+	{
+		read_batch->is_sorted = 0;
+	}
+	read_batch->entries[ read_batch->number_of_entries ].item_descriptor = item_descriptor;
+	read_batch->entries[ read_batch->number_of_entries ].item_index      = item_index;
+
+	read_batch->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Sorts the entries of the read batch by record file offset
+ * A stable merge sort is used so that entries with the same file offset retain their order
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_read_batch_sort(
+     libmsiecf_read_batch_t *read_batch,
+     libcerror_error_t **error )
+{
+	libmsiecf_read_batch_entry_t *destination_entries = NULL;
+	libmsiecf_read_batch_entry_t *source_entries      = NULL;
+	libmsiecf_read_batch_entry_t *sorted_entries      = NULL;
+	static char *function                             = "libmsiecf_read_batch_sort";
+	int destination_index                             = 0;
+	int left_index                                    = 0;
+	int left_end_index                                = 0;
+	int merge_index                                   = 0;
+	int right_index                                   = 0;
+	int right_end_index                               = 0;
+	int run_size                                      = 0;
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_batch->is_sorted != 0 )
+	{
+		return( 1 );
+	}
+	sorted_entries = (libmsiecf_read_batch_entry_t *) memory_allocate(
+	                                                   sizeof( libmsiecf_read_batch_entry_t ) * read_batch->number_of_entries );
+
+	if( sorted_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted entries.",
+		 function );
+
+		return( -1 );
+	}
+	source_entries      = read_batch->entries;
+	destination_entries = sorted_entries;
+
+	for( run_size = 1;
+	     run_size < read_batch->number_of_entries;
+	     run_size *= 2 )
+	{
+		for( merge_index = 0;
+		     merge_index < read_batch->number_of_entries;
+		     merge_index += 2 * run_size )
+		{
+			destination_index = merge_index;
+			left_index        = merge_index;
+			left_end_index    = merge_index + run_size;
+			right_end_index   = left_end_index + run_size;
+
+			if( left_end_index > read_batch->number_of_entries )
+			{
+				left_end_index = read_batch->number_of_entries;
+			}
+			if( right_end_index > read_batch->number_of_entries )
+			{
+				right_end_index = read_batch->number_of_entries;
+			}
+			right_index = left_end_index;
+
+			while( destination_index < right_end_index )
+			{
+				if( ( right_index >= right_end_index )
+				 || ( ( left_index < left_end_index )
+				  && ( source_entries[ left_index ].item_descriptor->file_offset <= source_entries[ right_index ].item_descriptor->file_offset ) ) )
+				{
+					destination_entries[ destination_index++ ] = source_entries[ left_index++ ];
+				}
+				else
+				{
+					destination_entries[ destination_index++ ] = source_entries[ right_index++ ];
+				}
+			}
+		}
+		/* Swap the source and destination entries for the next pass
+		 */
+		sorted_entries      = source_entries;
+		source_entries      = destination_entries;
+		destination_entries = sorted_entries;
+	}
+	/* After the last pass the sorted entries are in the source entries
+	 */
+	if( source_entries != read_batch->entries )
+	{
+		memory_free(
+		 read_batch->entries );
+
+		read_batch->entries                     = source_entries;
+		read_batch->number_of_allocated_entries = read_batch->number_of_entries;
+	}
+	else
+	{
+		memory_free(
+		 destination_entries );
+	}
+	read_batch->is_sorted = 1;
+
+	return( 1 );
+}
+
+/* Determines the run of entries, starting at a specific entry, of which the records are read at once
+ * Records that are not in ascending order, more than the maximum read gap apart
+ * or exceed the maximum coalesced read size end the run
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_read_batch_get_run(
+     libmsiecf_read_batch_t *read_batch,
+     int first_entry_index,
+     size_t maximum_read_gap,
+     int *number_of_run_entries,
+     off64_t *run_offset,
+     size64_t *run_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_item_descriptor_t *item_descriptor = NULL;
+	static char *function                        = "libmsiecf_read_batch_get_run";
+	size_t read_size                             = 0;
+	off64_t run_end_offset                       = 0;
+	off64_t run_start_offset                     = 0;
+	int entry_index                              = 0;
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_entry_index < 0 )
+	 || ( first_entry_index >= read_batch->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_run_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of run entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run size.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = first_entry_index;
+	     entry_index < read_batch->number_of_entries;
+	     entry_index++ )
+	{
+		item_descriptor = read_batch->entries[ entry_index ].item_descriptor;
+
+		read_size = (size_t) item_descriptor->record_size;
+
+		/* Tainted URL records are read with one additional block
+		 */
+		if( ( item_descriptor->type == LIBMSIECF_ITEM_TYPE_URL )
+		 && ( ( item_descriptor->flags & LIBMSIECF_ITEM_FLAG_TAINTED ) != 0 ) )
+		{
+			read_size += LIBMSIECF_DEFAULT_BLOCK_SIZE;
+		}
+		if( entry_index == first_entry_index )
+		{
+			run_start_offset = item_descriptor->file_offset;
+			run_end_offset   = item_descriptor->file_offset + (off64_t) read_size;
+		}
+		else
+		{
+			if( ( item_descriptor->file_offset < run_start_offset )
+			 || ( item_descriptor->file_offset > ( run_end_offset + (off64_t) maximum_read_gap ) )
+			 || ( ( item_descriptor->file_offset + (off64_t) read_size - run_start_offset ) > LIBMSIECF_MAXIMUM_COALESCED_READ_SIZE ) )
+			{
+				break;
+			}
+			if( ( item_descriptor->file_offset + (off64_t) read_size ) > run_end_offset )
+			{
+				run_end_offset = item_descriptor->file_offset + (off64_t) read_size;
+			}
+		}
+	}
+	*number_of_run_entries = entry_index - first_entry_index;
+	*run_offset            = run_start_offset;
+	*run_size              = (size64_t) ( run_end_offset - run_start_offset );
+
+	return( 1 );
+}
+
+/* Reads the items of the read batch
+ * The entries are sorted by record file offset and adjacent records are read at once,
+ * either from the file data in memory or with a single read into the read buffer
+ * The items are stored by item index, on error the items already created are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_read_batch_read_items(
+     libmsiecf_read_batch_t *read_batch,
+     libmsiecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmsiecf_item_cache_t *item_cache,
+     libmsiecf_item_t **items,
+     int number_of_items,
+     libcerror_error_t **error )
+{
+	libmsiecf_item_descriptor_t *item_descriptor = NULL;
+	const uint8_t *run_data                      = NULL;
+	uint8_t *reallocation                        = NULL;
+	static char *function                        = "libmsiecf_read_batch_read_items";
+	size64_t run_size                            = 0;
+	size_t maximum_read_gap                      = LIBMSIECF_MAXIMUM_COALESCED_READ_GAP;
+	ssize_t read_count                           = 0;
+	off64_t run_offset                           = 0;
+	int entry_index                              = 0;
+	int item_index                               = 0;
+	int number_of_run_entries                    = 0;
+	int result                                   = 0;
+	int run_entry_index                          = 0;
+
+	if( read_batch == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read batch.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid items.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of items value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < read_batch->number_of_entries;
+	     entry_index++ )
+	{
+		item_index = read_batch->entries[ entry_index ].item_index;
+
+		if( item_index >= number_of_items )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry: %d item index value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( items[ item_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid item: %d value already set.",
+			 function,
+			 item_index );
+
+			return( -1 );
+		}
+	}
+	if( libmsiecf_read_batch_sort(
+	     read_batch,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to sort read batch.",
+		 function );
+
+		return( -1 );
+	}
+	/* The sequential access pattern reads larger gaps between records since the data
+	 * is likely needed next, the random access pattern only reads adjacent records
+	 */
+	if( io_handle->access_pattern == LIBMSIECF_ACCESS_PATTERN_SEQUENTIAL )
+	{
+		maximum_read_gap = LIBMSIECF_SEQUENTIAL_MAXIMUM_COALESCED_READ_GAP;
+	}
+	else if( io_handle->access_pattern == LIBMSIECF_ACCESS_PATTERN_RANDOM )
+	{
+		maximum_read_gap = 0;
+	}
+	entry_index = 0;
+
+	while( entry_index < read_batch->number_of_entries )
+	{
+		if( libmsiecf_read_batch_get_run(
+		     read_batch,
+		     entry_index,
+		     maximum_read_gap,
+		     &number_of_run_entries,
+		     &run_offset,
+		     &run_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve run of entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		result = libmsiecf_io_handle_get_file_data(
+		          io_handle,
+		          run_offset,
+		          (size_t) run_size,
+		          &run_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 run_offset,
+			 run_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			if( run_size > (size64_t) read_batch->read_buffer_size )
+			{
+				if( run_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid run size value exceeds maximum allocation size.",
+					 function );
+
+					return( -1 );
+				}
+				reallocation = (uint8_t *) memory_reallocate(
+				                            read_batch->read_buffer,
+				                            sizeof( uint8_t ) * (size_t) run_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize read buffer.",
+					 function );
+
+					return( -1 );
+				}
+				read_batch->read_buffer      = reallocation;
+				read_batch->read_buffer_size = (size_t) run_size;
+			}
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              read_batch->read_buffer,
+			              (size_t) run_size,
+			              run_offset,
+			              error );
+
+			if( read_count != (ssize_t) run_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 run_offset,
+				 run_offset );
+
+				return( -1 );
+			}
+			run_data = read_batch->read_buffer;
+		}
+		for( run_entry_index = entry_index;
+		     run_entry_index < ( entry_index + number_of_run_entries );
+		     run_entry_index++ )
+		{
+			item_descriptor = read_batch->entries[ run_entry_index ].item_descriptor;
+			item_index      = read_batch->entries[ run_entry_index ].item_index;
+
+			if( libmsiecf_item_initialize(
+			     &( items[ item_index ] ),
+			     item_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create item: %d.",
+				 function,
+				 item_index );
+
+				return( -1 );
+			}
+			if( libmsiecf_internal_item_read_values(
+			     (libmsiecf_internal_item_t *) items[ item_index ],
+			     io_handle,
+			     file_io_handle,
+			     &( run_data[ item_descriptor->file_offset - run_offset ] ),
+			     (size_t) ( run_offset + (off64_t) run_size - item_descriptor->file_offset ),
+			     item_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read item: %d values.",
+				 function,
+				 item_index );
+
+				return( -1 );
+			}
+		}
+		entry_index += number_of_run_entries;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,122 @@
+/*
+ * Read batch functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMSIECF_READ_BATCH_H )
+#define _LIBMSIECF_READ_BATCH_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmsiecf_io_handle.h"
+#include "libmsiecf_item_cache.h"
+#include "libmsiecf_item_descriptor.h"
+#include "libmsiecf_libbfio.h"
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmsiecf_read_batch_entry libmsiecf_read_batch_entry_t;
+
+struct libmsiecf_read_batch_entry
+{
+	/* The item descriptor
+	 */
+	libmsiecf_item_descriptor_t *item_descriptor;
+
+	/* The index of the item the record is read into
+	 */
+	int item_index;
+};
+
+typedef struct libmsiecf_read_batch libmsiecf_read_batch_t;
+
+struct libmsiecf_read_batch
+{
+	/* The entries
+	 */
+	libmsiecf_read_batch_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* Value to indicate the entries are sorted by file offset
+	 */
+	uint8_t is_sorted;
+
+	/* The read buffer, used when the file data is not read into memory
+	 */
+	uint8_t *read_buffer;
+
+	/* The read buffer size
+	 */
+	size_t read_buffer_size;
+};
+
+int libmsiecf_read_batch_initialize(
+     libmsiecf_read_batch_t **read_batch,
+     libcerror_error_t **error );
+
+int libmsiecf_read_batch_free(
+     libmsiecf_read_batch_t **read_batch,
+     libcerror_error_t **error );
+
+int libmsiecf_read_batch_append_item_descriptor(
+     libmsiecf_read_batch_t *read_batch,
+     libmsiecf_item_descriptor_t *item_descriptor,
+     int item_index,
+     libcerror_error_t **error );
+
+int libmsiecf_read_batch_sort(
+     libmsiecf_read_batch_t *read_batch,
+     libcerror_error_t **error );
+
+int libmsiecf_read_batch_get_run(
+     libmsiecf_read_batch_t *read_batch,
+     int first_entry_index,
+     size_t maximum_read_gap,
+     int *number_of_run_entries,
+     off64_t *run_offset,
+     size64_t *run_size,
+     libcerror_error_t **error );
+
+int libmsiecf_read_batch_read_items(
+     libmsiecf_read_batch_t *read_batch,
+     libmsiecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmsiecf_item_cache_t *item_cache,
+     libmsiecf_item_t **items,
+     int number_of_items,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMSIECF_READ_BATCH_H ) */
+
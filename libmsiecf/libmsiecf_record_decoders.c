@@ -0,0 +1,1321 @@
+/*
+ * Record decoder functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* This file was generated by scripts/generate_record_decoders.py
+ * from dtfabric.yaml and libmsiecf.ini, do not edit
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_record_decoders.h"
+
+/* Decodes the file header values
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_file_header_values_decode(
+     libmsiecf_file_header_values_t *file_header_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_file_header_values_decode";
+
+	if( file_header_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < LIBMSIECF_FILE_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 28 ] ),
+	 file_header_values->file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 32 ] ),
+	 file_header_values->hash_table_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 36 ] ),
+	 file_header_values->number_of_blocks );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 40 ] ),
+	 file_header_values->number_of_allocated_blocks );
+
+	return( 1 );
+}
+
+/* Decodes the URL record header version 4.7 values
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v47_values_decode(
+     libmsiecf_url_record_header_v47_values_t *url_record_header_v47_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v47_values_decode";
+
+	if( url_record_header_v47_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL record header version 4.7 values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < LIBMSIECF_URL_RECORD_HEADER_V47_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 8 ] ),
+	 url_record_header_v47_values->secondary_time );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 url_record_header_v47_values->primary_time );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 24 ] ),
+	 url_record_header_v47_values->expiration_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 32 ] ),
+	 url_record_header_v47_values->cached_file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 52 ] ),
+	 url_record_header_v47_values->unknown_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 56 ] ),
+	 url_record_header_v47_values->location_offset );
+
+	url_record_header_v47_values->cache_directory_index = data[ 60 ];
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 64 ] ),
+	 url_record_header_v47_values->filename_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 68 ] ),
+	 url_record_header_v47_values->cache_entry_flags );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 72 ] ),
+	 url_record_header_v47_values->data_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 76 ] ),
+	 url_record_header_v47_values->data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 84 ] ),
+	 url_record_header_v47_values->last_checked_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 88 ] ),
+	 url_record_header_v47_values->number_of_hits );
+
+	return( 1 );
+}
+
+/* Decodes the secondary time of consecutive URL record header version 4.7s into a column
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v47_decode_secondary_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint64_t *column,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v47_decode_secondary_time_column";
+	int record_index      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( data_size / LIBMSIECF_URL_RECORD_HEADER_V47_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ 8 ] ),
+		 column[ record_index ] );
+
+		data += LIBMSIECF_URL_RECORD_HEADER_V47_SIZE;
+	}
+	return( 1 );
+}
+
+/* Decodes the primary time of consecutive URL record header version 4.7s into a column
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v47_decode_primary_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint64_t *column,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v47_decode_primary_time_column";
+	int record_index      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( data_size / LIBMSIECF_URL_RECORD_HEADER_V47_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ 16 ] ),
+		 column[ record_index ] );
+
+		data += LIBMSIECF_URL_RECORD_HEADER_V47_SIZE;
+	}
+	return( 1 );
+}
+
+/* Decodes the expiration time of consecutive URL record header version 4.7s into a column
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v47_decode_expiration_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint64_t *column,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v47_decode_expiration_time_column";
+	int record_index      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( data_size / LIBMSIECF_URL_RECORD_HEADER_V47_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ 24 ] ),
+		 column[ record_index ] );
+
+		data += LIBMSIECF_URL_RECORD_HEADER_V47_SIZE;
+	}
+	return( 1 );
+}
+
+/* Decodes the cached file size of consecutive URL record header version 4.7s into a column
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v47_decode_cached_file_size_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint32_t *column,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v47_decode_cached_file_size_column";
+	int record_index      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( data_size / LIBMSIECF_URL_RECORD_HEADER_V47_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 32 ] ),
+		 column[ record_index ] );
+
+		data += LIBMSIECF_URL_RECORD_HEADER_V47_SIZE;
+	}
+	return( 1 );
+}
+
+/* Decodes the cache directory index of consecutive URL record header version 4.7s into a column
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v47_decode_cache_directory_index_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint8_t *column,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v47_decode_cache_directory_index_column";
+	int record_index      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( data_size / LIBMSIECF_URL_RECORD_HEADER_V47_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		column[ record_index ] = data[ 60 ];
+
+		data += LIBMSIECF_URL_RECORD_HEADER_V47_SIZE;
+	}
+	return( 1 );
+}
+
+/* Decodes the last checked time of consecutive URL record header version 4.7s into a column
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v47_decode_last_checked_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint32_t *column,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v47_decode_last_checked_time_column";
+	int record_index      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( data_size / LIBMSIECF_URL_RECORD_HEADER_V47_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 84 ] ),
+		 column[ record_index ] );
+
+		data += LIBMSIECF_URL_RECORD_HEADER_V47_SIZE;
+	}
+	return( 1 );
+}
+
+/* Decodes the number of hits of consecutive URL record header version 4.7s into a column
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v47_decode_number_of_hits_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint32_t *column,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v47_decode_number_of_hits_column";
+	int record_index      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( data_size / LIBMSIECF_URL_RECORD_HEADER_V47_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 88 ] ),
+		 column[ record_index ] );
+
+		data += LIBMSIECF_URL_RECORD_HEADER_V47_SIZE;
+	}
+	return( 1 );
+}
+
+/* Decodes the URL record header version 5.2 values
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v52_values_decode(
+     libmsiecf_url_record_header_v52_values_t *url_record_header_v52_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v52_values_decode";
+
+	if( url_record_header_v52_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL record header version 5.2 values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < LIBMSIECF_URL_RECORD_HEADER_V52_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 8 ] ),
+	 url_record_header_v52_values->secondary_time );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 url_record_header_v52_values->primary_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 24 ] ),
+	 url_record_header_v52_values->expiration_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 32 ] ),
+	 url_record_header_v52_values->cached_file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 48 ] ),
+	 url_record_header_v52_values->unknown_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 52 ] ),
+	 url_record_header_v52_values->location_offset );
+
+	url_record_header_v52_values->cache_directory_index = data[ 56 ];
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 60 ] ),
+	 url_record_header_v52_values->filename_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 64 ] ),
+	 url_record_header_v52_values->cache_entry_flags );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 68 ] ),
+	 url_record_header_v52_values->data_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 72 ] ),
+	 url_record_header_v52_values->data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 80 ] ),
+	 url_record_header_v52_values->last_checked_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 84 ] ),
+	 url_record_header_v52_values->number_of_hits );
+
+	return( 1 );
+}
+
+/* Decodes the secondary time of consecutive URL record header version 5.2s into a column
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v52_decode_secondary_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint64_t *column,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v52_decode_secondary_time_column";
+	int record_index      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( data_size / LIBMSIECF_URL_RECORD_HEADER_V52_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ 8 ] ),
+		 column[ record_index ] );
+
+		data += LIBMSIECF_URL_RECORD_HEADER_V52_SIZE;
+	}
+	return( 1 );
+}
+
+/* Decodes the primary time of consecutive URL record header version 5.2s into a column
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v52_decode_primary_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint64_t *column,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v52_decode_primary_time_column";
+	int record_index      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( data_size / LIBMSIECF_URL_RECORD_HEADER_V52_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( data[ 16 ] ),
+		 column[ record_index ] );
+
+		data += LIBMSIECF_URL_RECORD_HEADER_V52_SIZE;
+	}
+	return( 1 );
+}
+
+/* Decodes the expiration time of consecutive URL record header version 5.2s into a column
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v52_decode_expiration_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint64_t *column,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v52_decode_expiration_time_column";
+	int record_index      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( data_size / LIBMSIECF_URL_RECORD_HEADER_V52_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 24 ] ),
+		 column[ record_index ] );
+
+		data += LIBMSIECF_URL_RECORD_HEADER_V52_SIZE;
+	}
+	return( 1 );
+}
+
+/* Decodes the cached file size of consecutive URL record header version 5.2s into a column
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v52_decode_cached_file_size_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint32_t *column,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v52_decode_cached_file_size_column";
+	int record_index      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( data_size / LIBMSIECF_URL_RECORD_HEADER_V52_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 32 ] ),
+		 column[ record_index ] );
+
+		data += LIBMSIECF_URL_RECORD_HEADER_V52_SIZE;
+	}
+	return( 1 );
+}
+
+/* Decodes the cache directory index of consecutive URL record header version 5.2s into a column
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v52_decode_cache_directory_index_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint8_t *column,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v52_decode_cache_directory_index_column";
+	int record_index      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( data_size / LIBMSIECF_URL_RECORD_HEADER_V52_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		column[ record_index ] = data[ 56 ];
+
+		data += LIBMSIECF_URL_RECORD_HEADER_V52_SIZE;
+	}
+	return( 1 );
+}
+
+/* Decodes the last checked time of consecutive URL record header version 5.2s into a column
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v52_decode_last_checked_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint32_t *column,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v52_decode_last_checked_time_column";
+	int record_index      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( data_size / LIBMSIECF_URL_RECORD_HEADER_V52_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 80 ] ),
+		 column[ record_index ] );
+
+		data += LIBMSIECF_URL_RECORD_HEADER_V52_SIZE;
+	}
+	return( 1 );
+}
+
+/* Decodes the number of hits of consecutive URL record header version 5.2s into a column
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_record_header_v52_decode_number_of_hits_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint32_t *column,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_record_header_v52_decode_number_of_hits_column";
+	int record_index      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) number_of_records > ( data_size / LIBMSIECF_URL_RECORD_HEADER_V52_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( column == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ 84 ] ),
+		 column[ record_index ] );
+
+		data += LIBMSIECF_URL_RECORD_HEADER_V52_SIZE;
+	}
+	return( 1 );
+}
+
+/* Decodes the LEAK record header values
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_leak_record_header_values_decode(
+     libmsiecf_leak_record_header_values_t *leak_record_header_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_leak_record_header_values_decode";
+
+	if( leak_record_header_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid LEAK record header values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < LIBMSIECF_LEAK_RECORD_HEADER_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 32 ] ),
+	 leak_record_header_values->cached_file_size );
+
+	leak_record_header_values->cache_directory_index = data[ 56 ];
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( data[ 60 ] ),
+	 leak_record_header_values->filename_offset );
+
+	return( 1 );
+}
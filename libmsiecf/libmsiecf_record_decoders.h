@@ -0,0 +1,336 @@
+/*
+ * Record decoder functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* This file was generated by scripts/generate_record_decoders.py
+ * from dtfabric.yaml and libmsiecf.ini, do not edit
+ */
+
+#if !defined( _LIBMSIECF_RECORD_DECODERS_H )
+#define _LIBMSIECF_RECORD_DECODERS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmsiecf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the file header
+ */
+#define LIBMSIECF_FILE_HEADER_SIZE	72
+
+typedef struct libmsiecf_file_header_values libmsiecf_file_header_values_t;
+
+struct libmsiecf_file_header_values
+{
+	/* The file size
+	 */
+	uint32_t file_size;
+
+	/* The hash table offset
+	 */
+	uint32_t hash_table_offset;
+
+	/* The number of blocks
+	 */
+	uint32_t number_of_blocks;
+
+	/* The number of allocated blocks
+	 */
+	uint32_t number_of_allocated_blocks;
+};
+
+/* The size of the URL record header version 4.7
+ */
+#define LIBMSIECF_URL_RECORD_HEADER_V47_SIZE	100
+
+typedef struct libmsiecf_url_record_header_v47_values libmsiecf_url_record_header_v47_values_t;
+
+struct libmsiecf_url_record_header_v47_values
+{
+	/* Secondary date and time, contains a FILETIME
+	 */
+	uint64_t secondary_time;
+
+	/* Primary date and time, contains a FILETIME
+	 */
+	uint64_t primary_time;
+
+	/* Expiration date and time, contains a FILETIME
+	 */
+	uint64_t expiration_time;
+
+	/* The cached file size
+	 */
+	uint32_t cached_file_size;
+
+	/* The unknown offset
+	 */
+	uint32_t unknown_offset;
+
+	/* The location offset
+	 */
+	uint32_t location_offset;
+
+	/* The cache directory index
+	 */
+	uint8_t cache_directory_index;
+
+	/* The filename offset
+	 */
+	uint32_t filename_offset;
+
+	/* The cache entry flags
+	 */
+	uint32_t cache_entry_flags;
+
+	/* The data offset
+	 */
+	uint32_t data_offset;
+
+	/* The data size
+	 */
+	uint32_t data_size;
+
+	/* Last checked date and time, contains a FAT date and time
+	 */
+	uint32_t last_checked_time;
+
+	/* The number of hits
+	 */
+	uint32_t number_of_hits;
+};
+
+/* The size of the URL record header version 5.2
+ */
+#define LIBMSIECF_URL_RECORD_HEADER_V52_SIZE	96
+
+typedef struct libmsiecf_url_record_header_v52_values libmsiecf_url_record_header_v52_values_t;
+
+struct libmsiecf_url_record_header_v52_values
+{
+	/* Secondary date and time, contains a FILETIME
+	 */
+	uint64_t secondary_time;
+
+	/* Primary date and time, contains a FILETIME
+	 */
+	uint64_t primary_time;
+
+	/* Expiration date and time, contains a FAT date and time
+	 */
+	uint32_t expiration_time;
+
+	/* The cached file size
+	 */
+	uint32_t cached_file_size;
+
+	/* The unknown offset
+	 */
+	uint32_t unknown_offset;
+
+	/* The location offset
+	 */
+	uint32_t location_offset;
+
+	/* The cache directory index
+	 */
+	uint8_t cache_directory_index;
+
+	/* The filename offset
+	 */
+	uint32_t filename_offset;
+
+	/* The cache entry flags
+	 */
+	uint32_t cache_entry_flags;
+
+	/* The data offset
+	 */
+	uint32_t data_offset;
+
+	/* The data size
+	 */
+	uint32_t data_size;
+
+	/* Last checked date and time, contains a FAT date and time
+	 */
+	uint32_t last_checked_time;
+
+	/* The number of hits
+	 */
+	uint32_t number_of_hits;
+};
+
+/* The size of the LEAK record header
+ */
+#define LIBMSIECF_LEAK_RECORD_HEADER_SIZE	96
+
+typedef struct libmsiecf_leak_record_header_values libmsiecf_leak_record_header_values_t;
+
+struct libmsiecf_leak_record_header_values
+{
+	/* The cached file size
+	 */
+	uint32_t cached_file_size;
+
+	/* The cache directory index
+	 */
+	uint8_t cache_directory_index;
+
+	/* The filename offset
+	 */
+	uint32_t filename_offset;
+};
+
+/* The size of the REDR record header
+ */
+#define LIBMSIECF_REDR_RECORD_HEADER_SIZE	16
+
+int libmsiecf_file_header_values_decode(
+     libmsiecf_file_header_values_t *file_header_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v47_values_decode(
+     libmsiecf_url_record_header_v47_values_t *url_record_header_v47_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v47_decode_secondary_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint64_t *column,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v47_decode_primary_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint64_t *column,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v47_decode_expiration_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint64_t *column,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v47_decode_cached_file_size_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint32_t *column,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v47_decode_cache_directory_index_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint8_t *column,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v47_decode_last_checked_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint32_t *column,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v47_decode_number_of_hits_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint32_t *column,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v52_values_decode(
+     libmsiecf_url_record_header_v52_values_t *url_record_header_v52_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v52_decode_secondary_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint64_t *column,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v52_decode_primary_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint64_t *column,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v52_decode_expiration_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint64_t *column,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v52_decode_cached_file_size_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint32_t *column,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v52_decode_cache_directory_index_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint8_t *column,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v52_decode_last_checked_time_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint32_t *column,
+     libcerror_error_t **error );
+
+int libmsiecf_url_record_header_v52_decode_number_of_hits_column(
+     const uint8_t *data,
+     size_t data_size,
+     int number_of_records,
+     uint32_t *column,
+     libcerror_error_t **error );
+
+int libmsiecf_leak_record_header_values_decode(
+     libmsiecf_leak_record_header_values_t *leak_record_header_values,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMSIECF_RECORD_DECODERS_H ) */
@@ -0,0 +1,536 @@
+/*
+ * Record scan chunk functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmsiecf_definitions.h"
+#include "libmsiecf_item_descriptor.h"
+#include "libmsiecf_item_descriptor_arena.h"
+#include "libmsiecf_libcdata.h"
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_record_scan_chunk.h"
+
+/* Creates a record scan chunk
+ * Make sure the value record_scan_chunk is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_record_scan_chunk_initialize(
+     libmsiecf_record_scan_chunk_t **record_scan_chunk,
+     off64_t start_offset,
+     off64_t end_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_record_scan_chunk_initialize";
+
+	if( record_scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record scan chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_scan_chunk != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record scan chunk value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid start offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( end_offset < start_offset )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*record_scan_chunk = memory_allocate_structure(
+	                      libmsiecf_record_scan_chunk_t );
+
+	if( *record_scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record scan chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_scan_chunk,
+	     0,
+	     sizeof( libmsiecf_record_scan_chunk_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record scan chunk.",
+		 function );
+
+		memory_free(
+		 *record_scan_chunk );
+
+		*record_scan_chunk = NULL;
+
+		return( -1 );
+	}
+	if( libmsiecf_item_descriptor_arena_initialize(
+	     &( ( *record_scan_chunk )->item_descriptor_arena ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item descriptor arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *record_scan_chunk )->item_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create item array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *record_scan_chunk )->recovered_item_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create recovered item array.",
+		 function );
+
+		goto on_error;
+	}
+	( *record_scan_chunk )->start_offset = start_offset;
+	( *record_scan_chunk )->end_offset   = end_offset;
+	( *record_scan_chunk )->file_offset  = start_offset;
+	( *record_scan_chunk )->item_type    = LIBMSIECF_ITEM_TYPE_UNDEFINED;
+
+	return( 1 );
+
+on_error:
+	if( *record_scan_chunk != NULL )
+	{
+		if( ( *record_scan_chunk )->recovered_item_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *record_scan_chunk )->recovered_item_array ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *record_scan_chunk )->item_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *record_scan_chunk )->item_array ),
+			 NULL,
+			 NULL );
+		}
+		if( ( *record_scan_chunk )->item_descriptor_arena != NULL )
+		{
+			libmsiecf_item_descriptor_arena_free(
+			 &( ( *record_scan_chunk )->item_descriptor_arena ),
+			 NULL );
+		}
+		memory_free(
+		 *record_scan_chunk );
+
+		*record_scan_chunk = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record scan chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_record_scan_chunk_free(
+     libmsiecf_record_scan_chunk_t **record_scan_chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_record_scan_chunk_free";
+	int result            = 1;
+
+	if( record_scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record scan chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_scan_chunk != NULL )
+	{
+		/* The item descriptors are managed by the item descriptor arena
+		 */
+		if( libcdata_array_free(
+		     &( ( *record_scan_chunk )->recovered_item_array ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free recovered item array.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( ( *record_scan_chunk )->item_array ),
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free item array.",
+			 function );
+
+			result = -1;
+		}
+		if( libmsiecf_item_descriptor_arena_free(
+		     &( ( *record_scan_chunk )->item_descriptor_arena ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free item descriptor arena.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *record_scan_chunk );
+
+		*record_scan_chunk = NULL;
+	}
+	return( result );
+}
+
+/* Appends a synchronization point to the record scan chunk
+ * The synchronization point captures the number of item descriptors found before the record boundary
+ * Returns 1 if successful, 0 if the maximum number of synchronization points was reached or -1 on error
+ */
+int libmsiecf_record_scan_chunk_append_synchronization_point(
+     libmsiecf_record_scan_chunk_t *record_scan_chunk,
+     off64_t file_offset,
+     libmsiecf_item_descriptor_t *last_item_descriptor,
+     libcdata_array_t *item_table,
+     libcdata_array_t *recovered_item_table,
+     libcerror_error_t **error )
+{
+	libmsiecf_record_scan_synchronization_point_t *synchronization_point = NULL;
+	static char *function                                                = "libmsiecf_record_scan_chunk_append_synchronization_point";
+	int number_of_items                                                  = 0;
+	int number_of_recovered_items                                        = 0;
+
+	if( record_scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record scan chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_scan_chunk->number_of_synchronization_points < 0 )
+	 || ( record_scan_chunk->number_of_synchronization_points > LIBMSIECF_RECORD_SCAN_MAXIMUM_NUMBER_OF_SYNCHRONIZATION_POINTS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record scan chunk - number of synchronization points value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_scan_chunk->number_of_synchronization_points > 0 )
+	{
+		synchronization_point = &( record_scan_chunk->synchronization_points[ record_scan_chunk->number_of_synchronization_points - 1 ] );
+
+		if( file_offset <= synchronization_point->file_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid file offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( record_scan_chunk->number_of_synchronization_points == LIBMSIECF_RECORD_SCAN_MAXIMUM_NUMBER_OF_SYNCHRONIZATION_POINTS )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     item_table,
+	     &number_of_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of items.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     recovered_item_table,
+	     &number_of_recovered_items,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered items.",
+		 function );
+
+		return( -1 );
+	}
+	synchronization_point = &( record_scan_chunk->synchronization_points[ record_scan_chunk->number_of_synchronization_points ] );
+
+	synchronization_point->file_offset               = file_offset;
+	synchronization_point->number_of_items           = number_of_items;
+	synchronization_point->number_of_recovered_items = number_of_recovered_items;
+	synchronization_point->last_item_descriptor      = last_item_descriptor;
+
+	record_scan_chunk->number_of_synchronization_points += 1;
+
+	return( 1 );
+}
+
+/* Moves the item descriptors of the record scan chunk, starting at the first item and
+ * first recovered item index, to the item tables and the management of the item descriptors
+ * to the item descriptor arena
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_record_scan_chunk_move_items(
+     libmsiecf_record_scan_chunk_t *record_scan_chunk,
+     int first_item_index,
+     int first_recovered_item_index,
+     libcdata_array_t *item_table,
+     libcdata_array_t *recovered_item_table,
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *source_array               = NULL;
+	libcdata_array_t *target_array               = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor = NULL;
+	static char *function                        = "libmsiecf_record_scan_chunk_move_items";
+	int array_index                              = 0;
+	int entry_index                              = 0;
+	int first_entry_index                        = 0;
+	int number_of_entries                        = 0;
+	int table_entry_index                        = 0;
+
+	if( record_scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record scan chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_item_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first item index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_recovered_item_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first recovered item index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* Item descriptors before the first index are not moved to the item tables
+	 * but are still managed by the item descriptor arena
+	 */
+	if( libmsiecf_item_descriptor_arena_move(
+	     item_descriptor_arena,
+	     record_scan_chunk->item_descriptor_arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to move item descriptors to item descriptor arena.",
+		 function );
+
+		return( -1 );
+	}
+	for( array_index = 0;
+	     array_index < 2;
+	     array_index++ )
+	{
+		if( array_index == 0 )
+		{
+			source_array      = record_scan_chunk->item_array;
+			target_array      = item_table;
+			first_entry_index = first_item_index;
+		}
+		else
+		{
+			source_array      = record_scan_chunk->recovered_item_array;
+			target_array      = recovered_item_table;
+			first_entry_index = first_recovered_item_index;
+		}
+		if( libcdata_array_get_number_of_entries(
+		     source_array,
+		     &number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of entries.",
+			 function );
+
+			return( -1 );
+		}
+		for( entry_index = first_entry_index;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     source_array,
+			     entry_index,
+			     (intptr_t **) &item_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve item descriptor: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( libcdata_array_set_entry_by_index(
+			     source_array,
+			     entry_index,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set item descriptor: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( libcdata_array_append_entry(
+			     target_array,
+			     &table_entry_index,
+			     (intptr_t *) item_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append item descriptor: %d to item table.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			item_descriptor = NULL;
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,177 @@
+/*
+ * Record scan chunk functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMSIECF_RECORD_SCAN_CHUNK_H )
+#define _LIBMSIECF_RECORD_SCAN_CHUNK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmsiecf_allocation_map.h"
+#include "libmsiecf_definitions.h"
+#include "libmsiecf_file_io_handle_pool.h"
+#include "libmsiecf_item_descriptor.h"
+#include "libmsiecf_item_descriptor_arena.h"
+#include "libmsiecf_libbfio.h"
+#include "libmsiecf_libcdata.h"
+#include "libmsiecf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmsiecf_record_scan_synchronization_point libmsiecf_record_scan_synchronization_point_t;
+
+struct libmsiecf_record_scan_synchronization_point
+{
+	/* The offset of the record boundary
+	 */
+	off64_t file_offset;
+
+	/* The number of item descriptors found before the record boundary
+	 */
+	int number_of_items;
+
+	/* The number of recovered item descriptors found before the record boundary
+	 */
+	int number_of_recovered_items;
+
+	/* The last item descriptor at the record boundary
+	 */
+	libmsiecf_item_descriptor_t *last_item_descriptor;
+};
+
+typedef struct libmsiecf_record_scan_chunk libmsiecf_record_scan_chunk_t;
+
+struct libmsiecf_record_scan_chunk
+{
+	/* The start offset
+	 */
+	off64_t start_offset;
+
+	/* The end offset
+	 */
+	off64_t end_offset;
+
+	/* The current offset
+	 */
+	off64_t file_offset;
+
+	/* The size of the current record
+	 */
+	size32_t record_size;
+
+	/* The remaining size of the current unallocated record
+	 */
+	size32_t remaining_record_size;
+
+	/* The item type of the current record
+	 */
+	uint8_t item_type;
+
+	/* The last item descriptor, that can be marked as tainted
+	 */
+	libmsiecf_item_descriptor_t *last_item_descriptor;
+
+	/* The item descriptor that stands in for the last item descriptor
+	 * of the preceding chunk
+	 */
+	libmsiecf_item_descriptor_t boundary_item_descriptor;
+
+	/* The file IO handle, used when no file IO handle pool is set
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The file IO handle pool the scan grabs a file IO handle from
+	 */
+	libmsiecf_file_io_handle_pool_t *file_io_handle_pool;
+
+	/* The allocation map
+	 */
+	libmsiecf_allocation_map_t *allocation_map;
+
+	/* The arena the item descriptors are allocated from
+	 */
+	libmsiecf_item_descriptor_arena_t *item_descriptor_arena;
+
+	/* The item descriptors array
+	 */
+	libcdata_array_t *item_array;
+
+	/* The recovered item descriptors array
+	 */
+	libcdata_array_t *recovered_item_array;
+
+	/* The synchronization points, which are the first record boundaries
+	 * at which the scan had no pending record
+	 */
+	libmsiecf_record_scan_synchronization_point_t synchronization_points[ LIBMSIECF_RECORD_SCAN_MAXIMUM_NUMBER_OF_SYNCHRONIZATION_POINTS ];
+
+	/* The number of synchronization points
+	 */
+	int number_of_synchronization_points;
+
+	/* The chunk that a scan continuing into it stops at the synchronization points of
+	 */
+	libmsiecf_record_scan_chunk_t *synchronization_chunk;
+
+	/* The index of the synchronization point the scan stopped at or -1 if not stopped
+	 */
+	int synchronization_point_index;
+
+	/* The result of scanning the chunk
+	 */
+	int result;
+};
+
+int libmsiecf_record_scan_chunk_initialize(
+     libmsiecf_record_scan_chunk_t **record_scan_chunk,
+     off64_t start_offset,
+     off64_t end_offset,
+     libcerror_error_t **error );
+
+int libmsiecf_record_scan_chunk_free(
+     libmsiecf_record_scan_chunk_t **record_scan_chunk,
+     libcerror_error_t **error );
+
+int libmsiecf_record_scan_chunk_append_synchronization_point(
+     libmsiecf_record_scan_chunk_t *record_scan_chunk,
+     off64_t file_offset,
+     libmsiecf_item_descriptor_t *last_item_descriptor,
+     libcdata_array_t *item_table,
+     libcdata_array_t *recovered_item_table,
+     libcerror_error_t **error );
+
+int libmsiecf_record_scan_chunk_move_items(
+     libmsiecf_record_scan_chunk_t *record_scan_chunk,
+     int first_item_index,
+     int first_recovered_item_index,
+     libcdata_array_t *item_table,
+     libcdata_array_t *recovered_item_table,
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMSIECF_RECORD_SCAN_CHUNK_H ) */
+
@@ -192,6 +192,99 @@ int libmsiecf_redirected_get_location(
 	return( 1 );
 }
 
+/* Retrieves a view of the location
+ * The view references the record data of the item and is valid for the lifetime of the item
+ * The location is not converted and uses the ASCII codepage, including the end of string character if present
+ * Returns 1 if successful, 0 if no location or -1 on error
+ */
+int libmsiecf_redirected_get_location_view(
+     libmsiecf_item_t *redirected,
+     const uint8_t **location,
+     size_t *location_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_t *internal_item = NULL;
+	static char *function                    = "libmsiecf_redirected_get_location_view";
+
+	if( redirected == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid redirected.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libmsiecf_internal_item_t *) redirected;
+
+	if( internal_item->item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->item_descriptor->type != LIBMSIECF_ITEM_TYPE_REDIRECTED )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type: %" PRIu8 ".",
+		 function,
+		 internal_item->item_descriptor->type );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing item values.",
+		 function );
+
+		return( -1 );
+	}
+	if( location == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location.",
+		 function );
+
+		return( -1 );
+	}
+	if( location_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (libmsiecf_redirected_values_t *) internal_item->value )->location_data == NULL )
+	{
+		return( 0 );
+	}
+	*location      = ( (libmsiecf_redirected_values_t *) internal_item->value )->location_data;
+	*location_size = ( (libmsiecf_redirected_values_t *) internal_item->value )->location_data_size;
+
+	return( 1 );
+}
+
 /* Retrieves the size of the UTF-8 encoded location
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if no location or -1 on error
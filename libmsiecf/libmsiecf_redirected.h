@@ -46,6 +46,13 @@ int libmsiecf_redirected_get_location(
      size_t string_size,
      libcerror_error_t **error );
 
+LIBMSIECF_EXTERN \
+int libmsiecf_redirected_get_location_view(
+     libmsiecf_item_t *redirected,
+     const uint8_t **location,
+     size_t *location_size,
+     libcerror_error_t **error );
+
 LIBMSIECF_EXTERN \
 int libmsiecf_redirected_get_utf8_location_size(
      libmsiecf_item_t *redirected,
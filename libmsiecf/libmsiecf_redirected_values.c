@@ -24,12 +24,14 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libmsiecf_atomic.h"
 #include "libmsiecf_definitions.h"
 #include "libmsiecf_hash.h"
 #include "libmsiecf_libbfio.h"
 #include "libmsiecf_libcerror.h"
 #include "libmsiecf_libcnotify.h"
 #include "libmsiecf_libfvalue.h"
+#include "libmsiecf_record_decoders.h"
 #include "libmsiecf_redirected_values.h"
 
 #include "msiecf_redr_record.h"
@@ -94,6 +96,8 @@ int libmsiecf_redirected_values_initialize(
 
 		goto on_error;
 	}
+	( *redirected_values )->reference_count = 1;
+
 	return( 1 );
 
 on_error:
@@ -130,6 +134,16 @@ int libmsiecf_redirected_values_free(
 	}
 	if( *redirected_values != NULL )
 	{
+		/* The values are shared by the item cache and the items
+		 * hence they are only freed when the last reference is released
+		 */
+		if( LIBMSIECF_ATOMIC_DECREMENT(
+		     &( ( *redirected_values )->reference_count ) ) > 0 )
+		{
+			*redirected_values = NULL;
+
+			return( 1 );
+		}
 		if( ( *redirected_values )->location != NULL )
 		{
 			if( libfvalue_value_free(
@@ -146,6 +160,11 @@ int libmsiecf_redirected_values_free(
 				result = -1;
 			}
 		}
+		if( ( *redirected_values )->record_data != NULL )
+		{
+			memory_free(
+			 ( *redirected_values )->record_data );
+		}
 		memory_free(
 		 *redirected_values );
 
@@ -154,6 +173,33 @@ int libmsiecf_redirected_values_free(
 	return( result );
 }
 
+/* References redirected values
+ * The redirected values are freed when the last reference is released by libmsiecf_redirected_values_free
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_redirected_values_reference(
+     libmsiecf_redirected_values_t *redirected_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_redirected_values_reference";
+
+	if( redirected_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid redirected values.",
+		 function );
+
+		return( -1 );
+	}
+	LIBMSIECF_ATOMIC_INCREMENT(
+	 &( redirected_values->reference_count ) );
+
+	return( 1 );
+}
+
 /* Reads the redirected values from a REDR record
  * Returns 1 if successful or -1 on error
  */
@@ -216,6 +262,67 @@ int libmsiecf_redirected_values_read_data(
 
 		return( -1 );
 	}
+	/* The record data is copied once and the values reference it
+	 * unless the data already is the record data of the redirected values
+	 */
+	if( data != redirected_values->record_data )
+	{
+		if( redirected_values->record_data != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid redirected values - record data value already set.",
+			 function );
+
+			return( -1 );
+		}
+		if( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid data size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		redirected_values->record_data = (uint8_t *) memory_allocate(
+		                                              sizeof( uint8_t ) * data_size );
+
+		if( redirected_values->record_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     redirected_values->record_data,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy record data.",
+			 function );
+
+			return( -1 );
+		}
+		redirected_values->record_data_size = data_size;
+
+		data = redirected_values->record_data;
+	}
+	redirected_values->ascii_codepage = ascii_codepage;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -296,10 +403,10 @@ int libmsiecf_redirected_values_read_data(
 	}
 	value_size = libfvalue_value_type_set_data_string(
 	              redirected_values->location,
-	              &( data[ 16 ] ),
-	              data_size - 16,
+	              &( data[ LIBMSIECF_REDR_RECORD_HEADER_SIZE ] ),
+	              data_size - LIBMSIECF_REDR_RECORD_HEADER_SIZE,
 	              ascii_codepage,
-	              LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+	              LIBFVALUE_VALUE_DATA_FLAG_NON_MANAGED,
 	              error );
 
 	if( value_size == -1 )
@@ -313,6 +420,9 @@ int libmsiecf_redirected_values_read_data(
 
 		goto on_error;
 	}
+	redirected_values->location_data      = &( data[ 16 ] );
+	redirected_values->location_data_size = (size_t) value_size;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -388,6 +498,9 @@ on_error:
 		 &( redirected_values->location ),
 		 NULL );
 	}
+	redirected_values->location_data      = NULL;
+	redirected_values->location_data_size = 0;
+
 	return( 1 );
 }
 
@@ -403,7 +516,6 @@ int libmsiecf_redirected_values_read_file_io_handle(
      uint8_t item_flags,
      libcerror_error_t **error )
 {
-	uint8_t *record_data  = NULL;
 	static char *function = "libmsiecf_redirected_values_read_file_io_handle";
 	ssize_t read_count    = 0;
 
@@ -418,6 +530,17 @@ int libmsiecf_redirected_values_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( redirected_values->record_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid redirected values - record data value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( record_size > (size32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 	{
 		libcerror_error_set(
@@ -441,10 +564,12 @@ int libmsiecf_redirected_values_read_file_io_handle(
 
 		return( -1 );
 	}
-	record_data = (uint8_t *) memory_allocate(
-	                           sizeof( uint8_t ) * record_size );
+	/* The record data is read into the buffer owned by the redirected values
+	 */
+	redirected_values->record_data = (uint8_t *) memory_allocate(
+	                                              sizeof( uint8_t ) * record_size );
 
-	if( record_data == NULL )
+	if( redirected_values->record_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -455,6 +580,8 @@ int libmsiecf_redirected_values_read_file_io_handle(
 
 		goto on_error;
 	}
+	redirected_values->record_data_size = (size_t) record_size;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -467,7 +594,7 @@ int libmsiecf_redirected_values_read_file_io_handle(
 #endif
 	read_count = libbfio_handle_read_buffer_at_offset(
 	              file_io_handle,
-	              record_data,
+	              redirected_values->record_data,
 	              (size_t) record_size,
 	              record_offset,
 	              error );
@@ -487,7 +614,7 @@ int libmsiecf_redirected_values_read_file_io_handle(
 	}
 	if( libmsiecf_redirected_values_read_data(
 	     redirected_values,
-	     record_data,
+	     redirected_values->record_data,
 	     (size_t) record_size,
 	     ascii_codepage,
 	     item_flags,
@@ -502,17 +629,12 @@ int libmsiecf_redirected_values_read_file_io_handle(
 
 		goto on_error;
 	}
-	memory_free(
-	 record_data );
-
 	return( 1 );
 
 on_error:
-	if( record_data != NULL )
-	{
-		memory_free(
-		 record_data );
-	}
+	/* The record data can be referenced by the values read so far
+	 * and is freed together with the redirected values
+	 */
 	return( -1 );
 }
 
@@ -37,9 +37,34 @@ typedef struct libmsiecf_redirected_values libmsiecf_redirected_values_t;
 
 struct libmsiecf_redirected_values
 {
-	/* The location value
+	/* The location value, which references the record data
 	 */
 	libfvalue_value_t *location;
+
+	/* The location data, which references the record data
+	 */
+	const uint8_t *location_data;
+
+	/* The location data size
+	 */
+	size_t location_data_size;
+
+	/* The codepage of the ASCII strings
+	 */
+	int ascii_codepage;
+
+	/* The record data
+	 * the values above reference this buffer instead of copies of the data
+	 */
+	uint8_t *record_data;
+
+	/* The record data size
+	 */
+	size_t record_data_size;
+
+	/* The reference count
+	 */
+	int32_t reference_count;
 };
 
 int libmsiecf_redirected_values_initialize(
@@ -50,6 +75,10 @@ int libmsiecf_redirected_values_free(
      libmsiecf_redirected_values_t **redirected_values,
      libcerror_error_t **error );
 
+int libmsiecf_redirected_values_reference(
+     libmsiecf_redirected_values_t *redirected_values,
+     libcerror_error_t **error );
+
 int libmsiecf_redirected_values_read_data(
      libmsiecf_redirected_values_t *redirected_values,
      const uint8_t *data,
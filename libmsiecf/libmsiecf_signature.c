@@ -0,0 +1,168 @@
+/*
+ * Record signature functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_signature.h"
+
+/* Determines if a 32-bit value is a record signature
+ */
+#define libmsiecf_signature_is_record( value_32bit ) \
+	( ( value_32bit == LIBMSIECF_SIGNATURE_URL ) \
+	 || ( value_32bit == LIBMSIECF_SIGNATURE_HASH ) \
+	 || ( value_32bit == LIBMSIECF_SIGNATURE_REDR ) \
+	 || ( value_32bit == LIBMSIECF_SIGNATURE_LEAK ) )
+
+/* Determines if a byte is the first byte of a record signature
+ * "URL ", "HASH", "REDR" and "LEAK" all start with a different character
+ */
+#define libmsiecf_signature_is_record_first_byte( byte_value ) \
+	( ( byte_value == (uint8_t) 'U' ) \
+	 || ( byte_value == (uint8_t) 'H' ) \
+	 || ( byte_value == (uint8_t) 'R' ) \
+	 || ( byte_value == (uint8_t) 'L' ) )
+
+/* Finds the first block that starts with a record signature
+ * The data is expected to start at a block boundary
+ * The block index is set to the index of the block containing the signature
+ * or the number of blocks that were checked if no signature was found
+ * Returns 1 if a record signature was found, 0 if not or -1 on error
+ */
+int libmsiecf_signature_find_record(
+     const uint8_t *data,
+     size_t data_size,
+     size_t block_size,
+     size_t *block_index,
+     libcerror_error_t **error )
+{
+	const uint8_t *block_data = NULL;
+	static char *function     = "libmsiecf_signature_find_record";
+	size_t number_of_blocks   = 0;
+	size_t search_index       = 0;
+	size_t value_index        = 0;
+	uint32_t value_32bit      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size < 4 )
+	 || ( block_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block index.",
+		 function );
+
+		return( -1 );
+	}
+	*block_index = 0;
+
+	if( data_size < 4 )
+	{
+		return( 0 );
+	}
+	/* Only complete 4-byte values are checked
+	 */
+	number_of_blocks = ( ( data_size - 4 ) / block_size ) + 1;
+
+	/* Check 4 blocks per iteration, the 32-bit values are only read
+	 * if one of the blocks starts with the first byte of a record signature
+	 */
+	while( ( search_index + 4 ) <= number_of_blocks )
+	{
+		block_data = &( data[ search_index * block_size ] );
+
+		if( libmsiecf_signature_is_record_first_byte( block_data[ 0 ] )
+		 || libmsiecf_signature_is_record_first_byte( block_data[ block_size ] )
+		 || libmsiecf_signature_is_record_first_byte( block_data[ 2 * block_size ] )
+		 || libmsiecf_signature_is_record_first_byte( block_data[ 3 * block_size ] ) )
+		{
+			for( value_index = 0;
+			     value_index < 4;
+			     value_index++ )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( block_data[ value_index * block_size ] ),
+				 value_32bit );
+
+				if( libmsiecf_signature_is_record( value_32bit ) )
+				{
+					*block_index = search_index + value_index;
+
+					return( 1 );
+				}
+			}
+		}
+		search_index += 4;
+	}
+	while( search_index < number_of_blocks )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ search_index * block_size ] ),
+		 value_32bit );
+
+		if( libmsiecf_signature_is_record( value_32bit ) )
+		{
+			*block_index = search_index;
+
+			return( 1 );
+		}
+		search_index++;
+	}
+	*block_index = number_of_blocks;
+
+	return( 0 );
+}
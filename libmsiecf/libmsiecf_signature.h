@@ -0,0 +1,52 @@
+/*
+ * Record signature functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMSIECF_SIGNATURE_H )
+#define _LIBMSIECF_SIGNATURE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmsiecf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The record signatures as 32-bit little-endian values
+ */
+#define LIBMSIECF_SIGNATURE_HASH	0x48534148UL
+#define LIBMSIECF_SIGNATURE_LEAK	0x4b41454cUL
+#define LIBMSIECF_SIGNATURE_REDR	0x52444552UL
+#define LIBMSIECF_SIGNATURE_URL		0x204c5255UL
+
+int libmsiecf_signature_find_record(
+     const uint8_t *data,
+     size_t data_size,
+     size_t block_size,
+     size_t *block_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMSIECF_SIGNATURE_H ) */
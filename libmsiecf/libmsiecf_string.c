@@ -0,0 +1,290 @@
+/*
+ * String functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_libuna.h"
+#include "libmsiecf_string.h"
+
+/* Determines if a byte stream only contains 7-bit ASCII characters
+ * The byte stream is tested 32 bytes at a time, 8 bytes per 64-bit word,
+ * since the URL strings are predominantly ASCII
+ * Returns 1 if ASCII, 0 if not or -1 on error
+ */
+int libmsiecf_string_is_ascii(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     libcerror_error_t **error )
+{
+	uint64_t values_64bit[ 4 ];
+
+	static char *function    = "libmsiecf_string_is_ascii";
+	size_t byte_stream_index = 0;
+	uint8_t byte_value       = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The byte stream is copied into the 64-bit values to prevent unaligned access
+	 */
+	while( ( byte_stream_index + 32 ) <= byte_stream_size )
+	{
+		if( memory_copy(
+		     values_64bit,
+		     &( byte_stream[ byte_stream_index ] ),
+		     32 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( ( values_64bit[ 0 ] | values_64bit[ 1 ] | values_64bit[ 2 ] | values_64bit[ 3 ] ) & (uint64_t) 0x8080808080808080UL ) != 0 )
+		{
+			return( 0 );
+		}
+		byte_stream_index += 32;
+	}
+	while( byte_stream_index < byte_stream_size )
+	{
+		byte_value |= byte_stream[ byte_stream_index++ ];
+	}
+	if( ( byte_value & 0x80 ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Creates an UTF-8 string from a byte stream
+ * The byte stream is copied directly if it only contains ASCII characters
+ * otherwise it is converted using the codepage
+ * Make sure the value utf8_string is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_string_get_utf8_string_from_byte_stream(
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libmsiecf_string_get_utf8_string_from_byte_stream";
+	size_t safe_string_size = 0;
+	size_t string_length    = 0;
+	int result              = 0;
+
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *utf8_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid UTF-8 string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmsiecf_string_is_ascii(
+	          byte_stream,
+	          byte_stream_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if byte stream is ASCII.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		/* All supported codepages map the ASCII characters onto themselves
+		 */
+		while( string_length < byte_stream_size )
+		{
+			if( byte_stream[ string_length ] == 0 )
+			{
+				break;
+			}
+			string_length++;
+		}
+		safe_string_size = string_length + 1;
+	}
+	else if( libuna_utf8_string_size_from_byte_stream(
+	          byte_stream,
+	          byte_stream_size,
+	          codepage,
+	          &safe_string_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( safe_string_size == 0 )
+	 || ( safe_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	*utf8_string = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * safe_string_size );
+
+	if( *utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( result != 0 )
+	{
+		if( string_length > 0 )
+		{
+			if( memory_copy(
+			     *utf8_string,
+			     byte_stream,
+			     string_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy byte stream to UTF-8 string.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		( *utf8_string )[ string_length ] = 0;
+	}
+	else if( libuna_utf8_string_copy_from_byte_stream(
+	          (libuna_utf8_character_t *) *utf8_string,
+	          safe_string_size,
+	          byte_stream,
+	          byte_stream_size,
+	          codepage,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy byte stream to UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	*utf8_string_size = safe_string_size;
+
+	return( 1 );
+
+on_error:
+	if( *utf8_string != NULL )
+	{
+		memory_free(
+		 *utf8_string );
+
+		*utf8_string = NULL;
+	}
+	return( -1 );
+}
+
@@ -36,10 +36,14 @@
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
 typedef struct libmsiecf_file {}	libmsiecf_file_t;
 typedef struct libmsiecf_item {}	libmsiecf_item_t;
+typedef struct libmsiecf_item_view {}	libmsiecf_item_view_t;
+typedef struct libmsiecf_url_columns {}	libmsiecf_url_columns_t;
 
 #else
 typedef intptr_t libmsiecf_file_t;
 typedef intptr_t libmsiecf_item_t;
+typedef intptr_t libmsiecf_item_view_t;
+typedef intptr_t libmsiecf_url_columns_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
@@ -637,6 +637,7 @@ int libmsiecf_url_get_location_size(
      libcerror_error_t **error )
 {
 	libmsiecf_internal_item_t *internal_item = NULL;
+	libmsiecf_url_strings_t *url_strings     = NULL;
 	static char *function                    = "libmsiecf_url_get_location_size";
 
 	if( url == NULL )
@@ -686,12 +687,26 @@ int libmsiecf_url_get_location_size(
 
 		return( -1 );
 	}
-	if( ( (libmsiecf_url_values_t *) internal_item->value )->location == NULL )
+	if( libmsiecf_url_values_read_strings(
+	     (libmsiecf_url_values_t *) internal_item->value,
+	     &url_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read URL strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( url_strings->location == NULL )
 	{
 		return( 0 );
 	}
 	if( libfvalue_value_get_data_size(
-	     ( (libmsiecf_url_values_t *) internal_item->value )->location,
+	     url_strings->location,
 	     string_size,
 	     error ) != 1 )
 	{
@@ -718,6 +733,7 @@ int libmsiecf_url_get_location(
      libcerror_error_t **error )
 {
 	libmsiecf_internal_item_t *internal_item = NULL;
+	libmsiecf_url_strings_t *url_strings     = NULL;
 	static char *function                    = "libmsiecf_url_get_location";
 
 	if( url == NULL )
@@ -767,12 +783,26 @@ int libmsiecf_url_get_location(
 
 		return( -1 );
 	}
-	if( ( (libmsiecf_url_values_t *) internal_item->value )->location == NULL )
+	if( libmsiecf_url_values_read_strings(
+	     (libmsiecf_url_values_t *) internal_item->value,
+	     &url_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read URL strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( url_strings->location == NULL )
 	{
 		return( 0 );
 	}
 	if( libfvalue_value_copy_data(
-	     ( (libmsiecf_url_values_t *) internal_item->value )->location,
+	     url_strings->location,
 	     (uint8_t *) string,
 	     string_size,
 	     error ) != 1 )
@@ -789,6 +819,111 @@ int libmsiecf_url_get_location(
 	return( 1 );
 }
 
+/* Retrieves a view of the location
+ * The view references the record data of the item and is valid for the lifetime of the item
+ * The location is not converted and uses the ASCII codepage, including the end of string character if present
+ * Returns 1 if successful, 0 if no location or -1 on error
+ */
+int libmsiecf_url_get_location_view(
+     libmsiecf_item_t *url,
+     const uint8_t **location,
+     size_t *location_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_t *internal_item = NULL;
+	static char *function                    = "libmsiecf_url_get_location_view";
+	int result                               = 0;
+
+	if( url == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libmsiecf_internal_item_t *) url;
+
+	if( internal_item->item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->item_descriptor->type != LIBMSIECF_ITEM_TYPE_URL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type: %" PRIu8 ".",
+		 function,
+		 internal_item->item_descriptor->type );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing item values.",
+		 function );
+
+		return( -1 );
+	}
+	if( location == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location.",
+		 function );
+
+		return( -1 );
+	}
+	if( location_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid location size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmsiecf_url_values_get_record_string(
+	          (libmsiecf_url_values_t *) internal_item->value,
+	          ( (libmsiecf_url_values_t *) internal_item->value )->location_offset,
+	          location,
+	          location_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve location.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size of the UTF-8 encoded location
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if no location or -1 on error
@@ -799,6 +934,7 @@ int libmsiecf_url_get_utf8_location_size(
      libcerror_error_t **error )
 {
 	libmsiecf_internal_item_t *internal_item = NULL;
+	libmsiecf_url_strings_t *url_strings     = NULL;
 	static char *function                    = "libmsiecf_url_get_utf8_location_size";
 
 	if( url == NULL )
@@ -848,25 +984,37 @@ int libmsiecf_url_get_utf8_location_size(
 
 		return( -1 );
 	}
-	if( ( (libmsiecf_url_values_t *) internal_item->value )->location == NULL )
+	if( libmsiecf_url_values_read_strings(
+	     (libmsiecf_url_values_t *) internal_item->value,
+	     &url_strings,
+	     error ) != 1 )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read URL strings.",
+		 function );
+
+		return( -1 );
 	}
-	if( libfvalue_value_get_utf8_string_size(
-	     ( (libmsiecf_url_values_t *) internal_item->value )->location,
-	     0,
-	     utf8_string_size,
-	     error ) != 1 )
+	if( utf8_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve location UTF-8 string size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
 		 function );
 
 		return( -1 );
 	}
+	if( url_strings->utf8_location == NULL )
+	{
+		return( 0 );
+	}
+	*utf8_string_size = url_strings->utf8_location_size;
+
 	return( 1 );
 }
 
@@ -881,6 +1029,7 @@ int libmsiecf_url_get_utf8_location(
      libcerror_error_t **error )
 {
 	libmsiecf_internal_item_t *internal_item = NULL;
+	libmsiecf_url_strings_t *url_strings     = NULL;
 	static char *function                    = "libmsiecf_url_get_utf8_location";
 
 	if( url == NULL )
@@ -930,21 +1079,66 @@ int libmsiecf_url_get_utf8_location(
 
 		return( -1 );
 	}
-	if( ( (libmsiecf_url_values_t *) internal_item->value )->location == NULL )
+	if( libmsiecf_url_values_read_strings(
+	     (libmsiecf_url_values_t *) internal_item->value,
+	     &url_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read URL strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( url_strings->utf8_location == NULL )
 	{
 		return( 0 );
 	}
-	if( libfvalue_value_copy_to_utf8_string(
-	     ( (libmsiecf_url_values_t *) internal_item->value )->location,
-	     0,
+	if( utf8_string_size < url_strings->utf8_location_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
 	     utf8_string,
-	     utf8_string_size,
-	     error ) != 1 )
+	     url_strings->utf8_location,
+	     url_strings->utf8_location_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
 		 "%s: unable to copy location to UTF-8 string.",
 		 function );
 
@@ -963,6 +1157,7 @@ int libmsiecf_url_get_utf16_location_size(
      libcerror_error_t **error )
 {
 	libmsiecf_internal_item_t *internal_item = NULL;
+	libmsiecf_url_strings_t *url_strings     = NULL;
 	static char *function                    = "libmsiecf_url_get_utf16_location_size";
 
 	if( url == NULL )
@@ -1012,12 +1207,26 @@ int libmsiecf_url_get_utf16_location_size(
 
 		return( -1 );
 	}
-	if( ( (libmsiecf_url_values_t *) internal_item->value )->location == NULL )
+	if( libmsiecf_url_values_read_strings(
+	     (libmsiecf_url_values_t *) internal_item->value,
+	     &url_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read URL strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( url_strings->location == NULL )
 	{
 		return( 0 );
 	}
 	if( libfvalue_value_get_utf16_string_size(
-	     ( (libmsiecf_url_values_t *) internal_item->value )->location,
+	     url_strings->location,
 	     0,
 	     utf16_string_size,
 	     error ) != 1 )
@@ -1045,6 +1254,7 @@ int libmsiecf_url_get_utf16_location(
      libcerror_error_t **error )
 {
 	libmsiecf_internal_item_t *internal_item = NULL;
+	libmsiecf_url_strings_t *url_strings     = NULL;
 	static char *function                    = "libmsiecf_url_get_utf16_location";
 
 	if( url == NULL )
@@ -1094,12 +1304,26 @@ int libmsiecf_url_get_utf16_location(
 
 		return( -1 );
 	}
-	if( ( (libmsiecf_url_values_t *) internal_item->value )->location == NULL )
+	if( libmsiecf_url_values_read_strings(
+	     (libmsiecf_url_values_t *) internal_item->value,
+	     &url_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read URL strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( url_strings->location == NULL )
 	{
 		return( 0 );
 	}
 	if( libfvalue_value_copy_to_utf16_string(
-	     ( (libmsiecf_url_values_t *) internal_item->value )->location,
+	     url_strings->location,
 	     0,
 	     utf16_string,
 	     utf16_string_size,
@@ -1127,6 +1351,7 @@ int libmsiecf_url_get_filename_size(
      libcerror_error_t **error )
 {
 	libmsiecf_internal_item_t *internal_item = NULL;
+	libmsiecf_url_strings_t *url_strings     = NULL;
 	static char *function                    = "libmsiecf_url_get_filename_size";
 
 	if( url == NULL )
@@ -1176,12 +1401,26 @@ int libmsiecf_url_get_filename_size(
 
 		return( -1 );
 	}
-	if( ( (libmsiecf_url_values_t *) internal_item->value )->filename == NULL )
+	if( libmsiecf_url_values_read_strings(
+	     (libmsiecf_url_values_t *) internal_item->value,
+	     &url_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read URL strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( url_strings->filename == NULL )
 	{
 		return( 0 );
 	}
 	if( libfvalue_value_get_data_size(
-	     ( (libmsiecf_url_values_t *) internal_item->value )->filename,
+	     url_strings->filename,
 	     string_size,
 	     error ) != 1 )
 	{
@@ -1208,6 +1447,7 @@ int libmsiecf_url_get_filename(
      libcerror_error_t **error )
 {
 	libmsiecf_internal_item_t *internal_item = NULL;
+	libmsiecf_url_strings_t *url_strings     = NULL;
 	static char *function                    = "libmsiecf_url_get_filename";
 
 	if( url == NULL )
@@ -1257,12 +1497,26 @@ int libmsiecf_url_get_filename(
 
 		return( -1 );
 	}
-	if( ( (libmsiecf_url_values_t *) internal_item->value )->filename == NULL )
+	if( libmsiecf_url_values_read_strings(
+	     (libmsiecf_url_values_t *) internal_item->value,
+	     &url_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read URL strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( url_strings->filename == NULL )
 	{
 		return( 0 );
 	}
 	if( libfvalue_value_copy_data(
-	     ( (libmsiecf_url_values_t *) internal_item->value )->filename,
+	     url_strings->filename,
 	     (uint8_t *) string,
 	     string_size,
 	     error ) != 1 )
@@ -1279,6 +1533,111 @@ int libmsiecf_url_get_filename(
 	return( 1 );
 }
 
+/* Retrieves a view of the filename
+ * The view references the record data of the item and is valid for the lifetime of the item
+ * The filename is not converted and uses the ASCII codepage, including the end of string character if present
+ * Returns 1 if successful, 0 if no filename or -1 on error
+ */
+int libmsiecf_url_get_filename_view(
+     libmsiecf_item_t *url,
+     const uint8_t **filename,
+     size_t *filename_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_t *internal_item = NULL;
+	static char *function                    = "libmsiecf_url_get_filename_view";
+	int result                               = 0;
+
+	if( url == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libmsiecf_internal_item_t *) url;
+
+	if( internal_item->item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->item_descriptor->type != LIBMSIECF_ITEM_TYPE_URL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type: %" PRIu8 ".",
+		 function,
+		 internal_item->item_descriptor->type );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing item values.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename size.",
+		 function );
+
+		return( -1 );
+	}
+	result = libmsiecf_url_values_get_record_string(
+	          (libmsiecf_url_values_t *) internal_item->value,
+	          ( (libmsiecf_url_values_t *) internal_item->value )->filename_offset,
+	          filename,
+	          filename_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve filename.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size of the UTF-8 encoded filename
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if no filename or -1 on error
@@ -1289,6 +1648,7 @@ int libmsiecf_url_get_utf8_filename_size(
      libcerror_error_t **error )
 {
 	libmsiecf_internal_item_t *internal_item = NULL;
+	libmsiecf_url_strings_t *url_strings     = NULL;
 	static char *function                    = "libmsiecf_url_get_utf8_filename_size";
 
 	if( url == NULL )
@@ -1338,25 +1698,37 @@ int libmsiecf_url_get_utf8_filename_size(
 
 		return( -1 );
 	}
-	if( ( (libmsiecf_url_values_t *) internal_item->value )->filename == NULL )
+	if( libmsiecf_url_values_read_strings(
+	     (libmsiecf_url_values_t *) internal_item->value,
+	     &url_strings,
+	     error ) != 1 )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read URL strings.",
+		 function );
+
+		return( -1 );
 	}
-	if( libfvalue_value_get_utf8_string_size(
-	     ( (libmsiecf_url_values_t *) internal_item->value )->filename,
-	     0,
-	     utf8_string_size,
-	     error ) != 1 )
+	if( utf8_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve filename UTF-8 string size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
 		 function );
 
 		return( -1 );
 	}
+	if( url_strings->utf8_filename == NULL )
+	{
+		return( 0 );
+	}
+	*utf8_string_size = url_strings->utf8_filename_size;
+
 	return( 1 );
 }
 
@@ -1371,6 +1743,7 @@ int libmsiecf_url_get_utf8_filename(
      libcerror_error_t **error )
 {
 	libmsiecf_internal_item_t *internal_item = NULL;
+	libmsiecf_url_strings_t *url_strings     = NULL;
 	static char *function                    = "libmsiecf_url_get_utf8_filename";
 
 	if( url == NULL )
@@ -1420,21 +1793,66 @@ int libmsiecf_url_get_utf8_filename(
 
 		return( -1 );
 	}
-	if( ( (libmsiecf_url_values_t *) internal_item->value )->filename == NULL )
+	if( libmsiecf_url_values_read_strings(
+	     (libmsiecf_url_values_t *) internal_item->value,
+	     &url_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read URL strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( url_strings->utf8_filename == NULL )
 	{
 		return( 0 );
 	}
-	if( libfvalue_value_copy_to_utf8_string(
-	     ( (libmsiecf_url_values_t *) internal_item->value )->filename,
-	     0,
+	if( utf8_string_size < url_strings->utf8_filename_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid UTF-8 string size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
 	     utf8_string,
-	     utf8_string_size,
-	     error ) != 1 )
+	     url_strings->utf8_filename,
+	     url_strings->utf8_filename_size ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
 		 "%s: unable to copy filename to UTF-8 string.",
 		 function );
 
@@ -1453,6 +1871,7 @@ int libmsiecf_url_get_utf16_filename_size(
      libcerror_error_t **error )
 {
 	libmsiecf_internal_item_t *internal_item = NULL;
+	libmsiecf_url_strings_t *url_strings     = NULL;
 	static char *function                    = "libmsiecf_url_get_utf16_filename_size";
 
 	if( url == NULL )
@@ -1502,12 +1921,26 @@ int libmsiecf_url_get_utf16_filename_size(
 
 		return( -1 );
 	}
-	if( ( (libmsiecf_url_values_t *) internal_item->value )->filename == NULL )
+	if( libmsiecf_url_values_read_strings(
+	     (libmsiecf_url_values_t *) internal_item->value,
+	     &url_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read URL strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( url_strings->filename == NULL )
 	{
 		return( 0 );
 	}
 	if( libfvalue_value_get_utf16_string_size(
-	     ( (libmsiecf_url_values_t *) internal_item->value )->filename,
+	     url_strings->filename,
 	     0,
 	     utf16_string_size,
 	     error ) != 1 )
@@ -1535,6 +1968,7 @@ int libmsiecf_url_get_utf16_filename(
      libcerror_error_t **error )
 {
 	libmsiecf_internal_item_t *internal_item = NULL;
+	libmsiecf_url_strings_t *url_strings     = NULL;
 	static char *function                    = "libmsiecf_url_get_utf16_filename";
 
 	if( url == NULL )
@@ -1584,12 +2018,26 @@ int libmsiecf_url_get_utf16_filename(
 
 		return( -1 );
 	}
-	if( ( (libmsiecf_url_values_t *) internal_item->value )->filename == NULL )
+	if( libmsiecf_url_values_read_strings(
+	     (libmsiecf_url_values_t *) internal_item->value,
+	     &url_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read URL strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( url_strings->filename == NULL )
 	{
 		return( 0 );
 	}
 	if( libfvalue_value_copy_to_utf16_string(
-	     ( (libmsiecf_url_values_t *) internal_item->value )->filename,
+	     url_strings->filename,
 	     0,
 	     utf16_string,
 	     utf16_string_size,
@@ -1796,3 +2244,95 @@ int libmsiecf_url_get_data(
 	return( 1 );
 }
 
+/* Retrieves a view of the data
+ * The view references the record data of the item and is valid for the lifetime of the item
+ * Returns 1 if successful, 0 if no data or -1 on error
+ */
+int libmsiecf_url_get_data_view(
+     libmsiecf_item_t *url,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_item_t *internal_item = NULL;
+	static char *function                    = "libmsiecf_url_get_data_view";
+
+	if( url == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL.",
+		 function );
+
+		return( -1 );
+	}
+	internal_item = (libmsiecf_internal_item_t *) url;
+
+	if( internal_item->item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_item->item_descriptor->type != LIBMSIECF_ITEM_TYPE_URL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type: %" PRIu8 ".",
+		 function,
+		 internal_item->item_descriptor->type );
+
+		return( -1 );
+	}
+	if( internal_item->value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid item - missing item values.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (libmsiecf_url_values_t *) internal_item->value )->data == NULL )
+	{
+		return( 0 );
+	}
+	*data      = ( (libmsiecf_url_values_t *) internal_item->value )->data;
+	*data_size = ( (libmsiecf_url_values_t *) internal_item->value )->data_size;
+
+	return( 1 );
+}
+
@@ -94,6 +94,13 @@ int libmsiecf_url_get_location(
      size_t string_size,
      libcerror_error_t **error );
 
+LIBMSIECF_EXTERN \
+int libmsiecf_url_get_location_view(
+     libmsiecf_item_t *url,
+     const uint8_t **location,
+     size_t *location_size,
+     libcerror_error_t **error );
+
 LIBMSIECF_EXTERN \
 int libmsiecf_url_get_utf8_location_size(
      libmsiecf_item_t *url,
@@ -133,6 +140,13 @@ int libmsiecf_url_get_filename(
      size_t string_size,
      libcerror_error_t **error );
 
+LIBMSIECF_EXTERN \
+int libmsiecf_url_get_filename_view(
+     libmsiecf_item_t *url,
+     const uint8_t **filename,
+     size_t *filename_size,
+     libcerror_error_t **error );
+
 LIBMSIECF_EXTERN \
 int libmsiecf_url_get_utf8_filename_size(
      libmsiecf_item_t *url,
@@ -172,6 +186,13 @@ int libmsiecf_url_get_data(
      size_t data_size,
      libcerror_error_t **error );
 
+LIBMSIECF_EXTERN \
+int libmsiecf_url_get_data_view(
+     libmsiecf_item_t *url,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1387 @@
+/*
+ * URL columns functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libmsiecf_definitions.h"
+#include "libmsiecf_io_handle.h"
+#include "libmsiecf_item_descriptor.h"
+#include "libmsiecf_libbfio.h"
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_record_decoders.h"
+#include "libmsiecf_url_columns.h"
+
+/* Creates URL columns
+ * Make sure the value url_columns is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_columns_initialize(
+     libmsiecf_url_columns_t **url_columns,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_url_columns_t *internal_url_columns = NULL;
+	static char *function                                  = "libmsiecf_url_columns_initialize";
+
+	if( url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	if( *url_columns != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid URL columns value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_url_columns = memory_allocate_structure(
+	                        libmsiecf_internal_url_columns_t );
+
+	if( internal_url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create URL columns.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_url_columns,
+	     0,
+	     sizeof( libmsiecf_internal_url_columns_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear URL columns.",
+		 function );
+
+		goto on_error;
+	}
+	*url_columns = (libmsiecf_url_columns_t *) internal_url_columns;
+
+	return( 1 );
+
+on_error:
+	if( internal_url_columns != NULL )
+	{
+		memory_free(
+		 internal_url_columns );
+	}
+	return( -1 );
+}
+
+/* Frees URL columns
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_columns_free(
+     libmsiecf_url_columns_t **url_columns,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_url_columns_t *internal_url_columns = NULL;
+	static char *function                                  = "libmsiecf_url_columns_free";
+
+	if( url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	if( *url_columns != NULL )
+	{
+		internal_url_columns = (libmsiecf_internal_url_columns_t *) *url_columns;
+		*url_columns         = NULL;
+
+		if( internal_url_columns->item_indexes != NULL )
+		{
+			memory_free(
+			 internal_url_columns->item_indexes );
+		}
+		if( internal_url_columns->item_flags != NULL )
+		{
+			memory_free(
+			 internal_url_columns->item_flags );
+		}
+		if( internal_url_columns->primary_times != NULL )
+		{
+			memory_free(
+			 internal_url_columns->primary_times );
+		}
+		if( internal_url_columns->secondary_times != NULL )
+		{
+			memory_free(
+			 internal_url_columns->secondary_times );
+		}
+		if( internal_url_columns->expiration_times != NULL )
+		{
+			memory_free(
+			 internal_url_columns->expiration_times );
+		}
+		if( internal_url_columns->last_checked_times != NULL )
+		{
+			memory_free(
+			 internal_url_columns->last_checked_times );
+		}
+		if( internal_url_columns->cached_file_sizes != NULL )
+		{
+			memory_free(
+			 internal_url_columns->cached_file_sizes );
+		}
+		if( internal_url_columns->numbers_of_hits != NULL )
+		{
+			memory_free(
+			 internal_url_columns->numbers_of_hits );
+		}
+		if( internal_url_columns->cache_directory_indexes != NULL )
+		{
+			memory_free(
+			 internal_url_columns->cache_directory_indexes );
+		}
+		if( internal_url_columns->record_header_data != NULL )
+		{
+			memory_free(
+			 internal_url_columns->record_header_data );
+		}
+		memory_free(
+		 internal_url_columns );
+	}
+	return( 1 );
+}
+
+/* Resizes the URL columns to hold a specific number of rows and removes the current rows
+ * The columns and record header data are only reallocated when they need to grow
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_internal_url_columns_resize(
+     libmsiecf_internal_url_columns_t *internal_url_columns,
+     int number_of_rows,
+     size_t record_header_size,
+     libcerror_error_t **error )
+{
+	void *reallocation    = NULL;
+	static char *function = "libmsiecf_internal_url_columns_resize";
+
+	if( internal_url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_header_size == 0 )
+	 || ( record_header_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record header size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_rows < 0 )
+	 || ( (size_t) number_of_rows > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / record_header_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of rows value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_url_columns->number_of_rows     = 0;
+	internal_url_columns->record_header_size = record_header_size;
+
+	if( number_of_rows > internal_url_columns->number_of_allocated_rows )
+	{
+		reallocation = memory_reallocate(
+		                internal_url_columns->item_indexes,
+		                sizeof( int ) * number_of_rows );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize item indexes column.",
+			 function );
+
+			return( -1 );
+		}
+		internal_url_columns->item_indexes = (int *) reallocation;
+
+		reallocation = memory_reallocate(
+		                internal_url_columns->item_flags,
+		                sizeof( uint8_t ) * number_of_rows );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize item flags column.",
+			 function );
+
+			return( -1 );
+		}
+		internal_url_columns->item_flags = (uint8_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                internal_url_columns->primary_times,
+		                sizeof( uint64_t ) * number_of_rows );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize primary times column.",
+			 function );
+
+			return( -1 );
+		}
+		internal_url_columns->primary_times = (uint64_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                internal_url_columns->secondary_times,
+		                sizeof( uint64_t ) * number_of_rows );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize secondary times column.",
+			 function );
+
+			return( -1 );
+		}
+		internal_url_columns->secondary_times = (uint64_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                internal_url_columns->expiration_times,
+		                sizeof( uint64_t ) * number_of_rows );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize expiration times column.",
+			 function );
+
+			return( -1 );
+		}
+		internal_url_columns->expiration_times = (uint64_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                internal_url_columns->last_checked_times,
+		                sizeof( uint32_t ) * number_of_rows );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize last checked times column.",
+			 function );
+
+			return( -1 );
+		}
+		internal_url_columns->last_checked_times = (uint32_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                internal_url_columns->cached_file_sizes,
+		                sizeof( uint32_t ) * number_of_rows );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize cached file sizes column.",
+			 function );
+
+			return( -1 );
+		}
+		internal_url_columns->cached_file_sizes = (uint32_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                internal_url_columns->numbers_of_hits,
+		                sizeof( uint32_t ) * number_of_rows );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize numbers of hits column.",
+			 function );
+
+			return( -1 );
+		}
+		internal_url_columns->numbers_of_hits = (uint32_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                internal_url_columns->cache_directory_indexes,
+		                sizeof( uint8_t ) * number_of_rows );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize cache directory indexes column.",
+			 function );
+
+			return( -1 );
+		}
+		internal_url_columns->cache_directory_indexes  = (uint8_t *) reallocation;
+		internal_url_columns->number_of_allocated_rows = number_of_rows;
+	}
+	if( ( record_header_size * internal_url_columns->number_of_allocated_rows ) > internal_url_columns->record_header_data_size )
+	{
+		reallocation = memory_reallocate(
+		                internal_url_columns->record_header_data,
+		                record_header_size * internal_url_columns->number_of_allocated_rows );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize record header data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_url_columns->record_header_data      = (uint8_t *) reallocation;
+		internal_url_columns->record_header_data_size = record_header_size * internal_url_columns->number_of_allocated_rows;
+	}
+	return( 1 );
+}
+
+/* Reads the record header of an URL item into the next row
+ * Only the record header is read, the record header is decoded by
+ * libmsiecf_internal_url_columns_decode_record_headers
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_internal_url_columns_read_record_header(
+     libmsiecf_internal_url_columns_t *internal_url_columns,
+     libmsiecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmsiecf_item_descriptor_t *item_descriptor,
+     int item_index,
+     libcerror_error_t **error )
+{
+	const uint8_t *file_data    = NULL;
+	uint8_t *record_header_data = NULL;
+	static char *function       = "libmsiecf_internal_url_columns_read_record_header";
+	ssize_t read_count          = 0;
+	int result                  = 0;
+
+	if( internal_url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_url_columns->number_of_rows >= internal_url_columns->number_of_allocated_rows )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid URL columns - number of rows value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( item_descriptor->type != LIBMSIECF_ITEM_TYPE_URL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported item type: %" PRIu8 ".",
+		 function,
+		 item_descriptor->type );
+
+		return( -1 );
+	}
+	if( (size_t) item_descriptor->record_size < internal_url_columns->record_header_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid item descriptor - record size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	record_header_data = &( internal_url_columns->record_header_data[ internal_url_columns->number_of_rows * internal_url_columns->record_header_size ] );
+
+	result = libmsiecf_io_handle_get_file_data(
+	          io_handle,
+	          item_descriptor->file_offset,
+	          internal_url_columns->record_header_size,
+	          &file_data,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 item_descriptor->file_offset,
+		 item_descriptor->file_offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( memory_copy(
+		     record_header_data,
+		     file_data,
+		     internal_url_columns->record_header_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy record header data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		read_count = libmsiecf_io_handle_read_buffer_at_offset(
+		              io_handle,
+		              file_io_handle,
+		              record_header_data,
+		              internal_url_columns->record_header_size,
+		              item_descriptor->file_offset,
+		              error );
+
+		if( read_count != (ssize_t) internal_url_columns->record_header_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record header data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 item_descriptor->file_offset,
+			 item_descriptor->file_offset );
+
+			return( -1 );
+		}
+	}
+	if( memory_compare(
+	     record_header_data,
+	     "URL ",
+	     4 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		return( -1 );
+	}
+	internal_url_columns->item_indexes[ internal_url_columns->number_of_rows ] = item_index;
+	internal_url_columns->item_flags[ internal_url_columns->number_of_rows ]   = item_descriptor->flags;
+
+	internal_url_columns->number_of_rows += 1;
+
+	return( 1 );
+}
+
+/* Decodes the format version 4.7 record headers into the columns
+ * Every column is decoded in a separate pass over the record headers
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_internal_url_columns_decode_record_headers_v47(
+     libmsiecf_internal_url_columns_t *internal_url_columns,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_internal_url_columns_decode_record_headers_v47";
+
+	if( internal_url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_url_columns->record_header_size != LIBMSIECF_URL_RECORD_HEADER_V47_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid URL columns - unsupported record header size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_url_record_header_v47_decode_primary_time_column(
+	     internal_url_columns->record_header_data,
+	     internal_url_columns->record_header_data_size,
+	     internal_url_columns->number_of_rows,
+	     internal_url_columns->primary_times,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode primary time column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_url_record_header_v47_decode_secondary_time_column(
+	     internal_url_columns->record_header_data,
+	     internal_url_columns->record_header_data_size,
+	     internal_url_columns->number_of_rows,
+	     internal_url_columns->secondary_times,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode secondary time column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_url_record_header_v47_decode_expiration_time_column(
+	     internal_url_columns->record_header_data,
+	     internal_url_columns->record_header_data_size,
+	     internal_url_columns->number_of_rows,
+	     internal_url_columns->expiration_times,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode expiration time column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_url_record_header_v47_decode_last_checked_time_column(
+	     internal_url_columns->record_header_data,
+	     internal_url_columns->record_header_data_size,
+	     internal_url_columns->number_of_rows,
+	     internal_url_columns->last_checked_times,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode last checked time column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_url_record_header_v47_decode_cached_file_size_column(
+	     internal_url_columns->record_header_data,
+	     internal_url_columns->record_header_data_size,
+	     internal_url_columns->number_of_rows,
+	     internal_url_columns->cached_file_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode cached file size column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_url_record_header_v47_decode_number_of_hits_column(
+	     internal_url_columns->record_header_data,
+	     internal_url_columns->record_header_data_size,
+	     internal_url_columns->number_of_rows,
+	     internal_url_columns->numbers_of_hits,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode number of hits column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_url_record_header_v47_decode_cache_directory_index_column(
+	     internal_url_columns->record_header_data,
+	     internal_url_columns->record_header_data_size,
+	     internal_url_columns->number_of_rows,
+	     internal_url_columns->cache_directory_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode cache directory index column.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decodes the format version 5.2 record headers into the columns
+ * Every column is decoded in a separate pass over the record headers
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_internal_url_columns_decode_record_headers_v52(
+     libmsiecf_internal_url_columns_t *internal_url_columns,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_internal_url_columns_decode_record_headers_v52";
+
+	if( internal_url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_url_columns->record_header_size != LIBMSIECF_URL_RECORD_HEADER_V52_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid URL columns - unsupported record header size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_url_record_header_v52_decode_primary_time_column(
+	     internal_url_columns->record_header_data,
+	     internal_url_columns->record_header_data_size,
+	     internal_url_columns->number_of_rows,
+	     internal_url_columns->primary_times,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode primary time column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_url_record_header_v52_decode_secondary_time_column(
+	     internal_url_columns->record_header_data,
+	     internal_url_columns->record_header_data_size,
+	     internal_url_columns->number_of_rows,
+	     internal_url_columns->secondary_times,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode secondary time column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_url_record_header_v52_decode_expiration_time_column(
+	     internal_url_columns->record_header_data,
+	     internal_url_columns->record_header_data_size,
+	     internal_url_columns->number_of_rows,
+	     internal_url_columns->expiration_times,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode expiration time column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_url_record_header_v52_decode_last_checked_time_column(
+	     internal_url_columns->record_header_data,
+	     internal_url_columns->record_header_data_size,
+	     internal_url_columns->number_of_rows,
+	     internal_url_columns->last_checked_times,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode last checked time column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_url_record_header_v52_decode_cached_file_size_column(
+	     internal_url_columns->record_header_data,
+	     internal_url_columns->record_header_data_size,
+	     internal_url_columns->number_of_rows,
+	     internal_url_columns->cached_file_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode cached file size column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_url_record_header_v52_decode_number_of_hits_column(
+	     internal_url_columns->record_header_data,
+	     internal_url_columns->record_header_data_size,
+	     internal_url_columns->number_of_rows,
+	     internal_url_columns->numbers_of_hits,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode number of hits column.",
+		 function );
+
+		return( -1 );
+	}
+	if( libmsiecf_url_record_header_v52_decode_cache_directory_index_column(
+	     internal_url_columns->record_header_data,
+	     internal_url_columns->record_header_data_size,
+	     internal_url_columns->number_of_rows,
+	     internal_url_columns->cache_directory_indexes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode cache directory index column.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Decodes the record headers into the columns
+ * The format version is checked once for all rows
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_internal_url_columns_decode_record_headers(
+     libmsiecf_internal_url_columns_t *internal_url_columns,
+     libmsiecf_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_internal_url_columns_decode_record_headers";
+	int result            = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->major_version == 4 )
+	 && ( io_handle->minor_version == 7 ) )
+	{
+		result = libmsiecf_internal_url_columns_decode_record_headers_v47(
+		          internal_url_columns,
+		          error );
+	}
+	else if( ( io_handle->major_version == 5 )
+	      && ( io_handle->minor_version == 2 ) )
+	{
+		result = libmsiecf_internal_url_columns_decode_record_headers_v52(
+		          internal_url_columns,
+		          error );
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %d.%d.",
+		 function,
+		 io_handle->major_version,
+		 io_handle->minor_version );
+
+		return( -1 );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to decode record headers.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of rows
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_columns_get_number_of_rows(
+     libmsiecf_url_columns_t *url_columns,
+     int *number_of_rows,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_url_columns_t *internal_url_columns = NULL;
+	static char *function                                  = "libmsiecf_url_columns_get_number_of_rows";
+
+	if( url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	internal_url_columns = (libmsiecf_internal_url_columns_t *) url_columns;
+
+	if( number_of_rows == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of rows.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_rows = internal_url_columns->number_of_rows;
+
+	return( 1 );
+}
+
+/* Retrieves the item indexes column
+ * The item index refers to the items or the recovered items, depending on the item flags
+ * The column contains a value for every row and remains valid until the URL columns are read again or freed
+ * Returns 1 if successful, 0 if there are no rows or -1 on error
+ */
+int libmsiecf_url_columns_get_item_indexes(
+     libmsiecf_url_columns_t *url_columns,
+     const int **item_indexes,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_url_columns_t *internal_url_columns = NULL;
+	static char *function                                  = "libmsiecf_url_columns_get_item_indexes";
+
+	if( url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	internal_url_columns = (libmsiecf_internal_url_columns_t *) url_columns;
+
+	if( item_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_url_columns->number_of_rows == 0 )
+	{
+		return( 0 );
+	}
+	*item_indexes = internal_url_columns->item_indexes;
+
+	return( 1 );
+}
+
+/* Retrieves the item flags column
+ * The column contains a value for every row and remains valid until the URL columns are read again or freed
+ * Returns 1 if successful, 0 if there are no rows or -1 on error
+ */
+int libmsiecf_url_columns_get_item_flags(
+     libmsiecf_url_columns_t *url_columns,
+     const uint8_t **item_flags,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_url_columns_t *internal_url_columns = NULL;
+	static char *function                                  = "libmsiecf_url_columns_get_item_flags";
+
+	if( url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	internal_url_columns = (libmsiecf_internal_url_columns_t *) url_columns;
+
+	if( item_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_url_columns->number_of_rows == 0 )
+	{
+		return( 0 );
+	}
+	*item_flags = internal_url_columns->item_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the primary date and time column
+ * Contains FILETIME values
+ * The column contains a value for every row and remains valid until the URL columns are read again or freed
+ * Returns 1 if successful, 0 if there are no rows or -1 on error
+ */
+int libmsiecf_url_columns_get_primary_times(
+     libmsiecf_url_columns_t *url_columns,
+     const uint64_t **primary_times,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_url_columns_t *internal_url_columns = NULL;
+	static char *function                                  = "libmsiecf_url_columns_get_primary_times";
+
+	if( url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	internal_url_columns = (libmsiecf_internal_url_columns_t *) url_columns;
+
+	if( primary_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid primary times.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_url_columns->number_of_rows == 0 )
+	{
+		return( 0 );
+	}
+	*primary_times = internal_url_columns->primary_times;
+
+	return( 1 );
+}
+
+/* Retrieves the secondary date and time column
+ * Contains FILETIME values
+ * The column contains a value for every row and remains valid until the URL columns are read again or freed
+ * Returns 1 if successful, 0 if there are no rows or -1 on error
+ */
+int libmsiecf_url_columns_get_secondary_times(
+     libmsiecf_url_columns_t *url_columns,
+     const uint64_t **secondary_times,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_url_columns_t *internal_url_columns = NULL;
+	static char *function                                  = "libmsiecf_url_columns_get_secondary_times";
+
+	if( url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	internal_url_columns = (libmsiecf_internal_url_columns_t *) url_columns;
+
+	if( secondary_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid secondary times.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_url_columns->number_of_rows == 0 )
+	{
+		return( 0 );
+	}
+	*secondary_times = internal_url_columns->secondary_times;
+
+	return( 1 );
+}
+
+/* Retrieves the expiration date and time column
+ * Contains FILETIME values in format version 4.7 and FAT date time values in format version 5.2
+ * The column contains a value for every row and remains valid until the URL columns are read again or freed
+ * Returns 1 if successful, 0 if there are no rows or -1 on error
+ */
+int libmsiecf_url_columns_get_expiration_times(
+     libmsiecf_url_columns_t *url_columns,
+     const uint64_t **expiration_times,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_url_columns_t *internal_url_columns = NULL;
+	static char *function                                  = "libmsiecf_url_columns_get_expiration_times";
+
+	if( url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	internal_url_columns = (libmsiecf_internal_url_columns_t *) url_columns;
+
+	if( expiration_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid expiration times.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_url_columns->number_of_rows == 0 )
+	{
+		return( 0 );
+	}
+	*expiration_times = internal_url_columns->expiration_times;
+
+	return( 1 );
+}
+
+/* Retrieves the last checked date and time column
+ * Contains FAT date time values
+ * The column contains a value for every row and remains valid until the URL columns are read again or freed
+ * Returns 1 if successful, 0 if there are no rows or -1 on error
+ */
+int libmsiecf_url_columns_get_last_checked_times(
+     libmsiecf_url_columns_t *url_columns,
+     const uint32_t **last_checked_times,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_url_columns_t *internal_url_columns = NULL;
+	static char *function                                  = "libmsiecf_url_columns_get_last_checked_times";
+
+	if( url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	internal_url_columns = (libmsiecf_internal_url_columns_t *) url_columns;
+
+	if( last_checked_times == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last checked times.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_url_columns->number_of_rows == 0 )
+	{
+		return( 0 );
+	}
+	*last_checked_times = internal_url_columns->last_checked_times;
+
+	return( 1 );
+}
+
+/* Retrieves the cached file size column
+ * The column contains a value for every row and remains valid until the URL columns are read again or freed
+ * Returns 1 if successful, 0 if there are no rows or -1 on error
+ */
+int libmsiecf_url_columns_get_cached_file_sizes(
+     libmsiecf_url_columns_t *url_columns,
+     const uint32_t **cached_file_sizes,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_url_columns_t *internal_url_columns = NULL;
+	static char *function                                  = "libmsiecf_url_columns_get_cached_file_sizes";
+
+	if( url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	internal_url_columns = (libmsiecf_internal_url_columns_t *) url_columns;
+
+	if( cached_file_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached file sizes.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_url_columns->number_of_rows == 0 )
+	{
+		return( 0 );
+	}
+	*cached_file_sizes = internal_url_columns->cached_file_sizes;
+
+	return( 1 );
+}
+
+/* Retrieves the number of hits column
+ * The column contains a value for every row and remains valid until the URL columns are read again or freed
+ * Returns 1 if successful, 0 if there are no rows or -1 on error
+ */
+int libmsiecf_url_columns_get_numbers_of_hits(
+     libmsiecf_url_columns_t *url_columns,
+     const uint32_t **numbers_of_hits,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_url_columns_t *internal_url_columns = NULL;
+	static char *function                                  = "libmsiecf_url_columns_get_numbers_of_hits";
+
+	if( url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	internal_url_columns = (libmsiecf_internal_url_columns_t *) url_columns;
+
+	if( numbers_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid numbers of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_url_columns->number_of_rows == 0 )
+	{
+		return( 0 );
+	}
+	*numbers_of_hits = internal_url_columns->numbers_of_hits;
+
+	return( 1 );
+}
+
+/* Retrieves the cache directory index column
+ * The column contains a value for every row and remains valid until the URL columns are read again or freed
+ * Returns 1 if successful, 0 if there are no rows or -1 on error
+ */
+int libmsiecf_url_columns_get_cache_directory_indexes(
+     libmsiecf_url_columns_t *url_columns,
+     const uint8_t **cache_directory_indexes,
+     libcerror_error_t **error )
+{
+	libmsiecf_internal_url_columns_t *internal_url_columns = NULL;
+	static char *function                                  = "libmsiecf_url_columns_get_cache_directory_indexes";
+
+	if( url_columns == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL columns.",
+		 function );
+
+		return( -1 );
+	}
+	internal_url_columns = (libmsiecf_internal_url_columns_t *) url_columns;
+
+	if( cache_directory_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache directory indexes.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_url_columns->number_of_rows == 0 )
+	{
+		return( 0 );
+	}
+	*cache_directory_indexes = internal_url_columns->cache_directory_indexes;
+
+	return( 1 );
+}
+
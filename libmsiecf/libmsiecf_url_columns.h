@@ -0,0 +1,202 @@
+/*
+ * URL columns functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBMSIECF_URL_COLUMNS_H )
+#define _LIBMSIECF_URL_COLUMNS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libmsiecf_extern.h"
+#include "libmsiecf_io_handle.h"
+#include "libmsiecf_item_descriptor.h"
+#include "libmsiecf_libbfio.h"
+#include "libmsiecf_libcerror.h"
+#include "libmsiecf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libmsiecf_internal_url_columns libmsiecf_internal_url_columns_t;
+
+struct libmsiecf_internal_url_columns
+{
+	/* The number of rows
+	 */
+	int number_of_rows;
+
+	/* The number of allocated rows
+	 */
+	int number_of_allocated_rows;
+
+	/* The item indexes column
+	 */
+	int *item_indexes;
+
+	/* The item flags column
+	 */
+	uint8_t *item_flags;
+
+	/* The primary date and time column
+	 */
+	uint64_t *primary_times;
+
+	/* The secondary date and time column
+	 */
+	uint64_t *secondary_times;
+
+	/* The expiration date and time column
+	 */
+	uint64_t *expiration_times;
+
+	/* The last checked date and time column
+	 */
+	uint32_t *last_checked_times;
+
+	/* The cached file size column
+	 */
+	uint32_t *cached_file_sizes;
+
+	/* The number of hits column
+	 */
+	uint32_t *numbers_of_hits;
+
+	/* The cache directory index column
+	 */
+	uint8_t *cache_directory_indexes;
+
+	/* The record header size
+	 */
+	size_t record_header_size;
+
+	/* The record header data, which contains the record header of every row
+	 */
+	uint8_t *record_header_data;
+
+	/* The record header data size
+	 */
+	size_t record_header_data_size;
+};
+
+LIBMSIECF_EXTERN \
+int libmsiecf_url_columns_initialize(
+     libmsiecf_url_columns_t **url_columns,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_url_columns_free(
+     libmsiecf_url_columns_t **url_columns,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_url_columns_resize(
+     libmsiecf_internal_url_columns_t *internal_url_columns,
+     int number_of_rows,
+     size_t record_header_size,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_url_columns_read_record_header(
+     libmsiecf_internal_url_columns_t *internal_url_columns,
+     libmsiecf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libmsiecf_item_descriptor_t *item_descriptor,
+     int item_index,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_url_columns_decode_record_headers_v47(
+     libmsiecf_internal_url_columns_t *internal_url_columns,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_url_columns_decode_record_headers_v52(
+     libmsiecf_internal_url_columns_t *internal_url_columns,
+     libcerror_error_t **error );
+
+int libmsiecf_internal_url_columns_decode_record_headers(
+     libmsiecf_internal_url_columns_t *internal_url_columns,
+     libmsiecf_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_url_columns_get_number_of_rows(
+     libmsiecf_url_columns_t *url_columns,
+     int *number_of_rows,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_url_columns_get_item_indexes(
+     libmsiecf_url_columns_t *url_columns,
+     const int **item_indexes,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_url_columns_get_item_flags(
+     libmsiecf_url_columns_t *url_columns,
+     const uint8_t **item_flags,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_url_columns_get_primary_times(
+     libmsiecf_url_columns_t *url_columns,
+     const uint64_t **primary_times,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_url_columns_get_secondary_times(
+     libmsiecf_url_columns_t *url_columns,
+     const uint64_t **secondary_times,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_url_columns_get_expiration_times(
+     libmsiecf_url_columns_t *url_columns,
+     const uint64_t **expiration_times,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_url_columns_get_last_checked_times(
+     libmsiecf_url_columns_t *url_columns,
+     const uint32_t **last_checked_times,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_url_columns_get_cached_file_sizes(
+     libmsiecf_url_columns_t *url_columns,
+     const uint32_t **cached_file_sizes,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_url_columns_get_numbers_of_hits(
+     libmsiecf_url_columns_t *url_columns,
+     const uint32_t **numbers_of_hits,
+     libcerror_error_t **error );
+
+LIBMSIECF_EXTERN \
+int libmsiecf_url_columns_get_cache_directory_indexes(
+     libmsiecf_url_columns_t *url_columns,
+     const uint8_t **cache_directory_indexes,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBMSIECF_URL_COLUMNS_H ) */
+
@@ -25,6 +25,7 @@
 #include <system_string.h>
 #include <types.h>
 
+#include "libmsiecf_atomic.h"
 #include "libmsiecf_debug.h"
 #include "libmsiecf_definitions.h"
 #include "libmsiecf_hash.h"
@@ -36,10 +37,158 @@
 #include "libmsiecf_libfole.h"
 #include "libmsiecf_libfvalue.h"
 #include "libmsiecf_property_type.h"
+#include "libmsiecf_record_decoders.h"
+#include "libmsiecf_string.h"
 #include "libmsiecf_url_values.h"
 
 #include "msiecf_url_record.h"
 
+/* Creates URL strings
+ * Make sure the value url_strings is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_strings_initialize(
+     libmsiecf_url_strings_t **url_strings,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_strings_initialize";
+
+	if( url_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( *url_strings != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid URL strings value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*url_strings = memory_allocate_structure(
+	                libmsiecf_url_strings_t );
+
+	if( *url_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create URL strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *url_strings,
+	     0,
+	     sizeof( libmsiecf_url_strings_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear URL strings.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *url_strings != NULL )
+	{
+		memory_free(
+		 *url_strings );
+
+		*url_strings = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees URL strings
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_strings_free(
+     libmsiecf_url_strings_t **url_strings,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_strings_free";
+	int result            = 1;
+
+	if( url_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( *url_strings != NULL )
+	{
+		if( ( *url_strings )->location != NULL )
+		{
+			if( libfvalue_value_free(
+			     &( ( *url_strings )->location ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free location value.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *url_strings )->filename != NULL )
+		{
+			if( libfvalue_value_free(
+			     &( ( *url_strings )->filename ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free filename value.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *url_strings )->utf8_location != NULL )
+		{
+			memory_free(
+			 ( *url_strings )->utf8_location );
+		}
+		if( ( *url_strings )->utf8_filename != NULL )
+		{
+			memory_free(
+			 ( *url_strings )->utf8_filename );
+		}
+		memory_free(
+		 *url_strings );
+
+		*url_strings = NULL;
+	}
+	return( result );
+}
+
 /* Creates URL values
  * Make sure the value url_values is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -100,6 +249,8 @@ int libmsiecf_url_values_initialize(
 
 		goto on_error;
 	}
+	( *url_values )->reference_count = 1;
+
 	return( 1 );
 
 on_error:
@@ -136,49 +287,510 @@ int libmsiecf_url_values_free(
 	}
 	if( *url_values != NULL )
 	{
-		if( ( *url_values )->location != NULL )
+		/* The values are shared by the item cache and the items
+		 * hence they are only freed when the last reference is released
+		 */
+		if( LIBMSIECF_ATOMIC_DECREMENT(
+		     &( ( *url_values )->reference_count ) ) > 0 )
 		{
-			if( libfvalue_value_free(
-			     &( ( *url_values )->location ),
+			*url_values = NULL;
+
+			return( 1 );
+		}
+		if( ( *url_values )->strings != NULL )
+		{
+			if( libmsiecf_url_strings_free(
+			     &( ( *url_values )->strings ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free location value.",
+				 "%s: unable to free strings.",
 				 function );
 
 				result = -1;
 			}
 		}
-		if( ( *url_values )->filename != NULL )
+		if( ( *url_values )->record_data != NULL )
 		{
-			if( libfvalue_value_free(
-			     &( ( *url_values )->filename ),
+			memory_free(
+			 ( *url_values )->record_data );
+		}
+		memory_free(
+		 *url_values );
+
+		*url_values = NULL;
+	}
+	return( result );
+}
+
+/* References URL values
+ * The URL values are freed when the last reference is released by libmsiecf_url_values_free
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_values_reference(
+     libmsiecf_url_values_t *url_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_values_reference";
+
+	if( url_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL values.",
+		 function );
+
+		return( -1 );
+	}
+	LIBMSIECF_ATOMIC_INCREMENT(
+	 &( url_values->reference_count ) );
+
+	return( 1 );
+}
+
+/* Reads the location and filename strings from the URL record data
+ * The strings are only read when first accessed, since most consumers
+ * only need a subset of the URL values
+ *
+ * The strings are read into separate URL strings that are published using
+ * an atomic compare and swap, hence a concurrent reader either sees no strings
+ * or the complete strings. If multiple threads read the strings at the same time
+ * the strings of the first thread are used and the others are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libmsiecf_url_values_read_strings(
+     libmsiecf_url_values_t *url_values,
+     libmsiecf_url_strings_t **url_strings,
+     libcerror_error_t **error )
+{
+	libmsiecf_url_strings_t *read_url_strings = NULL;
+	const uint8_t *data                       = NULL;
+	static char *function                     = "libmsiecf_url_values_read_strings";
+	size_t data_size                          = 0;
+	ssize_t value_size                        = 0;
+	uint32_t filename_offset                  = 0;
+	uint32_t location_offset                  = 0;
+	uint8_t item_flags                        = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t value_32bit                      = 0;
+#endif
+
+	if( url_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL values.",
+		 function );
+
+		return( -1 );
+	}
+	if( url_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL strings.",
+		 function );
+
+		return( -1 );
+	}
+	/* The load pairs with the compare and swap below, hence the strings
+	 * are completely visible once the pointer is
+	 */
+	*url_strings = (libmsiecf_url_strings_t *) LIBMSIECF_ATOMIC_LOAD_POINTER(
+	                                            &( url_values->strings ) );
+
+	if( *url_strings != NULL )
+	{
+		return( 1 );
+	}
+	data            = url_values->record_data;
+	data_size       = url_values->record_data_size;
+	location_offset = url_values->location_offset;
+	filename_offset = url_values->filename_offset;
+	item_flags      = url_values->item_flags;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid URL values - missing record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_url_strings_initialize(
+	     &read_url_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create URL strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( location_offset > 0 )
+	 && ( location_offset <= data_size ) )
+	{
+		if( libfvalue_value_type_initialize(
+		     &( read_url_strings->location ),
+		     LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create location value.",
+			 function );
+
+			goto on_error;
+		}
+		value_size = libfvalue_value_type_set_data_string(
+		              read_url_strings->location,
+		              &( data[ location_offset ] ),
+		              data_size - location_offset,
+		              url_values->ascii_codepage,
+		              LIBFVALUE_VALUE_DATA_FLAG_NON_MANAGED,
+		              error );
+
+		if( value_size == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data of location value.",
+			 function );
+
+			goto on_error;
+		}
+		read_url_strings->location_data      = &( data[ location_offset ] );
+		read_url_strings->location_data_size = (size_t) value_size;
+
+		/* The UTF-8 location is converted once, since it is immutable and
+		 * retrieving it otherwise requires a codepage conversion for both
+		 * the size and the string
+		 */
+		if( libmsiecf_string_get_utf8_string_from_byte_stream(
+		     &( data[ location_offset ] ),
+		     (size_t) value_size,
+		     url_values->ascii_codepage,
+		     &( read_url_strings->utf8_location ),
+		     &( read_url_strings->utf8_location_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to create UTF-8 location.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: location\t\t\t\t: ",
+			 function );
+
+			if( libfvalue_value_print(
+			     read_url_strings->location,
+			     0,
+			     0,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free filename value.",
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print location value.",
 				 function );
 
-				result = -1;
+				goto on_error;
+			}
+			libcnotify_printf(
+			 "\n" );
+
+			if( libmsiecf_hash_calculate(
+			     &value_32bit,
+			     &( data[ location_offset ] ),
+			     data_size - location_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to calculate location hash.",
+				 function );
+
+				goto on_error;
 			}
+			libcnotify_printf(
+			 "%s: hash value\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 value_32bit );
 		}
-		if( ( *url_values )->data != NULL )
+#endif
+		if( ( data[ location_offset + value_size - 1 ] != 0 )
+		 && ( ( item_flags & LIBMSIECF_ITEM_FLAG_PARTIAL ) == 0 ) )
 		{
-			memory_free(
-			 ( *url_values )->data );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported unterminated location string.",
+			 function );
+
+			goto on_error;
 		}
-		memory_free(
-		 *url_values );
+	}
+	if( ( filename_offset > 0 )
+	 && ( filename_offset <= data_size ) )
+	{
+		if( libfvalue_value_type_initialize(
+		     &( read_url_strings->filename ),
+		     LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create filename value.",
+			 function );
 
-		*url_values = NULL;
+			goto on_error;
+		}
+		value_size = libfvalue_value_type_set_data_string(
+		              read_url_strings->filename,
+		              &( data[ filename_offset ] ),
+		              data_size - filename_offset,
+		              url_values->ascii_codepage,
+		              LIBFVALUE_VALUE_DATA_FLAG_NON_MANAGED,
+		              error );
+
+		if( value_size == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set data of filename value.",
+			 function );
+
+			goto on_error;
+		}
+		read_url_strings->filename_data      = &( data[ filename_offset ] );
+		read_url_strings->filename_data_size = (size_t) value_size;
+
+		/* The UTF-8 filename is converted once, since it is immutable and
+		 * retrieving it otherwise requires a codepage conversion for both
+		 * the size and the string
+		 */
+		if( libmsiecf_string_get_utf8_string_from_byte_stream(
+		     &( data[ filename_offset ] ),
+		     (size_t) value_size,
+		     url_values->ascii_codepage,
+		     &( read_url_strings->utf8_filename ),
+		     &( read_url_strings->utf8_filename_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to create UTF-8 filename.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: filename\t\t\t\t: ",
+			 function );
+
+			if( libfvalue_value_print(
+			     read_url_strings->filename,
+			     0,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print filename value.",
+				 function );
+
+				goto on_error;
+			}
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		if( ( data[ filename_offset + value_size - 1 ] != 0 )
+		 && ( ( item_flags & LIBMSIECF_ITEM_FLAG_PARTIAL ) == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported unterminated filename string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( LIBMSIECF_ATOMIC_COMPARE_AND_SWAP_POINTER(
+	     &( url_values->strings ),
+	     NULL,
+	     read_url_strings ) == 0 )
+	{
+		/* Another thread published its strings first
+		 */
+		if( libmsiecf_url_strings_free(
+		     &read_url_strings,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free URL strings.",
+			 function );
+
+			goto on_error;
+		}
+		read_url_strings = (libmsiecf_url_strings_t *) LIBMSIECF_ATOMIC_LOAD_POINTER(
+		                                                &( url_values->strings ) );
+	}
+	*url_strings = read_url_strings;
+
+	return( 1 );
+
+on_error:
+	/* The URL strings are not published on error, hence they are not referenced
+	 * by other threads
+	 */
+	if( read_url_strings != NULL )
+	{
+		libmsiecf_url_strings_free(
+		 &read_url_strings,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a string stored in the URL record data
+ * The string is not decoded and includes the end of string character if present
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libmsiecf_url_values_get_record_string(
+     libmsiecf_url_values_t *url_values,
+     uint32_t string_offset,
+     const uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libmsiecf_url_values_get_record_string";
+	size_t data_offset    = 0;
+
+	if( url_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid URL values.",
+		 function );
+
+		return( -1 );
+	}
+	if( url_values->record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid URL values - missing record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( string_offset == 0 )
+	 || ( (size_t) string_offset >= url_values->record_data_size ) )
+	{
+		return( 0 );
+	}
+	for( data_offset = (size_t) string_offset;
+	     data_offset < url_values->record_data_size;
+	     data_offset++ )
+	{
+		if( url_values->record_data[ data_offset ] == 0 )
+		{
+			data_offset++;
+
+			break;
+		}
+	}
+	if( ( url_values->record_data[ data_offset - 1 ] != 0 )
+	 && ( ( url_values->item_flags & LIBMSIECF_ITEM_FLAG_PARTIAL ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported unterminated string.",
+		 function );
+
+		return( -1 );
 	}
-	return( result );
+	*string      = &( url_values->record_data[ string_offset ] );
+	*string_size = data_offset - (size_t) string_offset;
+
+	return( 1 );
 }
 
 /* Reads the URL values from an URL record
@@ -192,6 +804,9 @@ int libmsiecf_url_values_read_data(
      uint8_t item_flags,
      libcerror_error_t **error )
 {
+	libmsiecf_url_record_header_v47_values_t record_header_v47_values;
+	libmsiecf_url_record_header_v52_values_t record_header_v52_values;
+
 	static char *function             = "libmsiecf_url_values_read_data";
 	size_t required_data_size         = 0;
 	ssize_t value_size                = 0;
@@ -295,6 +910,67 @@ int libmsiecf_url_values_read_data(
 
 		return( -1 );
 	}
+	/* The record data is copied once and the values reference it
+	 * unless the data already is the record data of the URL values
+	 */
+	if( data != url_values->record_data )
+	{
+		if( url_values->record_data != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid URL values - record data value already set.",
+			 function );
+
+			return( -1 );
+		}
+		if( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid data size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		url_values->record_data = (uint8_t *) memory_allocate(
+		                                       sizeof( uint8_t ) * data_size );
+
+		if( url_values->record_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record data.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     url_values->record_data,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy record data.",
+			 function );
+
+			return( -1 );
+		}
+		url_values->record_data_size = data_size;
+
+		data = url_values->record_data;
+	}
+	url_values->ascii_codepage = io_handle->ascii_codepage;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -324,108 +1000,68 @@ int libmsiecf_url_values_read_data(
 	if( ( io_handle->major_version == 4 )
 	 && ( io_handle->minor_version == 7 ) )
 	{
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (msiecf_url_record_header_v47_t *) data )->secondary_filetime,
-		 url_values->secondary_time );
-
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (msiecf_url_record_header_v47_t *) data )->primary_filetime,
-		 url_values->primary_time );
-
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (msiecf_url_record_header_v47_t *) data )->expiration_time,
-		 url_values->expiration_time );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v47_t *) data )->cached_file_size,
-		 url_values->cached_file_size );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v47_t *) data )->unknown_offset,
-		 unknown_offset );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v47_t *) data )->location_offset,
-		 location_offset );
-
-		url_values->cache_directory_index = ( (msiecf_url_record_header_v47_t *) data )->cache_directory_index;
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v47_t *) data )->filename_offset,
-		 filename_offset );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v47_t *) data )->data_offset,
-		 url_data_offset );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v47_t *) data )->data_size,
-		 url_data_size );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v47_t *) data )->last_checked_time,
-		 url_values->last_checked_time );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v47_t *) data )->number_of_hits,
-		 url_values->number_of_hits );
+		if( libmsiecf_url_record_header_v47_values_decode(
+		     &record_header_v47_values,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to decode URL record header version 4.7 values.",
+			 function );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v47_t *) data )->cache_entry_flags,
-		 cache_entry_flags );
+			goto on_error;
+		}
+		url_values->secondary_time        = record_header_v47_values.secondary_time;
+		url_values->primary_time          = record_header_v47_values.primary_time;
+		url_values->expiration_time       = record_header_v47_values.expiration_time;
+		url_values->cached_file_size      = record_header_v47_values.cached_file_size;
+		url_values->cache_directory_index = record_header_v47_values.cache_directory_index;
+		url_values->last_checked_time     = record_header_v47_values.last_checked_time;
+		url_values->number_of_hits        = record_header_v47_values.number_of_hits;
+
+		unknown_offset    = record_header_v47_values.unknown_offset;
+		location_offset   = record_header_v47_values.location_offset;
+		filename_offset   = record_header_v47_values.filename_offset;
+		url_data_offset   = record_header_v47_values.data_offset;
+		url_data_size     = record_header_v47_values.data_size;
+		cache_entry_flags = record_header_v47_values.cache_entry_flags;
 	}
 	else if( ( io_handle->major_version == 5 )
 	      && ( io_handle->minor_version == 2 ) )
 	{
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (msiecf_url_record_header_v52_t *) data )->secondary_filetime,
-		 url_values->secondary_time );
-
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (msiecf_url_record_header_v52_t *) data )->primary_filetime,
-		 url_values->primary_time );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v52_t *) data )->expiration_time,
-		 url_values->expiration_time );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v52_t *) data )->cached_file_size,
-		 url_values->cached_file_size );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v52_t *) data )->unknown_offset,
-		 unknown_offset );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v52_t *) data )->location_offset,
-		 location_offset );
-
-		url_values->cache_directory_index = ( (msiecf_url_record_header_v52_t *) data )->cache_directory_index;
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v52_t *) data )->filename_offset,
-		 filename_offset );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v52_t *) data )->data_offset,
-		 url_data_offset );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v52_t *) data )->data_size,
-		 url_data_size );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v52_t *) data )->last_checked_time,
-		 url_values->last_checked_time );
-
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v52_t *) data )->number_of_hits,
-		 url_values->number_of_hits );
+		if( libmsiecf_url_record_header_v52_values_decode(
+		     &record_header_v52_values,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to decode URL record header version 5.2 values.",
+			 function );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (msiecf_url_record_header_v52_t *) data )->cache_entry_flags,
-		 cache_entry_flags );
+			goto on_error;
+		}
+		url_values->secondary_time        = record_header_v52_values.secondary_time;
+		url_values->primary_time          = record_header_v52_values.primary_time;
+		url_values->expiration_time       = record_header_v52_values.expiration_time;
+		url_values->cached_file_size      = record_header_v52_values.cached_file_size;
+		url_values->cache_directory_index = record_header_v52_values.cache_directory_index;
+		url_values->last_checked_time     = record_header_v52_values.last_checked_time;
+		url_values->number_of_hits        = record_header_v52_values.number_of_hits;
+
+		unknown_offset    = record_header_v52_values.unknown_offset;
+		location_offset   = record_header_v52_values.location_offset;
+		filename_offset   = record_header_v52_values.filename_offset;
+		url_data_offset   = record_header_v52_values.data_offset;
+		url_data_size     = record_header_v52_values.data_size;
+		cache_entry_flags = record_header_v52_values.cache_entry_flags;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -821,9 +1457,6 @@ int libmsiecf_url_values_read_data(
 			}
 			else
 			{
-				memory_free(
-				 data );
-
 				return( 1 );
 			}
 		}
@@ -858,97 +1491,12 @@ int libmsiecf_url_values_read_data(
 		}
 		else
 		{
-			if( libfvalue_value_type_initialize(
-			     &( url_values->location ),
-			     LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create location value.",
-				 function );
-
-				goto on_error;
-			}
-			value_size = libfvalue_value_type_set_data_string(
-			              url_values->location,
-			              &( data[ location_offset ] ),
-			              data_size - location_offset,
-			              io_handle->ascii_codepage,
-			              LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-			              error );
-
-			if( value_size == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set data of location value.",
-				 function );
-
-				goto on_error;
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: location\t\t\t\t: ",
-				 function );
-
-				if( libfvalue_value_print(
-				     url_values->location,
-				     0,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-					 "%s: unable to print location value.",
-					 function );
-
-					goto on_error;
-				}
-				libcnotify_printf(
-				 "\n" );
-
-				if( libmsiecf_hash_calculate(
-				     &value_32bit,
-				     &( data[ location_offset ] ),
-				     data_size - location_offset,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-					 "%s: unable to calculate location hash.",
-					 function );
-
-					goto on_error;
-				}
-				libcnotify_printf(
-				 "%s: hash value\t\t\t\t: 0x%08" PRIx32 "\n",
-				 function,
-				 value_32bit );
-			}
-#endif
-			if( ( data[ location_offset + value_size - 1 ] != 0 )
-			 && ( ( item_flags & LIBMSIECF_ITEM_FLAG_PARTIAL ) == 0 ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported unterminated location string.",
-				 function );
+			/* The location string is read on demand, the type is determined
+			 * from the remaining record data instead, where the end-of-string
+			 * character ends any comparison
+			 */
+			value_size = (ssize_t) ( data_size - location_offset );
 
-				goto on_error;
-			}
 			if( url_values->type == LIBMSIECF_URL_ITEM_TYPE_UNDEFINED )
 			{
 				if( value_size >= 18 )
@@ -1188,97 +1736,22 @@ int libmsiecf_url_values_read_data(
 			}
 		}
 	}
-	if( filename_offset > 0 )
+	if( ( filename_offset > data_size )
+	 && ( ( item_flags & LIBMSIECF_ITEM_FLAG_PARTIAL ) == 0 ) )
 	{
-		if( filename_offset > data_size )
-		{
-			if( ( item_flags & LIBMSIECF_ITEM_FLAG_PARTIAL ) == 0 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: filename offset exceeds size of URL record data.",
-				 function );
-
-				goto on_error;
-			}
-		}
-		else
-		{
-			if( libfvalue_value_type_initialize(
-			     &( url_values->filename ),
-			     LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create filename value.",
-				 function );
-
-				goto on_error;
-			}
-			value_size = libfvalue_value_type_set_data_string(
-			              url_values->filename,
-			              &( data[ filename_offset ] ),
-			              data_size - filename_offset,
-			              io_handle->ascii_codepage,
-			              LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-			              error );
-
-			if( value_size == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set data of filename value.",
-				 function );
-
-				goto on_error;
-			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: filename\t\t\t\t: ",
-				 function );
-
-				if( libfvalue_value_print(
-				     url_values->filename,
-				     0,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-					 "%s: unable to print filename value.",
-					 function );
-
-					goto on_error;
-				}
-				libcnotify_printf(
-				 "\n" );
-			}
-#endif
-			if( ( data[ filename_offset + value_size - 1 ] != 0 )
-			 && ( ( item_flags & LIBMSIECF_ITEM_FLAG_PARTIAL ) == 0 ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported unterminated filename string.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: filename offset exceeds size of URL record data.",
+		 function );
 
-				goto on_error;
-			}
-		}
+		goto on_error;
 	}
+	url_values->location_offset = location_offset;
+	url_values->filename_offset = filename_offset;
+	url_values->item_flags      = item_flags;
+
 	if( url_data_offset > 0 )
 	{
 		if( url_data_offset > data_size )
@@ -1327,36 +1800,8 @@ int libmsiecf_url_values_read_data(
 
 				goto on_error;
 			}
-			url_values->data = (uint8_t *) memory_allocate(
-			                                sizeof( uint8_t ) * url_data_size );
-
-			if( url_values->data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create data.",
-				 function );
-
-				goto on_error;
-			}
+			url_values->data      = &( data[ url_data_offset ] );
 			url_values->data_size = (size_t) url_data_size;
-
-			if( memory_copy(
-			     url_values->data,
-			     &( data[ url_data_offset ] ),
-			     url_values->data_size ) == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to copy data.",
-				 function );
-
-				goto on_error;
-			}
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
 			{
@@ -1514,7 +1959,6 @@ int libmsiecf_url_values_read_file_io_handle(
      uint8_t item_flags,
      libcerror_error_t **error )
 {
-	uint8_t *record_data  = NULL;
 	static char *function = "libmsiecf_url_values_read_file_io_handle";
 	ssize_t read_count    = 0;
 
@@ -1529,6 +1973,17 @@ int libmsiecf_url_values_read_file_io_handle(
 
 		return( -1 );
 	}
+	if( url_values->record_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid URL values - record data value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( record_size > (size32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 	{
 		libcerror_error_set(
@@ -1558,10 +2013,12 @@ int libmsiecf_url_values_read_file_io_handle(
 	{
 		record_size += LIBMSIECF_DEFAULT_BLOCK_SIZE;
 	}
-	record_data = (uint8_t *) memory_allocate(
-	                           record_size );
+	/* The record data is read into the buffer owned by the URL values
+	 */
+	url_values->record_data = (uint8_t *) memory_allocate(
+	                                       sizeof( uint8_t ) * record_size );
 
-	if( record_data == NULL )
+	if( url_values->record_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1572,6 +2029,8 @@ int libmsiecf_url_values_read_file_io_handle(
 
 		goto on_error;
 	}
+	url_values->record_data_size = (size_t) record_size;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1582,9 +2041,10 @@ int libmsiecf_url_values_read_file_io_handle(
 		 url_record_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
+	read_count = libmsiecf_io_handle_read_buffer_at_offset(
+	              io_handle,
 	              file_io_handle,
-	              record_data,
+	              url_values->record_data,
 	              record_size,
 	              url_record_offset,
 	              error );
@@ -1605,7 +2065,7 @@ int libmsiecf_url_values_read_file_io_handle(
 	if( libmsiecf_url_values_read_data(
 	     url_values,
 	     io_handle,
-	     record_data,
+	     url_values->record_data,
 	     (size_t) record_size,
 	     item_flags,
 	     error ) != 1 )
@@ -1619,19 +2079,12 @@ int libmsiecf_url_values_read_file_io_handle(
 
 		goto on_error;
 	}
-	memory_free(
-	 record_data );
-
-	record_data = NULL;
-
 	return( 1 );
 
 on_error:
-	if( record_data != NULL )
-	{
-		memory_free(
-		 record_data );
-	}
+	/* The record data can be referenced by the values read so far
+	 * and is freed together with the URL values
+	 */
 	return( -1 );
 }
 
@@ -34,6 +34,51 @@
 extern "C" {
 #endif
 
+typedef struct libmsiecf_url_strings libmsiecf_url_strings_t;
+
+struct libmsiecf_url_strings
+{
+	/* The location string value, which references the record data
+	 */
+	libfvalue_value_t *location;
+
+	/* The location data, which references the record data
+	 */
+	const uint8_t *location_data;
+
+	/* The location data size
+	 */
+	size_t location_data_size;
+
+	/* The UTF-8 encoded location
+	 */
+	uint8_t *utf8_location;
+
+	/* The UTF-8 encoded location size
+	 */
+	size_t utf8_location_size;
+
+	/* The filename string value, which references the record data
+	 */
+	libfvalue_value_t *filename;
+
+	/* The filename data, which references the record data
+	 */
+	const uint8_t *filename_data;
+
+	/* The filename data size
+	 */
+	size_t filename_data_size;
+
+	/* The UTF-8 encoded filename
+	 */
+	uint8_t *utf8_filename;
+
+	/* The UTF-8 encoded filename size
+	 */
+	size_t utf8_filename_size;
+};
+
 typedef struct libmsiecf_url_values libmsiecf_url_values_t;
 
 struct libmsiecf_url_values
@@ -75,23 +120,58 @@ struct libmsiecf_url_values
 	 */
 	uint8_t cache_directory_index;
 
-	/* The location string value
+	/* The data, which references the record data
 	 */
-	libfvalue_value_t *location;
+	const uint8_t *data;
 
-	/* The filename string value
+	/* The data size
 	 */
-	libfvalue_value_t *filename;
+	size_t data_size;
 
-	/* The data
+	/* The location offset
 	 */
-	uint8_t *data;
+	uint32_t location_offset;
 
-	/* The data size
+	/* The filename offset
 	 */
-	size_t data_size;
+	uint32_t filename_offset;
+
+	/* The item flags
+	 */
+	uint8_t item_flags;
+
+	/* The codepage of the ASCII strings
+	 */
+	int ascii_codepage;
+
+	/* The record data
+	 * the values above reference this buffer instead of copies of the data
+	 */
+	uint8_t *record_data;
+
+	/* The record data size
+	 */
+	size_t record_data_size;
+
+	/* The location and filename strings, which are read on first access
+	 * they are published once using an atomic compare and swap and are
+	 * not changed afterwards, hence they are read without locking
+	 */
+	libmsiecf_url_strings_t *strings;
+
+	/* The reference count
+	 */
+	int32_t reference_count;
 };
 
+int libmsiecf_url_strings_initialize(
+     libmsiecf_url_strings_t **url_strings,
+     libcerror_error_t **error );
+
+int libmsiecf_url_strings_free(
+     libmsiecf_url_strings_t **url_strings,
+     libcerror_error_t **error );
+
 int libmsiecf_url_values_initialize(
      libmsiecf_url_values_t **url_values,
      libcerror_error_t **error );
@@ -100,6 +180,22 @@ int libmsiecf_url_values_free(
      libmsiecf_url_values_t **url_values,
      libcerror_error_t **error );
 
+int libmsiecf_url_values_reference(
+     libmsiecf_url_values_t *url_values,
+     libcerror_error_t **error );
+
+int libmsiecf_url_values_read_strings(
+     libmsiecf_url_values_t *url_values,
+     libmsiecf_url_strings_t **url_strings,
+     libcerror_error_t **error );
+
+int libmsiecf_url_values_get_record_string(
+     libmsiecf_url_values_t *url_values,
+     uint32_t string_offset,
+     const uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error );
+
 int libmsiecf_url_values_read_data(
      libmsiecf_url_values_t *url_values,
      libmsiecf_io_handle_t *io_handle,
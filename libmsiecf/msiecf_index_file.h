@@ -0,0 +1,170 @@
+/*
+ * The index file definition of a MSIE Cache File
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MSIECF_INDEX_FILE_H )
+#define _MSIECF_INDEX_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct msiecf_index_file_header msiecf_index_file_header_t;
+
+struct msiecf_index_file_header
+{
+	/* Signature
+	 * Consists of 8 bytes
+	 * Contains: "MSIECFIX"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* Format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* Key checksum of the index.dat file
+	 * Consists of 4 bytes
+	 * Contains an Adler-32 of the entire file
+	 */
+	uint8_t key_checksum[ 4 ];
+
+	/* File size
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* Hash table offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t hash_table_offset[ 4 ];
+
+	/* Number of blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_blocks[ 4 ];
+
+	/* Number of allocated blocks
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_allocated_blocks[ 4 ];
+
+	/* Block size
+	 * Consists of 2 bytes
+	 */
+	uint8_t block_size[ 2 ];
+
+	/* Major version
+	 * Consists of 1 byte
+	 */
+	uint8_t major_version;
+
+	/* Minor version
+	 * Consists of 1 byte
+	 */
+	uint8_t minor_version;
+
+	/* Number of items
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_items[ 4 ];
+
+	/* Number of recovered items
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_recovered_items[ 4 ];
+
+	/* Number of hash map buckets
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_hash_map_buckets[ 4 ];
+
+	/* Number of hash map entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_hash_map_entries[ 4 ];
+
+	/* Checksum of the data following the header
+	 * Consists of 4 bytes
+	 * Contains an Adler-32 of the item descriptors and hash map buckets
+	 */
+	uint8_t data_checksum[ 4 ];
+
+	/* Padding
+	 * Consists of 4 bytes
+	 */
+	uint8_t padding[ 4 ];
+};
+
+typedef struct msiecf_index_file_item_descriptor msiecf_index_file_item_descriptor_t;
+
+struct msiecf_index_file_item_descriptor
+{
+	/* File offset
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_offset[ 8 ];
+
+	/* Record size
+	 * Consists of 4 bytes
+	 */
+	uint8_t record_size[ 4 ];
+
+	/* Item type
+	 * Consists of 1 byte
+	 */
+	uint8_t type;
+
+	/* Item flags
+	 * Consists of 1 byte
+	 */
+	uint8_t flags;
+
+	/* Padding
+	 * Consists of 2 bytes
+	 */
+	uint8_t padding[ 2 ];
+};
+
+typedef struct msiecf_index_file_hash_map_bucket msiecf_index_file_hash_map_bucket_t;
+
+struct msiecf_index_file_hash_map_bucket
+{
+	/* Hash value
+	 * Consists of 4 bytes
+	 */
+	uint8_t hash_value[ 4 ];
+
+	/* Record offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t record_offset[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MSIECF_INDEX_FILE_H ) */
+
@@ -28,6 +28,7 @@
 #endif
 
 #include "pymsiecf.h"
+#include "pymsiecf_access_patterns.h"
 #include "pymsiecf_cache_directories.h"
 #include "pymsiecf_error.h"
 #include "pymsiecf_file.h"
@@ -612,6 +613,28 @@ PyMODINIT_FUNC initpymsiecf(
 #endif
 	gil_state = PyGILState_Ensure();
 
+	/* Setup the access_patterns type object
+	 */
+	pymsiecf_access_patterns_type_object.tp_new = PyType_GenericNew;
+
+	if( pymsiecf_access_patterns_init_type(
+	     &pymsiecf_access_patterns_type_object ) != 1 )
+	{
+		goto on_error;
+	}
+	if( PyType_Ready(
+	     &pymsiecf_access_patterns_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pymsiecf_access_patterns_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "access_patterns",
+	 (PyObject *) &pymsiecf_access_patterns_type_object );
+
 	/* Setup the cache directories type object
 	 */
 	pymsiecf_cache_directories_type_object.tp_new = PyType_GenericNew;
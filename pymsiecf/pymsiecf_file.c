@@ -86,6 +86,14 @@ PyMethodDef pymsiecf_file_object_methods[] = {
 	  "\n"
 	  "Closes a file." },
 
+	{ "refresh",
+	  (PyCFunction) pymsiecf_file_refresh,
+	  METH_NOARGS,
+	  "refresh() -> None\n"
+	  "\n"
+	  "Refreshes a file that is modified by another process.\n"
+	  "New items are appended hence existing item indexes remain valid." },
+
 	{ "get_size",
 	  (PyCFunction) pymsiecf_file_get_size,
 	  METH_NOARGS,
@@ -108,6 +116,45 @@ PyMethodDef pymsiecf_file_object_methods[] = {
 	  "Sets the codepage for ASCII strings used in the file.\n"
 	  "Expects the codepage to be a string containing a Python codec definition." },
 
+	{ "get_access_pattern",
+	  (PyCFunction) pymsiecf_file_get_access_pattern,
+	  METH_NOARGS,
+	  "get_access_pattern() -> Integer\n"
+	  "\n"
+	  "Retrieves the access pattern." },
+
+	{ "set_access_pattern",
+	  (PyCFunction) pymsiecf_file_set_access_pattern,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_access_pattern(access_pattern) -> None\n"
+	  "\n"
+	  "Sets the access pattern.\n"
+	  "Expects the access pattern to be one of the values defined by access_patterns." },
+
+	{ "get_maximum_block_cache_size",
+	  (PyCFunction) pymsiecf_file_get_maximum_block_cache_size,
+	  METH_NOARGS,
+	  "get_maximum_block_cache_size() -> Integer\n"
+	  "\n"
+	  "Retrieves the maximum size of the block cache." },
+
+	{ "set_maximum_block_cache_size",
+	  (PyCFunction) pymsiecf_file_set_maximum_block_cache_size,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_maximum_block_cache_size(maximum_cache_size) -> None\n"
+	  "\n"
+	  "Sets the maximum size of the block cache.\n"
+	  "The block cache reduces the number of small reads of file-like objects, a value of 0 disables it." },
+
+	{ "set_index_filename",
+	  (PyCFunction) pymsiecf_file_set_index_filename,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "set_index_filename(filename) -> None\n"
+	  "\n"
+	  "Sets the index filename.\n"
+	  "The index file stores the result of the record scan so that reopening the same file can skip it.\n"
+	  "The index filename must be set before the file is opened." },
+
 	{ "get_format_version",
 	  (PyCFunction) pymsiecf_file_get_format_version,
 	  METH_NOARGS,
@@ -143,6 +190,20 @@ PyMethodDef pymsiecf_file_object_methods[] = {
 	  "\n"
 	  "Retrieves the item specified by the index." },
 
+	{ "get_items_by_range",
+	  (PyCFunction) pymsiecf_file_get_items_by_range,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_items_by_range(first_item_index, number_of_items) -> List of objects\n"
+	  "\n"
+	  "Retrieves a range of items." },
+
+	{ "get_items_by_indexes",
+	  (PyCFunction) pymsiecf_file_get_items_by_indexes,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "get_items_by_indexes(item_indexes) -> List of objects\n"
+	  "\n"
+	  "Retrieves the items specified by a sequence of indexes." },
+
 	{ "get_number_of_recovered_items",
 	  (PyCFunction) pymsiecf_file_get_number_of_recovered_items,
 	  METH_NOARGS,
@@ -910,6 +971,55 @@ PyObject *pymsiecf_file_close(
 	return( Py_None );
 }
 
+/* Refreshes the file
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pymsiecf_file_refresh(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments PYMSIECF_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pymsiecf_file_refresh";
+	int result               = 0;
+
+	PYMSIECF_UNREFERENCED_PARAMETER( arguments )
+
+	if( pymsiecf_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libmsiecf_file_refresh(
+	          pymsiecf_file->file,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pymsiecf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to refresh file.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
 /* Retrieves the size
  * Returns a Python object if successful or NULL on error
  */
@@ -1274,20 +1384,17 @@ int pymsiecf_file_set_ascii_codepage_setter(
 	return( -1 );
 }
 
-/* Retrieves the format version
+/* Retrieves the access pattern
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pymsiecf_file_get_format_version(
+PyObject *pymsiecf_file_get_access_pattern(
            pymsiecf_file_t *pymsiecf_file,
            PyObject *arguments PYMSIECF_ATTRIBUTE_UNUSED )
 {
-	char utf8_string[ 4 ];
-
-	PyObject *string_object  = NULL;
+	PyObject *integer_object = NULL;
 	libcerror_error_t *error = NULL;
-	static char *function    = "pymsiecf_file_get_format_version";
-	uint8_t major_version    = 0;
-	uint8_t minor_version    = 0;
+	static char *function    = "pymsiecf_file_get_access_pattern";
+	int access_pattern       = 0;
 	int result               = 0;
 
 	PYMSIECF_UNREFERENCED_PARAMETER( arguments )
@@ -1303,10 +1410,9 @@ PyObject *pymsiecf_file_get_format_version(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libmsiecf_file_get_format_version(
+	result = libmsiecf_file_get_access_pattern(
 	          pymsiecf_file->file,
-	          &major_version,
-	          &minor_version,
+	          &access_pattern,
 	          &error );
 
 	Py_END_ALLOW_THREADS
@@ -1316,7 +1422,7 @@ PyObject *pymsiecf_file_get_format_version(
 		pymsiecf_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve format version.",
+		 "%s: unable to retrieve access pattern.",
 		 function );
 
 		libcerror_error_free(
@@ -1324,61 +1430,88 @@ PyObject *pymsiecf_file_get_format_version(
 
 		return( NULL );
 	}
-	if( major_version > 9 )
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) access_pattern );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) access_pattern );
+#endif
+	return( integer_object );
+}
+
+/* Sets the access pattern
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pymsiecf_file_set_access_pattern(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	libcerror_error_t *error    = NULL;
+	static char *keyword_list[] = { "access_pattern", NULL };
+	static char *function       = "pymsiecf_file_set_access_pattern";
+	int access_pattern          = 0;
+	int result                  = 0;
+
+	if( pymsiecf_file == NULL )
 	{
 		PyErr_Format(
 		 PyExc_ValueError,
-		 "%s: major version out of bounds.",
+		 "%s: invalid file.",
 		 function );
 
 		return( NULL );
 	}
-	if( minor_version > 9 )
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
+	     keyword_list,
+	     &access_pattern ) == 0 )
 	{
-		PyErr_Format(
-		 PyExc_ValueError,
-		 "%s: minor version out of bounds.",
-		 function );
-
 		return( NULL );
 	}
-	utf8_string[ 0 ] = '0' + (char) major_version;
-	utf8_string[ 1 ] = '.';
-	utf8_string[ 2 ] = '0' + (char) minor_version;
-	utf8_string[ 3 ] = 0;
+	Py_BEGIN_ALLOW_THREADS
 
-	/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
-	 * the end of string character is part of the string
-	 */
-	string_object = PyUnicode_DecodeUTF8(
-	                 utf8_string,
-	                 (Py_ssize_t) 3,
-	                 NULL );
+	result = libmsiecf_file_set_access_pattern(
+	          pymsiecf_file->file,
+	          access_pattern,
+	          &error );
 
-	if( string_object == NULL )
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
-		PyErr_Format(
+		pymsiecf_error_raise(
+		 error,
 		 PyExc_IOError,
-		 "%s: unable to convert UTF-8 string into Unicode object.",
+		 "%s: unable to set access pattern.",
 		 function );
 
+		libcerror_error_free(
+		 &error );
+
 		return( NULL );
 	}
-	return( string_object );
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
 }
 
-/* Retrieves the number of cache directories
+/* Retrieves the maximum size of the block cache
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pymsiecf_file_get_number_of_cache_directories(
+PyObject *pymsiecf_file_get_maximum_block_cache_size(
            pymsiecf_file_t *pymsiecf_file,
            PyObject *arguments PYMSIECF_ATTRIBUTE_UNUSED )
 {
-	PyObject *integer_object        = NULL;
-	libcerror_error_t *error        = NULL;
-	static char *function           = "pymsiecf_file_get_number_of_cache_directories";
-	int number_of_cache_directories = 0;
-	int result                      = 0;
+	PyObject *integer_object  = NULL;
+	libcerror_error_t *error  = NULL;
+	static char *function     = "pymsiecf_file_get_maximum_block_cache_size";
+	size_t maximum_cache_size = 0;
+	int result                = 0;
 
 	PYMSIECF_UNREFERENCED_PARAMETER( arguments )
 
@@ -1393,9 +1526,9 @@ PyObject *pymsiecf_file_get_number_of_cache_directories(
 	}
 	Py_BEGIN_ALLOW_THREADS
 
-	result = libmsiecf_file_get_number_of_cache_directories(
+	result = libmsiecf_file_get_maximum_block_cache_size(
 	          pymsiecf_file->file,
-	          &number_of_cache_directories,
+	          &maximum_cache_size,
 	          &error );
 
 	Py_END_ALLOW_THREADS
@@ -1405,7 +1538,7 @@ PyObject *pymsiecf_file_get_number_of_cache_directories(
 		pymsiecf_error_raise(
 		 error,
 		 PyExc_IOError,
-		 "%s: unable to retrieve number of cache directories.",
+		 "%s: unable to retrieve maximum block cache size.",
 		 function );
 
 		libcerror_error_free(
@@ -1413,29 +1546,26 @@ PyObject *pymsiecf_file_get_number_of_cache_directories(
 
 		return( NULL );
 	}
-#if PY_MAJOR_VERSION >= 3
-	integer_object = PyLong_FromLong(
-	                  (long) number_of_cache_directories );
-#else
-	integer_object = PyInt_FromLong(
-	                  (long) number_of_cache_directories );
-#endif
+	integer_object = pymsiecf_integer_unsigned_new_from_64bit(
+	                  (uint64_t) maximum_cache_size );
+
 	return( integer_object );
 }
 
-/* Retrieves a specific cache directory by index
+/* Sets the maximum size of the block cache
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pymsiecf_file_get_cache_directory_by_index(
-           PyObject *pymsiecf_file,
-           int cache_directory_index )
+PyObject *pymsiecf_file_set_maximum_block_cache_size(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments,
+           PyObject *keywords )
 {
-	char string[ 9 ];
-
-	PyObject *string_object  = NULL;
-	libcerror_error_t *error = NULL;
-	static char *function    = "pymsiecf_file_get_cache_directory_by_index";
-	int result               = 0;
+	PyObject *integer_object    = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *keyword_list[] = { "maximum_cache_size", NULL };
+	static char *function       = "pymsiecf_file_set_maximum_block_cache_size";
+	uint64_t maximum_cache_size = 0;
+	int result                  = 0;
 
 	if( pymsiecf_file == NULL )
 	{
@@ -1446,75 +1576,374 @@ PyObject *pymsiecf_file_get_cache_directory_by_index(
 
 		return( NULL );
 	}
-	Py_BEGIN_ALLOW_THREADS
-
-	result = libmsiecf_file_get_cache_directory_name(
-	          ( (pymsiecf_file_t *) pymsiecf_file )->file,
-	          cache_directory_index,
-	          string,
-	          9,
-	          &error );
-
-	Py_END_ALLOW_THREADS
-
-	if( result == -1 )
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &integer_object ) == 0 )
+	{
+		return( NULL );
+	}
+	if( pymsiecf_integer_unsigned_copy_to_64bit(
+	     integer_object,
+	     &maximum_cache_size,
+	     &error ) != 1 )
 	{
 		pymsiecf_error_raise(
 		 error,
-		 PyExc_IOError,
-		 "%s: unable to retrieve cache directory name: %d.",
-		 function,
-		 cache_directory_index );
+		 PyExc_ValueError,
+		 "%s: unable to convert integer object into maximum cache size.",
+		 function );
 
 		libcerror_error_free(
 		 &error );
 
 		return( NULL );
 	}
-	else if( result == 0 )
+	if( maximum_cache_size > (uint64_t) SSIZE_MAX )
 	{
-		Py_IncRef(
-		 Py_None );
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid maximum cache size value exceeds maximum.",
+		 function );
 
-		return( Py_None );
+		return( NULL );
 	}
-	/* Assumed that the directory name contains only basic ASCII characters
-	 */
-#if PY_MAJOR_VERSION >= 3
-	string_object = PyBytes_FromString(
-	                 string );
-#else
-	string_object = PyString_FromString(
-	                 string );
-#endif
-	if( string_object == NULL )
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libmsiecf_file_set_maximum_block_cache_size(
+	          pymsiecf_file->file,
+	          (size_t) maximum_cache_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
 	{
-		PyErr_Format(
-		 PyExc_MemoryError,
-		 "%s: unable to convert cache directory name string into string object.",
+		pymsiecf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set maximum block cache size.",
 		 function );
 
+		libcerror_error_free(
+		 &error );
+
 		return( NULL );
 	}
-	return( string_object );
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
 }
 
-/* Retrieves a specific cache directory
+/* Sets the index filename
  * Returns a Python object if successful or NULL on error
  */
-PyObject *pymsiecf_file_get_cache_directory(
+PyObject *pymsiecf_file_set_index_filename(
            pymsiecf_file_t *pymsiecf_file,
            PyObject *arguments,
            PyObject *keywords )
 {
-	PyObject *string_object     = NULL;
-	static char *keyword_list[] = { "cache_directory_index", NULL };
-	int cache_directory_index   = 0;
+	libcerror_error_t *error    = NULL;
+	char *filename              = NULL;
+	static char *function       = "pymsiecf_file_set_index_filename";
+	static char *keyword_list[] = { "filename", NULL };
+	size_t filename_length      = 0;
+	int result                  = 0;
 
-	if( PyArg_ParseTupleAndKeywords(
-	     arguments,
-	     keywords,
-	     "i",
+	if( pymsiecf_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "s",
+	     keyword_list,
+	     &filename ) == 0 )
+	{
+		return( NULL );
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libmsiecf_file_set_index_filename(
+	          pymsiecf_file->file,
+	          filename,
+	          filename_length,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pymsiecf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to set index filename.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 Py_None );
+
+	return( Py_None );
+}
+
+/* Retrieves the format version
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pymsiecf_file_get_format_version(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments PYMSIECF_ATTRIBUTE_UNUSED )
+{
+	char utf8_string[ 4 ];
+
+	PyObject *string_object  = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pymsiecf_file_get_format_version";
+	uint8_t major_version    = 0;
+	uint8_t minor_version    = 0;
+	int result               = 0;
+
+	PYMSIECF_UNREFERENCED_PARAMETER( arguments )
+
+	if( pymsiecf_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libmsiecf_file_get_format_version(
+	          pymsiecf_file->file,
+	          &major_version,
+	          &minor_version,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pymsiecf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve format version.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	if( major_version > 9 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: major version out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	if( minor_version > 9 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: minor version out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	utf8_string[ 0 ] = '0' + (char) major_version;
+	utf8_string[ 1 ] = '.';
+	utf8_string[ 2 ] = '0' + (char) minor_version;
+	utf8_string[ 3 ] = 0;
+
+	/* Pass the string length to PyUnicode_DecodeUTF8 otherwise it makes
+	 * the end of string character is part of the string
+	 */
+	string_object = PyUnicode_DecodeUTF8(
+	                 utf8_string,
+	                 (Py_ssize_t) 3,
+	                 NULL );
+
+	if( string_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: unable to convert UTF-8 string into Unicode object.",
+		 function );
+
+		return( NULL );
+	}
+	return( string_object );
+}
+
+/* Retrieves the number of cache directories
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pymsiecf_file_get_number_of_cache_directories(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments PYMSIECF_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object        = NULL;
+	libcerror_error_t *error        = NULL;
+	static char *function           = "pymsiecf_file_get_number_of_cache_directories";
+	int number_of_cache_directories = 0;
+	int result                      = 0;
+
+	PYMSIECF_UNREFERENCED_PARAMETER( arguments )
+
+	if( pymsiecf_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libmsiecf_file_get_number_of_cache_directories(
+	          pymsiecf_file->file,
+	          &number_of_cache_directories,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pymsiecf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of cache directories.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) number_of_cache_directories );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) number_of_cache_directories );
+#endif
+	return( integer_object );
+}
+
+/* Retrieves a specific cache directory by index
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pymsiecf_file_get_cache_directory_by_index(
+           PyObject *pymsiecf_file,
+           int cache_directory_index )
+{
+	char string[ 9 ];
+
+	PyObject *string_object  = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pymsiecf_file_get_cache_directory_by_index";
+	int result               = 0;
+
+	if( pymsiecf_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libmsiecf_file_get_cache_directory_name(
+	          ( (pymsiecf_file_t *) pymsiecf_file )->file,
+	          cache_directory_index,
+	          string,
+	          9,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pymsiecf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve cache directory name: %d.",
+		 function,
+		 cache_directory_index );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	/* Assumed that the directory name contains only basic ASCII characters
+	 */
+#if PY_MAJOR_VERSION >= 3
+	string_object = PyBytes_FromString(
+	                 string );
+#else
+	string_object = PyString_FromString(
+	                 string );
+#endif
+	if( string_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to convert cache directory name string into string object.",
+		 function );
+
+		return( NULL );
+	}
+	return( string_object );
+}
+
+/* Retrieves a specific cache directory
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pymsiecf_file_get_cache_directory(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *string_object     = NULL;
+	static char *keyword_list[] = { "cache_directory_index", NULL };
+	int cache_directory_index   = 0;
+
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "i",
 	     keyword_list,
 	     &cache_directory_index ) == 0 )
 	{
@@ -1818,6 +2247,441 @@ PyObject *pymsiecf_file_get_item(
 	return( item_object );
 }
 
+/* Retrieves a range of items
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pymsiecf_file_get_items_by_range(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *item_object       = NULL;
+	PyObject *list_object       = NULL;
+	PyTypeObject *type_object   = NULL;
+	libcerror_error_t *error    = NULL;
+	libmsiecf_item_t **items    = NULL;
+	static char *function       = "pymsiecf_file_get_items_by_range";
+	static char *keyword_list[] = { "first_item_index", "number_of_items", NULL };
+	int first_item_index        = 0;
+	int item_index              = 0;
+	int number_of_items         = 0;
+	int result                  = 0;
+
+	if( pymsiecf_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "ii",
+	     keyword_list,
+	     &first_item_index,
+	     &number_of_items ) == 0 )
+	{
+		return( NULL );
+	}
+	if( ( number_of_items < 0 )
+	 || ( (size_t) number_of_items > ( (size_t) SSIZE_MAX / sizeof( libmsiecf_item_t * ) ) ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of items value out of bounds.",
+		 function );
+
+		return( NULL );
+	}
+	list_object = PyList_New(
+	               (Py_ssize_t) number_of_items );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list object.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_items == 0 )
+	{
+		return( list_object );
+	}
+	items = (libmsiecf_item_t **) PyMem_Malloc(
+	                               sizeof( libmsiecf_item_t * ) * number_of_items );
+
+	if( items == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create items.",
+		 function );
+
+		goto on_error;
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		items[ item_index ] = NULL;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libmsiecf_file_get_items_by_range(
+	          pymsiecf_file->file,
+	          first_item_index,
+	          number_of_items,
+	          items,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pymsiecf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve items: %d to %d.",
+		 function,
+		 first_item_index,
+		 first_item_index + number_of_items );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		type_object = pymsiecf_file_get_item_type_object(
+		               items[ item_index ] );
+
+		if( type_object == NULL )
+		{
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve item: %d type object.",
+			 function,
+			 first_item_index + item_index );
+
+			goto on_error;
+		}
+		item_object = pymsiecf_item_new(
+		               type_object,
+		               items[ item_index ],
+		               (PyObject *) pymsiecf_file );
+
+		if( item_object == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create item: %d object.",
+			 function,
+			 first_item_index + item_index );
+
+			goto on_error;
+		}
+		/* The item object now owns the item
+		 */
+		items[ item_index ] = NULL;
+
+		/* PyList_SetItem steals the reference to the item object
+		 */
+		PyList_SetItem(
+		 list_object,
+		 (Py_ssize_t) item_index,
+		 item_object );
+	}
+	PyMem_Free(
+	 items );
+
+	return( list_object );
+
+on_error:
+	if( items != NULL )
+	{
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			if( items[ item_index ] != NULL )
+			{
+				libmsiecf_item_free(
+				 &( items[ item_index ] ),
+				 NULL );
+			}
+		}
+		PyMem_Free(
+		 items );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	return( NULL );
+}
+
+/* Retrieves specific items
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pymsiecf_file_get_items_by_indexes(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *indexes_object    = NULL;
+	PyObject *item_object       = NULL;
+	PyObject *list_object       = NULL;
+	PyObject *sequence_object   = NULL;
+	PyTypeObject *type_object   = NULL;
+	libcerror_error_t *error    = NULL;
+	libmsiecf_item_t **items    = NULL;
+	int *item_indexes           = NULL;
+	static char *function       = "pymsiecf_file_get_items_by_indexes";
+	static char *keyword_list[] = { "item_indexes", NULL };
+	Py_ssize_t sequence_size    = 0;
+	long long_value             = 0;
+	int item_index              = 0;
+	int number_of_items         = 0;
+	int result                  = 0;
+
+	if( pymsiecf_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &indexes_object ) == 0 )
+	{
+		return( NULL );
+	}
+	sequence_object = PySequence_Fast(
+	                   indexes_object,
+	                   "item indexes must be a sequence" );
+
+	if( sequence_object == NULL )
+	{
+		return( NULL );
+	}
+	sequence_size = PySequence_Fast_GET_SIZE(
+	                 sequence_object );
+
+	if( ( sequence_size < 0 )
+	 || ( (size_t) sequence_size > ( (size_t) SSIZE_MAX / sizeof( libmsiecf_item_t * ) ) )
+	 || ( sequence_size > (Py_ssize_t) INT_MAX ) )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid number of item indexes value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_items = (int) sequence_size;
+
+	list_object = PyList_New(
+	               (Py_ssize_t) number_of_items );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list object.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_items == 0 )
+	{
+		Py_DecRef(
+		 sequence_object );
+
+		return( list_object );
+	}
+	item_indexes = (int *) PyMem_Malloc(
+	                        sizeof( int ) * number_of_items );
+
+	if( item_indexes == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create item indexes.",
+		 function );
+
+		goto on_error;
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		long_value = PyLong_AsLong(
+		              PySequence_Fast_GET_ITEM(
+		               sequence_object,
+		               (Py_ssize_t) item_index ) );
+
+		if( ( long_value == -1 )
+		 && ( PyErr_Occurred() != NULL ) )
+		{
+			goto on_error;
+		}
+		if( ( long_value < 0 )
+		 || ( long_value > (long) INT_MAX ) )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid item index: %d value out of bounds.",
+			 function,
+			 item_index );
+
+			goto on_error;
+		}
+		item_indexes[ item_index ] = (int) long_value;
+	}
+	items = (libmsiecf_item_t **) PyMem_Malloc(
+	                               sizeof( libmsiecf_item_t * ) * number_of_items );
+
+	if( items == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create items.",
+		 function );
+
+		goto on_error;
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		items[ item_index ] = NULL;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libmsiecf_file_get_items_by_indexes(
+	          pymsiecf_file->file,
+	          item_indexes,
+	          number_of_items,
+	          items,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pymsiecf_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve items.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		type_object = pymsiecf_file_get_item_type_object(
+		               items[ item_index ] );
+
+		if( type_object == NULL )
+		{
+			PyErr_Format(
+			 PyExc_IOError,
+			 "%s: unable to retrieve item: %d type object.",
+			 function,
+			 item_indexes[ item_index ] );
+
+			goto on_error;
+		}
+		item_object = pymsiecf_item_new(
+		               type_object,
+		               items[ item_index ],
+		               (PyObject *) pymsiecf_file );
+
+		if( item_object == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create item: %d object.",
+			 function,
+			 item_indexes[ item_index ] );
+
+			goto on_error;
+		}
+		/* The item object now owns the item
+		 */
+		items[ item_index ] = NULL;
+
+		/* PyList_SetItem steals the reference to the item object
+		 */
+		PyList_SetItem(
+		 list_object,
+		 (Py_ssize_t) item_index,
+		 item_object );
+	}
+	PyMem_Free(
+	 items );
+
+	PyMem_Free(
+	 item_indexes );
+
+	Py_DecRef(
+	 sequence_object );
+
+	return( list_object );
+
+on_error:
+	if( items != NULL )
+	{
+		for( item_index = 0;
+		     item_index < number_of_items;
+		     item_index++ )
+		{
+			if( items[ item_index ] != NULL )
+			{
+				libmsiecf_item_free(
+				 &( items[ item_index ] ),
+				 NULL );
+			}
+		}
+		PyMem_Free(
+		 items );
+	}
+	if( item_indexes != NULL )
+	{
+		PyMem_Free(
+		 item_indexes );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	Py_DecRef(
+	 sequence_object );
+
+	return( NULL );
+}
+
 /* Retrieves a sequence and iterator object for the items
  * Returns a Python object if successful or NULL on error
  */
@@ -77,6 +77,10 @@ PyObject *pymsiecf_file_close(
            pymsiecf_file_t *pymsiecf_file,
            PyObject *arguments );
 
+PyObject *pymsiecf_file_refresh(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments );
+
 PyObject *pymsiecf_file_get_size(
            pymsiecf_file_t *pymsiecf_file,
            PyObject *arguments );
@@ -99,6 +103,29 @@ int pymsiecf_file_set_ascii_codepage_setter(
      PyObject *string_object,
      void *closure );
 
+PyObject *pymsiecf_file_get_access_pattern(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments );
+
+PyObject *pymsiecf_file_set_access_pattern(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pymsiecf_file_get_maximum_block_cache_size(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments );
+
+PyObject *pymsiecf_file_set_maximum_block_cache_size(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pymsiecf_file_set_index_filename(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pymsiecf_file_get_format_version(
            pymsiecf_file_t *pymsiecf_file,
            PyObject *arguments );
@@ -136,6 +163,16 @@ PyObject *pymsiecf_file_get_item(
            PyObject *arguments,
            PyObject *keywords );
 
+PyObject *pymsiecf_file_get_items_by_range(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pymsiecf_file_get_items_by_indexes(
+           pymsiecf_file_t *pymsiecf_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
 PyObject *pymsiecf_file_get_items(
            pymsiecf_file_t *pymsiecf_file,
            PyObject *arguments );
@@ -0,0 +1,511 @@
+#!/usr/bin/env python3
+#
+# Script to generate the record decoders from the dtFabric definitions.
+#
+# Usage: generate_record_decoders.py dtfabric.yaml libmsiecf.ini OUTPUT
+#
+# OUTPUT is either libmsiecf_record_decoders.c or libmsiecf_record_decoders.h
+#
+# Which members are decoded is controlled by the [dtFabric] data_types
+# in libmsiecf.ini:
+# * integer members with usage "in_struct" or "in_function" are decoded
+#   into the values structure of the data type;
+# * members with a "column" data type also get a batch decoder that
+#   decodes the member of consecutive records into a column of that
+#   data type.
+
+import argparse
+import configparser
+import json
+import os
+import sys
+
+import yaml
+
+
+COPYRIGHT = """\
+/*
+ * {description}
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+/* This file was generated by scripts/generate_record_decoders.py
+ * from dtfabric.yaml and libmsiecf.ini, do not edit
+ */
+"""
+
+C_TYPES = {
+    1: 'uint8_t',
+    2: 'uint16_t',
+    4: 'uint32_t',
+    8: 'uint64_t'}
+
+
+class Member(object):
+  """Structure member.
+
+  Attributes:
+    data_size (int): size of the member data.
+    data_type (str): C data type of the member value or None if the member
+        is not an integer.
+    description (str): description of the member.
+    name (str): name of the member.
+    offset (int): offset of the member relative to the start of
+        the structure.
+  """
+
+  def __init__(self, name, offset, data_size):
+    """Initializes a structure member."""
+    super(Member, self).__init__()
+    self.data_size = data_size
+    self.data_type = None
+    self.description = None
+    self.name = name
+    self.offset = offset
+
+
+class Structure(object):
+  """Structure.
+
+  Attributes:
+    columns (list[tuple[Member, str]]): members that are decoded into columns
+        and the C data type of their column.
+    data_size (int): size of the fixed-size part of the structure data.
+    description (str): description of the structure.
+    members (list[Member]): members decoded into the values structure.
+    name (str): name of the structure.
+  """
+
+  def __init__(self, name, description):
+    """Initializes a structure."""
+    super(Structure, self).__init__()
+    self.columns = []
+    self.data_size = 0
+    self.description = description
+    self.members = []
+    self.name = name
+
+
+def LowerCaseDescription(description):
+  """Converts the first word of a description to lower case.
+
+  Acronyms, such as URL, are kept in upper case.
+  """
+  if len(description) > 1 and description[1].islower():
+    return ''.join([description[0].lower(), description[1:]])
+  return description
+
+
+def ReadIntegerTypes(definitions):
+  """Reads the integer data type definitions.
+
+  Returns:
+    dict[str, int]: size per integer data type name.
+  """
+  integer_types = {}
+  for definition in definitions:
+    if definition.get('type') == 'integer':
+      integer_types[definition['name']] = definition['attributes']['size']
+  return integer_types
+
+
+def ReadStructures(definitions, data_types):
+  """Reads the structure definitions that have data type options.
+
+  Args:
+    definitions (list[dict[str, object]]): dtFabric definitions.
+    data_types (dict[str, dict[str, dict[str, str]]]): data type options.
+
+  Returns:
+    list[Structure]: structures.
+
+  Raises:
+    RuntimeError: if a structure is not supported.
+  """
+  integer_types = ReadIntegerTypes(definitions)
+
+  structures = []
+  for definition in definitions:
+    if definition.get('type') != 'structure':
+      continue
+
+    options = data_types.get(definition['name'], None)
+    if options is None:
+      continue
+
+    byte_order = definition.get('attributes', {}).get('byte_order', None)
+    if byte_order != 'little-endian':
+      raise RuntimeError('Unsupported byte order of structure: {0:s}'.format(
+          definition['name']))
+
+    structure = Structure(definition['name'], definition['description'])
+
+    for member_definition in definition['members']:
+      name = member_definition['name']
+
+      data_type = member_definition.get('data_type', None)
+      if data_type:
+        data_size = integer_types[data_type]
+      elif member_definition.get('type') == 'stream':
+        data_size = member_definition['elements_data_size']
+      else:
+        # The fixed-size part of the structure ends at the first member
+        # with a variable size, such as a terminated string.
+        break
+
+      member = Member(name, structure.data_size, data_size)
+      member.description = member_definition.get('description', None)
+      if data_type:
+        member.data_type = C_TYPES[data_size]
+
+      member_options = options.get(name, {})
+      # Stream members, such as the signature, are compared by the caller
+      # and are not decoded.
+      if (member.data_type and
+          member_options.get('usage', None) in ('in_function', 'in_struct')):
+        structure.members.append(member)
+
+      column_data_type = member_options.get('column', None)
+      if column_data_type:
+        if not member.data_type:
+          raise RuntimeError((
+              'Unsupported member: {0:s}.{1:s} only integer members can be '
+              'decoded into a column').format(structure.name, name))
+        column_data_size = integer_types[column_data_type]
+        if column_data_size < data_size:
+          raise RuntimeError((
+              'Unsupported column data type of member: {0:s}.{1:s} column '
+              'data type is smaller than member').format(structure.name, name))
+        structure.columns.append((member, C_TYPES[column_data_size]))
+
+      structure.data_size += data_size
+
+    structures.append(structure)
+
+  return structures
+
+
+def WriteDeclarations(lines, declarations):
+  """Writes local variable declarations with aligned assignments.
+
+  Args:
+    lines (list[str]): lines of the generated file.
+    declarations (list[tuple[str, str]]): declaration and value.
+  """
+  width = max(len(declaration) for declaration, _ in declarations)
+  for declaration, value in declarations:
+    lines.append('\t{0:s} = {1:s};'.format(declaration.ljust(width), value))
+
+
+def WriteArgumentCheck(lines, condition, error_code, message):
+  """Writes an argument check."""
+  lines.extend([
+      '\tif( {0:s} )'.format(condition),
+      '\t{',
+      '\t\tlibcerror_error_set(',
+      '\t\t error,',
+      '\t\t LIBCERROR_ERROR_DOMAIN_ARGUMENTS,',
+      '\t\t {0:s},'.format(error_code),
+      '\t\t "%s: {0:s}.",'.format(message),
+      '\t\t function );',
+      '',
+      '\t\treturn( -1 );',
+      '\t}'])
+
+
+def WriteCopy(lines, indentation, member, value):
+  """Writes the copy of a member value from data at a fixed offset."""
+  if member.data_size == 1:
+    lines.append('{0:s}{1:s} = data[ {2:d} ];'.format(
+        indentation, value, member.offset))
+  else:
+    lines.extend([
+        '{0:s}byte_stream_copy_to_uint{1:d}_little_endian('.format(
+            indentation, member.data_size * 8),
+        '{0:s} &( data[ {1:d} ] ),'.format(indentation, member.offset),
+        '{0:s} {1:s} );'.format(indentation, value)])
+
+
+def GetSizeDefinition(structure):
+  """Retrieves the name of the size definition of a structure."""
+  return 'LIBMSIECF_{0:s}_SIZE'.format(structure.name.upper())
+
+
+def GetDecodeFunction(structure):
+  """Retrieves the prototype of the decode function of a structure."""
+  return [
+      'int libmsiecf_{0:s}_values_decode('.format(structure.name),
+      '     libmsiecf_{0:s}_values_t *{0:s}_values,'.format(structure.name),
+      '     const uint8_t *data,',
+      '     size_t data_size,',
+      '     libcerror_error_t **error )']
+
+
+def GetColumnFunction(structure, member, column_data_type):
+  """Retrieves the prototype of the column decode function of a member."""
+  return [
+      'int libmsiecf_{0:s}_decode_{1:s}_column('.format(
+          structure.name, member.name),
+      '     const uint8_t *data,',
+      '     size_t data_size,',
+      '     int number_of_records,',
+      '     {0:s} *column,'.format(column_data_type),
+      '     libcerror_error_t **error )']
+
+
+def GenerateHeader(structures):
+  """Generates the header file.
+
+  Returns:
+    list[str]: lines of the header file.
+  """
+  lines = COPYRIGHT.format(description='Record decoder functions').split('\n')
+  lines.extend([
+      '#if !defined( _LIBMSIECF_RECORD_DECODERS_H )',
+      '#define _LIBMSIECF_RECORD_DECODERS_H',
+      '',
+      '#include <common.h>',
+      '#include <types.h>',
+      '',
+      '#include "libmsiecf_libcerror.h"',
+      '',
+      '#if defined( __cplusplus )',
+      'extern "C" {',
+      '#endif',
+      ''])
+
+  for structure in structures:
+    lines.extend([
+        '/* The size of the {0:s}'.format(
+            LowerCaseDescription(structure.description)),
+        ' */',
+        '#define {0:s}\t{1:d}'.format(
+            GetSizeDefinition(structure), structure.data_size),
+        ''])
+
+    if not structure.members:
+      continue
+
+    lines.extend([
+        'typedef struct libmsiecf_{0:s}_values '
+        'libmsiecf_{0:s}_values_t;'.format(structure.name),
+        '',
+        'struct libmsiecf_{0:s}_values'.format(structure.name),
+        '{'])
+
+    for index, member in enumerate(structure.members):
+      if index > 0:
+        lines.append('')
+      description = member.description or (
+          'The {0:s}'.format(member.name.replace('_', ' ')))
+      lines.extend([
+          '\t/* {0:s}'.format(description),
+          '\t */',
+          '\t{0:s} {1:s};'.format(member.data_type, member.name)])
+
+    lines.extend(['};', ''])
+
+  for structure in structures:
+    if structure.members:
+      lines.extend(GetDecodeFunction(structure))
+      lines[-1] = '{0:s};'.format(lines[-1])
+      lines.append('')
+
+    for member, column_data_type in structure.columns:
+      lines.extend(GetColumnFunction(structure, member, column_data_type))
+      lines[-1] = '{0:s};'.format(lines[-1])
+      lines.append('')
+
+  lines.extend([
+      '#if defined( __cplusplus )',
+      '}',
+      '#endif',
+      '',
+      '#endif /* !defined( _LIBMSIECF_RECORD_DECODERS_H ) */',
+      ''])
+
+  return lines
+
+
+def GenerateSource(structures):
+  """Generates the source file.
+
+  Returns:
+    list[str]: lines of the source file.
+  """
+  lines = COPYRIGHT.format(description='Record decoder functions').split('\n')
+  lines.extend([
+      '#include <common.h>',
+      '#include <byte_stream.h>',
+      '#include <types.h>',
+      '',
+      '#include "libmsiecf_libcerror.h"',
+      '#include "libmsiecf_record_decoders.h"',
+      ''])
+
+  for structure in structures:
+    description = LowerCaseDescription(structure.description)
+    size_definition = GetSizeDefinition(structure)
+
+    if structure.members:
+      function = 'libmsiecf_{0:s}_values_decode'.format(structure.name)
+      values = '{0:s}_values'.format(structure.name)
+
+      lines.extend([
+          '/* Decodes the {0:s} values'.format(description),
+          ' * Returns 1 if successful or -1 on error',
+          ' */'])
+      lines.extend(GetDecodeFunction(structure))
+      lines.append('{')
+      WriteDeclarations(lines, [
+          ('static char *function', '"{0:s}"'.format(function))])
+      lines.append('')
+
+      WriteArgumentCheck(
+          lines, '{0:s} == NULL'.format(values),
+          'LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE',
+          'invalid {0:s} values'.format(description))
+      WriteArgumentCheck(
+          lines, 'data == NULL', 'LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE',
+          'invalid data')
+      WriteArgumentCheck(
+          lines, 'data_size < {0:s}'.format(size_definition),
+          'LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL',
+          'invalid data size value too small')
+
+      for member in structure.members:
+        WriteCopy(lines, '\t', member, '{0:s}->{1:s}'.format(
+            values, member.name))
+        lines.append('')
+
+      lines.extend(['\treturn( 1 );', '}', ''])
+
+    for member, column_data_type in structure.columns:
+      function = 'libmsiecf_{0:s}_decode_{1:s}_column'.format(
+          structure.name, member.name)
+
+      lines.extend([
+          '/* Decodes the {0:s} of consecutive {1:s}s into a column'.format(
+              member.name.replace('_', ' '), description),
+          ' * Returns 1 if successful or -1 on error',
+          ' */'])
+      lines.extend(GetColumnFunction(structure, member, column_data_type))
+      lines.append('{')
+      WriteDeclarations(lines, [
+          ('static char *function', '"{0:s}"'.format(function)),
+          ('int record_index', '0')])
+      lines.append('')
+
+      WriteArgumentCheck(
+          lines, 'data == NULL', 'LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE',
+          'invalid data')
+      WriteArgumentCheck(
+          lines, 'number_of_records < 0',
+          'LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO',
+          'invalid number of records value less than zero')
+      WriteArgumentCheck(
+          lines, '(size_t) number_of_records > ( data_size / {0:s} )'.format(
+              size_definition),
+          'LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL',
+          'invalid data size value too small')
+      WriteArgumentCheck(
+          lines, 'column == NULL', 'LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE',
+          'invalid column')
+
+      lines.extend([
+          '\tfor( record_index = 0;',
+          '\t     record_index < number_of_records;',
+          '\t     record_index++ )',
+          '\t{'])
+      WriteCopy(lines, '\t\t', member, 'column[ record_index ]')
+      lines.extend([
+          '',
+          '\t\tdata += {0:s};'.format(size_definition),
+          '\t}',
+          '\treturn( 1 );',
+          '}',
+          ''])
+
+  return lines
+
+
+def Main():
+  """The main program function.
+
+  Returns:
+    bool: True if successful or False if not.
+  """
+  argument_parser = argparse.ArgumentParser(description=(
+      'Generates the record decoders from the dtFabric definitions.'))
+
+  argument_parser.add_argument(
+      'definitions', action='store', metavar='DTFABRIC_YAML', type=str,
+      help='path of the dtFabric definitions file.')
+
+  argument_parser.add_argument(
+      'project_configuration', action='store', metavar='PROJECT_INI',
+      type=str, help='path of the project configuration file.')
+
+  argument_parser.add_argument(
+      'output', action='store', metavar='OUTPUT', type=str,
+      help='path of the generated source (.c) or header (.h) file.')
+
+  options = argument_parser.parse_args()
+
+  with open(options.definitions, 'r', encoding='utf8') as file_object:
+    definitions = [
+        definition for definition in yaml.safe_load_all(file_object)
+        if definition]
+
+  project_configuration = configparser.ConfigParser(interpolation=None)
+  project_configuration.read(options.project_configuration, encoding='utf8')
+
+  data_types = json.loads(project_configuration.get('dtFabric', 'data_types'))
+
+  try:
+    structures = ReadStructures(definitions, data_types)
+  except RuntimeError as exception:
+    print(exception, file=sys.stderr)
+    return False
+
+  if options.output.endswith('.h'):
+    lines = GenerateHeader(structures)
+  elif options.output.endswith('.c'):
+    lines = GenerateSource(structures)
+  else:
+    print('Unsupported output file: {0:s}'.format(options.output),
+          file=sys.stderr)
+    return False
+
+  # Write to a temporary file first so that an interrupted run does not
+  # leave a partial file behind that looks up to date.
+  temporary_path = '{0:s}.tmp'.format(options.output)
+  with open(temporary_path, 'w', encoding='utf8', newline='\n') as file_object:
+    file_object.write('\n'.join(lines))
+
+  os.replace(temporary_path, options.output)
+
+  return True
+
+
+if __name__ == '__main__':
+  if not Main():
+    sys.exit(1)
+  else:
+    sys.exit(0)
@@ -0,0 +1,1360 @@
+/*
+ * Library allocation_map type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "msiecf_test_libcdata.h"
+#include "msiecf_test_libcerror.h"
+#include "msiecf_test_libmsiecf.h"
+#include "msiecf_test_macros.h"
+#include "msiecf_test_memory.h"
+#include "msiecf_test_unused.h"
+
+#include "../libmsiecf/libmsiecf_allocation_map.h"
+
+uint8_t msiecf_test_allocation_map_data1[ 16 ] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t msiecf_test_allocation_map_data2[ 16 ] = {
+	0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff };
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* Tests the libmsiecf_allocation_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_allocation_map_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libmsiecf_allocation_map_t *allocation_map = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 1;
+	int number_of_memset_fail_tests            = 1;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_allocation_map_initialize(
+	          &allocation_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_map",
+	 allocation_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_allocation_map_free(
+	          &allocation_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "allocation_map",
+	 allocation_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_allocation_map_initialize(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	allocation_map = (libmsiecf_allocation_map_t *) 0x12345678UL;
+
+	result = libmsiecf_allocation_map_initialize(
+	          &allocation_map,
+	          &error );
+
+	allocation_map = NULL;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_allocation_map_initialize with malloc failing
+		 */
+		msiecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libmsiecf_allocation_map_initialize(
+		          &allocation_map,
+		          &error );
+
+		if( msiecf_test_malloc_attempts_before_fail != -1 )
+		{
+			msiecf_test_malloc_attempts_before_fail = -1;
+
+			if( allocation_map != NULL )
+			{
+				libmsiecf_allocation_map_free(
+				 &allocation_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "allocation_map",
+			 allocation_map );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_allocation_map_initialize with memset failing
+		 */
+		msiecf_test_memset_attempts_before_fail = test_number;
+
+		result = libmsiecf_allocation_map_initialize(
+		          &allocation_map,
+		          &error );
+
+		if( msiecf_test_memset_attempts_before_fail != -1 )
+		{
+			msiecf_test_memset_attempts_before_fail = -1;
+
+			if( allocation_map != NULL )
+			{
+				libmsiecf_allocation_map_free(
+				 &allocation_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "allocation_map",
+			 allocation_map );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MSIECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_map != NULL )
+	{
+		libmsiecf_allocation_map_free(
+		 &allocation_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_allocation_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_allocation_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_allocation_map_free(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+/* Tests the libmsiecf_allocation_map_set_data function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_allocation_map_set_data(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libmsiecf_allocation_map_t *allocation_map = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_allocation_map_initialize(
+	          &allocation_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_map",
+	 allocation_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_allocation_map_set_data(
+	          allocation_map,
+	          msiecf_test_allocation_map_data1,
+	          16,
+	          128,
+	          0x4000,
+	          128,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "allocation_map->number_of_blocks",
+	 allocation_map->number_of_blocks,
+	 128 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "allocation_map->number_of_allocated_blocks",
+	 allocation_map->number_of_allocated_blocks,
+	 58 );
+
+	result = libmsiecf_allocation_map_set_data(
+	          allocation_map,
+	          msiecf_test_allocation_map_data2,
+	          16,
+	          124,
+	          0x4000,
+	          128,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "allocation_map->number_of_blocks",
+	 allocation_map->number_of_blocks,
+	 124 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "allocation_map->number_of_allocated_blocks",
+	 allocation_map->number_of_allocated_blocks,
+	 104 );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_allocation_map_set_data(
+	          NULL,
+	          msiecf_test_allocation_map_data1,
+	          16,
+	          128,
+	          0x4000,
+	          128,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_allocation_map_set_data(
+	          allocation_map,
+	          NULL,
+	          16,
+	          128,
+	          0x4000,
+	          128,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_allocation_map_set_data(
+	          allocation_map,
+	          msiecf_test_allocation_map_data1,
+	          16,
+	          129,
+	          0x4000,
+	          128,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_allocation_map_set_data(
+	          allocation_map,
+	          msiecf_test_allocation_map_data1,
+	          16,
+	          128,
+	          -1,
+	          128,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_allocation_map_set_data(
+	          allocation_map,
+	          msiecf_test_allocation_map_data1,
+	          16,
+	          128,
+	          0x4000,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_allocation_map_free(
+	          &allocation_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "allocation_map",
+	 allocation_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_map != NULL )
+	{
+		libmsiecf_allocation_map_free(
+		 &allocation_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_allocation_map_is_unallocated_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_allocation_map_is_unallocated_offset(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libmsiecf_allocation_map_t *allocation_map = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_allocation_map_initialize(
+	          &allocation_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_map",
+	 allocation_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_allocation_map_set_data(
+	          allocation_map,
+	          msiecf_test_allocation_map_data2,
+	          16,
+	          124,
+	          0x4000,
+	          128,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_allocation_map_is_unallocated_offset(
+	          allocation_map,
+	          0x4000,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_allocation_map_is_unallocated_offset(
+	          allocation_map,
+	          0x4000 + ( 4 * 128 ),
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_allocation_map_is_unallocated_offset(
+	          allocation_map,
+	          0x4000 + ( 64 * 128 ) + 16,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_allocation_map_is_unallocated_offset(
+	          allocation_map,
+	          0x4000 + ( 72 * 128 ),
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Offsets outside the mapped blocks are not unallocated
+	 */
+	result = libmsiecf_allocation_map_is_unallocated_offset(
+	          allocation_map,
+	          0x3f80,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_allocation_map_is_unallocated_offset(
+	          allocation_map,
+	          0x4000 + ( 128 * 128 ),
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_allocation_map_is_unallocated_offset(
+	          NULL,
+	          0x4000,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_allocation_map_free(
+	          &allocation_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "allocation_map",
+	 allocation_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( allocation_map != NULL )
+	{
+		libmsiecf_allocation_map_free(
+		 &allocation_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_allocation_map_get_unallocated_ranges function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_allocation_map_get_unallocated_ranges(
+     void )
+{
+	uint64_t expected_range_offsets[ 3 ]          = { 0x4000, 0x5f80, 0x6480 };
+	uint64_t expected_range_sizes[ 3 ]            = { 512, 1152, 896 };
+	libcdata_range_list_t *unallocated_block_list = NULL;
+	libcerror_error_t *error                      = NULL;
+	libmsiecf_allocation_map_t *allocation_map    = NULL;
+	intptr_t *value                               = NULL;
+	uint64_t range_offset                         = 0;
+	uint64_t range_size                           = 0;
+	int number_of_ranges                          = 0;
+	int range_index                               = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_allocation_map_initialize(
+	          &allocation_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_map",
+	 allocation_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_allocation_map_set_data(
+	          allocation_map,
+	          msiecf_test_allocation_map_data2,
+	          16,
+	          124,
+	          0x4000,
+	          128,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_range_list_initialize(
+	          &unallocated_block_list,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "unallocated_block_list",
+	 unallocated_block_list );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_allocation_map_get_unallocated_ranges(
+	          allocation_map,
+	          unallocated_block_list,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_range_list_get_number_of_elements(
+	          unallocated_block_list,
+	          &number_of_ranges,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 3 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( range_index = 0;
+	     range_index < 3;
+	     range_index++ )
+	{
+		result = libcdata_range_list_get_range_by_index(
+		          unallocated_block_list,
+		          range_index,
+		          &range_offset,
+		          &range_size,
+		          &value,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_EQUAL_UINT64(
+		 "range_offset",
+		 range_offset,
+		 expected_range_offsets[ range_index ] );
+
+		MSIECF_TEST_ASSERT_EQUAL_UINT64(
+		 "range_size",
+		 range_size,
+		 expected_range_sizes[ range_index ] );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test a range that ends at the last block
+	 */
+	result = libcdata_range_list_empty(
+	          unallocated_block_list,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_allocation_map_set_data(
+	          allocation_map,
+	          msiecf_test_allocation_map_data1,
+	          16,
+	          100,
+	          0x4000,
+	          128,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_allocation_map_get_unallocated_ranges(
+	          allocation_map,
+	          unallocated_block_list,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_range_list_get_range_by_index(
+	          unallocated_block_list,
+	          0,
+	          &range_offset,
+	          &range_size,
+	          &value,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT64(
+	 "range_offset",
+	 range_offset,
+	 (uint64_t) 0x4000 + ( 58 * 128 ) );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT64(
+	 "range_size",
+	 range_size,
+	 (uint64_t) 42 * 128 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_allocation_map_get_unallocated_ranges(
+	          NULL,
+	          unallocated_block_list,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_allocation_map_get_unallocated_ranges(
+	          allocation_map,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_range_list_free(
+	          &unallocated_block_list,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_allocation_map_free(
+	          &allocation_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "allocation_map",
+	 allocation_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( unallocated_block_list != NULL )
+	{
+		libcdata_range_list_free(
+		 &unallocated_block_list,
+		 NULL,
+		 NULL );
+	}
+	if( allocation_map != NULL )
+	{
+		libmsiecf_allocation_map_free(
+		 &allocation_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_allocation_map_get_changed_ranges function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_allocation_map_get_changed_ranges(
+     void )
+{
+	uint64_t expected_range_offsets[ 4 ]                = { 0x4000, 0x5d00, 0x6400, 0x6800 };
+	uint64_t expected_range_sizes[ 4 ]                  = { 512, 640, 128, 5632 };
+	libcdata_range_list_t *changed_block_list           = NULL;
+	libcerror_error_t *error                            = NULL;
+	libmsiecf_allocation_map_t *allocation_map          = NULL;
+	libmsiecf_allocation_map_t *previous_allocation_map = NULL;
+	intptr_t *value                                     = NULL;
+	uint64_t range_offset                               = 0;
+	uint64_t range_size                                 = 0;
+	int number_of_ranges                                = 0;
+	int range_index                                     = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_allocation_map_initialize(
+	          &previous_allocation_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libmsiecf_allocation_map_set_data(
+	          previous_allocation_map,
+	          msiecf_test_allocation_map_data1,
+	          16,
+	          100,
+	          0x4000,
+	          128,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_allocation_map_initialize(
+	          &allocation_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libmsiecf_allocation_map_set_data(
+	          allocation_map,
+	          msiecf_test_allocation_map_data2,
+	          16,
+	          124,
+	          0x4000,
+	          128,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_range_list_initialize(
+	          &changed_block_list,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_allocation_map_get_changed_ranges(
+	          allocation_map,
+	          previous_allocation_map,
+	          changed_block_list,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_range_list_get_number_of_elements(
+	          changed_block_list,
+	          &number_of_ranges,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 4 );
+
+	for( range_index = 0;
+	     range_index < 4;
+	     range_index++ )
+	{
+		result = libcdata_range_list_get_range_by_index(
+		          changed_block_list,
+		          range_index,
+		          &range_offset,
+		          &range_size,
+		          &value,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_EQUAL_UINT64(
+		 "range_offset",
+		 range_offset,
+		 expected_range_offsets[ range_index ] );
+
+		MSIECF_TEST_ASSERT_EQUAL_UINT64(
+		 "range_size",
+		 range_size,
+		 expected_range_sizes[ range_index ] );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test an unchanged allocation map
+	 */
+	result = libcdata_range_list_empty(
+	          changed_block_list,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libmsiecf_allocation_map_get_changed_ranges(
+	          allocation_map,
+	          allocation_map,
+	          changed_block_list,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_range_list_get_number_of_elements(
+	          changed_block_list,
+	          &number_of_ranges,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_ranges",
+	 number_of_ranges,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_allocation_map_get_changed_ranges(
+	          NULL,
+	          previous_allocation_map,
+	          changed_block_list,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_allocation_map_get_changed_ranges(
+	          allocation_map,
+	          NULL,
+	          changed_block_list,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_allocation_map_get_changed_ranges(
+	          allocation_map,
+	          previous_allocation_map,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_range_list_free(
+	          &changed_block_list,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libmsiecf_allocation_map_free(
+	          &allocation_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libmsiecf_allocation_map_free(
+	          &previous_allocation_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( changed_block_list != NULL )
+	{
+		libcdata_range_list_free(
+		 &changed_block_list,
+		 NULL,
+		 NULL );
+	}
+	if( allocation_map != NULL )
+	{
+		libmsiecf_allocation_map_free(
+		 &allocation_map,
+		 NULL );
+	}
+	if( previous_allocation_map != NULL )
+	{
+		libmsiecf_allocation_map_free(
+		 &previous_allocation_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argc )
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_allocation_map_initialize",
+	 msiecf_test_allocation_map_initialize );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_allocation_map_free",
+	 msiecf_test_allocation_map_free );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_allocation_map_set_data",
+	 msiecf_test_allocation_map_set_data );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_allocation_map_is_unallocated_offset",
+	 msiecf_test_allocation_map_is_unallocated_offset );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_allocation_map_get_unallocated_ranges",
+	 msiecf_test_allocation_map_get_unallocated_ranges );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_allocation_map_get_changed_ranges",
+	 msiecf_test_allocation_map_get_changed_ranges );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -36,6 +36,7 @@
 #include "msiecf_test_memory.h"
 #include "msiecf_test_unused.h"
 
+#include "../libmsiecf/libmsiecf_allocation_map.h"
 #include "../libmsiecf/libmsiecf_allocation_table.h"
 #include "../libmsiecf/libmsiecf_definitions.h"
 
@@ -50,15 +51,15 @@ uint8_t msiecf_test_allocation_table_data1[ 16 ] = {
 int msiecf_test_allocation_table_read_file_io_handle(
      void )
 {
-	libbfio_handle_t *file_io_handle        = NULL;
-	libcdata_range_list_t *allocation_table = NULL;
-	libcerror_error_t *error                = NULL;
-	int result                              = 0;
+	libbfio_handle_t *file_io_handle           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libmsiecf_allocation_map_t *allocation_map = NULL;
+	int result                                 = 0;
 
 	/* Initialize test
 	 */
-	result = libcdata_range_list_initialize(
-	          &allocation_table,
+	result = libmsiecf_allocation_map_initialize(
+	          &allocation_map,
 	          &error );
 
 	MSIECF_TEST_ASSERT_EQUAL_INT(
@@ -67,8 +68,8 @@ int msiecf_test_allocation_table_read_file_io_handle(
 	 1 );
 
 	MSIECF_TEST_ASSERT_IS_NOT_NULL(
-	 "allocation_table",
-	 allocation_table );
+	 "allocation_map",
+	 allocation_map );
 
 	MSIECF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -98,7 +99,7 @@ int msiecf_test_allocation_table_read_file_io_handle(
 	/* Test regular cases
 	 */
 	result = libmsiecf_allocation_table_read_file_io_handle(
-	          allocation_table,
+	          allocation_map,
 	          file_io_handle,
 	          0,
 	          32768,
@@ -117,6 +118,16 @@ int msiecf_test_allocation_table_read_file_io_handle(
 	 "error",
 	 error );
 
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "allocation_map->number_of_blocks",
+	 allocation_map->number_of_blocks,
+	 128 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "allocation_map->number_of_allocated_blocks",
+	 allocation_map->number_of_allocated_blocks,
+	 58 );
+
 	/* Test error cases
 	 */
 	result = libmsiecf_allocation_table_read_file_io_handle(
@@ -143,7 +154,7 @@ int msiecf_test_allocation_table_read_file_io_handle(
 	 &error );
 
 	result = libmsiecf_allocation_table_read_file_io_handle(
-	          allocation_table,
+	          allocation_map,
 	          NULL,
 	          0,
 	          32768,
@@ -166,7 +177,7 @@ int msiecf_test_allocation_table_read_file_io_handle(
 	 &error );
 
 	result = libmsiecf_allocation_table_read_file_io_handle(
-	          allocation_table,
+	          allocation_map,
 	          file_io_handle,
 	          -1,
 	          32768,
@@ -205,9 +216,8 @@ int msiecf_test_allocation_table_read_file_io_handle(
 
 	/* Clean up
 	 */
-	result = libcdata_range_list_free(
-	          &allocation_table,
-	          NULL,
+	result = libmsiecf_allocation_map_free(
+	          &allocation_map,
 	          &error );
 
 	MSIECF_TEST_ASSERT_EQUAL_INT(
@@ -216,8 +226,8 @@ int msiecf_test_allocation_table_read_file_io_handle(
 	 1 );
 
 	MSIECF_TEST_ASSERT_IS_NULL(
-	 "allocation_table",
-	 allocation_table );
+	 "allocation_map",
+	 allocation_map );
 
 	MSIECF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -237,11 +247,10 @@ on_error:
 		 &file_io_handle,
 		 NULL );
 	}
-	if( allocation_table != NULL )
+	if( allocation_map != NULL )
 	{
-		libcdata_range_list_free(
-		 &allocation_table,
-		 NULL,
+		libmsiecf_allocation_map_free(
+		 &allocation_map,
 		 NULL );
 	}
 	return( 0 );
@@ -0,0 +1,864 @@
+/*
+ * Library block_cache type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "msiecf_test_functions.h"
+#include "msiecf_test_libbfio.h"
+#include "msiecf_test_libcerror.h"
+#include "msiecf_test_libmsiecf.h"
+#include "msiecf_test_macros.h"
+#include "msiecf_test_memory.h"
+#include "msiecf_test_unused.h"
+
+#include "../libmsiecf/libmsiecf_block_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* The test data consists of 2 full pages and a partial page
+ */
+#define MSIECF_TEST_BLOCK_CACHE_DATA_SIZE	( ( 2 * LIBMSIECF_BLOCK_CACHE_PAGE_SIZE ) + 4096 )
+
+uint8_t msiecf_test_block_cache_data[ MSIECF_TEST_BLOCK_CACHE_DATA_SIZE ];
+
+/* Tests the libmsiecf_block_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_block_cache_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libmsiecf_block_cache_t *block_cache = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 1;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_block_cache_initialize(
+	          &block_cache,
+	          LIBMSIECF_BLOCK_CACHE_PAGE_SIZE,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_block_cache_initialize(
+	          NULL,
+	          LIBMSIECF_BLOCK_CACHE_PAGE_SIZE,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	block_cache = (libmsiecf_block_cache_t *) 0x12345678UL;
+
+	result = libmsiecf_block_cache_initialize(
+	          &block_cache,
+	          LIBMSIECF_BLOCK_CACHE_PAGE_SIZE,
+	          &error );
+
+	block_cache = NULL;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_block_cache_initialize with malloc failing
+		 */
+		msiecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libmsiecf_block_cache_initialize(
+		          &block_cache,
+		          LIBMSIECF_BLOCK_CACHE_PAGE_SIZE,
+		          &error );
+
+		if( msiecf_test_malloc_attempts_before_fail != -1 )
+		{
+			msiecf_test_malloc_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libmsiecf_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_block_cache_initialize with memset failing
+		 */
+		msiecf_test_memset_attempts_before_fail = test_number;
+
+		result = libmsiecf_block_cache_initialize(
+		          &block_cache,
+		          LIBMSIECF_BLOCK_CACHE_PAGE_SIZE,
+		          &error );
+
+		if( msiecf_test_memset_attempts_before_fail != -1 )
+		{
+			msiecf_test_memset_attempts_before_fail = -1;
+
+			if( block_cache != NULL )
+			{
+				libmsiecf_block_cache_free(
+				 &block_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "block_cache",
+			 block_cache );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MSIECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libmsiecf_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_block_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_block_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_block_cache_free(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_block_cache_get_maximum_size and libmsiecf_block_cache_set_maximum_size functions
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_block_cache_maximum_size(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libmsiecf_block_cache_t *block_cache = NULL;
+	size_t maximum_size                  = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_block_cache_initialize(
+	          &block_cache,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_block_cache_get_maximum_size(
+	          block_cache,
+	          &maximum_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_size",
+	 maximum_size,
+	 (size_t) 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_block_cache_set_maximum_size(
+	          block_cache,
+	          4 * LIBMSIECF_BLOCK_CACHE_PAGE_SIZE,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_block_cache_get_maximum_size(
+	          block_cache,
+	          &maximum_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_size",
+	 maximum_size,
+	 (size_t) ( 4 * LIBMSIECF_BLOCK_CACHE_PAGE_SIZE ) );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_block_cache_get_maximum_size(
+	          NULL,
+	          &maximum_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_block_cache_get_maximum_size(
+	          block_cache,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_block_cache_set_maximum_size(
+	          NULL,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libmsiecf_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_block_cache_read_buffer_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_block_cache_read_buffer_at_offset(
+     void )
+{
+	uint8_t buffer[ 4096 ];
+
+	libbfio_handle_t *file_io_handle     = NULL;
+	libcerror_error_t *error             = NULL;
+	libmsiecf_block_cache_t *block_cache = NULL;
+	ssize_t read_count                   = 0;
+	size_t data_offset                   = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	for( data_offset = 0;
+	     data_offset < MSIECF_TEST_BLOCK_CACHE_DATA_SIZE;
+	     data_offset++ )
+	{
+		msiecf_test_block_cache_data[ data_offset ] = (uint8_t) ( ( data_offset * 7 ) + ( data_offset / 251 ) );
+	}
+	result = msiecf_test_open_file_io_handle(
+	          &file_io_handle,
+	          msiecf_test_block_cache_data,
+	          MSIECF_TEST_BLOCK_CACHE_DATA_SIZE,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_block_cache_initialize(
+	          &block_cache,
+	          2 * LIBMSIECF_BLOCK_CACHE_PAGE_SIZE,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "block_cache",
+	 block_cache );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libmsiecf_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              file_io_handle,
+	              buffer,
+	              256,
+	              LIBMSIECF_BLOCK_CACHE_PAGE_SIZE - 128,
+	              &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 256 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( msiecf_test_block_cache_data[ LIBMSIECF_BLOCK_CACHE_PAGE_SIZE - 128 ] ),
+	          256 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_entries",
+	 block_cache->number_of_entries,
+	 2 );
+
+	/* Test reading cached data
+	 */
+	read_count = libmsiecf_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              file_io_handle,
+	              buffer,
+	              512,
+	              LIBMSIECF_BLOCK_CACHE_PAGE_SIZE + 1024,
+	              &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( msiecf_test_block_cache_data[ LIBMSIECF_BLOCK_CACHE_PAGE_SIZE + 1024 ] ),
+	          512 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test reading the partial last page, which removes the least recently used page
+	 */
+	read_count = libmsiecf_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              file_io_handle,
+	              buffer,
+	              4096,
+	              ( 2 * LIBMSIECF_BLOCK_CACHE_PAGE_SIZE ) + 2048,
+	              &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 2048 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( msiecf_test_block_cache_data[ ( 2 * LIBMSIECF_BLOCK_CACHE_PAGE_SIZE ) + 2048 ] ),
+	          2048 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_entries",
+	 block_cache->number_of_entries,
+	 2 );
+
+	/* Test reading at the end of the data
+	 */
+	read_count = libmsiecf_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              file_io_handle,
+	              buffer,
+	              16,
+	              MSIECF_TEST_BLOCK_CACHE_DATA_SIZE,
+	              &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading with a maximum size smaller than the page size
+	 */
+	result = libmsiecf_block_cache_set_maximum_size(
+	          block_cache,
+	          1024,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libmsiecf_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              file_io_handle,
+	              buffer,
+	              16,
+	              100,
+	              &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          buffer,
+	          &( msiecf_test_block_cache_data[ 100 ] ),
+	          16 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "block_cache->number_of_entries",
+	 block_cache->number_of_entries,
+	 0 );
+
+	/* Test error cases
+	 */
+	read_count = libmsiecf_block_cache_read_buffer_at_offset(
+	              NULL,
+	              file_io_handle,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libmsiecf_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              file_io_handle,
+	              NULL,
+	              16,
+	              0,
+	              &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libmsiecf_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              file_io_handle,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libmsiecf_block_cache_read_buffer_at_offset(
+	              block_cache,
+	              file_io_handle,
+	              buffer,
+	              16,
+	              -1,
+	              &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_block_cache_free(
+	          &block_cache,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "block_cache",
+	 block_cache );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = msiecf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( block_cache != NULL )
+	{
+		libmsiecf_block_cache_free(
+		 &block_cache,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argc )
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_block_cache_initialize",
+	 msiecf_test_block_cache_initialize );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_block_cache_free",
+	 msiecf_test_block_cache_free );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_block_cache_get_maximum_size",
+	 msiecf_test_block_cache_maximum_size );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_block_cache_read_buffer_at_offset",
+	 msiecf_test_block_cache_read_buffer_at_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -32,6 +32,7 @@
 
 #include "msiecf_test_functions.h"
 #include "msiecf_test_getopt.h"
+#include "msiecf_test_libcdata.h"
 #include "msiecf_test_libcerror.h"
 #include "msiecf_test_libclocale.h"
 #include "msiecf_test_libmsiecf.h"
@@ -40,6 +41,8 @@
 #include "msiecf_test_memory.h"
 
 #include "../libmsiecf/libmsiecf_file.h"
+#include "../libmsiecf/libmsiecf_item_descriptor.h"
+#include "../libmsiecf/libmsiecf_item_descriptor_arena.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
 #error Unsupported size of wchar_t
@@ -835,6 +838,172 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libmsiecf_file_open function with a deferred record scan
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_open_deferred_record_scan(
+     const system_character_t *source )
+{
+	libcerror_error_t *error               = NULL;
+	libmsiecf_file_t *file                 = NULL;
+	int access_flags                       = 0;
+	int deferred_number_of_items           = 0;
+	int deferred_number_of_recovered_items = 0;
+	int number_of_items                    = 0;
+	int number_of_recovered_items          = 0;
+	int pass                               = 0;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_file_initialize(
+	          &file,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open with and without deferring the record scan
+	 */
+	for( pass = 0;
+	     pass < 2;
+	     pass++ )
+	{
+		access_flags = LIBMSIECF_OPEN_READ;
+
+		if( pass == 1 )
+		{
+			access_flags |= LIBMSIECF_ACCESS_FLAG_DEFER_RECORD_SCAN;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libmsiecf_file_open_wide(
+		          file,
+		          source,
+		          access_flags,
+		          &error );
+#else
+		result = libmsiecf_file_open(
+		          file,
+		          source,
+		          access_flags,
+		          &error );
+#endif
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The recovered items are requested first to trigger the record scan
+		 */
+		result = libmsiecf_file_get_number_of_recovered_items(
+		          file,
+		          &deferred_number_of_recovered_items,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmsiecf_file_get_number_of_items(
+		          file,
+		          &deferred_number_of_items,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( pass == 0 )
+		{
+			number_of_items           = deferred_number_of_items;
+			number_of_recovered_items = deferred_number_of_recovered_items;
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "deferred_number_of_items",
+			 deferred_number_of_items,
+			 number_of_items );
+
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "deferred_number_of_recovered_items",
+			 deferred_number_of_recovered_items,
+			 number_of_recovered_items );
+		}
+		result = libmsiecf_file_close(
+		          file,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libmsiecf_file_free(
+	          &file,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libmsiecf_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libmsiecf_file_signal_abort function
  * Returns 1 if successful or 0 if not
  */
@@ -1182,40 +1351,70 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libmsiecf_file_get_number_of_unallocated_blocks function
+/* Tests the libmsiecf_file_get_number_of_scan_threads and libmsiecf_file_set_number_of_scan_threads functions
  * Returns 1 if successful or 0 if not
  */
-int msiecf_test_file_get_number_of_unallocated_blocks(
+int msiecf_test_file_set_number_of_scan_threads(
      libmsiecf_file_t *file )
 {
-	libcerror_error_t *error                = NULL;
-	int number_of_unallocated_blocks        = 0;
-	int number_of_unallocated_blocks_is_set = 0;
-	int result                              = 0;
+	libcerror_error_t *error   = NULL;
+	int number_of_scan_threads = 0;
+	int result                 = 0;
 
 	/* Test regular cases
 	 */
-	result = libmsiecf_file_get_number_of_unallocated_blocks(
+	result = libmsiecf_file_set_number_of_scan_threads(
 	          file,
-	          &number_of_unallocated_blocks,
+	          4,
 	          &error );
 
-	MSIECF_TEST_ASSERT_NOT_EQUAL_INT(
+	MSIECF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	MSIECF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	number_of_unallocated_blocks_is_set = result;
+	result = libmsiecf_file_get_number_of_scan_threads(
+	          file,
+	          &number_of_scan_threads,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_scan_threads",
+	 number_of_scan_threads,
+	 4 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_set_number_of_scan_threads(
+	          file,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libmsiecf_file_get_number_of_unallocated_blocks(
+	result = libmsiecf_file_set_number_of_scan_threads(
 	          NULL,
-	          &number_of_unallocated_blocks,
+	          4,
 	          &error );
 
 	MSIECF_TEST_ASSERT_EQUAL_INT(
@@ -1230,25 +1429,57 @@ int msiecf_test_file_get_number_of_unallocated_blocks(
 	libcerror_error_free(
 	 &error );
 
-	if( number_of_unallocated_blocks_is_set != 0 )
-	{
-		result = libmsiecf_file_get_number_of_unallocated_blocks(
-		          file,
-		          NULL,
-		          &error );
+	result = libmsiecf_file_set_number_of_scan_threads(
+	          file,
+	          -1,
+	          &error );
 
-		MSIECF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		MSIECF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_number_of_scan_threads(
+	          NULL,
+	          &number_of_scan_threads,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_number_of_scan_threads(
+	          file,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1260,40 +1491,2011 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libmsiecf_file_get_number_of_cache_directories function
+/* Tests the libmsiecf_file_get_access_pattern and libmsiecf_file_set_access_pattern functions
  * Returns 1 if successful or 0 if not
  */
-int msiecf_test_file_get_number_of_cache_directories(
+int msiecf_test_file_set_access_pattern(
      libmsiecf_file_t *file )
 {
-	libcerror_error_t *error               = NULL;
-	int number_of_cache_directories        = 0;
-	int number_of_cache_directories_is_set = 0;
-	int result                             = 0;
+	libcerror_error_t *error = NULL;
+	int access_pattern       = 0;
+	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libmsiecf_file_get_number_of_cache_directories(
+	result = libmsiecf_file_set_access_pattern(
 	          file,
-	          &number_of_cache_directories,
+	          LIBMSIECF_ACCESS_PATTERN_SEQUENTIAL,
 	          &error );
 
-	MSIECF_TEST_ASSERT_NOT_EQUAL_INT(
+	MSIECF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	MSIECF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	number_of_cache_directories_is_set = result;
-
-	/* Test error cases
-	 */
-	result = libmsiecf_file_get_number_of_cache_directories(
-	          NULL,
-	          &number_of_cache_directories,
+	result = libmsiecf_file_get_access_pattern(
+	          file,
+	          &access_pattern,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "access_pattern",
+	 access_pattern,
+	 LIBMSIECF_ACCESS_PATTERN_SEQUENTIAL );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_set_access_pattern(
+	          file,
+	          LIBMSIECF_ACCESS_PATTERN_NORMAL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_set_access_pattern(
+	          NULL,
+	          LIBMSIECF_ACCESS_PATTERN_SEQUENTIAL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_set_access_pattern(
+	          file,
+	          -1,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_access_pattern(
+	          NULL,
+	          &access_pattern,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_access_pattern(
+	          file,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_file_set_maximum_block_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_set_maximum_block_cache_size(
+     libmsiecf_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	libmsiecf_item_t *item    = NULL;
+	size_t maximum_cache_size = 0;
+	int item_index            = 0;
+	int number_of_items       = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_set_maximum_block_cache_size(
+	          file,
+	          1024 * 1024,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_get_maximum_block_cache_size(
+	          file,
+	          &maximum_cache_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_cache_size",
+	 maximum_cache_size,
+	 (size_t) ( 1024 * 1024 ) );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading the items using the block cache
+	 */
+	result = libmsiecf_file_get_number_of_items(
+	          file,
+	          &number_of_items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		result = libmsiecf_file_get_item_by_index(
+		          file,
+		          item_index,
+		          &item,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NOT_NULL(
+		 "item",
+		 item );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmsiecf_item_free(
+		          &item,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libmsiecf_file_set_maximum_block_cache_size(
+	          file,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_set_maximum_block_cache_size(
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_maximum_block_cache_size(
+	          NULL,
+	          &maximum_cache_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_maximum_block_cache_size(
+	          file,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libmsiecf_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_file_get_maximum_number_of_file_io_handles and libmsiecf_file_set_maximum_number_of_file_io_handles functions
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_set_maximum_number_of_file_io_handles(
+     libmsiecf_file_t *file )
+{
+	libcerror_error_t *error              = NULL;
+	libmsiecf_item_t *item                = NULL;
+	int item_index                        = 0;
+	int maximum_number_of_file_io_handles = 0;
+	int number_of_items                   = 0;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_set_maximum_number_of_file_io_handles(
+	          file,
+	          4,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_get_maximum_number_of_file_io_handles(
+	          file,
+	          &maximum_number_of_file_io_handles,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_file_io_handles",
+	 maximum_number_of_file_io_handles,
+	 4 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading the items using the file IO handle pool
+	 */
+	result = libmsiecf_file_get_number_of_items(
+	          file,
+	          &number_of_items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		result = libmsiecf_file_get_item_by_index(
+		          file,
+		          item_index,
+		          &item,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NOT_NULL(
+		 "item",
+		 item );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmsiecf_item_free(
+		          &item,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libmsiecf_file_set_maximum_number_of_file_io_handles(
+	          file,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_set_maximum_number_of_file_io_handles(
+	          NULL,
+	          4,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_set_maximum_number_of_file_io_handles(
+	          file,
+	          -1,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_set_maximum_number_of_file_io_handles(
+	          file,
+	          LIBMSIECF_MAXIMUM_NUMBER_OF_FILE_IO_HANDLES + 1,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_maximum_number_of_file_io_handles(
+	          NULL,
+	          &maximum_number_of_file_io_handles,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_maximum_number_of_file_io_handles(
+	          file,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libmsiecf_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_file_refresh function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_refresh(
+     libmsiecf_file_t *file )
+{
+	libcerror_error_t *error                = NULL;
+	int number_of_items                     = 0;
+	int number_of_recovered_items           = 0;
+	int refreshed_number_of_items           = 0;
+	int refreshed_number_of_recovered_items = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_file_get_number_of_items(
+	          file,
+	          &number_of_items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_get_number_of_recovered_items(
+	          file,
+	          &number_of_recovered_items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_refresh(
+	          file,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Refreshing an unmodified file does not add items
+	 */
+	result = libmsiecf_file_get_number_of_items(
+	          file,
+	          &refreshed_number_of_items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "refreshed_number_of_items",
+	 refreshed_number_of_items,
+	 number_of_items );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_get_number_of_recovered_items(
+	          file,
+	          &refreshed_number_of_recovered_items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "refreshed_number_of_recovered_items",
+	 refreshed_number_of_recovered_items,
+	 number_of_recovered_items );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_refresh(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_file_get_number_of_unallocated_blocks function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_get_number_of_unallocated_blocks(
+     libmsiecf_file_t *file )
+{
+	libcerror_error_t *error                = NULL;
+	int number_of_unallocated_blocks        = 0;
+	int number_of_unallocated_blocks_is_set = 0;
+	int result                              = 0;
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_get_number_of_unallocated_blocks(
+	          file,
+	          &number_of_unallocated_blocks,
+	          &error );
+
+	MSIECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_unallocated_blocks_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_get_number_of_unallocated_blocks(
+	          NULL,
+	          &number_of_unallocated_blocks,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_unallocated_blocks_is_set != 0 )
+	{
+		result = libmsiecf_file_get_number_of_unallocated_blocks(
+		          file,
+		          NULL,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		MSIECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_file_get_number_of_cache_directories function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_get_number_of_cache_directories(
+     libmsiecf_file_t *file )
+{
+	libcerror_error_t *error               = NULL;
+	int number_of_cache_directories        = 0;
+	int number_of_cache_directories_is_set = 0;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_get_number_of_cache_directories(
+	          file,
+	          &number_of_cache_directories,
+	          &error );
+
+	MSIECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_cache_directories_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_get_number_of_cache_directories(
+	          NULL,
+	          &number_of_cache_directories,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_cache_directories_is_set != 0 )
+	{
+		result = libmsiecf_file_get_number_of_cache_directories(
+		          file,
+		          NULL,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		MSIECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_file_get_number_of_items function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_get_number_of_items(
+     libmsiecf_file_t *file )
+{
+	libcerror_error_t *error   = NULL;
+	int number_of_items        = 0;
+	int number_of_items_is_set = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_get_number_of_items(
+	          file,
+	          &number_of_items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_items_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_get_number_of_items(
+	          NULL,
+	          &number_of_items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_items_is_set != 0 )
+	{
+		result = libmsiecf_file_get_number_of_items(
+		          file,
+		          NULL,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		MSIECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_file_get_items_by_range function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_get_items_by_range(
+     libmsiecf_file_t *file )
+{
+	libmsiecf_item_t *items[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	libmsiecf_item_t *item   = NULL;
+	off64_t expected_offset  = 0;
+	off64_t offset           = 0;
+	int item_index           = 0;
+	int number_of_items      = 0;
+	int result               = 0;
+
+	for( item_index = 0;
+	     item_index < 16;
+	     item_index++ )
+	{
+		items[ item_index ] = NULL;
+	}
+	result = libmsiecf_file_get_number_of_items(
+	          file,
+	          &number_of_items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_items > 16 )
+	{
+		number_of_items = 16;
+	}
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_get_items_by_range(
+	          file,
+	          0,
+	          number_of_items,
+	          items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		MSIECF_TEST_ASSERT_IS_NOT_NULL(
+		 "items[ item_index ]",
+		 items[ item_index ] );
+
+		result = libmsiecf_file_get_item_by_index(
+		          file,
+		          item_index,
+		          &item,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmsiecf_item_get_offset(
+		          item,
+		          &expected_offset,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libmsiecf_item_get_offset(
+		          items[ item_index ],
+		          &offset,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) expected_offset );
+
+		result = libmsiecf_item_free(
+		          &item,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libmsiecf_item_free(
+		          &( items[ item_index ] ),
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libmsiecf_file_get_items_by_range(
+	          NULL,
+	          0,
+	          number_of_items,
+	          items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_items_by_range(
+	          file,
+	          -1,
+	          number_of_items,
+	          items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_items_by_range(
+	          file,
+	          0,
+	          number_of_items,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libmsiecf_item_free(
+		 &item,
+		 NULL );
+	}
+	for( item_index = 0;
+	     item_index < 16;
+	     item_index++ )
+	{
+		if( items[ item_index ] != NULL )
+		{
+			libmsiecf_item_free(
+			 &( items[ item_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_file_get_items_by_indexes function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_get_items_by_indexes(
+     libmsiecf_file_t *file )
+{
+	libmsiecf_item_t *items[ 16 ];
+	int item_indexes[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	libmsiecf_item_t *item   = NULL;
+	off64_t expected_offset  = 0;
+	off64_t offset           = 0;
+	int item_index           = 0;
+	int number_of_items      = 0;
+	int result               = 0;
+
+	for( item_index = 0;
+	     item_index < 16;
+	     item_index++ )
+	{
+		items[ item_index ] = NULL;
+	}
+	result = libmsiecf_file_get_number_of_items(
+	          file,
+	          &number_of_items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_items > 16 )
+	{
+		number_of_items = 16;
+	}
+	/* Request the items in reverse order
+	 */
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		item_indexes[ item_index ] = number_of_items - ( item_index + 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_get_items_by_indexes(
+	          file,
+	          item_indexes,
+	          number_of_items,
+	          items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( item_index = 0;
+	     item_index < number_of_items;
+	     item_index++ )
+	{
+		MSIECF_TEST_ASSERT_IS_NOT_NULL(
+		 "items[ item_index ]",
+		 items[ item_index ] );
+
+		result = libmsiecf_file_get_item_by_index(
+		          file,
+		          item_indexes[ item_index ],
+		          &item,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libmsiecf_item_get_offset(
+		          item,
+		          &expected_offset,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libmsiecf_item_get_offset(
+		          items[ item_index ],
+		          &offset,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT64(
+		 "offset",
+		 (int64_t) offset,
+		 (int64_t) expected_offset );
+
+		result = libmsiecf_item_free(
+		          &item,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libmsiecf_item_free(
+		          &( items[ item_index ] ),
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libmsiecf_file_get_items_by_indexes(
+	          NULL,
+	          item_indexes,
+	          number_of_items,
+	          items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_items_by_indexes(
+	          file,
+	          NULL,
+	          number_of_items,
+	          items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_items_by_indexes(
+	          file,
+	          item_indexes,
+	          number_of_items,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libmsiecf_item_free(
+		 &item,
+		 NULL );
+	}
+	for( item_index = 0;
+	     item_index < 16;
+	     item_index++ )
+	{
+		if( items[ item_index ] != NULL )
+		{
+			libmsiecf_item_free(
+			 &( items[ item_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_file_get_item_by_utf8_location function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_get_item_by_utf8_location(
+     libmsiecf_file_t *file )
+{
+	uint8_t utf8_location[ 26 ] = {
+		'x', '-', 'm', 's', 'i', 'e', 'c', 'f', '-', 't', 'e', 's', 't', ':',
+		'n', 'o', 'n', 'e', 'x', 'i', 's', 't', 'e', 'n', 't', 0 };
+
+	libcerror_error_t *error = NULL;
+	libmsiecf_item_t *item   = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_get_item_by_utf8_location(
+	          file,
+	          utf8_location,
+	          25,
+	          &item,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_get_item_by_utf8_location(
+	          NULL,
+	          utf8_location,
+	          25,
+	          &item,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_item_by_utf8_location(
+	          file,
+	          NULL,
+	          25,
+	          &item,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_item_by_utf8_location(
+	          file,
+	          utf8_location,
+	          (size_t) SSIZE_MAX + 1,
+	          &item,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_item_by_utf8_location(
+	          file,
+	          utf8_location,
+	          25,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libmsiecf_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_file_get_item_by_utf16_location function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_get_item_by_utf16_location(
+     libmsiecf_file_t *file )
+{
+	uint16_t utf16_location[ 26 ] = {
+		'x', '-', 'm', 's', 'i', 'e', 'c', 'f', '-', 't', 'e', 's', 't', ':',
+		'n', 'o', 'n', 'e', 'x', 'i', 's', 't', 'e', 'n', 't', 0 };
+
+	libcerror_error_t *error = NULL;
+	libmsiecf_item_t *item   = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_get_item_by_utf16_location(
+	          file,
+	          utf16_location,
+	          25,
+	          &item,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "item",
+	 item );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_get_item_by_utf16_location(
+	          NULL,
+	          utf16_location,
+	          25,
+	          &item,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_item_by_utf16_location(
+	          file,
+	          NULL,
+	          25,
+	          &item,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_item_by_utf16_location(
+	          file,
+	          utf16_location,
+	          (size_t) SSIZE_MAX + 1,
+	          &item,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_get_item_by_utf16_location(
+	          file,
+	          utf16_location,
+	          25,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item != NULL )
+	{
+		libmsiecf_item_free(
+		 &item,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_file_get_number_of_recovered_items function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_get_number_of_recovered_items(
+     libmsiecf_file_t *file )
+{
+	libcerror_error_t *error             = NULL;
+	int number_of_recovered_items        = 0;
+	int number_of_recovered_items_is_set = 0;
+	int result                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_get_number_of_recovered_items(
+	          file,
+	          &number_of_recovered_items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_recovered_items_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_get_number_of_recovered_items(
+	          NULL,
+	          &number_of_recovered_items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_recovered_items_is_set != 0 )
+	{
+		result = libmsiecf_file_get_number_of_recovered_items(
+		          file,
+		          NULL,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		MSIECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Callback function to count the items of libmsiecf_file_iterate_items
+ * Returns 1 to continue
+ */
+int msiecf_test_file_iterate_items_callback(
+     libmsiecf_item_view_t *item_view,
+     void *user_data )
+{
+	uint8_t item_type = 0;
+
+	if( libmsiecf_item_view_get_type(
+	     item_view,
+	     &item_type,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	*( (int *) user_data ) += 1;
+
+	return( 1 );
+}
+
+/* Callback function to check the item offsets of libmsiecf_file_iterate_items
+ * Returns 1 to continue or -1 if the items are not in file offset order
+ */
+int msiecf_test_file_iterate_items_offset_order_callback(
+     libmsiecf_item_view_t *item_view,
+     void *user_data )
+{
+	off64_t offset = 0;
+	size64_t size  = 0;
+
+	if( libmsiecf_item_view_get_offset_range(
+	     item_view,
+	     &offset,
+	     &size,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( offset < *( (off64_t *) user_data ) )
+	{
+		return( -1 );
+	}
+	*( (off64_t *) user_data ) = offset;
+
+	return( 1 );
+}
+
+/* Tests the libmsiecf_file_iterate_items function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_iterate_items(
+     libmsiecf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	off64_t previous_offset  = 0;
+	int number_of_item_views = 0;
+	int number_of_items      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_get_number_of_items(
+	          file,
+	          &number_of_items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_iterate_items(
+	          file,
+	          LIBMSIECF_ITERATE_FLAG_ITEMS,
+	          &msiecf_test_file_iterate_items_callback,
+	          (void *) &number_of_item_views,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_item_views",
+	 number_of_item_views,
+	 number_of_items );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_iterate_items(
+	          file,
+	          LIBMSIECF_ITERATE_FLAG_ITEMS | LIBMSIECF_ITERATE_FLAG_RECOVERED_ITEMS | LIBMSIECF_ITERATE_FLAG_OFFSET_ORDER,
+	          &msiecf_test_file_iterate_items_offset_order_callback,
+	          (void *) &previous_offset,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_iterate_items(
+	          NULL,
+	          LIBMSIECF_ITERATE_FLAG_ITEMS,
+	          &msiecf_test_file_iterate_items_callback,
+	          (void *) &number_of_item_views,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_iterate_items(
+	          file,
+	          0xff,
+	          &msiecf_test_file_iterate_items_callback,
+	          (void *) &number_of_item_views,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_iterate_items(
+	          file,
+	          LIBMSIECF_ITERATE_FLAG_ITEMS,
+	          NULL,
+	          (void *) &number_of_item_views,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_file_read_url_columns function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_read_url_columns(
+     libmsiecf_file_t *file )
+{
+	libcerror_error_t *error             = NULL;
+	libmsiecf_url_columns_t *url_columns = NULL;
+	int number_of_items                  = 0;
+	int number_of_rows                   = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_url_columns_initialize(
+	          &url_columns,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "url_columns",
+	 url_columns );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_get_number_of_items(
+	          file,
+	          &number_of_items,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_read_url_columns(
+	          file,
+	          LIBMSIECF_ITERATE_FLAG_ITEMS,
+	          url_columns,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_url_columns_get_number_of_rows(
+	          url_columns,
+	          &number_of_rows,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_rows",
+	 number_of_rows,
+	 number_of_items + 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reading the URL columns again reuses the columns
+	 */
+	result = libmsiecf_file_read_url_columns(
+	          file,
+	          LIBMSIECF_ITERATE_FLAG_ITEMS | LIBMSIECF_ITERATE_FLAG_RECOVERED_ITEMS | LIBMSIECF_ITERATE_FLAG_OFFSET_ORDER,
+	          url_columns,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_read_url_columns(
+	          NULL,
+	          LIBMSIECF_ITERATE_FLAG_ITEMS,
+	          url_columns,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_read_url_columns(
+	          file,
+	          0xff,
+	          url_columns,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_read_url_columns(
+	          file,
+	          LIBMSIECF_ITERATE_FLAG_ITEMS,
+	          NULL,
 	          &error );
 
 	MSIECF_TEST_ASSERT_EQUAL_INT(
@@ -1301,77 +3503,447 @@ int msiecf_test_file_get_number_of_cache_directories(
 	 result,
 	 -1 );
 
-	MSIECF_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_url_columns_free(
+	          &url_columns,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "url_columns",
+	 url_columns );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( url_columns != NULL )
+	{
+		libmsiecf_url_columns_free(
+		 &url_columns,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* Appends an item descriptor to an array
+ * Returns 1 if successful or -1 on error
+ */
+int msiecf_test_file_append_item_descriptor(
+     libcdata_array_t *item_array,
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     off64_t file_offset,
+     uint32_t record_size,
+     uint8_t type,
+     uint8_t flags,
+     libmsiecf_item_descriptor_t **item_descriptor,
+     libcerror_error_t **error )
+{
+	int entry_index = 0;
+
+	if( libmsiecf_item_descriptor_arena_allocate(
+	     item_descriptor_arena,
+	     item_descriptor,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	( *item_descriptor )->file_offset = file_offset;
+	( *item_descriptor )->record_size = record_size;
+	( *item_descriptor )->type        = type;
+	( *item_descriptor )->flags       = flags;
+
+	if( libcdata_array_append_entry(
+	     item_array,
+	     &entry_index,
+	     (intptr_t *) *item_descriptor,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libmsiecf_internal_file_merge_scanned_items function
+ * with records that were changed or overwritten in place
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_internal_file_merge_scanned_items(
+     void )
+{
+	libcdata_array_t *scanned_item_array                             = NULL;
+	libcdata_array_t *scanned_recovered_item_array                   = NULL;
+	libcerror_error_t *error                                         = NULL;
+	libmsiecf_file_t *file                                           = NULL;
+	libmsiecf_internal_file_t *internal_file                         = NULL;
+	libmsiecf_item_descriptor_arena_t *scanned_item_descriptor_arena = NULL;
+	libmsiecf_item_descriptor_t *changed_item_descriptor             = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor                     = NULL;
+	libmsiecf_item_descriptor_t *new_item_descriptor                 = NULL;
+	libmsiecf_item_descriptor_t *overwritten_item_descriptor         = NULL;
+	libmsiecf_item_descriptor_t *scanned_changed_item_descriptor     = NULL;
+	libmsiecf_item_descriptor_t *scanned_overwritten_item_descriptor = NULL;
+	int number_of_entries                                            = 0;
+	int result                                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_file_initialize(
+	          &file,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_file = (libmsiecf_internal_file_t *) file;
+
+	result = libmsiecf_item_descriptor_arena_initialize(
+	          &( internal_file->item_descriptor_arena ),
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_descriptor_arena_initialize(
+	          &scanned_item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &( internal_file->item_array ),
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &( internal_file->recovered_item_array ),
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &scanned_item_array,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &scanned_recovered_item_array,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The record at offset 0x5000 is overwritten in place by a record of another type and size
+	 * and the flags of the record at offset 0x5400 are changed
+	 */
+	result = msiecf_test_file_append_item_descriptor(
+	          internal_file->item_array,
+	          internal_file->item_descriptor_arena,
+	          0x5000,
+	          256,
+	          LIBMSIECF_ITEM_TYPE_URL,
+	          0,
+	          &overwritten_item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = msiecf_test_file_append_item_descriptor(
+	          internal_file->item_array,
+	          internal_file->item_descriptor_arena,
+	          0x5400,
+	          128,
+	          LIBMSIECF_ITEM_TYPE_URL,
+	          0,
+	          &changed_item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = msiecf_test_file_append_item_descriptor(
+	          scanned_item_array,
+	          scanned_item_descriptor_arena,
+	          0x5000,
+	          384,
+	          LIBMSIECF_ITEM_TYPE_LEAK,
+	          0,
+	          &scanned_overwritten_item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = msiecf_test_file_append_item_descriptor(
+	          scanned_item_array,
+	          scanned_item_descriptor_arena,
+	          0x5400,
+	          128,
+	          LIBMSIECF_ITEM_TYPE_URL,
+	          LIBMSIECF_ITEM_FLAG_PARTIAL,
+	          &scanned_changed_item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = msiecf_test_file_append_item_descriptor(
+	          scanned_item_array,
+	          scanned_item_descriptor_arena,
+	          0x5800,
+	          128,
+	          LIBMSIECF_ITEM_TYPE_URL,
+	          0,
+	          &new_item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test merge scanned items
+	 */
+	result = libmsiecf_internal_file_merge_scanned_items(
+	          internal_file,
+	          scanned_item_array,
+	          scanned_recovered_item_array,
+	          scanned_item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          internal_file->item_array,
+	          &number_of_entries,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The descriptor of the overwritten record is replaced and marked as stale
+	 */
+	result = libcdata_array_get_entry_by_index(
+	          internal_file->item_array,
+	          0,
+	          (intptr_t **) &item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "item_descriptor",
+	 ( item_descriptor == scanned_overwritten_item_descriptor ),
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "item_descriptor->type",
+	 item_descriptor->type,
+	 (uint8_t) LIBMSIECF_ITEM_TYPE_LEAK );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "item_descriptor->is_stale",
+	 item_descriptor->is_stale,
+	 0 );
 
-	libcerror_error_free(
-	 &error );
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "overwritten_item_descriptor->is_stale",
+	 overwritten_item_descriptor->is_stale,
+	 1 );
 
-	if( number_of_cache_directories_is_set != 0 )
-	{
-		result = libmsiecf_file_get_number_of_cache_directories(
-		          file,
-		          NULL,
-		          &error );
+	/* The descriptor of the changed record is replaced and not marked as stale
+	 */
+	result = libcdata_array_get_entry_by_index(
+	          internal_file->item_array,
+	          1,
+	          (intptr_t **) &item_descriptor,
+	          &error );
 
-		MSIECF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		MSIECF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "item_descriptor",
+	 ( item_descriptor == scanned_changed_item_descriptor ),
+	 1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "item_descriptor->flags",
+	 item_descriptor->flags,
+	 (uint8_t) LIBMSIECF_ITEM_FLAG_PARTIAL );
 
-/* Tests the libmsiecf_file_get_number_of_items function
- * Returns 1 if successful or 0 if not
- */
-int msiecf_test_file_get_number_of_items(
-     libmsiecf_file_t *file )
-{
-	libcerror_error_t *error   = NULL;
-	int number_of_items        = 0;
-	int number_of_items_is_set = 0;
-	int result                 = 0;
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "changed_item_descriptor->is_stale",
+	 changed_item_descriptor->is_stale,
+	 0 );
 
-	/* Test regular cases
+	/* The descriptor of the new record is appended
 	 */
-	result = libmsiecf_file_get_number_of_items(
-	          file,
-	          &number_of_items,
+	result = libcdata_array_get_entry_by_index(
+	          internal_file->item_array,
+	          2,
+	          (intptr_t **) &item_descriptor,
 	          &error );
 
-	MSIECF_TEST_ASSERT_NOT_EQUAL_INT(
+	MSIECF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	MSIECF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	number_of_items_is_set = result;
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "item_descriptor",
+	 ( item_descriptor == new_item_descriptor ),
+	 1 );
 
 	/* Test error cases
 	 */
-	result = libmsiecf_file_get_number_of_items(
+	result = libmsiecf_internal_file_merge_scanned_items(
 	          NULL,
-	          &number_of_items,
+	          scanned_item_array,
+	          scanned_recovered_item_array,
+	          scanned_item_descriptor_arena,
 	          &error );
 
 	MSIECF_TEST_ASSERT_EQUAL_INT(
@@ -1386,103 +3958,103 @@ int msiecf_test_file_get_number_of_items(
 	libcerror_error_free(
 	 &error );
 
-	if( number_of_items_is_set != 0 )
-	{
-		result = libmsiecf_file_get_number_of_items(
-		          file,
-		          NULL,
-		          &error );
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &scanned_recovered_item_array,
+	          NULL,
+	          &error );
 
-		MSIECF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		MSIECF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
+	result = libcdata_array_free(
+	          &scanned_item_array,
+	          NULL,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* Tests the libmsiecf_file_get_number_of_recovered_items function
- * Returns 1 if successful or 0 if not
- */
-int msiecf_test_file_get_number_of_recovered_items(
-     libmsiecf_file_t *file )
-{
-	libcerror_error_t *error             = NULL;
-	int number_of_recovered_items        = 0;
-	int number_of_recovered_items_is_set = 0;
-	int result                           = 0;
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	result = libmsiecf_file_get_number_of_recovered_items(
-	          file,
-	          &number_of_recovered_items,
+	result = libmsiecf_item_descriptor_arena_free(
+	          &scanned_item_descriptor_arena,
 	          &error );
 
-	MSIECF_TEST_ASSERT_NOT_EQUAL_INT(
+	MSIECF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	MSIECF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	number_of_recovered_items_is_set = result;
+	result = libcdata_array_free(
+	          &( internal_file->recovered_item_array ),
+	          NULL,
+	          &error );
 
-	/* Test error cases
-	 */
-	result = libmsiecf_file_get_number_of_recovered_items(
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &( internal_file->item_array ),
 	          NULL,
-	          &number_of_recovered_items,
 	          &error );
 
 	MSIECF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	MSIECF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = libmsiecf_item_descriptor_arena_free(
+	          &( internal_file->item_descriptor_arena ),
+	          &error );
 
-	if( number_of_recovered_items_is_set != 0 )
-	{
-		result = libmsiecf_file_get_number_of_recovered_items(
-		          file,
-		          NULL,
-		          &error );
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		MSIECF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		MSIECF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	result = libmsiecf_file_free(
+	          &file,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1491,9 +4063,60 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( scanned_recovered_item_array != NULL )
+	{
+		libcdata_array_free(
+		 &scanned_recovered_item_array,
+		 NULL,
+		 NULL );
+	}
+	if( scanned_item_array != NULL )
+	{
+		libcdata_array_free(
+		 &scanned_item_array,
+		 NULL,
+		 NULL );
+	}
+	if( scanned_item_descriptor_arena != NULL )
+	{
+		libmsiecf_item_descriptor_arena_free(
+		 &scanned_item_descriptor_arena,
+		 NULL );
+	}
+	if( internal_file != NULL )
+	{
+		if( internal_file->recovered_item_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_file->recovered_item_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_file->item_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_file->item_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_file->item_descriptor_arena != NULL )
+		{
+			libmsiecf_item_descriptor_arena_free(
+			 &( internal_file->item_descriptor_arena ),
+			 NULL );
+		}
+	}
+	if( file != NULL )
+	{
+		libmsiecf_file_free(
+		 &file,
+		 NULL );
+	}
 	return( 0 );
 }
 
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -1549,6 +4172,14 @@ int main(
 	 "libmsiecf_file_free",
 	 msiecf_test_file_free );
 
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_internal_file_merge_scanned_items",
+	 msiecf_test_internal_file_merge_scanned_items );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -1581,6 +4212,11 @@ int main(
 		 msiecf_test_file_open_close,
 		 source );
 
+		MSIECF_TEST_RUN_WITH_ARGS(
+		 "libmsiecf_file_open_deferred_record_scan",
+		 msiecf_test_file_open_deferred_record_scan,
+		 source );
+
 		/* Initialize test
 		 */
 		result = msiecf_test_file_open_source(
@@ -1627,6 +4263,31 @@ int main(
 		 msiecf_test_file_set_ascii_codepage,
 		 file );
 
+		MSIECF_TEST_RUN_WITH_ARGS(
+		 "libmsiecf_file_set_number_of_scan_threads",
+		 msiecf_test_file_set_number_of_scan_threads,
+		 file );
+
+		MSIECF_TEST_RUN_WITH_ARGS(
+		 "libmsiecf_file_set_access_pattern",
+		 msiecf_test_file_set_access_pattern,
+		 file );
+
+		MSIECF_TEST_RUN_WITH_ARGS(
+		 "libmsiecf_file_set_maximum_block_cache_size",
+		 msiecf_test_file_set_maximum_block_cache_size,
+		 file );
+
+		MSIECF_TEST_RUN_WITH_ARGS(
+		 "libmsiecf_file_set_maximum_number_of_file_io_handles",
+		 msiecf_test_file_set_maximum_number_of_file_io_handles,
+		 file );
+
+		MSIECF_TEST_RUN_WITH_ARGS(
+		 "libmsiecf_file_refresh",
+		 msiecf_test_file_refresh,
+		 file );
+
 		/* TODO: add tests for libmsiecf_file_get_format_version */
 
 		MSIECF_TEST_RUN_WITH_ARGS(
@@ -1650,6 +4311,26 @@ int main(
 
 		/* TODO: add tests for libmsiecf_file_get_item_by_index */
 
+		MSIECF_TEST_RUN_WITH_ARGS(
+		 "libmsiecf_file_get_items_by_range",
+		 msiecf_test_file_get_items_by_range,
+		 file );
+
+		MSIECF_TEST_RUN_WITH_ARGS(
+		 "libmsiecf_file_get_items_by_indexes",
+		 msiecf_test_file_get_items_by_indexes,
+		 file );
+
+		MSIECF_TEST_RUN_WITH_ARGS(
+		 "libmsiecf_file_get_item_by_utf8_location",
+		 msiecf_test_file_get_item_by_utf8_location,
+		 file );
+
+		MSIECF_TEST_RUN_WITH_ARGS(
+		 "libmsiecf_file_get_item_by_utf16_location",
+		 msiecf_test_file_get_item_by_utf16_location,
+		 file );
+
 		MSIECF_TEST_RUN_WITH_ARGS(
 		 "libmsiecf_file_get_number_of_recovered_items",
 		 msiecf_test_file_get_number_of_recovered_items,
@@ -1657,6 +4338,16 @@ int main(
 
 		/* TODO: add tests for libmsiecf_file_get_recovered_item_by_index */
 
+		MSIECF_TEST_RUN_WITH_ARGS(
+		 "libmsiecf_file_iterate_items",
+		 msiecf_test_file_iterate_items,
+		 file );
+
+		MSIECF_TEST_RUN_WITH_ARGS(
+		 "libmsiecf_file_read_url_columns",
+		 msiecf_test_file_read_url_columns,
+		 file );
+
 		/* Clean up
 		 */
 		result = msiecf_test_file_close_source(
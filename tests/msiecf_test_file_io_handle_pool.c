@@ -0,0 +1,953 @@
+/*
+ * Library file_io_handle_pool type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "msiecf_test_functions.h"
+#include "msiecf_test_libbfio.h"
+#include "msiecf_test_libcerror.h"
+#include "msiecf_test_libmsiecf.h"
+#include "msiecf_test_macros.h"
+#include "msiecf_test_memory.h"
+#include "msiecf_test_unused.h"
+
+#include "../libmsiecf/libmsiecf_file_io_handle_pool.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* Tests the libmsiecf_file_io_handle_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_io_handle_pool_initialize(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libmsiecf_file_io_handle_pool_t *file_io_handle_pool = NULL;
+	int result                                           = 0;
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests                      = 1;
+	int number_of_memset_fail_tests                      = 1;
+	int test_number                                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_io_handle_pool_initialize(
+	          &file_io_handle_pool,
+	          1,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle_pool",
+	 file_io_handle_pool );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_io_handle_pool_free(
+	          &file_io_handle_pool,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "file_io_handle_pool",
+	 file_io_handle_pool );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_io_handle_pool_initialize(
+	          NULL,
+	          1,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	file_io_handle_pool = (libmsiecf_file_io_handle_pool_t *) 0x12345678UL;
+
+	result = libmsiecf_file_io_handle_pool_initialize(
+	          &file_io_handle_pool,
+	          1,
+	          &error );
+
+	file_io_handle_pool = NULL;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_file_io_handle_pool_initialize with malloc failing
+		 */
+		msiecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libmsiecf_file_io_handle_pool_initialize(
+		          &file_io_handle_pool,
+		          1,
+		          &error );
+
+		if( msiecf_test_malloc_attempts_before_fail != -1 )
+		{
+			msiecf_test_malloc_attempts_before_fail = -1;
+
+			if( file_io_handle_pool != NULL )
+			{
+				libmsiecf_file_io_handle_pool_free(
+				 &file_io_handle_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "file_io_handle_pool",
+			 file_io_handle_pool );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_file_io_handle_pool_initialize with memset failing
+		 */
+		msiecf_test_memset_attempts_before_fail = test_number;
+
+		result = libmsiecf_file_io_handle_pool_initialize(
+		          &file_io_handle_pool,
+		          1,
+		          &error );
+
+		if( msiecf_test_memset_attempts_before_fail != -1 )
+		{
+			msiecf_test_memset_attempts_before_fail = -1;
+
+			if( file_io_handle_pool != NULL )
+			{
+				libmsiecf_file_io_handle_pool_free(
+				 &file_io_handle_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "file_io_handle_pool",
+			 file_io_handle_pool );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MSIECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle_pool != NULL )
+	{
+		libmsiecf_file_io_handle_pool_free(
+		 &file_io_handle_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_file_io_handle_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_io_handle_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_io_handle_pool_free(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_file_io_handle_pool_get_maximum_number_of_handles and libmsiecf_file_io_handle_pool_set_maximum_number_of_handles functions
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_io_handle_pool_maximum_number_of_handles(
+     void )
+{
+	libcerror_error_t *error                             = NULL;
+	libmsiecf_file_io_handle_pool_t *file_io_handle_pool = NULL;
+	int maximum_number_of_handles                        = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_file_io_handle_pool_initialize(
+	          &file_io_handle_pool,
+	          1,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle_pool",
+	 file_io_handle_pool );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_io_handle_pool_get_maximum_number_of_handles(
+	          file_io_handle_pool,
+	          &maximum_number_of_handles,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_handles",
+	 maximum_number_of_handles,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_io_handle_pool_set_maximum_number_of_handles(
+	          file_io_handle_pool,
+	          8,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_io_handle_pool_get_maximum_number_of_handles(
+	          file_io_handle_pool,
+	          &maximum_number_of_handles,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_handles",
+	 maximum_number_of_handles,
+	 8 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_io_handle_pool_get_maximum_number_of_handles(
+	          NULL,
+	          &maximum_number_of_handles,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_io_handle_pool_get_maximum_number_of_handles(
+	          file_io_handle_pool,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_io_handle_pool_set_maximum_number_of_handles(
+	          NULL,
+	          1,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_io_handle_pool_set_maximum_number_of_handles(
+	          file_io_handle_pool,
+	          -1,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_io_handle_pool_set_maximum_number_of_handles(
+	          file_io_handle_pool,
+	          LIBMSIECF_MAXIMUM_NUMBER_OF_FILE_IO_HANDLES + 1,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_file_io_handle_pool_free(
+	          &file_io_handle_pool,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "file_io_handle_pool",
+	 file_io_handle_pool );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle_pool != NULL )
+	{
+		libmsiecf_file_io_handle_pool_free(
+		 &file_io_handle_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_file_io_handle_pool_grab_handle and libmsiecf_file_io_handle_pool_release_handle functions
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_io_handle_pool_grab_handle(
+     void )
+{
+	uint8_t data[ 256 ];
+
+	libbfio_handle_t *file_io_handle                     = NULL;
+	libbfio_handle_t *grabbed_file_io_handles[ 3 ]       = { NULL, NULL, NULL };
+	libcerror_error_t *error                             = NULL;
+	libmsiecf_file_io_handle_pool_t *file_io_handle_pool = NULL;
+	int handle_indexes[ 3 ]                              = { 0, 0, 0 };
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = msiecf_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          256,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_io_handle_pool_initialize(
+	          &file_io_handle_pool,
+	          2,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle_pool",
+	 file_io_handle_pool );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases without a file IO handle
+	 */
+	result = libmsiecf_file_io_handle_pool_grab_handle(
+	          file_io_handle_pool,
+	          &( grabbed_file_io_handles[ 0 ] ),
+	          &( handle_indexes[ 0 ] ),
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_io_handle_pool_set_file_io_handle(
+	          file_io_handle_pool,
+	          file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_io_handle_pool_grab_handle(
+	          file_io_handle_pool,
+	          &( grabbed_file_io_handles[ 0 ] ),
+	          &( handle_indexes[ 0 ] ),
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "handle_indexes[ 0 ]",
+	 handle_indexes[ 0 ],
+	 0 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "grabbed_file_io_handles[ 0 ] == file_io_handle",
+	 (int) ( grabbed_file_io_handles[ 0 ] == file_io_handle ),
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The second reader either gets a cloned file IO handle
+	 * or shares the file IO handle if cloning is not supported
+	 */
+	result = libmsiecf_file_io_handle_pool_grab_handle(
+	          file_io_handle_pool,
+	          &( grabbed_file_io_handles[ 1 ] ),
+	          &( handle_indexes[ 1 ] ),
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "grabbed_file_io_handles[ 1 ]",
+	 grabbed_file_io_handles[ 1 ] );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( handle_indexes[ 1 ] == 1 )
+	{
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "grabbed_file_io_handles[ 1 ] != file_io_handle",
+		 (int) ( grabbed_file_io_handles[ 1 ] != file_io_handle ),
+		 1 );
+	}
+	else
+	{
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "handle_indexes[ 1 ]",
+		 handle_indexes[ 1 ],
+		 -1 );
+	}
+	/* The third reader exceeds the maximum and shares the file IO handle
+	 */
+	result = libmsiecf_file_io_handle_pool_grab_handle(
+	          file_io_handle_pool,
+	          &( grabbed_file_io_handles[ 2 ] ),
+	          &( handle_indexes[ 2 ] ),
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "handle_indexes[ 2 ]",
+	 handle_indexes[ 2 ],
+	 -1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "grabbed_file_io_handles[ 2 ] == file_io_handle",
+	 (int) ( grabbed_file_io_handles[ 2 ] == file_io_handle ),
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_io_handle_pool_release_handle(
+	          file_io_handle_pool,
+	          handle_indexes[ 2 ],
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_io_handle_pool_release_handle(
+	          file_io_handle_pool,
+	          handle_indexes[ 1 ],
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_io_handle_pool_release_handle(
+	          file_io_handle_pool,
+	          handle_indexes[ 0 ],
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A released file IO handle is reused
+	 */
+	result = libmsiecf_file_io_handle_pool_grab_handle(
+	          file_io_handle_pool,
+	          &( grabbed_file_io_handles[ 0 ] ),
+	          &( handle_indexes[ 0 ] ),
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "handle_indexes[ 0 ]",
+	 handle_indexes[ 0 ],
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_io_handle_pool_release_handle(
+	          file_io_handle_pool,
+	          handle_indexes[ 0 ],
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Lowering the maximum frees the cloned file IO handles
+	 */
+	result = libmsiecf_file_io_handle_pool_set_maximum_number_of_handles(
+	          file_io_handle_pool,
+	          1,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "file_io_handle_pool->number_of_handles",
+	 file_io_handle_pool->number_of_handles,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_io_handle_pool_grab_handle(
+	          NULL,
+	          &( grabbed_file_io_handles[ 0 ] ),
+	          &( handle_indexes[ 0 ] ),
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_io_handle_pool_grab_handle(
+	          file_io_handle_pool,
+	          NULL,
+	          &( handle_indexes[ 0 ] ),
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_io_handle_pool_grab_handle(
+	          file_io_handle_pool,
+	          &( grabbed_file_io_handles[ 0 ] ),
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_io_handle_pool_release_handle(
+	          NULL,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_io_handle_pool_release_handle(
+	          file_io_handle_pool,
+	          LIBMSIECF_MAXIMUM_NUMBER_OF_FILE_IO_HANDLES,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_file_io_handle_pool_free(
+	          &file_io_handle_pool,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "file_io_handle_pool",
+	 file_io_handle_pool );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = msiecf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle_pool != NULL )
+	{
+		libmsiecf_file_io_handle_pool_free(
+		 &file_io_handle_pool,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argc )
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_file_io_handle_pool_initialize",
+	 msiecf_test_file_io_handle_pool_initialize );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_file_io_handle_pool_free",
+	 msiecf_test_file_io_handle_pool_free );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_file_io_handle_pool_get_maximum_number_of_handles",
+	 msiecf_test_file_io_handle_pool_maximum_number_of_handles );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_file_io_handle_pool_grab_handle",
+	 msiecf_test_file_io_handle_pool_grab_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
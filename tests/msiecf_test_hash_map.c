@@ -0,0 +1,981 @@
+/*
+ * Library hash_map type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "msiecf_test_libcerror.h"
+#include "msiecf_test_libmsiecf.h"
+#include "msiecf_test_macros.h"
+#include "msiecf_test_memory.h"
+#include "msiecf_test_unused.h"
+
+#include "../libmsiecf/libmsiecf_definitions.h"
+#include "../libmsiecf/libmsiecf_hash_map.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* Tests the libmsiecf_hash_map_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_hash_map_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libmsiecf_hash_map_t *hash_map  = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_hash_map_initialize(
+	          &hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_map",
+	 hash_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_hash_map_free(
+	          &hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "hash_map",
+	 hash_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_hash_map_initialize(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	hash_map = (libmsiecf_hash_map_t *) 0x12345678UL;
+
+	result = libmsiecf_hash_map_initialize(
+	          &hash_map,
+	          &error );
+
+	hash_map = NULL;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_hash_map_initialize with malloc failing
+		 */
+		msiecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libmsiecf_hash_map_initialize(
+		          &hash_map,
+		          &error );
+
+		if( msiecf_test_malloc_attempts_before_fail != -1 )
+		{
+			msiecf_test_malloc_attempts_before_fail = -1;
+
+			if( hash_map != NULL )
+			{
+				libmsiecf_hash_map_free(
+				 &hash_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "hash_map",
+			 hash_map );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_hash_map_initialize with memset failing
+		 */
+		msiecf_test_memset_attempts_before_fail = test_number;
+
+		result = libmsiecf_hash_map_initialize(
+		          &hash_map,
+		          &error );
+
+		if( msiecf_test_memset_attempts_before_fail != -1 )
+		{
+			msiecf_test_memset_attempts_before_fail = -1;
+
+			if( hash_map != NULL )
+			{
+				libmsiecf_hash_map_free(
+				 &hash_map,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "hash_map",
+			 hash_map );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MSIECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_map != NULL )
+	{
+		libmsiecf_hash_map_free(
+		 &hash_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_hash_map_free function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_hash_map_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_hash_map_free(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_hash_map_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_hash_map_resize(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libmsiecf_hash_map_t *hash_map = NULL;
+	uint32_t probe_index           = 0;
+	uint32_t record_offset         = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_hash_map_initialize(
+	          &hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_map",
+	 hash_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_hash_map_insert(
+	          hash_map,
+	          0x12345680UL,
+	          0x00004000UL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_hash_map_insert(
+	          hash_map,
+	          0x87654300UL,
+	          0x00008000UL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_hash_map_resize(
+	          hash_map,
+	          4 * LIBMSIECF_HASH_MAP_MINIMUM_NUMBER_OF_BUCKETS,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_map->number_of_buckets",
+	 hash_map->number_of_buckets,
+	 (uint32_t) 4 * LIBMSIECF_HASH_MAP_MINIMUM_NUMBER_OF_BUCKETS );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_map->number_of_entries",
+	 hash_map->number_of_entries,
+	 (uint32_t) 2 );
+
+	/* Test if the entries are retained after the resize
+	 */
+	probe_index = 0;
+
+	result = libmsiecf_hash_map_get_record_offset(
+	          hash_map,
+	          0x12345680UL,
+	          &probe_index,
+	          &record_offset,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "record_offset",
+	 record_offset,
+	 (uint32_t) 0x00004000UL );
+
+	probe_index = 0;
+
+	result = libmsiecf_hash_map_get_record_offset(
+	          hash_map,
+	          0x87654300UL,
+	          &probe_index,
+	          &record_offset,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "record_offset",
+	 record_offset,
+	 (uint32_t) 0x00008000UL );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_hash_map_resize(
+	          NULL,
+	          4 * LIBMSIECF_HASH_MAP_MINIMUM_NUMBER_OF_BUCKETS,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_hash_map_resize(
+	          hash_map,
+	          LIBMSIECF_HASH_MAP_MINIMUM_NUMBER_OF_BUCKETS / 2,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_hash_map_resize(
+	          hash_map,
+	          LIBMSIECF_HASH_MAP_MINIMUM_NUMBER_OF_BUCKETS + 1,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_hash_map_resize(
+	          hash_map,
+	          0xffffffffUL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_map->number_of_buckets",
+	 hash_map->number_of_buckets,
+	 (uint32_t) 4 * LIBMSIECF_HASH_MAP_MINIMUM_NUMBER_OF_BUCKETS );
+
+	/* Clean up
+	 */
+	result = libmsiecf_hash_map_free(
+	          &hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "hash_map",
+	 hash_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_map != NULL )
+	{
+		libmsiecf_hash_map_free(
+		 &hash_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_hash_map_insert function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_hash_map_insert(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libmsiecf_hash_map_t *hash_map = NULL;
+	uint32_t entry_index           = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_hash_map_initialize(
+	          &hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_map",
+	 hash_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_hash_map_insert(
+	          hash_map,
+	          0x12345680UL,
+	          0x00004000UL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_map->number_of_entries",
+	 hash_map->number_of_entries,
+	 (uint32_t) 1 );
+
+	/* Test if a duplicate pair is ignored
+	 */
+	result = libmsiecf_hash_map_insert(
+	          hash_map,
+	          0x12345680UL,
+	          0x00004000UL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_map->number_of_entries",
+	 hash_map->number_of_entries,
+	 (uint32_t) 1 );
+
+	/* Test if the hash map grows
+	 */
+	for( entry_index = 1;
+	     entry_index <= LIBMSIECF_HASH_MAP_MINIMUM_NUMBER_OF_BUCKETS;
+	     entry_index++ )
+	{
+		result = libmsiecf_hash_map_insert(
+		          hash_map,
+		          entry_index << 6,
+		          entry_index * LIBMSIECF_DEFAULT_BLOCK_SIZE,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_map->number_of_entries",
+	 hash_map->number_of_entries,
+	 (uint32_t) LIBMSIECF_HASH_MAP_MINIMUM_NUMBER_OF_BUCKETS + 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_map->number_of_buckets",
+	 hash_map->number_of_buckets,
+	 (uint32_t) 4 * LIBMSIECF_HASH_MAP_MINIMUM_NUMBER_OF_BUCKETS );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_hash_map_insert(
+	          NULL,
+	          0x12345680UL,
+	          0x00004000UL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_hash_map_insert(
+	          hash_map,
+	          0x12345680UL,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_hash_map_free(
+	          &hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "hash_map",
+	 hash_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_map != NULL )
+	{
+		libmsiecf_hash_map_free(
+		 &hash_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_hash_map_get_record_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_hash_map_get_record_offset(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libmsiecf_hash_map_t *hash_map = NULL;
+	uint32_t probe_index           = 0;
+	uint32_t record_offset         = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_hash_map_initialize(
+	          &hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_map",
+	 hash_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_hash_map_insert(
+	          hash_map,
+	          0x12345680UL,
+	          0x00004000UL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_hash_map_insert(
+	          hash_map,
+	          0x12345684UL,
+	          0x00008000UL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_hash_map_get_record_offset(
+	          hash_map,
+	          0x12345680UL,
+	          &probe_index,
+	          &record_offset,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "record_offset",
+	 record_offset,
+	 (uint32_t) 0x00004000UL );
+
+	result = libmsiecf_hash_map_get_record_offset(
+	          hash_map,
+	          0x12345680UL,
+	          &probe_index,
+	          &record_offset,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "record_offset",
+	 record_offset,
+	 (uint32_t) 0x00008000UL );
+
+	result = libmsiecf_hash_map_get_record_offset(
+	          hash_map,
+	          0x12345680UL,
+	          &probe_index,
+	          &record_offset,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	probe_index = 0;
+
+	result = libmsiecf_hash_map_get_record_offset(
+	          hash_map,
+	          0x87654300UL,
+	          &probe_index,
+	          &record_offset,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	probe_index = 0;
+
+	result = libmsiecf_hash_map_get_record_offset(
+	          NULL,
+	          0x12345680UL,
+	          &probe_index,
+	          &record_offset,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_hash_map_get_record_offset(
+	          hash_map,
+	          0x12345680UL,
+	          NULL,
+	          &record_offset,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_hash_map_get_record_offset(
+	          hash_map,
+	          0x12345680UL,
+	          &probe_index,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_hash_map_free(
+	          &hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "hash_map",
+	 hash_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_map != NULL )
+	{
+		libmsiecf_hash_map_free(
+		 &hash_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argc )
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_hash_map_initialize",
+	 msiecf_test_hash_map_initialize );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_hash_map_free",
+	 msiecf_test_hash_map_free );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_hash_map_resize",
+	 msiecf_test_hash_map_resize );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_hash_map_insert",
+	 msiecf_test_hash_map_insert );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_hash_map_get_record_offset",
+	 msiecf_test_hash_map_get_record_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
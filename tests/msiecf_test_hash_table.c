@@ -36,8 +36,9 @@
 #include "msiecf_test_memory.h"
 #include "msiecf_test_unused.h"
 
-#include "../libmsiecf/libmsiecf_hash_table.h"
 #include "../libmsiecf/libmsiecf_definitions.h"
+#include "../libmsiecf/libmsiecf_hash_map.h"
+#include "../libmsiecf/libmsiecf_hash_table.h"
 
 uint8_t msiecf_test_hash_table_data1[ 4096 ] = {
 	0x48, 0x41, 0x53, 0x48, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -300,6 +301,235 @@ uint8_t msiecf_test_hash_table_data1[ 4096 ] = {
 
 #if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
 
+/* Tests the libmsiecf_hash_table_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_hash_table_read_data(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	libmsiecf_hash_map_t *hash_map = NULL;
+	off64_t next_hash_table_offset = 0;
+	int result                     = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_hash_map_initialize(
+	          &hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_map",
+	 hash_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_hash_table_read_data(
+	          hash_map,
+	          &next_hash_table_offset,
+	          msiecf_test_hash_table_data1,
+	          4096,
+	          LIBMSIECF_DEFAULT_BLOCK_SIZE,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_hash_table_read_data(
+	          NULL,
+	          &next_hash_table_offset,
+	          msiecf_test_hash_table_data1,
+	          4096,
+	          LIBMSIECF_DEFAULT_BLOCK_SIZE,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_hash_table_read_data(
+	          hash_map,
+	          NULL,
+	          msiecf_test_hash_table_data1,
+	          4096,
+	          LIBMSIECF_DEFAULT_BLOCK_SIZE,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_hash_table_read_data(
+	          hash_map,
+	          &next_hash_table_offset,
+	          NULL,
+	          4096,
+	          LIBMSIECF_DEFAULT_BLOCK_SIZE,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_hash_table_read_data(
+	          hash_map,
+	          &next_hash_table_offset,
+	          msiecf_test_hash_table_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBMSIECF_DEFAULT_BLOCK_SIZE,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_hash_table_read_data(
+	          hash_map,
+	          &next_hash_table_offset,
+	          msiecf_test_hash_table_data1,
+	          0,
+	          LIBMSIECF_DEFAULT_BLOCK_SIZE,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_hash_table_read_data(
+	          hash_map,
+	          &next_hash_table_offset,
+	          msiecf_test_hash_table_data1,
+	          4096,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where data is too small for the HASH record
+	 */
+	result = libmsiecf_hash_table_read_data(
+	          hash_map,
+	          &next_hash_table_offset,
+	          msiecf_test_hash_table_data1,
+	          256,
+	          LIBMSIECF_DEFAULT_BLOCK_SIZE,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_hash_map_free(
+	          &hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "hash_map",
+	 hash_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_map != NULL )
+	{
+		libmsiecf_hash_map_free(
+		 &hash_map,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libmsiecf_hash_table_read_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
@@ -307,16 +537,15 @@ int msiecf_test_hash_table_read_file_io_handle(
      void )
 {
 	libbfio_handle_t *file_io_handle = NULL;
-	libcdata_array_t *hash_table     = NULL;
 	libcerror_error_t *error         = NULL;
+	libmsiecf_hash_map_t *hash_map   = NULL;
 	off64_t next_hash_table_offset   = 0;
 	int result                       = 0;
 
 	/* Initialize test
 	 */
-	result = libcdata_array_initialize(
-	          &hash_table,
-	          0,
+	result = libmsiecf_hash_map_initialize(
+	          &hash_map,
 	          &error );
 
 	MSIECF_TEST_ASSERT_EQUAL_INT(
@@ -325,8 +554,8 @@ int msiecf_test_hash_table_read_file_io_handle(
 	 1 );
 
 	MSIECF_TEST_ASSERT_IS_NOT_NULL(
-	 "hash_table",
-	 hash_table );
+	 "hash_map",
+	 hash_map );
 
 	MSIECF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -356,7 +585,7 @@ int msiecf_test_hash_table_read_file_io_handle(
 	/* Test regular cases
 	 */
 	result = libmsiecf_hash_table_read_file_io_handle(
-	          hash_table,
+	          hash_map,
 	          &next_hash_table_offset,
 	          file_io_handle,
 	          0,
@@ -395,7 +624,7 @@ int msiecf_test_hash_table_read_file_io_handle(
 	 &error );
 
 	result = libmsiecf_hash_table_read_file_io_handle(
-	          hash_table,
+	          hash_map,
 	          NULL,
 	          file_io_handle,
 	          0,
@@ -415,7 +644,7 @@ int msiecf_test_hash_table_read_file_io_handle(
 	 &error );
 
 	result = libmsiecf_hash_table_read_file_io_handle(
-	          hash_table,
+	          hash_map,
 	          &next_hash_table_offset,
 	          NULL,
 	          0,
@@ -435,7 +664,7 @@ int msiecf_test_hash_table_read_file_io_handle(
 	 &error );
 
 	result = libmsiecf_hash_table_read_file_io_handle(
-	          hash_table,
+	          hash_map,
 	          &next_hash_table_offset,
 	          file_io_handle,
 	          -1,
@@ -471,9 +700,8 @@ int msiecf_test_hash_table_read_file_io_handle(
 
 	/* Clean up
 	 */
-	result = libcdata_array_free(
-	          &hash_table,
-	          NULL,
+	result = libmsiecf_hash_map_free(
+	          &hash_map,
 	          &error );
 
 	MSIECF_TEST_ASSERT_EQUAL_INT(
@@ -482,8 +710,8 @@ int msiecf_test_hash_table_read_file_io_handle(
 	 1 );
 
 	MSIECF_TEST_ASSERT_IS_NULL(
-	 "hash_table",
-	 hash_table );
+	 "hash_map",
+	 hash_map );
 
 	MSIECF_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -503,11 +731,10 @@ on_error:
 		 &file_io_handle,
 		 NULL );
 	}
-	if( hash_table != NULL )
+	if( hash_map != NULL )
 	{
-		libcdata_array_free(
-		 &hash_table,
-		 NULL,
+		libmsiecf_hash_map_free(
+		 &hash_map,
 		 NULL );
 	}
 	return( 0 );
@@ -532,6 +759,10 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
 
+	MSIECF_TEST_RUN(
+	 "libmsiecf_hash_table_read_data",
+	 msiecf_test_hash_table_read_data );
+
 	MSIECF_TEST_RUN(
 	 "libmsiecf_hash_table_read_file_io_handle",
 	 msiecf_test_hash_table_read_file_io_handle );
@@ -0,0 +1,1389 @@
+/*
+ * Library index_file type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "msiecf_test_functions.h"
+#include "msiecf_test_libbfio.h"
+#include "msiecf_test_libcdata.h"
+#include "msiecf_test_libcerror.h"
+#include "msiecf_test_libmsiecf.h"
+#include "msiecf_test_macros.h"
+#include "msiecf_test_memory.h"
+#include "msiecf_test_unused.h"
+
+#include "../libmsiecf/libmsiecf_file_header.h"
+#include "../libmsiecf/libmsiecf_hash_map.h"
+#include "../libmsiecf/libmsiecf_index_file.h"
+#include "../libmsiecf/libmsiecf_item_descriptor.h"
+#include "../libmsiecf/libmsiecf_item_descriptor_arena.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* Tests the libmsiecf_index_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_index_file_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libmsiecf_index_file_t *index_file = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 1;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_index_file_initialize(
+	          &index_file,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "index_file",
+	 index_file );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_index_file_free(
+	          &index_file,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "index_file",
+	 index_file );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_index_file_initialize(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	index_file = (libmsiecf_index_file_t *) 0x12345678UL;
+
+	result = libmsiecf_index_file_initialize(
+	          &index_file,
+	          &error );
+
+	index_file = NULL;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_index_file_initialize with malloc failing
+		 */
+		msiecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libmsiecf_index_file_initialize(
+		          &index_file,
+		          &error );
+
+		if( msiecf_test_malloc_attempts_before_fail != -1 )
+		{
+			msiecf_test_malloc_attempts_before_fail = -1;
+
+			if( index_file != NULL )
+			{
+				libmsiecf_index_file_free(
+				 &index_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "index_file",
+			 index_file );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_index_file_initialize with memset failing
+		 */
+		msiecf_test_memset_attempts_before_fail = test_number;
+
+		result = libmsiecf_index_file_initialize(
+		          &index_file,
+		          &error );
+
+		if( msiecf_test_memset_attempts_before_fail != -1 )
+		{
+			msiecf_test_memset_attempts_before_fail = -1;
+
+			if( index_file != NULL )
+			{
+				libmsiecf_index_file_free(
+				 &index_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "index_file",
+			 index_file );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MSIECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_file != NULL )
+	{
+		libmsiecf_index_file_free(
+		 &index_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_index_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_index_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_index_file_free(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_index_file_set_key function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_index_file_set_key(
+     void )
+{
+	uint8_t file_data[ 0xc000 ];
+
+	libbfio_handle_t *file_io_handle     = NULL;
+	libcerror_error_t *error             = NULL;
+	libmsiecf_file_header_t *file_header = NULL;
+	libmsiecf_index_file_t *index_file   = NULL;
+	size_t file_data_index               = 0;
+	uint32_t key_checksum                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 * The file contains a hash table chain of 2 HASH records at offsets 0x4000 and 0x7000
+	 */
+	for( file_data_index = 0;
+	     file_data_index < 0xc000;
+	     file_data_index++ )
+	{
+		file_data[ file_data_index ] = (uint8_t) ( file_data_index * 7 );
+	}
+	if( memory_copy(
+	     &( file_data[ 0x4000 ] ),
+	     "HASH\x20\x00\x00\x00\x00\x70\x00\x00",
+	     12 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( file_data[ 0x7000 ] ),
+	     "HASH\x20\x00\x00\x00\x00\x00\x00\x00",
+	     12 ) == NULL )
+	{
+		goto on_error;
+	}
+	result = msiecf_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          0xc000,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_header_initialize(
+	          &file_header,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	file_header->major_version              = 5;
+	file_header->minor_version              = 2;
+	file_header->file_size                  = 0xc000;
+	file_header->hash_table_offset          = 0x4000;
+	file_header->number_of_blocks           = 0x0180;
+	file_header->number_of_allocated_blocks = 0x0040;
+
+	result = libmsiecf_index_file_initialize(
+	          &index_file,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_index_file_set_key(
+	          index_file,
+	          file_header,
+	          128,
+	          file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT64(
+	 "index_file->file_size",
+	 (uint64_t) index_file->file_size,
+	 (uint64_t) 0xc000 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "index_file->hash_table_offset",
+	 index_file->hash_table_offset,
+	 (uint32_t) 0x4000 );
+
+	key_checksum = index_file->key_checksum;
+
+	/* Test with a modified allocation table
+	 */
+	file_data[ 0x0260 ] ^= 0xff;
+
+	result = libmsiecf_index_file_set_key(
+	          index_file,
+	          file_header,
+	          128,
+	          file_io_handle,
+	          &error );
+
+	file_data[ 0x0260 ] ^= 0xff;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "index_file->key_checksum",
+	 (int64_t) index_file->key_checksum,
+	 (int64_t) key_checksum );
+
+	/* Test with a modified first HASH record
+	 */
+	file_data[ 0x4800 ] ^= 0xff;
+
+	result = libmsiecf_index_file_set_key(
+	          index_file,
+	          file_header,
+	          128,
+	          file_io_handle,
+	          &error );
+
+	file_data[ 0x4800 ] ^= 0xff;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "index_file->key_checksum",
+	 (int64_t) index_file->key_checksum,
+	 (int64_t) key_checksum );
+
+	/* Test with a modified second HASH record
+	 */
+	file_data[ 0x7800 ] ^= 0xff;
+
+	result = libmsiecf_index_file_set_key(
+	          index_file,
+	          file_header,
+	          128,
+	          file_io_handle,
+	          &error );
+
+	file_data[ 0x7800 ] ^= 0xff;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "index_file->key_checksum",
+	 (int64_t) index_file->key_checksum,
+	 (int64_t) key_checksum );
+
+	/* Test with a modified end of the file
+	 */
+	file_data[ 0xb000 ] ^= 0xff;
+
+	result = libmsiecf_index_file_set_key(
+	          index_file,
+	          file_header,
+	          128,
+	          file_io_handle,
+	          &error );
+
+	file_data[ 0xb000 ] ^= 0xff;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "index_file->key_checksum",
+	 (int64_t) index_file->key_checksum,
+	 (int64_t) key_checksum );
+
+	/* Test with modified record data in the middle of the file
+	 */
+	file_data[ 0x6000 ] ^= 0xff;
+
+	result = libmsiecf_index_file_set_key(
+	          index_file,
+	          file_header,
+	          128,
+	          file_io_handle,
+	          &error );
+
+	file_data[ 0x6000 ] ^= 0xff;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "index_file->key_checksum",
+	 (int64_t) index_file->key_checksum,
+	 (int64_t) key_checksum );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_index_file_set_key(
+	          NULL,
+	          file_header,
+	          128,
+	          file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_index_file_set_key(
+	          index_file,
+	          NULL,
+	          128,
+	          file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_index_file_free(
+	          &index_file,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "index_file",
+	 index_file );
+
+	result = libmsiecf_file_header_free(
+	          &file_header,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = msiecf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_file != NULL )
+	{
+		libmsiecf_index_file_free(
+		 &index_file,
+		 NULL );
+	}
+	if( file_header != NULL )
+	{
+		libmsiecf_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Appends an item descriptor to an array
+ * Returns 1 if successful or -1 on error
+ */
+int msiecf_test_index_file_append_item_descriptor(
+     libcdata_array_t *item_array,
+     libmsiecf_item_descriptor_arena_t *item_descriptor_arena,
+     off64_t file_offset,
+     uint32_t record_size,
+     uint8_t type,
+     libcerror_error_t **error )
+{
+	libmsiecf_item_descriptor_t *item_descriptor = NULL;
+	int entry_index                              = 0;
+
+	if( libmsiecf_item_descriptor_arena_allocate(
+	     item_descriptor_arena,
+	     &item_descriptor,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	item_descriptor->file_offset = file_offset;
+	item_descriptor->record_size = record_size;
+	item_descriptor->type        = type;
+
+	if( libcdata_array_append_entry(
+	     item_array,
+	     &entry_index,
+	     (intptr_t *) item_descriptor,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libmsiecf_index_file_write_file_io_handle and libmsiecf_index_file_read_file_io_handle functions
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_index_file_read_write_file_io_handle(
+     void )
+{
+	uint8_t key_data[ 1024 ];
+
+	libbfio_handle_t *file_io_handle                                 = NULL;
+	libbfio_handle_t *index_file_io_handle                           = NULL;
+	libcdata_array_t *item_array                                     = NULL;
+	libcdata_array_t *read_item_array                                = NULL;
+	libcdata_array_t *read_recovered_item_array                      = NULL;
+	libcdata_array_t *recovered_item_array                           = NULL;
+	libcerror_error_t *error                                         = NULL;
+	libmsiecf_file_header_t *file_header                             = NULL;
+	libmsiecf_hash_map_t *hash_map                                   = NULL;
+	libmsiecf_hash_map_t *read_hash_map                              = NULL;
+	libmsiecf_index_file_t *index_file                               = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor                     = NULL;
+	libmsiecf_item_descriptor_arena_t *item_descriptor_arena         = NULL;
+	libmsiecf_item_descriptor_arena_t *read_item_descriptor_arena    = NULL;
+	uint8_t *index_data                                              = NULL;
+	size_t index_data_size                                           = 0;
+	size_t key_data_index                                            = 0;
+	int number_of_entries                                            = 0;
+	int result                                                       = 0;
+
+	/* Initialize test
+	 */
+	for( key_data_index = 0;
+	     key_data_index < 1024;
+	     key_data_index++ )
+	{
+		key_data[ key_data_index ] = (uint8_t) ( key_data_index * 7 );
+	}
+	result = msiecf_test_open_file_io_handle(
+	          &file_io_handle,
+	          key_data,
+	          1024,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_file_header_initialize(
+	          &file_header,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	file_header->major_version              = 5;
+	file_header->minor_version              = 2;
+	file_header->file_size                  = 1024;
+	file_header->hash_table_offset          = 0x5000;
+	file_header->number_of_blocks           = 8;
+	file_header->number_of_allocated_blocks = 4;
+
+	result = libmsiecf_index_file_initialize(
+	          &index_file,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libmsiecf_index_file_set_key(
+	          index_file,
+	          file_header,
+	          128,
+	          file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT64(
+	 "index_file->file_size",
+	 (uint64_t) index_file->file_size,
+	 (uint64_t) 1024 );
+
+	result = libmsiecf_item_descriptor_arena_initialize(
+	          &item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_array_initialize(
+	          &item_array,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_array_initialize(
+	          &recovered_item_array,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = msiecf_test_index_file_append_item_descriptor(
+	          item_array,
+	          item_descriptor_arena,
+	          0x0080,
+	          0x0080,
+	          LIBMSIECF_ITEM_TYPE_URL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = msiecf_test_index_file_append_item_descriptor(
+	          item_array,
+	          item_descriptor_arena,
+	          0x0100,
+	          0x0100,
+	          LIBMSIECF_ITEM_TYPE_LEAK,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = msiecf_test_index_file_append_item_descriptor(
+	          recovered_item_array,
+	          item_descriptor_arena,
+	          0x0200,
+	          0x0080,
+	          LIBMSIECF_ITEM_TYPE_REDIRECTED,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libmsiecf_hash_map_initialize(
+	          &hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libmsiecf_hash_map_insert(
+	          hash_map,
+	          0x12345600UL,
+	          0x0080,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	index_data_size = 64 + ( 3 * 16 ) + ( hash_map->number_of_buckets * 8 );
+
+	index_data = (uint8_t *) memory_allocate(
+	                          index_data_size );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "index_data",
+	 index_data );
+
+	memory_set(
+	 index_data,
+	 0,
+	 index_data_size );
+
+	result = libbfio_memory_range_initialize(
+	          &index_file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_memory_range_set(
+	          index_file_io_handle,
+	          index_data,
+	          index_data_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libbfio_handle_open(
+	          index_file_io_handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_index_file_write_file_io_handle(
+	          index_file,
+	          index_file_io_handle,
+	          item_array,
+	          recovered_item_array,
+	          hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_descriptor_arena_initialize(
+	          &read_item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_array_initialize(
+	          &read_item_array,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_array_initialize(
+	          &read_recovered_item_array,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libmsiecf_hash_map_initialize(
+	          &read_hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libmsiecf_index_file_read_file_io_handle(
+	          index_file,
+	          index_file_io_handle,
+	          read_item_array,
+	          read_recovered_item_array,
+	          read_item_descriptor_arena,
+	          read_hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          read_item_array,
+	          &number_of_entries,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	result = libcdata_array_get_entry_by_index(
+	          read_item_array,
+	          1,
+	          (intptr_t **) &item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_descriptor",
+	 item_descriptor );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT64(
+	 "item_descriptor->file_offset",
+	 (int64_t) item_descriptor->file_offset,
+	 (int64_t) 0x0100 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "item_descriptor->record_size",
+	 item_descriptor->record_size,
+	 (uint32_t) 0x0100 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "item_descriptor->type",
+	 item_descriptor->type,
+	 (uint8_t) LIBMSIECF_ITEM_TYPE_LEAK );
+
+	result = libcdata_array_get_number_of_entries(
+	          read_recovered_item_array,
+	          &number_of_entries,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "read_hash_map->number_of_entries",
+	 read_hash_map->number_of_entries,
+	 hash_map->number_of_entries );
+
+	result = memory_compare(
+	          read_hash_map->buckets,
+	          hash_map->buckets,
+	          sizeof( uint32_t ) * 2 * hash_map->number_of_buckets );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libcdata_array_empty(
+	          read_item_array,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libcdata_array_empty(
+	          read_recovered_item_array,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	read_hash_map->number_of_entries = 0;
+
+	/* Test with a key that no longer matches the file
+	 */
+	index_file->key_checksum ^= 1;
+
+	result = libmsiecf_index_file_read_file_io_handle(
+	          index_file,
+	          index_file_io_handle,
+	          read_item_array,
+	          read_recovered_item_array,
+	          read_item_descriptor_arena,
+	          read_hash_map,
+	          &error );
+
+	index_file->key_checksum ^= 1;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with corrupted index data
+	 */
+	index_data[ 64 ] ^= 0xff;
+
+	result = libmsiecf_index_file_read_file_io_handle(
+	          index_file,
+	          index_file_io_handle,
+	          read_item_array,
+	          read_recovered_item_array,
+	          read_item_descriptor_arena,
+	          read_hash_map,
+	          &error );
+
+	index_data[ 64 ] ^= 0xff;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          read_item_array,
+	          &number_of_entries,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_index_file_read_file_io_handle(
+	          NULL,
+	          index_file_io_handle,
+	          read_item_array,
+	          read_recovered_item_array,
+	          read_item_descriptor_arena,
+	          read_hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_index_file_write_file_io_handle(
+	          NULL,
+	          index_file_io_handle,
+	          item_array,
+	          recovered_item_array,
+	          hash_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_close(
+	          index_file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libbfio_handle_free(
+	          &index_file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	memory_free(
+	 index_data );
+
+	index_data = NULL;
+
+	libmsiecf_hash_map_free(
+	 &read_hash_map,
+	 NULL );
+	libcdata_array_free(
+	 &read_recovered_item_array,
+	 NULL,
+	 NULL );
+	libcdata_array_free(
+	 &read_item_array,
+	 NULL,
+	 NULL );
+	libmsiecf_item_descriptor_arena_free(
+	 &read_item_descriptor_arena,
+	 NULL );
+	libmsiecf_hash_map_free(
+	 &hash_map,
+	 NULL );
+	libcdata_array_free(
+	 &recovered_item_array,
+	 NULL,
+	 NULL );
+	libcdata_array_free(
+	 &item_array,
+	 NULL,
+	 NULL );
+	libmsiecf_item_descriptor_arena_free(
+	 &item_descriptor_arena,
+	 NULL );
+	libmsiecf_index_file_free(
+	 &index_file,
+	 NULL );
+	libmsiecf_file_header_free(
+	 &file_header,
+	 NULL );
+
+	result = msiecf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	if( index_data != NULL )
+	{
+		memory_free(
+		 index_data );
+	}
+	if( read_hash_map != NULL )
+	{
+		libmsiecf_hash_map_free(
+		 &read_hash_map,
+		 NULL );
+	}
+	if( read_recovered_item_array != NULL )
+	{
+		libcdata_array_free(
+		 &read_recovered_item_array,
+		 NULL,
+		 NULL );
+	}
+	if( read_item_array != NULL )
+	{
+		libcdata_array_free(
+		 &read_item_array,
+		 NULL,
+		 NULL );
+	}
+	if( read_item_descriptor_arena != NULL )
+	{
+		libmsiecf_item_descriptor_arena_free(
+		 &read_item_descriptor_arena,
+		 NULL );
+	}
+	if( hash_map != NULL )
+	{
+		libmsiecf_hash_map_free(
+		 &hash_map,
+		 NULL );
+	}
+	if( recovered_item_array != NULL )
+	{
+		libcdata_array_free(
+		 &recovered_item_array,
+		 NULL,
+		 NULL );
+	}
+	if( item_array != NULL )
+	{
+		libcdata_array_free(
+		 &item_array,
+		 NULL,
+		 NULL );
+	}
+	if( item_descriptor_arena != NULL )
+	{
+		libmsiecf_item_descriptor_arena_free(
+		 &item_descriptor_arena,
+		 NULL );
+	}
+	if( index_file != NULL )
+	{
+		libmsiecf_index_file_free(
+		 &index_file,
+		 NULL );
+	}
+	if( file_header != NULL )
+	{
+		libmsiecf_file_header_free(
+		 &file_header,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argc )
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_index_file_initialize",
+	 msiecf_test_index_file_initialize );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_index_file_free",
+	 msiecf_test_index_file_free );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_index_file_set_key",
+	 msiecf_test_index_file_set_key );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_index_file_read_write_file_io_handle",
+	 msiecf_test_index_file_read_write_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,19 +21,27 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "msiecf_test_functions.h"
+#include "msiecf_test_libbfio.h"
+#include "msiecf_test_libcdata.h"
 #include "msiecf_test_libcerror.h"
 #include "msiecf_test_libmsiecf.h"
 #include "msiecf_test_macros.h"
 #include "msiecf_test_memory.h"
 #include "msiecf_test_unused.h"
 
+#include "../libmsiecf/libmsiecf_allocation_map.h"
 #include "../libmsiecf/libmsiecf_io_handle.h"
+#include "../libmsiecf/libmsiecf_item_descriptor.h"
+#include "../libmsiecf/libmsiecf_item_descriptor_arena.h"
+#include "../libmsiecf/libmsiecf_record_scan_chunk.h"
 
 #if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
 
@@ -398,6 +406,1107 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libmsiecf_io_handle_read_file_data and libmsiecf_io_handle_free_file_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_io_handle_read_file_data(
+     void )
+{
+	uint8_t file_data[ 256 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libmsiecf_io_handle_t *io_handle = NULL;
+	const uint8_t *data              = NULL;
+	size_t data_index                = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	for( data_index = 0;
+	     data_index < 256;
+	     data_index++ )
+	{
+		file_data[ data_index ] = (uint8_t) data_index;
+	}
+	result = libmsiecf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = msiecf_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          256,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_io_handle_read_file_data(
+	          io_handle,
+	          file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->file_data_size",
+	 io_handle->file_data_size,
+	 (size_t) 256 );
+
+	result = libmsiecf_io_handle_get_file_data(
+	          io_handle,
+	          128,
+	          128,
+	          &data,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          &( file_data[ 128 ] ),
+	          128 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test data beyond the end of the file data
+	 */
+	data = NULL;
+
+	result = libmsiecf_io_handle_get_file_data(
+	          io_handle,
+	          128,
+	          129,
+	          &data,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "data",
+	 data );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_io_handle_read_file_data(
+	          io_handle,
+	          file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_io_handle_free_file_data(
+	          io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "io_handle->file_data",
+	 io_handle->file_data );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "io_handle->file_data_size",
+	 io_handle->file_data_size,
+	 (size_t) 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_io_handle_read_file_data(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_io_handle_read_file_data(
+	          io_handle,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_io_handle_free_file_data(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = msiecf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libmsiecf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_io_handle_get_file_data function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_io_handle_get_file_data(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libmsiecf_io_handle_t *io_handle = NULL;
+	const uint8_t *data              = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_io_handle_get_file_data(
+	          io_handle,
+	          0,
+	          16,
+	          &data,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "data",
+	 data );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_io_handle_get_file_data(
+	          NULL,
+	          0,
+	          16,
+	          &data,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_io_handle_get_file_data(
+	          io_handle,
+	          -1,
+	          16,
+	          &data,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_io_handle_get_file_data(
+	          io_handle,
+	          0,
+	          16,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libmsiecf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_io_handle_read_record_scan_chunk function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_io_handle_read_record_scan_chunk(
+     void )
+{
+	uint8_t file_data[ 1024 ];
+
+	libbfio_handle_t *file_io_handle                         = NULL;
+	libcdata_array_t *item_table                             = NULL;
+	libcdata_array_t *recovered_item_table                   = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libmsiecf_allocation_map_t *allocation_map               = NULL;
+	libmsiecf_io_handle_t *io_handle                         = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor             = NULL;
+	libmsiecf_item_descriptor_arena_t *item_descriptor_arena = NULL;
+	libmsiecf_record_scan_chunk_t *record_scan_chunk         = NULL;
+	int number_of_entries                                    = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 * The file contains a URL record of 2 blocks, a LEAK record of 3 blocks
+	 * that crosses the chunk boundary at offset 512, a REDR record of 1 block
+	 * and a HASH record of 2 blocks
+	 */
+	if( memory_set(
+	     file_data,
+	     0,
+	     1024 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( file_data[ 0 ] ),
+	     "URL ",
+	     4 ) == NULL )
+	{
+		goto on_error;
+	}
+	file_data[ 4 ] = 2;
+
+	if( memory_copy(
+	     &( file_data[ 256 ] ),
+	     "LEAK",
+	     4 ) == NULL )
+	{
+		goto on_error;
+	}
+	file_data[ 260 ] = 3;
+
+	if( memory_copy(
+	     &( file_data[ 640 ] ),
+	     "REDR",
+	     4 ) == NULL )
+	{
+		goto on_error;
+	}
+	file_data[ 644 ] = 1;
+
+	if( memory_copy(
+	     &( file_data[ 768 ] ),
+	     "HASH",
+	     4 ) == NULL )
+	{
+		goto on_error;
+	}
+	file_data[ 772 ] = 2;
+
+	result = libmsiecf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->file_size = 1024;
+
+	result = msiecf_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          1024,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An allocation map without data marks all blocks as allocated
+	 */
+	result = libmsiecf_allocation_map_initialize(
+	          &allocation_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "allocation_map",
+	 allocation_map );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_descriptor_arena_initialize(
+	          &item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_descriptor_arena",
+	 item_descriptor_arena );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &item_table,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_table",
+	 item_table );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &recovered_item_table,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "recovered_item_table",
+	 recovered_item_table );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_record_scan_chunk_initialize(
+	          &record_scan_chunk,
+	          0,
+	          512,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_scan_chunk",
+	 record_scan_chunk );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_io_handle_read_record_scan_chunk(
+	          io_handle,
+	          file_io_handle,
+	          allocation_map,
+	          record_scan_chunk,
+	          item_table,
+	          recovered_item_table,
+	          item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The scan stops after the LEAK record that crosses the chunk boundary
+	 */
+	MSIECF_TEST_ASSERT_EQUAL_INT64(
+	 "record_scan_chunk->file_offset",
+	 (int64_t) record_scan_chunk->file_offset,
+	 (int64_t) 640 );
+
+	result = libcdata_array_get_number_of_entries(
+	          item_table,
+	          &number_of_entries,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 2 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test continuing the scan in the next chunk
+	 */
+	record_scan_chunk->end_offset = 1024;
+
+	result = libmsiecf_io_handle_read_record_scan_chunk(
+	          io_handle,
+	          file_io_handle,
+	          allocation_map,
+	          record_scan_chunk,
+	          item_table,
+	          recovered_item_table,
+	          item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT64(
+	 "record_scan_chunk->file_offset",
+	 (int64_t) record_scan_chunk->file_offset,
+	 (int64_t) 1024 );
+
+	result = libcdata_array_get_number_of_entries(
+	          item_table,
+	          &number_of_entries,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 3 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_entry_by_index(
+	          item_table,
+	          1,
+	          (intptr_t **) &item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_descriptor",
+	 item_descriptor );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "item_descriptor->type",
+	 item_descriptor->type,
+	 (uint8_t) LIBMSIECF_ITEM_TYPE_LEAK );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT64(
+	 "item_descriptor->file_offset",
+	 (int64_t) item_descriptor->file_offset,
+	 (int64_t) 256 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "item_descriptor->record_size",
+	 (uint32_t) item_descriptor->record_size,
+	 (uint32_t) 384 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "item_descriptor->flags",
+	 item_descriptor->flags,
+	 (uint8_t) 0 );
+
+	result = libcdata_array_get_entry_by_index(
+	          item_table,
+	          2,
+	          (intptr_t **) &item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_descriptor",
+	 item_descriptor );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "item_descriptor->type",
+	 item_descriptor->type,
+	 (uint8_t) LIBMSIECF_ITEM_TYPE_REDIRECTED );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT64(
+	 "item_descriptor->file_offset",
+	 (int64_t) item_descriptor->file_offset,
+	 (int64_t) 640 );
+
+	result = libcdata_array_get_number_of_entries(
+	          recovered_item_table,
+	          &number_of_entries,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_io_handle_read_record_scan_chunk(
+	          NULL,
+	          file_io_handle,
+	          allocation_map,
+	          record_scan_chunk,
+	          item_table,
+	          recovered_item_table,
+	          item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_io_handle_read_record_scan_chunk(
+	          io_handle,
+	          file_io_handle,
+	          allocation_map,
+	          NULL,
+	          item_table,
+	          recovered_item_table,
+	          item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_io_handle_read_record_scan_chunk(
+	          io_handle,
+	          file_io_handle,
+	          allocation_map,
+	          record_scan_chunk,
+	          NULL,
+	          recovered_item_table,
+	          item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_io_handle_read_record_scan_chunk(
+	          io_handle,
+	          file_io_handle,
+	          allocation_map,
+	          record_scan_chunk,
+	          item_table,
+	          NULL,
+	          item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_io_handle_read_record_scan_chunk(
+	          io_handle,
+	          file_io_handle,
+	          allocation_map,
+	          record_scan_chunk,
+	          item_table,
+	          recovered_item_table,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_scan_chunk->end_offset = 2048;
+
+	result = libmsiecf_io_handle_read_record_scan_chunk(
+	          io_handle,
+	          file_io_handle,
+	          allocation_map,
+	          record_scan_chunk,
+	          item_table,
+	          recovered_item_table,
+	          item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_record_scan_chunk_free(
+	          &record_scan_chunk,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "record_scan_chunk",
+	 record_scan_chunk );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The item descriptors are owned by the arena
+	 */
+	result = libcdata_array_free(
+	          &recovered_item_table,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &item_table,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_descriptor_arena_free(
+	          &item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_allocation_map_free(
+	          &allocation_map,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = msiecf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_scan_chunk != NULL )
+	{
+		libmsiecf_record_scan_chunk_free(
+		 &record_scan_chunk,
+		 NULL );
+	}
+	if( recovered_item_table != NULL )
+	{
+		libcdata_array_free(
+		 &recovered_item_table,
+		 NULL,
+		 NULL );
+	}
+	if( item_table != NULL )
+	{
+		libcdata_array_free(
+		 &item_table,
+		 NULL,
+		 NULL );
+	}
+	if( item_descriptor_arena != NULL )
+	{
+		libmsiecf_item_descriptor_arena_free(
+		 &item_descriptor_arena,
+		 NULL );
+	}
+	if( allocation_map != NULL )
+	{
+		libmsiecf_allocation_map_free(
+		 &allocation_map,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libmsiecf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
 
 /* The main program
@@ -429,8 +1538,20 @@ int main(
 	 "libmsiecf_io_handle_clear",
 	 msiecf_test_io_handle_clear );
 
+	MSIECF_TEST_RUN(
+	 "libmsiecf_io_handle_read_file_data",
+	 msiecf_test_io_handle_read_file_data );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_io_handle_get_file_data",
+	 msiecf_test_io_handle_get_file_data );
+
 	/* TODO: add tests for libmsiecf_io_handle_read_hash_table */
 
+	MSIECF_TEST_RUN(
+	 "libmsiecf_io_handle_read_record_scan_chunk",
+	 msiecf_test_io_handle_read_record_scan_chunk );
+
 	/* TODO: add tests for libmsiecf_io_handle_read_record_scan */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
@@ -0,0 +1,1046 @@
+/*
+ * Library item_cache type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "msiecf_test_libcerror.h"
+#include "msiecf_test_libmsiecf.h"
+#include "msiecf_test_macros.h"
+#include "msiecf_test_memory.h"
+#include "msiecf_test_unused.h"
+
+#include "../libmsiecf/libmsiecf_item_cache.h"
+#include "../libmsiecf/libmsiecf_item_descriptor.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+typedef struct msiecf_test_item_cache_value msiecf_test_item_cache_value_t;
+
+struct msiecf_test_item_cache_value
+{
+	/* The data
+	 */
+	uint32_t data;
+
+	/* The reference count
+	 */
+	int32_t reference_count;
+};
+
+/* Creates a test value
+ * Returns 1 if successful or -1 on error
+ */
+int msiecf_test_item_cache_value_initialize(
+     msiecf_test_item_cache_value_t **value,
+     uint32_t data )
+{
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	*value = memory_allocate_structure(
+	          msiecf_test_item_cache_value_t );
+
+	if( *value == NULL )
+	{
+		return( -1 );
+	}
+	( *value )->data            = data;
+	( *value )->reference_count = 1;
+
+	return( 1 );
+}
+
+/* Frees a test value
+ * The value is freed when the last reference is released
+ * Returns 1 if successful or -1 on error
+ */
+int msiecf_test_item_cache_value_free(
+     msiecf_test_item_cache_value_t **value,
+     libcerror_error_t **error MSIECF_TEST_ATTRIBUTE_UNUSED )
+{
+	MSIECF_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	if( *value != NULL )
+	{
+		( *value )->reference_count -= 1;
+
+		if( ( *value )->reference_count == 0 )
+		{
+			memory_free(
+			 *value );
+		}
+		*value = NULL;
+	}
+	return( 1 );
+}
+
+/* References a test value
+ * Returns 1 if successful or -1 on error
+ */
+int msiecf_test_item_cache_value_reference(
+     msiecf_test_item_cache_value_t *value,
+     libcerror_error_t **error MSIECF_TEST_ATTRIBUTE_UNUSED )
+{
+	MSIECF_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( value == NULL )
+	{
+		return( -1 );
+	}
+	value->reference_count += 1;
+
+	return( 1 );
+}
+
+/* Tests the libmsiecf_item_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_item_cache_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libmsiecf_item_cache_t *item_cache = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 2;
+	int number_of_memset_fail_tests    = 2;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_item_cache_initialize(
+	          &item_cache,
+	          1024,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_cache",
+	 item_cache );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_cache_free(
+	          &item_cache,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "item_cache",
+	 item_cache );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_item_cache_initialize(
+	          NULL,
+	          1024,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	item_cache = (libmsiecf_item_cache_t *) 0x12345678UL;
+
+	result = libmsiecf_item_cache_initialize(
+	          &item_cache,
+	          1024,
+	          &error );
+
+	item_cache = NULL;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_item_cache_initialize with malloc failing
+		 */
+		msiecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libmsiecf_item_cache_initialize(
+		          &item_cache,
+		          1024,
+		          &error );
+
+		if( msiecf_test_malloc_attempts_before_fail != -1 )
+		{
+			msiecf_test_malloc_attempts_before_fail = -1;
+
+			if( item_cache != NULL )
+			{
+				libmsiecf_item_cache_free(
+				 &item_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "item_cache",
+			 item_cache );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_item_cache_initialize with memset failing
+		 */
+		msiecf_test_memset_attempts_before_fail = test_number;
+
+		result = libmsiecf_item_cache_initialize(
+		          &item_cache,
+		          1024,
+		          &error );
+
+		if( msiecf_test_memset_attempts_before_fail != -1 )
+		{
+			msiecf_test_memset_attempts_before_fail = -1;
+
+			if( item_cache != NULL )
+			{
+				libmsiecf_item_cache_free(
+				 &item_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "item_cache",
+			 item_cache );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MSIECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_cache != NULL )
+	{
+		libmsiecf_item_cache_free(
+		 &item_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_item_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_item_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_item_cache_free(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_item_cache_get_maximum_size and libmsiecf_item_cache_set_maximum_size functions
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_item_cache_maximum_size(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libmsiecf_item_cache_t *item_cache = NULL;
+	size_t maximum_size                = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_item_cache_initialize(
+	          &item_cache,
+	          1024,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_cache",
+	 item_cache );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_item_cache_get_maximum_size(
+	          item_cache,
+	          &maximum_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_size",
+	 maximum_size,
+	 (size_t) 1024 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_cache_set_maximum_size(
+	          item_cache,
+	          2048,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_cache_get_maximum_size(
+	          item_cache,
+	          &maximum_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "maximum_size",
+	 maximum_size,
+	 (size_t) 2048 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_item_cache_get_maximum_size(
+	          NULL,
+	          &maximum_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_item_cache_get_maximum_size(
+	          item_cache,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_item_cache_set_maximum_size(
+	          NULL,
+	          2048,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_item_cache_free(
+	          &item_cache,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "item_cache",
+	 item_cache );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_cache != NULL )
+	{
+		libmsiecf_item_cache_free(
+		 &item_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_item_cache_get_value and libmsiecf_item_cache_set_value functions
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_item_cache_value(
+     void )
+{
+	libmsiecf_item_descriptor_t item_descriptors[ 3 ];
+
+	libcerror_error_t *error                   = NULL;
+	libmsiecf_item_cache_t *item_cache         = NULL;
+	msiecf_test_item_cache_value_t *test_value = NULL;
+	msiecf_test_item_cache_value_t *value      = NULL;
+	msiecf_test_item_cache_value_t *value2     = NULL;
+	int descriptor_index                       = 0;
+	int result                                 = 0;
+
+	int (*free_value)(
+	       intptr_t **value,
+	       libcerror_error_t **error ) = NULL;
+
+	/* Initialize test
+	 */
+	for( descriptor_index = 0;
+	     descriptor_index < 3;
+	     descriptor_index++ )
+	{
+		item_descriptors[ descriptor_index ].type        = LIBMSIECF_ITEM_TYPE_URL;
+		item_descriptors[ descriptor_index ].file_offset = (off64_t) 0x5000 + ( descriptor_index * 0x80 );
+		item_descriptors[ descriptor_index ].record_size = 0x80;
+		item_descriptors[ descriptor_index ].flags       = 0;
+	}
+	result = libmsiecf_item_cache_initialize(
+	          &item_cache,
+	          10,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_cache",
+	 item_cache );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_item_cache_get_value(
+	          item_cache,
+	          &( item_descriptors[ 0 ] ),
+	          (intptr_t **) &value,
+	          &free_value,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( descriptor_index = 0;
+	     descriptor_index < 3;
+	     descriptor_index++ )
+	{
+		result = msiecf_test_item_cache_value_initialize(
+		          &test_value,
+		          0x1000 + descriptor_index );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = libmsiecf_item_cache_set_value(
+		          item_cache,
+		          &( item_descriptors[ descriptor_index ] ),
+		          (intptr_t *) test_value,
+		          (int (*)(intptr_t **, libcerror_error_t **)) &msiecf_test_item_cache_value_free,
+		          (int (*)(intptr_t *, libcerror_error_t **)) &msiecf_test_item_cache_value_reference,
+		          4,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The cache references the value instead of copying it
+		 */
+		MSIECF_TEST_ASSERT_EQUAL_INT32(
+		 "test_value->reference_count",
+		 test_value->reference_count,
+		 (int32_t) 2 );
+
+		msiecf_test_item_cache_value_free(
+		 &test_value,
+		 NULL );
+	}
+	/* The least recently used value was removed to stay within the maximum size
+	 */
+	result = libmsiecf_item_cache_get_value(
+	          item_cache,
+	          &( item_descriptors[ 0 ] ),
+	          (intptr_t **) &value,
+	          &free_value,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_cache_get_value(
+	          item_cache,
+	          &( item_descriptors[ 1 ] ),
+	          (intptr_t **) &value,
+	          &free_value,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "value",
+	 value );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "value->data",
+	 value->data,
+	 (uint32_t) 0x1001 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT32(
+	 "value->reference_count",
+	 value->reference_count,
+	 (int32_t) 2 );
+
+	/* A cache hit shares the cached value
+	 */
+	result = libmsiecf_item_cache_get_value(
+	          item_cache,
+	          &( item_descriptors[ 1 ] ),
+	          (intptr_t **) &value2,
+	          &free_value,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "value2",
+	 ( value2 == value ),
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT32(
+	 "value->reference_count",
+	 value->reference_count,
+	 (int32_t) 3 );
+
+	result = free_value(
+	          (intptr_t **) &value2,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A value that is removed from the cache remains valid while referenced
+	 */
+	result = libmsiecf_item_cache_empty(
+	          item_cache,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT32(
+	 "value->reference_count",
+	 value->reference_count,
+	 (int32_t) 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "value->data",
+	 value->data,
+	 (uint32_t) 0x1001 );
+
+	result = free_value(
+	          (intptr_t **) &value,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_cache_get_value(
+	          item_cache,
+	          &( item_descriptors[ 2 ] ),
+	          (intptr_t **) &value,
+	          &free_value,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Values that exceed the maximum size are not cached
+	 */
+	result = msiecf_test_item_cache_value_initialize(
+	          &test_value,
+	          0x1000 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libmsiecf_item_cache_set_value(
+	          item_cache,
+	          &( item_descriptors[ 0 ] ),
+	          (intptr_t *) test_value,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &msiecf_test_item_cache_value_free,
+	          (int (*)(intptr_t *, libcerror_error_t **)) &msiecf_test_item_cache_value_reference,
+	          11,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT32(
+	 "test_value->reference_count",
+	 test_value->reference_count,
+	 (int32_t) 1 );
+
+	result = libmsiecf_item_cache_get_value(
+	          item_cache,
+	          &( item_descriptors[ 0 ] ),
+	          (intptr_t **) &value,
+	          &free_value,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_item_cache_get_value(
+	          NULL,
+	          &( item_descriptors[ 0 ] ),
+	          (intptr_t **) &value,
+	          &free_value,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_item_cache_get_value(
+	          item_cache,
+	          NULL,
+	          (intptr_t **) &value,
+	          &free_value,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_item_cache_set_value(
+	          NULL,
+	          &( item_descriptors[ 0 ] ),
+	          (intptr_t *) test_value,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &msiecf_test_item_cache_value_free,
+	          (int (*)(intptr_t *, libcerror_error_t **)) &msiecf_test_item_cache_value_reference,
+	          4,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_item_cache_set_value(
+	          item_cache,
+	          &( item_descriptors[ 0 ] ),
+	          NULL,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &msiecf_test_item_cache_value_free,
+	          (int (*)(intptr_t *, libcerror_error_t **)) &msiecf_test_item_cache_value_reference,
+	          4,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_item_cache_set_value(
+	          item_cache,
+	          &( item_descriptors[ 0 ] ),
+	          (intptr_t *) test_value,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &msiecf_test_item_cache_value_free,
+	          NULL,
+	          4,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	msiecf_test_item_cache_value_free(
+	 &test_value,
+	 NULL );
+
+	result = libmsiecf_item_cache_free(
+	          &item_cache,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "item_cache",
+	 item_cache );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value2 != NULL )
+	{
+		msiecf_test_item_cache_value_free(
+		 &value2,
+		 NULL );
+	}
+	if( value != NULL )
+	{
+		msiecf_test_item_cache_value_free(
+		 &value,
+		 NULL );
+	}
+	if( test_value != NULL )
+	{
+		msiecf_test_item_cache_value_free(
+		 &test_value,
+		 NULL );
+	}
+	if( item_cache != NULL )
+	{
+		libmsiecf_item_cache_free(
+		 &item_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argc )
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_item_cache_initialize",
+	 msiecf_test_item_cache_initialize );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_item_cache_free",
+	 msiecf_test_item_cache_free );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_item_cache_get_maximum_size",
+	 msiecf_test_item_cache_maximum_size );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_item_cache_set_value",
+	 msiecf_test_item_cache_value );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
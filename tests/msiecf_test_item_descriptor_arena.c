@@ -0,0 +1,930 @@
+/*
+ * Library item_descriptor_arena type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "msiecf_test_libcerror.h"
+#include "msiecf_test_libmsiecf.h"
+#include "msiecf_test_macros.h"
+#include "msiecf_test_memory.h"
+#include "msiecf_test_unused.h"
+
+#include "../libmsiecf/libmsiecf_definitions.h"
+#include "../libmsiecf/libmsiecf_item_descriptor.h"
+#include "../libmsiecf/libmsiecf_item_descriptor_arena.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* Tests the libmsiecf_item_descriptor_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_item_descriptor_arena_initialize(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	libmsiecf_item_descriptor_arena_t *item_descriptor_arena = NULL;
+	int result                                               = 0;
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests                          = 1;
+	int number_of_memset_fail_tests                          = 1;
+	int test_number                                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_item_descriptor_arena_initialize(
+	          &item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_descriptor_arena",
+	 item_descriptor_arena );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_descriptor_arena_free(
+	          &item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "item_descriptor_arena",
+	 item_descriptor_arena );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_item_descriptor_arena_initialize(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	item_descriptor_arena = (libmsiecf_item_descriptor_arena_t *) 0x12345678UL;
+
+	result = libmsiecf_item_descriptor_arena_initialize(
+	          &item_descriptor_arena,
+	          &error );
+
+	item_descriptor_arena = NULL;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_item_descriptor_arena_initialize with malloc failing
+		 */
+		msiecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libmsiecf_item_descriptor_arena_initialize(
+		          &item_descriptor_arena,
+		          &error );
+
+		if( msiecf_test_malloc_attempts_before_fail != -1 )
+		{
+			msiecf_test_malloc_attempts_before_fail = -1;
+
+			if( item_descriptor_arena != NULL )
+			{
+				libmsiecf_item_descriptor_arena_free(
+				 &item_descriptor_arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "item_descriptor_arena",
+			 item_descriptor_arena );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_item_descriptor_arena_initialize with memset failing
+		 */
+		msiecf_test_memset_attempts_before_fail = test_number;
+
+		result = libmsiecf_item_descriptor_arena_initialize(
+		          &item_descriptor_arena,
+		          &error );
+
+		if( msiecf_test_memset_attempts_before_fail != -1 )
+		{
+			msiecf_test_memset_attempts_before_fail = -1;
+
+			if( item_descriptor_arena != NULL )
+			{
+				libmsiecf_item_descriptor_arena_free(
+				 &item_descriptor_arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "item_descriptor_arena",
+			 item_descriptor_arena );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MSIECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_descriptor_arena != NULL )
+	{
+		libmsiecf_item_descriptor_arena_free(
+		 &item_descriptor_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_item_descriptor_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_item_descriptor_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_item_descriptor_arena_free(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_item_descriptor_arena_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_item_descriptor_arena_empty(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	libmsiecf_item_descriptor_arena_t *item_descriptor_arena = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor             = NULL;
+	int descriptor_index                                     = 0;
+	int number_of_item_descriptors                           = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_item_descriptor_arena_initialize(
+	          &item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_descriptor_arena",
+	 item_descriptor_arena );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Allocate enough item descriptors to require multiple slabs
+	 */
+	for( descriptor_index = 0;
+	     descriptor_index < 2 * LIBMSIECF_ITEM_DESCRIPTOR_ARENA_MINIMUM_SLAB_SIZE;
+	     descriptor_index++ )
+	{
+		item_descriptor = NULL;
+
+		result = libmsiecf_item_descriptor_arena_allocate(
+		          item_descriptor_arena,
+		          &item_descriptor,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libmsiecf_item_descriptor_arena_empty(
+	          item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "item_descriptor_arena->first_slab",
+	 item_descriptor_arena->first_slab );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "item_descriptor_arena->last_slab",
+	 item_descriptor_arena->last_slab );
+
+	result = libmsiecf_item_descriptor_arena_get_number_of_item_descriptors(
+	          item_descriptor_arena,
+	          &number_of_item_descriptors,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_item_descriptors",
+	 number_of_item_descriptors,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if an empty arena can be emptied again
+	 */
+	result = libmsiecf_item_descriptor_arena_empty(
+	          item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the arena can be reused after being emptied
+	 */
+	item_descriptor = NULL;
+
+	result = libmsiecf_item_descriptor_arena_allocate(
+	          item_descriptor_arena,
+	          &item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_descriptor",
+	 item_descriptor );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT64(
+	 "item_descriptor->file_offset",
+	 (int64_t) item_descriptor->file_offset,
+	 (int64_t) 0 );
+
+	result = libmsiecf_item_descriptor_arena_get_number_of_item_descriptors(
+	          item_descriptor_arena,
+	          &number_of_item_descriptors,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_item_descriptors",
+	 number_of_item_descriptors,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_item_descriptor_arena_empty(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_item_descriptor_arena_free(
+	          &item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "item_descriptor_arena",
+	 item_descriptor_arena );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_descriptor_arena != NULL )
+	{
+		libmsiecf_item_descriptor_arena_free(
+		 &item_descriptor_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_item_descriptor_arena_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_item_descriptor_arena_allocate(
+     void )
+{
+	libcerror_error_t *error                                 = NULL;
+	libmsiecf_item_descriptor_arena_t *item_descriptor_arena = NULL;
+	libmsiecf_item_descriptor_t *first_item_descriptor       = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor             = NULL;
+	int descriptor_index                                     = 0;
+	int number_of_item_descriptors                           = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_item_descriptor_arena_initialize(
+	          &item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_descriptor_arena",
+	 item_descriptor_arena );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_item_descriptor_arena_allocate(
+	          item_descriptor_arena,
+	          &first_item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "first_item_descriptor",
+	 first_item_descriptor );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	first_item_descriptor->file_offset = 0x5000;
+
+	/* Test if previously allocated item descriptors retain their address
+	 * when additional slabs are allocated
+	 */
+	for( descriptor_index = 1;
+	     descriptor_index < 2048;
+	     descriptor_index++ )
+	{
+		item_descriptor = NULL;
+
+		result = libmsiecf_item_descriptor_arena_allocate(
+		          item_descriptor_arena,
+		          &item_descriptor,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NOT_NULL(
+		 "item_descriptor",
+		 item_descriptor );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT64(
+		 "item_descriptor->file_offset",
+		 (int64_t) item_descriptor->file_offset,
+		 (int64_t) 0 );
+
+		item_descriptor->file_offset = (off64_t) 0x5000 + ( descriptor_index * 0x80 );
+	}
+	MSIECF_TEST_ASSERT_EQUAL_INT64(
+	 "first_item_descriptor->file_offset",
+	 (int64_t) first_item_descriptor->file_offset,
+	 (int64_t) 0x5000 );
+
+	result = libmsiecf_item_descriptor_arena_get_number_of_item_descriptors(
+	          item_descriptor_arena,
+	          &number_of_item_descriptors,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_item_descriptors",
+	 number_of_item_descriptors,
+	 2048 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_item_descriptor_arena_allocate(
+	          NULL,
+	          &item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_item_descriptor_arena_allocate(
+	          item_descriptor_arena,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_item_descriptor_arena_free(
+	          &item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "item_descriptor_arena",
+	 item_descriptor_arena );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_descriptor_arena != NULL )
+	{
+		libmsiecf_item_descriptor_arena_free(
+		 &item_descriptor_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_item_descriptor_arena_move function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_item_descriptor_arena_move(
+     void )
+{
+	libcerror_error_t *error                                             = NULL;
+	libmsiecf_item_descriptor_arena_t *destination_item_descriptor_arena = NULL;
+	libmsiecf_item_descriptor_arena_t *source_item_descriptor_arena      = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor                         = NULL;
+	int number_of_item_descriptors                                       = 0;
+	int result                                                           = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_item_descriptor_arena_initialize(
+	          &destination_item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_descriptor_arena_initialize(
+	          &source_item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_descriptor_arena_allocate(
+	          source_item_descriptor_arena,
+	          &item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_item_descriptor_arena_move(
+	          destination_item_descriptor_arena,
+	          source_item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_descriptor_arena_get_number_of_item_descriptors(
+	          destination_item_descriptor_arena,
+	          &number_of_item_descriptors,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_item_descriptors",
+	 number_of_item_descriptors,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_descriptor_arena_get_number_of_item_descriptors(
+	          source_item_descriptor_arena,
+	          &number_of_item_descriptors,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_item_descriptors",
+	 number_of_item_descriptors,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_item_descriptor_arena_move(
+	          NULL,
+	          source_item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_item_descriptor_arena_move(
+	          destination_item_descriptor_arena,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_item_descriptor_arena_move(
+	          destination_item_descriptor_arena,
+	          destination_item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_item_descriptor_arena_free(
+	          &source_item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_descriptor_arena_free(
+	          &destination_item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( source_item_descriptor_arena != NULL )
+	{
+		libmsiecf_item_descriptor_arena_free(
+		 &source_item_descriptor_arena,
+		 NULL );
+	}
+	if( destination_item_descriptor_arena != NULL )
+	{
+		libmsiecf_item_descriptor_arena_free(
+		 &destination_item_descriptor_arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argc )
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_item_descriptor_arena_initialize",
+	 msiecf_test_item_descriptor_arena_initialize );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_item_descriptor_arena_free",
+	 msiecf_test_item_descriptor_arena_free );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_item_descriptor_arena_empty",
+	 msiecf_test_item_descriptor_arena_empty );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_item_descriptor_arena_allocate",
+	 msiecf_test_item_descriptor_arena_allocate );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_item_descriptor_arena_move",
+	 msiecf_test_item_descriptor_arena_move );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1059 @@
+/*
+ * Library item_view type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "msiecf_test_libcerror.h"
+#include "msiecf_test_libmsiecf.h"
+#include "msiecf_test_macros.h"
+#include "msiecf_test_memory.h"
+#include "msiecf_test_unused.h"
+
+#include "../libmsiecf/libmsiecf_io_handle.h"
+#include "../libmsiecf/libmsiecf_item_descriptor.h"
+#include "../libmsiecf/libmsiecf_item_view.h"
+
+uint8_t msiecf_test_item_view_data1[ 512 ] = {
+	0x55, 0x52, 0x4c, 0x20, 0x04, 0x00, 0x00, 0x00, 0x80, 0xf9, 0x58, 0x8e, 0x81, 0xee, 0xcd, 0x01,
+	0xe0, 0x87, 0x44, 0x8e, 0x78, 0x1d, 0xce, 0x01, 0x6b, 0x42, 0x44, 0x52, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x10, 0xf8, 0x00, 0x00, 0x00,
+	0x41, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x6a, 0x42, 0x44, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x42, 0x44, 0x52,
+	0x00, 0x00, 0x00, 0x00, 0xef, 0xbe, 0xad, 0xde, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f,
+	0x77, 0x77, 0x77, 0x2e, 0x67, 0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x63,
+	0x68, 0x61, 0x72, 0x74, 0x3f, 0x63, 0x68, 0x73, 0x3d, 0x31, 0x35, 0x30, 0x78, 0x31, 0x35, 0x30,
+	0x26, 0x63, 0x68, 0x74, 0x3d, 0x71, 0x72, 0x26, 0x63, 0x68, 0x6c, 0x3d, 0x68, 0x74, 0x74, 0x70,
+	0x3a, 0x2f, 0x2f, 0x6c, 0x69, 0x62, 0x6d, 0x73, 0x69, 0x65, 0x63, 0x66, 0x2e, 0x67, 0x6f, 0x6f,
+	0x67, 0x6c, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x66, 0x69, 0x6c, 0x65,
+	0x73, 0x2f, 0x6c, 0x69, 0x62, 0x6d, 0x73, 0x69, 0x65, 0x63, 0x66, 0x2d, 0x61, 0x6c, 0x70, 0x68,
+	0x61, 0x2d, 0x32, 0x30, 0x31, 0x33, 0x30, 0x33, 0x30, 0x35, 0x2e, 0x74, 0x61, 0x72, 0x2e, 0x67,
+	0x7a, 0x26, 0x63, 0x68, 0x6c, 0x64, 0x3d, 0x4c, 0x7c, 0x31, 0x26, 0x63, 0x68, 0x6f, 0x65, 0x3d,
+	0x55, 0x54, 0x46, 0x2d, 0x38, 0x00, 0xad, 0xde, 0x63, 0x68, 0x61, 0x72, 0x74, 0x5b, 0x31, 0x5d,
+	0x2e, 0x70, 0x6e, 0x67, 0x00, 0xbe, 0xad, 0xde, 0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31,
+	0x20, 0x32, 0x30, 0x30, 0x20, 0x4f, 0x4b, 0x0d, 0x0a, 0x58, 0x2d, 0x46, 0x72, 0x61, 0x6d, 0x65,
+	0x2d, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x3a, 0x20, 0x41, 0x4c, 0x4c, 0x4f, 0x57, 0x41,
+	0x4c, 0x4c, 0x0d, 0x0a, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72,
+	0x6f, 0x6c, 0x2d, 0x41, 0x6c, 0x6c, 0x6f, 0x77, 0x2d, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x3a,
+	0x20, 0x2a, 0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65,
+	0x3a, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x0d, 0x0a, 0x58, 0x2d, 0x43,
+	0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 0x2d, 0x4f, 0x70, 0x74, 0x69,
+	0x6f, 0x6e, 0x73, 0x3a, 0x20, 0x6e, 0x6f, 0x73, 0x6e, 0x69, 0x66, 0x66, 0x0d, 0x0a, 0x43, 0x6f,
+	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30,
+	0x33, 0x30, 0x0d, 0x0a, 0x58, 0x2d, 0x58, 0x53, 0x53, 0x2d, 0x50, 0x72, 0x6f, 0x74, 0x65, 0x63,
+	0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x31, 0x3b, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x62, 0x6c,
+	0x6f, 0x63, 0x6b, 0x0d, 0x0a, 0x0d, 0x0a, 0x7e, 0x55, 0x3a, 0x2d, 0x0d, 0x0a, 0x00, 0xad, 0xde,
+	0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde,
+	0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde,
+	0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde };
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* Tests the libmsiecf_item_view_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_item_view_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libmsiecf_item_view_t *item_view = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_item_view_initialize(
+	          &item_view,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_view",
+	 item_view );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_view_free(
+	          &item_view,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "item_view",
+	 item_view );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_item_view_initialize(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	item_view = (libmsiecf_item_view_t *) 0x12345678UL;
+
+	result = libmsiecf_item_view_initialize(
+	          &item_view,
+	          &error );
+
+	item_view = NULL;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_item_view_initialize with malloc failing
+		 */
+		msiecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libmsiecf_item_view_initialize(
+		          &item_view,
+		          &error );
+
+		if( msiecf_test_malloc_attempts_before_fail != -1 )
+		{
+			msiecf_test_malloc_attempts_before_fail = -1;
+
+			if( item_view != NULL )
+			{
+				libmsiecf_item_view_free(
+				 &item_view,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "item_view",
+			 item_view );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_item_view_initialize with memset failing
+		 */
+		msiecf_test_memset_attempts_before_fail = test_number;
+
+		result = libmsiecf_item_view_initialize(
+		          &item_view,
+		          &error );
+
+		if( msiecf_test_memset_attempts_before_fail != -1 )
+		{
+			msiecf_test_memset_attempts_before_fail = -1;
+
+			if( item_view != NULL )
+			{
+				libmsiecf_item_view_free(
+				 &item_view,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "item_view",
+			 item_view );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MSIECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_view != NULL )
+	{
+		libmsiecf_item_view_free(
+		 &item_view,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_item_view_free function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_item_view_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_item_view_free(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+
+/* Tests the libmsiecf_internal_item_view_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_internal_item_view_read_data(
+     void )
+{
+	libmsiecf_item_descriptor_t item_descriptor;
+
+	libcerror_error_t *error         = NULL;
+	libmsiecf_io_handle_t *io_handle = NULL;
+	libmsiecf_item_view_t *item_view = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->major_version = 5;
+	io_handle->minor_version = 2;
+
+	result = libmsiecf_item_view_initialize(
+	          &item_view,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_view",
+	 item_view );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	item_descriptor.type        = LIBMSIECF_ITEM_TYPE_URL;
+	item_descriptor.file_offset = 0x5000;
+	item_descriptor.record_size = 512;
+	item_descriptor.flags       = 0;
+
+	( (libmsiecf_internal_item_view_t *) item_view )->item_descriptor = &item_descriptor;
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_internal_item_view_read_data(
+	          (libmsiecf_internal_item_view_t *) item_view,
+	          io_handle,
+	          msiecf_test_item_view_data1,
+	          512,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_internal_item_view_read_data(
+	          NULL,
+	          io_handle,
+	          msiecf_test_item_view_data1,
+	          512,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_internal_item_view_read_data(
+	          (libmsiecf_internal_item_view_t *) item_view,
+	          NULL,
+	          msiecf_test_item_view_data1,
+	          512,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_internal_item_view_read_data(
+	          (libmsiecf_internal_item_view_t *) item_view,
+	          io_handle,
+	          NULL,
+	          512,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_internal_item_view_read_data(
+	          (libmsiecf_internal_item_view_t *) item_view,
+	          io_handle,
+	          msiecf_test_item_view_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_internal_item_view_read_data(
+	          (libmsiecf_internal_item_view_t *) item_view,
+	          io_handle,
+	          msiecf_test_item_view_data1,
+	          64,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test partial record data
+	 */
+	item_descriptor.flags = LIBMSIECF_ITEM_FLAG_PARTIAL;
+
+	result = libmsiecf_internal_item_view_read_data(
+	          (libmsiecf_internal_item_view_t *) item_view,
+	          io_handle,
+	          msiecf_test_item_view_data1,
+	          64,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "has_record_header_values",
+	 ( (libmsiecf_internal_item_view_t *) item_view )->has_record_header_values,
+	 0 );
+
+	result = libmsiecf_internal_item_view_read_data(
+	          (libmsiecf_internal_item_view_t *) item_view,
+	          io_handle,
+	          msiecf_test_item_view_data1,
+	          128,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "has_record_header_values",
+	 ( (libmsiecf_internal_item_view_t *) item_view )->has_record_header_values,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "location_size",
+	 ( (libmsiecf_internal_item_view_t *) item_view )->location_size,
+	 (size_t) 24 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "filename",
+	 ( (libmsiecf_internal_item_view_t *) item_view )->filename );
+
+	/* Clean up
+	 */
+	result = libmsiecf_item_view_free(
+	          &item_view,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "item_view",
+	 item_view );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_view != NULL )
+	{
+		libmsiecf_item_view_free(
+		 &item_view,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libmsiecf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_item_view_get_type, libmsiecf_item_view_get_flags,
+ * libmsiecf_item_view_get_offset_range, libmsiecf_item_view_get_primary_time,
+ * libmsiecf_item_view_get_number_of_hits, libmsiecf_item_view_get_location
+ * and libmsiecf_item_view_get_filename functions
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_item_view_getters(
+     void )
+{
+	libmsiecf_item_descriptor_t item_descriptor;
+
+	libcerror_error_t *error         = NULL;
+	libmsiecf_io_handle_t *io_handle = NULL;
+	libmsiecf_item_view_t *item_view = NULL;
+	const uint8_t *string_data       = NULL;
+	size64_t size                    = 0;
+	size_t string_data_size          = 0;
+	off64_t offset                   = 0;
+	uint64_t primary_time            = 0;
+	uint32_t number_of_hits          = 0;
+	uint8_t item_flags               = 0;
+	uint8_t item_type                = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->major_version = 5;
+	io_handle->minor_version = 2;
+
+	result = libmsiecf_item_view_initialize(
+	          &item_view,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_view",
+	 item_view );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	item_descriptor.type        = LIBMSIECF_ITEM_TYPE_URL;
+	item_descriptor.file_offset = 0x5000;
+	item_descriptor.record_size = 512;
+	item_descriptor.flags       = LIBMSIECF_ITEM_FLAG_HASHED;
+
+	( (libmsiecf_internal_item_view_t *) item_view )->item_descriptor = &item_descriptor;
+
+	result = libmsiecf_internal_item_view_read_data(
+	          (libmsiecf_internal_item_view_t *) item_view,
+	          io_handle,
+	          msiecf_test_item_view_data1,
+	          512,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_item_view_get_type(
+	          item_view,
+	          &item_type,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "item_type",
+	 item_type,
+	 LIBMSIECF_ITEM_TYPE_URL );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_view_get_flags(
+	          item_view,
+	          &item_flags,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "item_flags",
+	 item_flags,
+	 LIBMSIECF_ITEM_FLAG_HASHED );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_view_get_offset_range(
+	          item_view,
+	          &offset,
+	          &size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0x5000 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 512 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_view_get_primary_time(
+	          item_view,
+	          &primary_time,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT64(
+	 "primary_time",
+	 primary_time,
+	 (uint64_t) 0x01ce1d788e4487e0UL );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_view_get_number_of_hits(
+	          item_view,
+	          &number_of_hits,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint32_t) 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_view_get_location(
+	          item_view,
+	          &string_data,
+	          &string_data_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "string_data_size",
+	 string_data_size,
+	 (size_t) 142 );
+
+	result = memory_compare(
+	          string_data,
+	          "https://www.google.com/chart",
+	          28 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_view_get_filename(
+	          item_view,
+	          &string_data,
+	          &string_data_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "string_data_size",
+	 string_data_size,
+	 (size_t) 13 );
+
+	result = memory_compare(
+	          string_data,
+	          "chart[1].png",
+	          13 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test values that are not available for the item type
+	 */
+	item_descriptor.type = LIBMSIECF_ITEM_TYPE_LEAK;
+
+	result = libmsiecf_item_view_get_primary_time(
+	          item_view,
+	          &primary_time,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	item_descriptor.type = LIBMSIECF_ITEM_TYPE_URL;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_item_view_get_type(
+	          NULL,
+	          &item_type,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_item_view_get_type(
+	          item_view,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_item_view_get_offset_range(
+	          item_view,
+	          NULL,
+	          &size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_item_view_get_location(
+	          item_view,
+	          NULL,
+	          &string_data_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_item_view_get_location(
+	          item_view,
+	          &string_data,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_item_view_free(
+	          &item_view,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "item_view",
+	 item_view );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( item_view != NULL )
+	{
+		libmsiecf_item_view_free(
+		 &item_view,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libmsiecf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argc )
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_item_view_initialize",
+	 msiecf_test_item_view_initialize );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_item_view_free",
+	 msiecf_test_item_view_free );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_internal_item_view_read_data",
+	 msiecf_test_internal_item_view_read_data );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_item_view_getters",
+	 msiecf_test_item_view_getters );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,18 +21,444 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "msiecf_test_functions.h"
+#include "msiecf_test_libbfio.h"
 #include "msiecf_test_libcerror.h"
 #include "msiecf_test_libmsiecf.h"
 #include "msiecf_test_macros.h"
 #include "msiecf_test_memory.h"
 #include "msiecf_test_unused.h"
 
+#include "../libmsiecf/libmsiecf_definitions.h"
+#include "../libmsiecf/libmsiecf_io_handle.h"
+#include "../libmsiecf/libmsiecf_item.h"
+#include "../libmsiecf/libmsiecf_item_descriptor.h"
+
+uint8_t msiecf_test_leak_data1[ 384 ] = {
+	0x4c, 0x45, 0x41, 0x4b, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x90, 0x96, 0xc3, 0x14, 0x73, 0x1d, 0xce, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x6c, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x90, 0x00, 0x00, 0x00,
+	0x41, 0x20, 0x00, 0x00, 0x9c, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x6a, 0x42, 0xdc, 0x4c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x42, 0xdc, 0x4c,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x73,
+	0x75, 0x70, 0x70, 0x6f, 0x72, 0x74, 0x2e, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x73, 0x6f, 0x66, 0x74,
+	0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x6b, 0x62, 0x2f, 0x32, 0x34, 0x39, 0x37, 0x32, 0x38, 0x31, 0x00,
+	0x32, 0x34, 0x39, 0x37, 0x32, 0x38, 0x31, 0x5b, 0x31, 0x5d, 0x00, 0x00, 0x48, 0x54, 0x54, 0x50,
+	0x2f, 0x31, 0x2e, 0x31, 0x20, 0x32, 0x30, 0x30, 0x20, 0x4f, 0x4b, 0x0d, 0x0a, 0x43, 0x6f, 0x6e,
+	0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 0x3a, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2f,
+	0x68, 0x74, 0x6d, 0x6c, 0x3b, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3d, 0x75, 0x74,
+	0x66, 0x2d, 0x38, 0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x45, 0x6e, 0x63,
+	0x6f, 0x64, 0x69, 0x6e, 0x67, 0x3a, 0x20, 0x67, 0x7a, 0x69, 0x70, 0x0d, 0x0a, 0x58, 0x2d, 0x41,
+	0x73, 0x70, 0x4e, 0x65, 0x74, 0x2d, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x34,
+	0x2e, 0x30, 0x2e, 0x33, 0x30, 0x33, 0x31, 0x39, 0x0d, 0x0a, 0x58, 0x2d, 0x50, 0x6f, 0x77, 0x65,
+	0x72, 0x65, 0x64, 0x2d, 0x42, 0x79, 0x3a, 0x20, 0x41, 0x53, 0x50, 0x2e, 0x4e, 0x45, 0x54, 0x0d,
+	0x0a, 0x58, 0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 0x2d,
+	0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x3a, 0x20, 0x6e, 0x6f, 0x73, 0x6e, 0x69, 0x66, 0x66,
+	0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68,
+	0x3a, 0x20, 0x32, 0x32, 0x33, 0x38, 0x30, 0x0d, 0x0a, 0x0d, 0x0a, 0x7e, 0x55, 0x3a, 0x2d, 0x0d,
+	0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* Opens a file IO handle of the record data and reads the leak item
+ * The file IO handle is closed after the item values were read
+ * Returns 1 if successful or -1 on error
+ */
+int msiecf_test_leak_open_source(
+     libmsiecf_item_t **leak,
+     libmsiecf_io_handle_t *io_handle,
+     libmsiecf_item_descriptor_t *item_descriptor,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "msiecf_test_leak_open_source";
+	int result                       = 0;
+
+	if( msiecf_test_open_file_io_handle(
+	     &file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_item_initialize(
+	     leak,
+	     item_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize leak.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_internal_item_read_values(
+	     (libmsiecf_internal_item_t *) *leak,
+	     io_handle,
+	     file_io_handle,
+	     NULL,
+	     0,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read leak values.",
+		 function );
+
+		goto on_error;
+	}
+	result = msiecf_test_close_file_io_handle(
+	          &file_io_handle,
+	          error );
+
+	if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *leak != NULL )
+	{
+		libmsiecf_item_free(
+		 leak,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		msiecf_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libmsiecf_leak_get_filename_view function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_leak_get_filename_view(
+     void )
+{
+	libmsiecf_item_descriptor_t item_descriptor;
+
+	libcerror_error_t *error         = NULL;
+	libmsiecf_io_handle_t *io_handle = NULL;
+	libmsiecf_item_t *leak           = NULL;
+	const uint8_t *first_filename    = NULL;
+	const uint8_t *filename          = NULL;
+	size_t first_filename_size       = 0;
+	size_t filename_size             = 0;
+	size_t utf8_string_size          = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->ascii_codepage = LIBMSIECF_CODEPAGE_WINDOWS_1252;
+
+	item_descriptor.type        = LIBMSIECF_ITEM_TYPE_LEAK;
+	item_descriptor.file_offset = 0;
+	item_descriptor.record_size = 384;
+	item_descriptor.flags       = 0;
+
+	result = msiecf_test_leak_open_source(
+	          &leak,
+	          io_handle,
+	          &item_descriptor,
+	          msiecf_test_leak_data1,
+	          384,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "leak",
+	 leak );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the file IO handle is closed at this point, hence the view references data owned by the item
+	 */
+	result = libmsiecf_leak_get_filename_view(
+	          leak,
+	          &first_filename,
+	          &first_filename_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "first_filename",
+	 first_filename );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "first_filename_size",
+	 first_filename_size,
+	 (size_t) 11 );
+
+	result = memory_compare(
+	          first_filename,
+	          "2497281[1]",
+	          10 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if the view remains valid after other values of the item were retrieved
+	 */
+	result = libmsiecf_leak_get_utf8_filename_size(
+	          leak,
+	          &utf8_string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_leak_get_filename_view(
+	          leak,
+	          &filename,
+	          &filename_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "filename",
+	 ( filename == first_filename ),
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "filename_size",
+	 filename_size,
+	 first_filename_size );
+
+	result = memory_compare(
+	          filename,
+	          "2497281[1]",
+	          10 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_leak_get_filename_view(
+	          NULL,
+	          &filename,
+	          &filename_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_leak_get_filename_view(
+	          leak,
+	          NULL,
+	          &filename_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_leak_get_filename_view(
+	          leak,
+	          &filename,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an item of a different type
+	 */
+	item_descriptor.type = LIBMSIECF_ITEM_TYPE_URL;
+
+	result = libmsiecf_leak_get_filename_view(
+	          leak,
+	          &filename,
+	          &filename_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	item_descriptor.type = LIBMSIECF_ITEM_TYPE_LEAK;
+
+	/* Clean up
+	 */
+	result = libmsiecf_item_free(
+	          &leak,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "leak",
+	 leak );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( leak != NULL )
+	{
+		libmsiecf_item_free(
+		 &leak,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libmsiecf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -56,6 +482,14 @@ int main(
 
 	/* TODO: add tests for libmsiecf_leak_get_filename */
 
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_leak_get_filename_view",
+	 msiecf_test_leak_get_filename_view );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
 	/* TODO: add tests for libmsiecf_leak_get_utf8_filename_size */
 
 	/* TODO: add tests for libmsiecf_leak_get_utf8_filename */
@@ -66,7 +500,11 @@ int main(
 
 	return( EXIT_SUCCESS );
 
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
 on_error:
 	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
 }
 
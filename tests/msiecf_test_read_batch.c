@@ -0,0 +1,984 @@
+/*
+ * Library read_batch type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "msiecf_test_libcerror.h"
+#include "msiecf_test_libmsiecf.h"
+#include "msiecf_test_macros.h"
+#include "msiecf_test_memory.h"
+#include "msiecf_test_unused.h"
+
+#include "../libmsiecf/libmsiecf_item_descriptor.h"
+#include "../libmsiecf/libmsiecf_read_batch.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* The item descriptors contain records that are not stored in ascending order
+ * and 2 records with the same file offset
+ */
+off64_t msiecf_test_read_batch_file_offsets[ 5 ] = {
+	0x5000, 0x4000, 0x4100, 0x4000, 0x8000 };
+
+size32_t msiecf_test_read_batch_record_sizes[ 5 ] = {
+	0x0080, 0x0100, 0x0080, 0x0100, 0x0080 };
+
+/* The item indexes in file offset order, where records with the same file offset retain their order
+ */
+int msiecf_test_read_batch_sorted_item_indexes[ 5 ] = {
+	1, 3, 2, 0, 4 };
+
+/* Tests the libmsiecf_read_batch_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_read_batch_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libmsiecf_read_batch_t *read_batch = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 1;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_read_batch_initialize(
+	          &read_batch,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_batch",
+	 read_batch );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_read_batch_free(
+	          &read_batch,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "read_batch",
+	 read_batch );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_read_batch_initialize(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_batch = (libmsiecf_read_batch_t *) 0x12345678UL;
+
+	result = libmsiecf_read_batch_initialize(
+	          &read_batch,
+	          &error );
+
+	read_batch = NULL;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_read_batch_initialize with malloc failing
+		 */
+		msiecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libmsiecf_read_batch_initialize(
+		          &read_batch,
+		          &error );
+
+		if( msiecf_test_malloc_attempts_before_fail != -1 )
+		{
+			msiecf_test_malloc_attempts_before_fail = -1;
+
+			if( read_batch != NULL )
+			{
+				libmsiecf_read_batch_free(
+				 &read_batch,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "read_batch",
+			 read_batch );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_read_batch_initialize with memset failing
+		 */
+		msiecf_test_memset_attempts_before_fail = test_number;
+
+		result = libmsiecf_read_batch_initialize(
+		          &read_batch,
+		          &error );
+
+		if( msiecf_test_memset_attempts_before_fail != -1 )
+		{
+			msiecf_test_memset_attempts_before_fail = -1;
+
+			if( read_batch != NULL )
+			{
+				libmsiecf_read_batch_free(
+				 &read_batch,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "read_batch",
+			 read_batch );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MSIECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_batch != NULL )
+	{
+		libmsiecf_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_read_batch_free function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_read_batch_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_read_batch_free(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+
+/* Tests the libmsiecf_read_batch_append_item_descriptor function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_read_batch_append_item_descriptor(
+     void )
+{
+	libmsiecf_item_descriptor_t item_descriptors[ 5 ];
+
+	libcerror_error_t *error           = NULL;
+	libmsiecf_read_batch_t *read_batch = NULL;
+	int descriptor_index               = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	for( descriptor_index = 0;
+	     descriptor_index < 5;
+	     descriptor_index++ )
+	{
+		item_descriptors[ descriptor_index ].type        = LIBMSIECF_ITEM_TYPE_REDIRECTED;
+		item_descriptors[ descriptor_index ].file_offset = msiecf_test_read_batch_file_offsets[ descriptor_index ];
+		item_descriptors[ descriptor_index ].record_size = msiecf_test_read_batch_record_sizes[ descriptor_index ];
+		item_descriptors[ descriptor_index ].flags       = 0;
+	}
+	result = libmsiecf_read_batch_initialize(
+	          &read_batch,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_batch",
+	 read_batch );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( descriptor_index = 0;
+	     descriptor_index < 5;
+	     descriptor_index++ )
+	{
+		result = libmsiecf_read_batch_append_item_descriptor(
+		          read_batch,
+		          &( item_descriptors[ descriptor_index ] ),
+		          descriptor_index,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "read_batch->number_of_entries",
+	 read_batch->number_of_entries,
+	 5 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "read_batch->is_sorted",
+	 read_batch->is_sorted,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_read_batch_append_item_descriptor(
+	          NULL,
+	          &( item_descriptors[ 0 ] ),
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_read_batch_append_item_descriptor(
+	          read_batch,
+	          NULL,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_read_batch_append_item_descriptor(
+	          read_batch,
+	          &( item_descriptors[ 0 ] ),
+	          -1,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_read_batch_free(
+	          &read_batch,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "read_batch",
+	 read_batch );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_batch != NULL )
+	{
+		libmsiecf_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_read_batch_sort function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_read_batch_sort(
+     void )
+{
+	libmsiecf_item_descriptor_t item_descriptors[ 5 ];
+
+	libcerror_error_t *error           = NULL;
+	libmsiecf_read_batch_t *read_batch = NULL;
+	int descriptor_index               = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	for( descriptor_index = 0;
+	     descriptor_index < 5;
+	     descriptor_index++ )
+	{
+		item_descriptors[ descriptor_index ].type        = LIBMSIECF_ITEM_TYPE_REDIRECTED;
+		item_descriptors[ descriptor_index ].file_offset = msiecf_test_read_batch_file_offsets[ descriptor_index ];
+		item_descriptors[ descriptor_index ].record_size = msiecf_test_read_batch_record_sizes[ descriptor_index ];
+		item_descriptors[ descriptor_index ].flags       = 0;
+	}
+	result = libmsiecf_read_batch_initialize(
+	          &read_batch,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_batch",
+	 read_batch );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( descriptor_index = 0;
+	     descriptor_index < 5;
+	     descriptor_index++ )
+	{
+		result = libmsiecf_read_batch_append_item_descriptor(
+		          read_batch,
+		          &( item_descriptors[ descriptor_index ] ),
+		          descriptor_index,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_read_batch_sort(
+	          read_batch,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "read_batch->is_sorted",
+	 read_batch->is_sorted,
+	 1 );
+
+	for( descriptor_index = 0;
+	     descriptor_index < 5;
+	     descriptor_index++ )
+	{
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "read_batch->entries[ descriptor_index ].item_index",
+		 read_batch->entries[ descriptor_index ].item_index,
+		 msiecf_test_read_batch_sorted_item_indexes[ descriptor_index ] );
+	}
+	/* Test error cases
+	 */
+	result = libmsiecf_read_batch_sort(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_read_batch_free(
+	          &read_batch,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "read_batch",
+	 read_batch );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_batch != NULL )
+	{
+		libmsiecf_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_read_batch_get_run function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_read_batch_get_run(
+     void )
+{
+	libmsiecf_item_descriptor_t item_descriptors[ 5 ];
+
+	libcerror_error_t *error           = NULL;
+	libmsiecf_read_batch_t *read_batch = NULL;
+	size64_t run_size                  = 0;
+	off64_t run_offset                 = 0;
+	int descriptor_index               = 0;
+	int number_of_run_entries          = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	for( descriptor_index = 0;
+	     descriptor_index < 5;
+	     descriptor_index++ )
+	{
+		item_descriptors[ descriptor_index ].type        = LIBMSIECF_ITEM_TYPE_REDIRECTED;
+		item_descriptors[ descriptor_index ].file_offset = msiecf_test_read_batch_file_offsets[ descriptor_index ];
+		item_descriptors[ descriptor_index ].record_size = msiecf_test_read_batch_record_sizes[ descriptor_index ];
+		item_descriptors[ descriptor_index ].flags       = 0;
+	}
+	result = libmsiecf_read_batch_initialize(
+	          &read_batch,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "read_batch",
+	 read_batch );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( descriptor_index = 0;
+	     descriptor_index < 5;
+	     descriptor_index++ )
+	{
+		result = libmsiecf_read_batch_append_item_descriptor(
+		          read_batch,
+		          &( item_descriptors[ descriptor_index ] ),
+		          descriptor_index,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	result = libmsiecf_read_batch_sort(
+	          read_batch,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_read_batch_get_run(
+	          read_batch,
+	          0,
+	          0,
+	          &number_of_run_entries,
+	          &run_offset,
+	          &run_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_run_entries",
+	 number_of_run_entries,
+	 3 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT64(
+	 "run_offset",
+	 (int64_t) run_offset,
+	 (int64_t) 0x00004000 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT64(
+	 "run_size",
+	 (uint64_t) run_size,
+	 (uint64_t) 0x00000180 );
+
+	result = libmsiecf_read_batch_get_run(
+	          read_batch,
+	          0,
+	          0x1000,
+	          &number_of_run_entries,
+	          &run_offset,
+	          &run_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_run_entries",
+	 number_of_run_entries,
+	 4 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT64(
+	 "run_offset",
+	 (int64_t) run_offset,
+	 (int64_t) 0x00004000 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT64(
+	 "run_size",
+	 (uint64_t) run_size,
+	 (uint64_t) 0x00001080 );
+
+	result = libmsiecf_read_batch_get_run(
+	          read_batch,
+	          4,
+	          0,
+	          &number_of_run_entries,
+	          &run_offset,
+	          &run_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_run_entries",
+	 number_of_run_entries,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT64(
+	 "run_offset",
+	 (int64_t) run_offset,
+	 (int64_t) 0x00008000 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT64(
+	 "run_size",
+	 (uint64_t) run_size,
+	 (uint64_t) 0x00000080 );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_read_batch_get_run(
+	          NULL,
+	          0,
+	          0,
+	          &number_of_run_entries,
+	          &run_offset,
+	          &run_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_read_batch_get_run(
+	          read_batch,
+	          -1,
+	          0,
+	          &number_of_run_entries,
+	          &run_offset,
+	          &run_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_read_batch_get_run(
+	          read_batch,
+	          5,
+	          0,
+	          &number_of_run_entries,
+	          &run_offset,
+	          &run_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_read_batch_get_run(
+	          read_batch,
+	          0,
+	          0,
+	          NULL,
+	          &run_offset,
+	          &run_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_read_batch_get_run(
+	          read_batch,
+	          0,
+	          0,
+	          &number_of_run_entries,
+	          NULL,
+	          &run_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_read_batch_get_run(
+	          read_batch,
+	          0,
+	          0,
+	          &number_of_run_entries,
+	          &run_offset,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_read_batch_free(
+	          &read_batch,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "read_batch",
+	 read_batch );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_batch != NULL )
+	{
+		libmsiecf_read_batch_free(
+		 &read_batch,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argc )
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_read_batch_initialize",
+	 msiecf_test_read_batch_initialize );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_read_batch_free",
+	 msiecf_test_read_batch_free );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_read_batch_append_item_descriptor",
+	 msiecf_test_read_batch_append_item_descriptor );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_read_batch_sort",
+	 msiecf_test_read_batch_sort );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_read_batch_get_run",
+	 msiecf_test_read_batch_get_run );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,541 @@
+/*
+ * Library record decoder functions test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "msiecf_test_libcerror.h"
+#include "msiecf_test_libmsiecf.h"
+#include "msiecf_test_macros.h"
+#include "msiecf_test_memory.h"
+#include "msiecf_test_unused.h"
+
+#include "../libmsiecf/libmsiecf_record_decoders.h"
+
+uint8_t msiecf_test_record_decoders_file_header_data1[ 72 ] = {
+	0x43, 0x6c, 0x69, 0x65, 0x6e, 0x74, 0x20, 0x55, 0x72, 0x6c, 0x43, 0x61, 0x63, 0x68, 0x65, 0x20,
+	0x4d, 0x4d, 0x46, 0x20, 0x56, 0x65, 0x72, 0x20, 0x35, 0x2e, 0x32, 0x00, 0x00, 0x80, 0x00, 0x00,
+	0x00, 0x40, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+uint8_t msiecf_test_record_decoders_url_record_header_data1[ 96 ] = {
+	0x55, 0x52, 0x4c, 0x20, 0x04, 0x00, 0x00, 0x00, 0x80, 0xf9, 0x58, 0x8e, 0x81, 0xee, 0xcd, 0x01,
+	0xe0, 0x87, 0x44, 0x8e, 0x78, 0x1d, 0xce, 0x01, 0x6b, 0x42, 0x44, 0x52, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x10, 0xf8, 0x00, 0x00, 0x00,
+	0x41, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x6a, 0x42, 0x44, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x42, 0x44, 0x52 };
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* Tests the libmsiecf_file_header_values_decode function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_file_header_values_decode(
+     void )
+{
+	libmsiecf_file_header_values_t file_header_values;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_file_header_values_decode(
+	          &file_header_values,
+	          msiecf_test_record_decoders_file_header_data1,
+	          72,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header_values.file_size",
+	 file_header_values.file_size,
+	 (uint32_t) 0x00008000UL );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header_values.hash_table_offset",
+	 file_header_values.hash_table_offset,
+	 (uint32_t) 0x00004000UL );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header_values.number_of_blocks",
+	 file_header_values.number_of_blocks,
+	 (uint32_t) 128 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header_values.number_of_allocated_blocks",
+	 file_header_values.number_of_allocated_blocks,
+	 (uint32_t) 58 );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_file_header_values_decode(
+	          NULL,
+	          msiecf_test_record_decoders_file_header_data1,
+	          72,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_header_values_decode(
+	          &file_header_values,
+	          NULL,
+	          72,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_file_header_values_decode(
+	          &file_header_values,
+	          msiecf_test_record_decoders_file_header_data1,
+	          71,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_url_record_header_v52_values_decode function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_url_record_header_v52_values_decode(
+     void )
+{
+	libmsiecf_url_record_header_v52_values_t url_record_header_values;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_url_record_header_v52_values_decode(
+	          &url_record_header_values,
+	          msiecf_test_record_decoders_url_record_header_data1,
+	          96,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT64(
+	 "url_record_header_values.secondary_time",
+	 url_record_header_values.secondary_time,
+	 (uint64_t) 0x01cdee818e58f980UL );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT64(
+	 "url_record_header_values.primary_time",
+	 url_record_header_values.primary_time,
+	 (uint64_t) 0x01ce1d788e4487e0UL );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "url_record_header_values.expiration_time",
+	 url_record_header_values.expiration_time,
+	 (uint32_t) 0x5244426bUL );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "url_record_header_values.cached_file_size",
+	 url_record_header_values.cached_file_size,
+	 (uint32_t) 1030 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "url_record_header_values.location_offset",
+	 url_record_header_values.location_offset,
+	 (uint32_t) 0x00000068UL );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "url_record_header_values.cache_directory_index",
+	 url_record_header_values.cache_directory_index,
+	 (uint8_t) 2 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "url_record_header_values.filename_offset",
+	 url_record_header_values.filename_offset,
+	 (uint32_t) 0x000000f8UL );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "url_record_header_values.cache_entry_flags",
+	 url_record_header_values.cache_entry_flags,
+	 (uint32_t) 0x00000041UL );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "url_record_header_values.data_offset",
+	 url_record_header_values.data_offset,
+	 (uint32_t) 0x00000108UL );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "url_record_header_values.data_size",
+	 url_record_header_values.data_size,
+	 (uint32_t) 198 );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "url_record_header_values.last_checked_time",
+	 url_record_header_values.last_checked_time,
+	 (uint32_t) 0x5244426aUL );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT32(
+	 "url_record_header_values.number_of_hits",
+	 url_record_header_values.number_of_hits,
+	 (uint32_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_url_record_header_v52_values_decode(
+	          NULL,
+	          msiecf_test_record_decoders_url_record_header_data1,
+	          96,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_url_record_header_v52_values_decode(
+	          &url_record_header_values,
+	          NULL,
+	          96,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_url_record_header_v52_values_decode(
+	          &url_record_header_values,
+	          msiecf_test_record_decoders_url_record_header_data1,
+	          95,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_url_record_header_v52_decode_expiration_time_column function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_url_record_header_v52_decode_expiration_time_column(
+     void )
+{
+	uint8_t record_header_data[ 2 * 96 ];
+	uint64_t expiration_times[ 2 ];
+
+	libcerror_error_t *error = NULL;
+	void *memory_result      = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_result = memory_copy(
+	                 record_header_data,
+	                 msiecf_test_record_decoders_url_record_header_data1,
+	                 96 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_result",
+	 memory_result );
+
+	memory_result = memory_copy(
+	                 &( record_header_data[ 96 ] ),
+	                 msiecf_test_record_decoders_url_record_header_data1,
+	                 96 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "memory_result",
+	 memory_result );
+
+	/* Set the expiration time of the second record to 0xfedcba98
+	 */
+	record_header_data[ 96 + 24 ] = 0x98;
+	record_header_data[ 96 + 25 ] = 0xba;
+	record_header_data[ 96 + 26 ] = 0xdc;
+	record_header_data[ 96 + 27 ] = 0xfe;
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_url_record_header_v52_decode_expiration_time_column(
+	          record_header_data,
+	          2 * 96,
+	          2,
+	          expiration_times,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT64(
+	 "expiration_times[ 0 ]",
+	 expiration_times[ 0 ],
+	 (uint64_t) 0x5244426bUL );
+
+	MSIECF_TEST_ASSERT_EQUAL_UINT64(
+	 "expiration_times[ 1 ]",
+	 expiration_times[ 1 ],
+	 (uint64_t) 0xfedcba98UL );
+
+	result = libmsiecf_url_record_header_v52_decode_expiration_time_column(
+	          record_header_data,
+	          2 * 96,
+	          0,
+	          expiration_times,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_url_record_header_v52_decode_expiration_time_column(
+	          NULL,
+	          2 * 96,
+	          2,
+	          expiration_times,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_url_record_header_v52_decode_expiration_time_column(
+	          record_header_data,
+	          2 * 96,
+	          -1,
+	          expiration_times,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_url_record_header_v52_decode_expiration_time_column(
+	          record_header_data,
+	          ( 2 * 96 ) - 1,
+	          2,
+	          expiration_times,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_url_record_header_v52_decode_expiration_time_column(
+	          record_header_data,
+	          2 * 96,
+	          2,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argc )
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_file_header_values_decode",
+	 msiecf_test_file_header_values_decode );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_url_record_header_v52_values_decode",
+	 msiecf_test_url_record_header_v52_values_decode );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_url_record_header_v52_decode_expiration_time_column",
+	 msiecf_test_url_record_header_v52_decode_expiration_time_column );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,935 @@
+/*
+ * Library record_scan_chunk type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "msiecf_test_libcdata.h"
+#include "msiecf_test_libcerror.h"
+#include "msiecf_test_libmsiecf.h"
+#include "msiecf_test_macros.h"
+#include "msiecf_test_memory.h"
+#include "msiecf_test_unused.h"
+
+#include "../libmsiecf/libmsiecf_item_descriptor.h"
+#include "../libmsiecf/libmsiecf_item_descriptor_arena.h"
+#include "../libmsiecf/libmsiecf_record_scan_chunk.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* Tests the libmsiecf_record_scan_chunk_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_record_scan_chunk_initialize(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libmsiecf_record_scan_chunk_t *record_scan_chunk = NULL;
+	int result                                       = 0;
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+	int number_of_malloc_fail_tests                  = 1;
+	int number_of_memset_fail_tests                  = 1;
+	int test_number                                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_record_scan_chunk_initialize(
+	          &record_scan_chunk,
+	          0,
+	          4096,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_scan_chunk",
+	 record_scan_chunk );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_record_scan_chunk_free(
+	          &record_scan_chunk,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "record_scan_chunk",
+	 record_scan_chunk );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_record_scan_chunk_initialize(
+	          NULL,
+	          0,
+	          4096,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_scan_chunk = (libmsiecf_record_scan_chunk_t *) 0x12345678UL;
+
+	result = libmsiecf_record_scan_chunk_initialize(
+	          &record_scan_chunk,
+	          0,
+	          4096,
+	          &error );
+
+	record_scan_chunk = NULL;
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_record_scan_chunk_initialize(
+	          &record_scan_chunk,
+	          -1,
+	          4096,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_record_scan_chunk_initialize(
+	          &record_scan_chunk,
+	          4096,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_record_scan_chunk_initialize with malloc failing
+		 */
+		msiecf_test_malloc_attempts_before_fail = test_number;
+
+		result = libmsiecf_record_scan_chunk_initialize(
+		          &record_scan_chunk,
+		          0,
+		          4096,
+		          &error );
+
+		if( msiecf_test_malloc_attempts_before_fail != -1 )
+		{
+			msiecf_test_malloc_attempts_before_fail = -1;
+
+			if( record_scan_chunk != NULL )
+			{
+				libmsiecf_record_scan_chunk_free(
+				 &record_scan_chunk,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "record_scan_chunk",
+			 record_scan_chunk );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libmsiecf_record_scan_chunk_initialize with memset failing
+		 */
+		msiecf_test_memset_attempts_before_fail = test_number;
+
+		result = libmsiecf_record_scan_chunk_initialize(
+		          &record_scan_chunk,
+		          0,
+		          4096,
+		          &error );
+
+		if( msiecf_test_memset_attempts_before_fail != -1 )
+		{
+			msiecf_test_memset_attempts_before_fail = -1;
+
+			if( record_scan_chunk != NULL )
+			{
+				libmsiecf_record_scan_chunk_free(
+				 &record_scan_chunk,
+				 NULL );
+			}
+		}
+		else
+		{
+			MSIECF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			MSIECF_TEST_ASSERT_IS_NULL(
+			 "record_scan_chunk",
+			 record_scan_chunk );
+
+			MSIECF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_MSIECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_scan_chunk != NULL )
+	{
+		libmsiecf_record_scan_chunk_free(
+		 &record_scan_chunk,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_record_scan_chunk_free function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_record_scan_chunk_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_record_scan_chunk_free(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_record_scan_chunk_append_synchronization_point function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_record_scan_chunk_append_synchronization_point(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor     = NULL;
+	libmsiecf_record_scan_chunk_t *record_scan_chunk = NULL;
+	int entry_index                                  = 0;
+	int point_index                                  = 0;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_record_scan_chunk_initialize(
+	          &record_scan_chunk,
+	          0,
+	          4096,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_scan_chunk",
+	 record_scan_chunk );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_record_scan_chunk_append_synchronization_point(
+	          record_scan_chunk,
+	          0,
+	          NULL,
+	          record_scan_chunk->item_array,
+	          record_scan_chunk->recovered_item_array,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_descriptor_arena_allocate(
+	          record_scan_chunk->item_descriptor_arena,
+	          &item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_append_entry(
+	          record_scan_chunk->item_array,
+	          &entry_index,
+	          (intptr_t *) item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_record_scan_chunk_append_synchronization_point(
+	          record_scan_chunk,
+	          128,
+	          item_descriptor,
+	          record_scan_chunk->item_array,
+	          record_scan_chunk->recovered_item_array,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "record_scan_chunk->number_of_synchronization_points",
+	 record_scan_chunk->number_of_synchronization_points,
+	 2 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "record_scan_chunk->synchronization_points[ 0 ].number_of_items",
+	 record_scan_chunk->synchronization_points[ 0 ].number_of_items,
+	 0 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "record_scan_chunk->synchronization_points[ 1 ].number_of_items",
+	 record_scan_chunk->synchronization_points[ 1 ].number_of_items,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "record_scan_chunk->synchronization_points[ 1 ].number_of_recovered_items",
+	 record_scan_chunk->synchronization_points[ 1 ].number_of_recovered_items,
+	 0 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "record_scan_chunk->synchronization_points[ 1 ].last_item_descriptor",
+	 ( record_scan_chunk->synchronization_points[ 1 ].last_item_descriptor == item_descriptor ),
+	 1 );
+
+	for( point_index = 2;
+	     point_index < LIBMSIECF_RECORD_SCAN_MAXIMUM_NUMBER_OF_SYNCHRONIZATION_POINTS;
+	     point_index++ )
+	{
+		result = libmsiecf_record_scan_chunk_append_synchronization_point(
+		          record_scan_chunk,
+		          (off64_t) point_index * 128,
+		          item_descriptor,
+		          record_scan_chunk->item_array,
+		          record_scan_chunk->recovered_item_array,
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test appending when the maximum number of synchronization points was reached
+	 */
+	result = libmsiecf_record_scan_chunk_append_synchronization_point(
+	          record_scan_chunk,
+	          4000,
+	          item_descriptor,
+	          record_scan_chunk->item_array,
+	          record_scan_chunk->recovered_item_array,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	item_descriptor = NULL;
+
+	/* Test error cases
+	 */
+	result = libmsiecf_record_scan_chunk_append_synchronization_point(
+	          NULL,
+	          4000,
+	          NULL,
+	          record_scan_chunk->item_array,
+	          record_scan_chunk->recovered_item_array,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_record_scan_chunk_append_synchronization_point(
+	          record_scan_chunk,
+	          128,
+	          NULL,
+	          record_scan_chunk->item_array,
+	          record_scan_chunk->recovered_item_array,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_record_scan_chunk_free(
+	          &record_scan_chunk,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "record_scan_chunk",
+	 record_scan_chunk );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_scan_chunk != NULL )
+	{
+		libmsiecf_record_scan_chunk_free(
+		 &record_scan_chunk,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_record_scan_chunk_move_items function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_record_scan_chunk_move_items(
+     void )
+{
+	libcdata_array_t *item_table                             = NULL;
+	libcdata_array_t *recovered_item_table                   = NULL;
+	libcerror_error_t *error                                 = NULL;
+	libmsiecf_item_descriptor_arena_t *item_descriptor_arena = NULL;
+	libmsiecf_item_descriptor_t *item_descriptor             = NULL;
+	libmsiecf_record_scan_chunk_t *record_scan_chunk         = NULL;
+	int entry_index                                          = 0;
+	int number_of_entries                                    = 0;
+	int result                                               = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_record_scan_chunk_initialize(
+	          &record_scan_chunk,
+	          0,
+	          4096,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "record_scan_chunk",
+	 record_scan_chunk );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &item_table,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_initialize(
+	          &recovered_item_table,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_descriptor_arena_initialize(
+	          &item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_descriptor_arena_allocate(
+	          record_scan_chunk->item_descriptor_arena,
+	          &item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_append_entry(
+	          record_scan_chunk->recovered_item_array,
+	          &entry_index,
+	          (intptr_t *) item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	item_descriptor = NULL;
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_record_scan_chunk_move_items(
+	          record_scan_chunk,
+	          0,
+	          0,
+	          item_table,
+	          recovered_item_table,
+	          item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          item_table,
+	          &number_of_entries,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          recovered_item_table,
+	          &number_of_entries,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_descriptor_arena_get_number_of_item_descriptors(
+	          item_descriptor_arena,
+	          &number_of_entries,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_record_scan_chunk_move_items(
+	          NULL,
+	          0,
+	          0,
+	          item_table,
+	          recovered_item_table,
+	          item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_record_scan_chunk_move_items(
+	          record_scan_chunk,
+	          -1,
+	          0,
+	          item_table,
+	          recovered_item_table,
+	          item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libcdata_array_free(
+	          &recovered_item_table,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &item_table,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_descriptor_arena_free(
+	          &item_descriptor_arena,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_record_scan_chunk_free(
+	          &record_scan_chunk,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "record_scan_chunk",
+	 record_scan_chunk );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( recovered_item_table != NULL )
+	{
+		libcdata_array_free(
+		 &recovered_item_table,
+		 NULL,
+		 NULL );
+	}
+	if( item_table != NULL )
+	{
+		libcdata_array_free(
+		 &item_table,
+		 NULL,
+		 NULL );
+	}
+	if( item_descriptor_arena != NULL )
+	{
+		libmsiecf_item_descriptor_arena_free(
+		 &item_descriptor_arena,
+		 NULL );
+	}
+	if( record_scan_chunk != NULL )
+	{
+		libmsiecf_record_scan_chunk_free(
+		 &record_scan_chunk,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argc )
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_record_scan_chunk_initialize",
+	 msiecf_test_record_scan_chunk_initialize );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_record_scan_chunk_free",
+	 msiecf_test_record_scan_chunk_free );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_record_scan_chunk_append_synchronization_point",
+	 msiecf_test_record_scan_chunk_append_synchronization_point );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_record_scan_chunk_move_items",
+	 msiecf_test_record_scan_chunk_move_items );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,18 +21,428 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "msiecf_test_functions.h"
+#include "msiecf_test_libbfio.h"
 #include "msiecf_test_libcerror.h"
 #include "msiecf_test_libmsiecf.h"
 #include "msiecf_test_macros.h"
 #include "msiecf_test_memory.h"
 #include "msiecf_test_unused.h"
 
+#include "../libmsiecf/libmsiecf_definitions.h"
+#include "../libmsiecf/libmsiecf_io_handle.h"
+#include "../libmsiecf/libmsiecf_item.h"
+#include "../libmsiecf/libmsiecf_item_descriptor.h"
+
+uint8_t msiecf_test_redirected_data1[ 128 ] = {
+	0x52, 0x45, 0x44, 0x52, 0x01, 0x00, 0x00, 0x00, 0xc8, 0x53, 0x00, 0x00, 0x40, 0x8e, 0xf0, 0xae,
+	0x68, 0x74, 0x74, 0x70, 0x3a, 0x2f, 0x2f, 0x67, 0x6f, 0x2e, 0x6d, 0x69, 0x63, 0x72, 0x6f, 0x73,
+	0x6f, 0x66, 0x74, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x66, 0x77, 0x6c, 0x69, 0x6e, 0x6b, 0x2f, 0x3f,
+	0x6c, 0x69, 0x6e, 0x6b, 0x69, 0x64, 0x3d, 0x32, 0x30, 0x39, 0x31, 0x39, 0x31, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* Opens a file IO handle of the record data and reads the redirected item
+ * The file IO handle is closed after the item values were read
+ * Returns 1 if successful or -1 on error
+ */
+int msiecf_test_redirected_open_source(
+     libmsiecf_item_t **redirected,
+     libmsiecf_io_handle_t *io_handle,
+     libmsiecf_item_descriptor_t *item_descriptor,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "msiecf_test_redirected_open_source";
+	int result                       = 0;
+
+	if( msiecf_test_open_file_io_handle(
+	     &file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_item_initialize(
+	     redirected,
+	     item_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize redirected.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_internal_item_read_values(
+	     (libmsiecf_internal_item_t *) *redirected,
+	     io_handle,
+	     file_io_handle,
+	     NULL,
+	     0,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read redirected values.",
+		 function );
+
+		goto on_error;
+	}
+	result = msiecf_test_close_file_io_handle(
+	          &file_io_handle,
+	          error );
+
+	if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *redirected != NULL )
+	{
+		libmsiecf_item_free(
+		 redirected,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		msiecf_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libmsiecf_redirected_get_location_view function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_redirected_get_location_view(
+     void )
+{
+	libmsiecf_item_descriptor_t item_descriptor;
+
+	libcerror_error_t *error         = NULL;
+	libmsiecf_io_handle_t *io_handle = NULL;
+	libmsiecf_item_t *redirected     = NULL;
+	const uint8_t *first_location    = NULL;
+	const uint8_t *location          = NULL;
+	size_t first_location_size       = 0;
+	size_t location_size             = 0;
+	size_t utf8_string_size          = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->ascii_codepage = LIBMSIECF_CODEPAGE_WINDOWS_1252;
+
+	item_descriptor.type        = LIBMSIECF_ITEM_TYPE_REDIRECTED;
+	item_descriptor.file_offset = 0;
+	item_descriptor.record_size = 128;
+	item_descriptor.flags       = 0;
+
+	result = msiecf_test_redirected_open_source(
+	          &redirected,
+	          io_handle,
+	          &item_descriptor,
+	          msiecf_test_redirected_data1,
+	          128,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "redirected",
+	 redirected );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the file IO handle is closed at this point, hence the view references data owned by the item
+	 */
+	result = libmsiecf_redirected_get_location_view(
+	          redirected,
+	          &first_location,
+	          &first_location_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "first_location",
+	 first_location );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "first_location_size",
+	 first_location_size,
+	 (size_t) 46 );
+
+	result = memory_compare(
+	          first_location,
+	          "http://go.microsoft.com/fwlink/?linkid=209191",
+	          45 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if the view remains valid after other values of the item were retrieved
+	 */
+	result = libmsiecf_redirected_get_utf8_location_size(
+	          redirected,
+	          &utf8_string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_redirected_get_location_view(
+	          redirected,
+	          &location,
+	          &location_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "location",
+	 ( location == first_location ),
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "location_size",
+	 location_size,
+	 first_location_size );
+
+	result = memory_compare(
+	          location,
+	          "http://go.microsoft.com/fwlink/?linkid=209191",
+	          45 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_redirected_get_location_view(
+	          NULL,
+	          &location,
+	          &location_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_redirected_get_location_view(
+	          redirected,
+	          NULL,
+	          &location_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_redirected_get_location_view(
+	          redirected,
+	          &location,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an item of a different type
+	 */
+	item_descriptor.type = LIBMSIECF_ITEM_TYPE_URL;
+
+	result = libmsiecf_redirected_get_location_view(
+	          redirected,
+	          &location,
+	          &location_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	item_descriptor.type = LIBMSIECF_ITEM_TYPE_REDIRECTED;
+
+	/* Clean up
+	 */
+	result = libmsiecf_item_free(
+	          &redirected,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "redirected",
+	 redirected );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( redirected != NULL )
+	{
+		libmsiecf_item_free(
+		 &redirected,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libmsiecf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -52,6 +462,14 @@ int main(
 
 	/* TODO: add tests for libmsiecf_redirected_get_location */
 
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_redirected_get_location_view",
+	 msiecf_test_redirected_get_location_view );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
 	/* TODO: add tests for libmsiecf_redirected_get_utf8_location_size */
 
 	/* TODO: add tests for libmsiecf_redirected_get_utf8_location */
@@ -62,7 +480,11 @@ int main(
 
 	return( EXIT_SUCCESS );
 
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
 on_error:
 	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
 }
 
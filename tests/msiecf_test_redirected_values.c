@@ -282,6 +282,136 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libmsiecf_redirected_values_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_redirected_values_reference(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libmsiecf_redirected_values_t *redirected_values  = NULL;
+	libmsiecf_redirected_values_t *redirected_values2 = NULL;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_redirected_values_initialize(
+	          &redirected_values,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "redirected_values",
+	 redirected_values );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_redirected_values_reference(
+	          redirected_values,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT32(
+	 "redirected_values->reference_count",
+	 redirected_values->reference_count,
+	 (int32_t) 2 );
+
+	/* Releasing a reference does not free the values that are still referenced
+	 */
+	redirected_values2 = redirected_values;
+
+	result = libmsiecf_redirected_values_free(
+	          &redirected_values2,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "redirected_values2",
+	 redirected_values2 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT32(
+	 "redirected_values->reference_count",
+	 redirected_values->reference_count,
+	 (int32_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_redirected_values_reference(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_redirected_values_free(
+	          &redirected_values,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "redirected_values",
+	 redirected_values );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( redirected_values != NULL )
+	{
+		libmsiecf_redirected_values_free(
+		 &redirected_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libmsiecf_redirected_values_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -723,6 +853,10 @@ int main(
 	 "libmsiecf_redirected_values_free",
 	 msiecf_test_redirected_values_free );
 
+	MSIECF_TEST_RUN(
+	 "libmsiecf_redirected_values_reference",
+	 msiecf_test_redirected_values_reference );
+
 	MSIECF_TEST_RUN(
 	 "libmsiecf_redirected_values_read_data",
 	 msiecf_test_redirected_values_read_data );
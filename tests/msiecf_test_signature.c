@@ -0,0 +1,296 @@
+/*
+ * Library signature functions test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "msiecf_test_libcerror.h"
+#include "msiecf_test_libmsiecf.h"
+#include "msiecf_test_macros.h"
+#include "msiecf_test_memory.h"
+#include "msiecf_test_unused.h"
+
+#include "../libmsiecf/libmsiecf_signature.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* Tests the libmsiecf_signature_find_record function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_signature_find_record(
+     void )
+{
+	uint8_t data[ 4096 ];
+
+	libcerror_error_t *error = NULL;
+	size_t block_index       = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	if( memory_set(
+	     data,
+	     0,
+	     4096 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Test regular cases
+	 */
+	result = libmsiecf_signature_find_record(
+	          data,
+	          4096,
+	          128,
+	          &block_index,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "block_index",
+	 block_index,
+	 (size_t) 32 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data[ 23 * 128 ]     = 'L';
+	data[ 23 * 128 + 1 ] = 'E';
+	data[ 23 * 128 + 2 ] = 'A';
+	data[ 23 * 128 + 3 ] = 'K';
+
+	/* Blocks that only start with the first byte of a signature are ignored
+	 */
+	data[ 21 * 128 ]     = 'H';
+	data[ 21 * 128 + 1 ] = 'A';
+	data[ 21 * 128 + 2 ] = 'S';
+	data[ 21 * 128 + 3 ] = 'X';
+
+	/* Signatures that are not block aligned are ignored
+	 */
+	data[ 9 * 128 + 8 ]  = 'U';
+	data[ 9 * 128 + 9 ]  = 'R';
+	data[ 9 * 128 + 10 ] = 'L';
+	data[ 9 * 128 + 11 ] = ' ';
+
+	result = libmsiecf_signature_find_record(
+	          data,
+	          4096,
+	          128,
+	          &block_index,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "block_index",
+	 block_index,
+	 (size_t) 23 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data[ 2 * 128 ]     = 'U';
+	data[ 2 * 128 + 1 ] = 'R';
+	data[ 2 * 128 + 2 ] = 'L';
+	data[ 2 * 128 + 3 ] = ' ';
+
+	result = libmsiecf_signature_find_record(
+	          data,
+	          4096,
+	          128,
+	          &block_index,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "block_index",
+	 block_index,
+	 (size_t) 2 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a signature in the last block that is partially available
+	 */
+	result = libmsiecf_signature_find_record(
+	          data,
+	          ( 2 * 128 ) + 3,
+	          128,
+	          &block_index,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "block_index",
+	 block_index,
+	 (size_t) 2 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_signature_find_record(
+	          NULL,
+	          4096,
+	          128,
+	          &block_index,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_signature_find_record(
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          128,
+	          &block_index,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_signature_find_record(
+	          data,
+	          4096,
+	          0,
+	          &block_index,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_signature_find_record(
+	          data,
+	          4096,
+	          128,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argc )
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_signature_find_record",
+	 msiecf_test_signature_find_record );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+}
@@ -0,0 +1,474 @@
+/*
+ * Library string functions test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "msiecf_test_libcerror.h"
+#include "msiecf_test_libmsiecf.h"
+#include "msiecf_test_macros.h"
+#include "msiecf_test_memory.h"
+#include "msiecf_test_unused.h"
+
+#include "../libmsiecf/libmsiecf_string.h"
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* Tests the libmsiecf_string_is_ascii function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_string_is_ascii(
+     void )
+{
+	uint8_t byte_stream[ 67 ];
+
+	libcerror_error_t *error = NULL;
+	size_t byte_stream_index = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	for( byte_stream_index = 0;
+	     byte_stream_index < 67;
+	     byte_stream_index++ )
+	{
+		byte_stream[ byte_stream_index ] = (uint8_t) ( 'a' + ( byte_stream_index % 26 ) );
+	}
+	/* Test regular cases
+	 */
+	result = libmsiecf_string_is_ascii(
+	          byte_stream,
+	          67,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_string_is_ascii(
+	          byte_stream,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a non-ASCII character in the 32 byte blocks and in the remainder
+	 */
+	byte_stream[ 45 ] = 0xe9;
+
+	result = libmsiecf_string_is_ascii(
+	          byte_stream,
+	          67,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream[ 45 ] = (uint8_t) 'a';
+	byte_stream[ 66 ] = 0x80;
+
+	result = libmsiecf_string_is_ascii(
+	          byte_stream,
+	          67,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_string_is_ascii(
+	          byte_stream,
+	          66,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_string_is_ascii(
+	          NULL,
+	          67,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_string_is_ascii(
+	          byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_string_get_utf8_string_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_string_get_utf8_string_from_byte_stream(
+     void )
+{
+	uint8_t ascii_byte_stream[ 26 ] = {
+		'h', 't', 't', 'p', ':', '/', '/', 'w', 'w', 'w', '.', 'e', 'x', 'a', 'm', 'p',
+		'l', 'e', '.', 'c', 'o', 'm', '/', 0, 'x', 'y' };
+
+	uint8_t codepage_byte_stream[ 5 ] = {
+		'c', 'a', 'f', 0xe9, 0 };
+
+	uint8_t expected_utf8_string[ 6 ] = {
+		'c', 'a', 'f', 0xc3, 0xa9, 0 };
+
+	libcerror_error_t *error = NULL;
+	uint8_t *utf8_string     = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_string_get_utf8_string_from_byte_stream(
+	          ascii_byte_stream,
+	          26,
+	          LIBMSIECF_CODEPAGE_WINDOWS_1252,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string",
+	 utf8_string );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 24 );
+
+	result = memory_compare(
+	          utf8_string,
+	          ascii_byte_stream,
+	          24 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	memory_free(
+	 utf8_string );
+
+	utf8_string = NULL;
+
+	result = libmsiecf_string_get_utf8_string_from_byte_stream(
+	          codepage_byte_stream,
+	          5,
+	          LIBMSIECF_CODEPAGE_WINDOWS_1252,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_string",
+	 utf8_string );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 6 );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          6 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_string_get_utf8_string_from_byte_stream(
+	          codepage_byte_stream,
+	          5,
+	          LIBMSIECF_CODEPAGE_WINDOWS_1252,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_free(
+	 utf8_string );
+
+	utf8_string = NULL;
+
+	result = libmsiecf_string_get_utf8_string_from_byte_stream(
+	          NULL,
+	          5,
+	          LIBMSIECF_CODEPAGE_WINDOWS_1252,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_string_get_utf8_string_from_byte_stream(
+	          codepage_byte_stream,
+	          5,
+	          LIBMSIECF_CODEPAGE_WINDOWS_1252,
+	          NULL,
+	          &utf8_string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_string_get_utf8_string_from_byte_stream(
+	          codepage_byte_stream,
+	          5,
+	          LIBMSIECF_CODEPAGE_WINDOWS_1252,
+	          &utf8_string,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_MSIECF_TEST_MEMORY )
+
+	/* Test libmsiecf_string_get_utf8_string_from_byte_stream with malloc failing
+	 */
+	msiecf_test_malloc_attempts_before_fail = 0;
+
+	result = libmsiecf_string_get_utf8_string_from_byte_stream(
+	          ascii_byte_stream,
+	          26,
+	          LIBMSIECF_CODEPAGE_WINDOWS_1252,
+	          &utf8_string,
+	          &utf8_string_size,
+	          &error );
+
+	if( msiecf_test_malloc_attempts_before_fail != -1 )
+	{
+		msiecf_test_malloc_attempts_before_fail = -1;
+
+		if( utf8_string != NULL )
+		{
+			memory_free(
+			 utf8_string );
+
+			utf8_string = NULL;
+		}
+	}
+	else
+	{
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "utf8_string",
+		 utf8_string );
+
+		MSIECF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_MSIECF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc MSIECF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] MSIECF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argc )
+	MSIECF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_string_is_ascii",
+	 msiecf_test_string_is_ascii );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_string_get_utf8_string_from_byte_stream",
+	 msiecf_test_string_get_utf8_string_from_byte_stream );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+}
+
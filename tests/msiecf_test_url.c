@@ -21,18 +21,1595 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "msiecf_test_functions.h"
+#include "msiecf_test_libbfio.h"
 #include "msiecf_test_libcerror.h"
 #include "msiecf_test_libmsiecf.h"
 #include "msiecf_test_macros.h"
 #include "msiecf_test_memory.h"
 #include "msiecf_test_unused.h"
 
+#include "../libmsiecf/libmsiecf_definitions.h"
+#include "../libmsiecf/libmsiecf_io_handle.h"
+#include "../libmsiecf/libmsiecf_item.h"
+#include "../libmsiecf/libmsiecf_item_cache.h"
+#include "../libmsiecf/libmsiecf_item_descriptor.h"
+#include "../libmsiecf/libmsiecf_libcthreads.h"
+#include "../libmsiecf/libmsiecf_url_values.h"
+
+#define MSIECF_TEST_URL_NUMBER_OF_THREADS	8
+
+uint8_t msiecf_test_url_data1[ 512 ] = {
+	0x55, 0x52, 0x4c, 0x20, 0x04, 0x00, 0x00, 0x00, 0x80, 0xf9, 0x58, 0x8e, 0x81, 0xee, 0xcd, 0x01,
+	0xe0, 0x87, 0x44, 0x8e, 0x78, 0x1d, 0xce, 0x01, 0x6b, 0x42, 0x44, 0x52, 0x00, 0x00, 0x00, 0x00,
+	0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x60, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x00, 0x02, 0x00, 0x10, 0x10, 0xf8, 0x00, 0x00, 0x00,
+	0x41, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x6a, 0x42, 0x44, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x42, 0x44, 0x52,
+	0x00, 0x00, 0x00, 0x00, 0xef, 0xbe, 0xad, 0xde, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f,
+	0x77, 0x77, 0x77, 0x2e, 0x67, 0x6f, 0x6f, 0x67, 0x6c, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x63,
+	0x68, 0x61, 0x72, 0x74, 0x3f, 0x63, 0x68, 0x73, 0x3d, 0x31, 0x35, 0x30, 0x78, 0x31, 0x35, 0x30,
+	0x26, 0x63, 0x68, 0x74, 0x3d, 0x71, 0x72, 0x26, 0x63, 0x68, 0x6c, 0x3d, 0x68, 0x74, 0x74, 0x70,
+	0x3a, 0x2f, 0x2f, 0x6c, 0x69, 0x62, 0x6d, 0x73, 0x69, 0x65, 0x63, 0x66, 0x2e, 0x67, 0x6f, 0x6f,
+	0x67, 0x6c, 0x65, 0x63, 0x6f, 0x64, 0x65, 0x2e, 0x63, 0x6f, 0x6d, 0x2f, 0x66, 0x69, 0x6c, 0x65,
+	0x73, 0x2f, 0x6c, 0x69, 0x62, 0x6d, 0x73, 0x69, 0x65, 0x63, 0x66, 0x2d, 0x61, 0x6c, 0x70, 0x68,
+	0x61, 0x2d, 0x32, 0x30, 0x31, 0x33, 0x30, 0x33, 0x30, 0x35, 0x2e, 0x74, 0x61, 0x72, 0x2e, 0x67,
+	0x7a, 0x26, 0x63, 0x68, 0x6c, 0x64, 0x3d, 0x4c, 0x7c, 0x31, 0x26, 0x63, 0x68, 0x6f, 0x65, 0x3d,
+	0x55, 0x54, 0x46, 0x2d, 0x38, 0x00, 0xad, 0xde, 0x63, 0x68, 0x61, 0x72, 0x74, 0x5b, 0x31, 0x5d,
+	0x2e, 0x70, 0x6e, 0x67, 0x00, 0xbe, 0xad, 0xde, 0x48, 0x54, 0x54, 0x50, 0x2f, 0x31, 0x2e, 0x31,
+	0x20, 0x32, 0x30, 0x30, 0x20, 0x4f, 0x4b, 0x0d, 0x0a, 0x58, 0x2d, 0x46, 0x72, 0x61, 0x6d, 0x65,
+	0x2d, 0x4f, 0x70, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x3a, 0x20, 0x41, 0x4c, 0x4c, 0x4f, 0x57, 0x41,
+	0x4c, 0x4c, 0x0d, 0x0a, 0x41, 0x63, 0x63, 0x65, 0x73, 0x73, 0x2d, 0x43, 0x6f, 0x6e, 0x74, 0x72,
+	0x6f, 0x6c, 0x2d, 0x41, 0x6c, 0x6c, 0x6f, 0x77, 0x2d, 0x4f, 0x72, 0x69, 0x67, 0x69, 0x6e, 0x3a,
+	0x20, 0x2a, 0x0d, 0x0a, 0x43, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65,
+	0x3a, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x2f, 0x70, 0x6e, 0x67, 0x0d, 0x0a, 0x58, 0x2d, 0x43,
+	0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x54, 0x79, 0x70, 0x65, 0x2d, 0x4f, 0x70, 0x74, 0x69,
+	0x6f, 0x6e, 0x73, 0x3a, 0x20, 0x6e, 0x6f, 0x73, 0x6e, 0x69, 0x66, 0x66, 0x0d, 0x0a, 0x43, 0x6f,
+	0x6e, 0x74, 0x65, 0x6e, 0x74, 0x2d, 0x4c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x3a, 0x20, 0x31, 0x30,
+	0x33, 0x30, 0x0d, 0x0a, 0x58, 0x2d, 0x58, 0x53, 0x53, 0x2d, 0x50, 0x72, 0x6f, 0x74, 0x65, 0x63,
+	0x74, 0x69, 0x6f, 0x6e, 0x3a, 0x20, 0x31, 0x3b, 0x20, 0x6d, 0x6f, 0x64, 0x65, 0x3d, 0x62, 0x6c,
+	0x6f, 0x63, 0x6b, 0x0d, 0x0a, 0x0d, 0x0a, 0x7e, 0x55, 0x3a, 0x2d, 0x0d, 0x0a, 0x00, 0xad, 0xde,
+	0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde,
+	0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde,
+	0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde, 0xef, 0xbe, 0xad, 0xde };
+
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+/* Opens a file IO handle of the record data and reads the url item
+ * The file IO handle is closed after the item values were read
+ * Returns 1 if successful or -1 on error
+ */
+int msiecf_test_url_open_source(
+     libmsiecf_item_t **url,
+     libmsiecf_io_handle_t *io_handle,
+     libmsiecf_item_descriptor_t *item_descriptor,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "msiecf_test_url_open_source";
+	int result                       = 0;
+
+	if( msiecf_test_open_file_io_handle(
+	     &file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_item_initialize(
+	     url,
+	     item_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize URL.",
+		 function );
+
+		goto on_error;
+	}
+	if( libmsiecf_internal_item_read_values(
+	     (libmsiecf_internal_item_t *) *url,
+	     io_handle,
+	     file_io_handle,
+	     NULL,
+	     0,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read URL values.",
+		 function );
+
+		goto on_error;
+	}
+	result = msiecf_test_close_file_io_handle(
+	          &file_io_handle,
+	          error );
+
+	if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *url != NULL )
+	{
+		libmsiecf_item_free(
+		 url,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		msiecf_test_close_file_io_handle(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libmsiecf_url_get_location_view function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_url_get_location_view(
+     void )
+{
+	libmsiecf_item_descriptor_t item_descriptor;
+
+	libcerror_error_t *error         = NULL;
+	libmsiecf_io_handle_t *io_handle = NULL;
+	libmsiecf_item_t *url            = NULL;
+	const uint8_t *first_location    = NULL;
+	const uint8_t *location          = NULL;
+	size_t first_location_size       = 0;
+	size_t location_size             = 0;
+	size_t utf8_string_size          = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->ascii_codepage = LIBMSIECF_CODEPAGE_WINDOWS_1252;
+	io_handle->major_version  = 5;
+	io_handle->minor_version  = 2;
+
+	item_descriptor.type        = LIBMSIECF_ITEM_TYPE_URL;
+	item_descriptor.file_offset = 0;
+	item_descriptor.record_size = 512;
+	item_descriptor.flags       = 0;
+
+	result = msiecf_test_url_open_source(
+	          &url,
+	          io_handle,
+	          &item_descriptor,
+	          msiecf_test_url_data1,
+	          512,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "url",
+	 url );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the file IO handle is closed at this point, hence the view references data owned by the item
+	 */
+	result = libmsiecf_url_get_location_view(
+	          url,
+	          &first_location,
+	          &first_location_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "first_location",
+	 first_location );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "first_location_size",
+	 first_location_size,
+	 (size_t) 142 );
+
+	result = memory_compare(
+	          first_location,
+	          "https://www.google.com/chart?",
+	          29 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if the view remains valid after other values of the item were retrieved
+	 */
+	result = libmsiecf_url_get_utf8_location_size(
+	          url,
+	          &utf8_string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_url_get_location_view(
+	          url,
+	          &location,
+	          &location_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "location",
+	 ( location == first_location ),
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "location_size",
+	 location_size,
+	 first_location_size );
+
+	result = memory_compare(
+	          location,
+	          "https://www.google.com/chart?",
+	          29 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_url_get_location_view(
+	          NULL,
+	          &location,
+	          &location_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_url_get_location_view(
+	          url,
+	          NULL,
+	          &location_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_url_get_location_view(
+	          url,
+	          &location,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an item of a different type
+	 */
+	item_descriptor.type = LIBMSIECF_ITEM_TYPE_LEAK;
+
+	result = libmsiecf_url_get_location_view(
+	          url,
+	          &location,
+	          &location_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	item_descriptor.type = LIBMSIECF_ITEM_TYPE_URL;
+
+	/* Clean up
+	 */
+	result = libmsiecf_item_free(
+	          &url,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "url",
+	 url );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( url != NULL )
+	{
+		libmsiecf_item_free(
+		 &url,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libmsiecf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+
+typedef struct msiecf_test_url_thread_values msiecf_test_url_thread_values_t;
+
+struct msiecf_test_url_thread_values
+{
+	/* The URL
+	 */
+	libmsiecf_item_t *url;
+
+	/* The UTF-8 location
+	 */
+	uint8_t utf8_location[ 256 ];
+
+	/* The UTF-8 location size
+	 */
+	size_t utf8_location_size;
+
+	/* The result
+	 */
+	int result;
+};
+
+/* Retrieves the UTF-8 location of the URL from a thread
+ * Returns 1 if successful or -1 on error
+ */
+int msiecf_test_url_get_utf8_location_thread(
+     msiecf_test_url_thread_values_t *thread_values )
+{
+	thread_values->result = libmsiecf_url_get_utf8_location_size(
+	                         thread_values->url,
+	                         &( thread_values->utf8_location_size ),
+	                         NULL );
+
+	if( ( thread_values->result == 1 )
+	 && ( thread_values->utf8_location_size <= 256 ) )
+	{
+		thread_values->result = libmsiecf_url_get_utf8_location(
+		                         thread_values->url,
+		                         thread_values->utf8_location,
+		                         256,
+		                         NULL );
+	}
+	return( 1 );
+}
+
+/* Tests the libmsiecf_url_get_utf8_location function from multiple threads
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_url_get_utf8_location_threads(
+     void )
+{
+	libcthreads_thread_t *threads[ MSIECF_TEST_URL_NUMBER_OF_THREADS ];
+	msiecf_test_url_thread_values_t thread_values[ MSIECF_TEST_URL_NUMBER_OF_THREADS ];
+	libmsiecf_item_descriptor_t item_descriptor;
+
+	libcerror_error_t *error         = NULL;
+	libmsiecf_io_handle_t *io_handle = NULL;
+	libmsiecf_item_t *url            = NULL;
+	int result                       = 0;
+	int thread_index                 = 0;
+
+	/* Initialize test
+	 */
+	for( thread_index = 0;
+	     thread_index < MSIECF_TEST_URL_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+	}
+	result = libmsiecf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->ascii_codepage = LIBMSIECF_CODEPAGE_WINDOWS_1252;
+	io_handle->major_version  = 5;
+	io_handle->minor_version  = 2;
+
+	item_descriptor.type        = LIBMSIECF_ITEM_TYPE_URL;
+	item_descriptor.file_offset = 0;
+	item_descriptor.record_size = 512;
+	item_descriptor.flags       = 0;
+
+	result = msiecf_test_url_open_source(
+	          &url,
+	          io_handle,
+	          &item_descriptor,
+	          msiecf_test_url_data1,
+	          512,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "url",
+	 url );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the location has not been read at this point, hence all the threads race to read it
+	 */
+	for( thread_index = 0;
+	     thread_index < MSIECF_TEST_URL_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		thread_values[ thread_index ].url                = url;
+		thread_values[ thread_index ].utf8_location_size = 0;
+		thread_values[ thread_index ].result             = 0;
+
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          (int (*)(void *)) &msiecf_test_url_get_utf8_location_thread,
+		          (void *) &( thread_values[ thread_index ] ),
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < MSIECF_TEST_URL_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < MSIECF_TEST_URL_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "thread_values[ thread_index ].result",
+		 thread_values[ thread_index ].result,
+		 1 );
+
+		MSIECF_TEST_ASSERT_EQUAL_SIZE(
+		 "thread_values[ thread_index ].utf8_location_size",
+		 thread_values[ thread_index ].utf8_location_size,
+		 (size_t) 142 );
+
+		result = memory_compare(
+		          thread_values[ thread_index ].utf8_location,
+		          "https://www.google.com/chart?",
+		          29 );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = memory_compare(
+		          thread_values[ thread_index ].utf8_location,
+		          thread_values[ 0 ].utf8_location,
+		          142 );
+
+		MSIECF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	/* Test if only the strings of one of the threads were retained
+	 */
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "url_values->strings",
+	 ( (libmsiecf_url_values_t *) ( (libmsiecf_internal_item_t *) url )->value )->strings );
+
+	/* Clean up
+	 */
+	result = libmsiecf_item_free(
+	          &url,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "url",
+	 url );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < MSIECF_TEST_URL_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( url != NULL )
+	{
+		libmsiecf_item_free(
+		 &url,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libmsiecf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT ) */
+
+/* Tests the libmsiecf_url_get_filename_view function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_url_get_filename_view(
+     void )
+{
+	libmsiecf_item_descriptor_t item_descriptor;
+
+	libcerror_error_t *error         = NULL;
+	libmsiecf_io_handle_t *io_handle = NULL;
+	libmsiecf_item_t *url            = NULL;
+	const uint8_t *first_filename    = NULL;
+	const uint8_t *filename          = NULL;
+	size_t first_filename_size       = 0;
+	size_t filename_size             = 0;
+	size_t utf8_string_size          = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->ascii_codepage = LIBMSIECF_CODEPAGE_WINDOWS_1252;
+	io_handle->major_version  = 5;
+	io_handle->minor_version  = 2;
+
+	item_descriptor.type        = LIBMSIECF_ITEM_TYPE_URL;
+	item_descriptor.file_offset = 0;
+	item_descriptor.record_size = 512;
+	item_descriptor.flags       = 0;
+
+	result = msiecf_test_url_open_source(
+	          &url,
+	          io_handle,
+	          &item_descriptor,
+	          msiecf_test_url_data1,
+	          512,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "url",
+	 url );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the file IO handle is closed at this point, hence the view references data owned by the item
+	 */
+	result = libmsiecf_url_get_filename_view(
+	          url,
+	          &first_filename,
+	          &first_filename_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "first_filename",
+	 first_filename );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "first_filename_size",
+	 first_filename_size,
+	 (size_t) 13 );
+
+	result = memory_compare(
+	          first_filename,
+	          "chart[1].png",
+	          12 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if the view remains valid after other values of the item were retrieved
+	 */
+	result = libmsiecf_url_get_utf8_filename_size(
+	          url,
+	          &utf8_string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_url_get_filename_view(
+	          url,
+	          &filename,
+	          &filename_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "filename",
+	 ( filename == first_filename ),
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "filename_size",
+	 filename_size,
+	 first_filename_size );
+
+	result = memory_compare(
+	          filename,
+	          "chart[1].png",
+	          12 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_url_get_filename_view(
+	          NULL,
+	          &filename,
+	          &filename_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_url_get_filename_view(
+	          url,
+	          NULL,
+	          &filename_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_url_get_filename_view(
+	          url,
+	          &filename,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an item of a different type
+	 */
+	item_descriptor.type = LIBMSIECF_ITEM_TYPE_LEAK;
+
+	result = libmsiecf_url_get_filename_view(
+	          url,
+	          &filename,
+	          &filename_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	item_descriptor.type = LIBMSIECF_ITEM_TYPE_URL;
+
+	/* Clean up
+	 */
+	result = libmsiecf_item_free(
+	          &url,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "url",
+	 url );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( url != NULL )
+	{
+		libmsiecf_item_free(
+		 &url,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libmsiecf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_url_get_data_view function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_url_get_data_view(
+     void )
+{
+	libmsiecf_item_descriptor_t item_descriptor;
+
+	libcerror_error_t *error         = NULL;
+	libmsiecf_io_handle_t *io_handle = NULL;
+	libmsiecf_item_t *url            = NULL;
+	const uint8_t *first_data        = NULL;
+	const uint8_t *data              = NULL;
+	size_t first_data_size           = 0;
+	size_t data_size                 = 0;
+	size_t utf8_string_size          = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->ascii_codepage = LIBMSIECF_CODEPAGE_WINDOWS_1252;
+	io_handle->major_version  = 5;
+	io_handle->minor_version  = 2;
+
+	item_descriptor.type        = LIBMSIECF_ITEM_TYPE_URL;
+	item_descriptor.file_offset = 0;
+	item_descriptor.record_size = 512;
+	item_descriptor.flags       = 0;
+
+	result = msiecf_test_url_open_source(
+	          &url,
+	          io_handle,
+	          &item_descriptor,
+	          msiecf_test_url_data1,
+	          512,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "url",
+	 url );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * the file IO handle is closed at this point, hence the view references data owned by the item
+	 */
+	result = libmsiecf_url_get_data_view(
+	          url,
+	          &first_data,
+	          &first_data_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "first_data",
+	 first_data );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "first_data_size",
+	 first_data_size,
+	 (size_t) 198 );
+
+	result = memory_compare(
+	          first_data,
+	          "HTTP/1.1 200 OK",
+	          15 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if the view remains valid after other values of the item were retrieved
+	 */
+	result = libmsiecf_url_get_utf8_location_size(
+	          url,
+	          &utf8_string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_url_get_data_view(
+	          url,
+	          &data,
+	          &data_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "data",
+	 ( data == first_data ),
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 first_data_size );
+
+	result = memory_compare(
+	          data,
+	          "HTTP/1.1 200 OK",
+	          15 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_url_get_data_view(
+	          NULL,
+	          &data,
+	          &data_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_url_get_data_view(
+	          url,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_url_get_data_view(
+	          url,
+	          &data,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an item of a different type
+	 */
+	item_descriptor.type = LIBMSIECF_ITEM_TYPE_LEAK;
+
+	result = libmsiecf_url_get_data_view(
+	          url,
+	          &data,
+	          &data_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	item_descriptor.type = LIBMSIECF_ITEM_TYPE_URL;
+
+	/* Clean up
+	 */
+	result = libmsiecf_item_free(
+	          &url,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "url",
+	 url );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( url != NULL )
+	{
+		libmsiecf_item_free(
+		 &url,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libmsiecf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libmsiecf_internal_item_read_values function with an item cache
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_url_read_values_cached(
+     void )
+{
+	libmsiecf_item_descriptor_t item_descriptor;
+
+	libcerror_error_t *error           = NULL;
+	libmsiecf_io_handle_t *io_handle   = NULL;
+	libmsiecf_item_cache_t *item_cache = NULL;
+	libmsiecf_item_t *url              = NULL;
+	libmsiecf_item_t *url2             = NULL;
+	libmsiecf_url_values_t *url_values = NULL;
+	size_t utf8_string_size            = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->ascii_codepage = LIBMSIECF_CODEPAGE_WINDOWS_1252;
+	io_handle->major_version  = 5;
+	io_handle->minor_version  = 2;
+
+	result = libmsiecf_item_cache_initialize(
+	          &item_cache,
+	          1024 * 1024,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "item_cache",
+	 item_cache );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	item_descriptor.type        = LIBMSIECF_ITEM_TYPE_URL;
+	item_descriptor.file_offset = 0;
+	item_descriptor.record_size = 512;
+	item_descriptor.flags       = 0;
+
+	result = libmsiecf_item_initialize(
+	          &url,
+	          &item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_item_initialize(
+	          &url2,
+	          &item_descriptor,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_internal_item_read_values(
+	          (libmsiecf_internal_item_t *) url,
+	          io_handle,
+	          NULL,
+	          msiecf_test_url_data1,
+	          512,
+	          item_cache,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	url_values = (libmsiecf_url_values_t *) ( (libmsiecf_internal_item_t *) url )->value;
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "url_values",
+	 url_values );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT32(
+	 "url_values->reference_count",
+	 url_values->reference_count,
+	 (int32_t) 2 );
+
+	/* Test if a cache hit shares the values instead of copying them
+	 */
+	result = libmsiecf_internal_item_read_values(
+	          (libmsiecf_internal_item_t *) url2,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          0,
+	          item_cache,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "url2->value",
+	 ( ( (libmsiecf_internal_item_t *) url2 )->value == (intptr_t *) url_values ),
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT32(
+	 "url_values->reference_count",
+	 url_values->reference_count,
+	 (int32_t) 3 );
+
+	result = libmsiecf_item_free(
+	          &url2,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the values remain valid after they were removed from the cache
+	 */
+	result = libmsiecf_item_cache_free(
+	          &item_cache,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT32(
+	 "url_values->reference_count",
+	 url_values->reference_count,
+	 (int32_t) 1 );
+
+	result = libmsiecf_url_get_utf8_location_size(
+	          url,
+	          &utf8_string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 142 );
+
+	/* Clean up
+	 */
+	result = libmsiecf_item_free(
+	          &url,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "url",
+	 url );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( url2 != NULL )
+	{
+		libmsiecf_item_free(
+		 &url2,
+		 NULL );
+	}
+	if( url != NULL )
+	{
+		libmsiecf_item_free(
+		 &url,
+		 NULL );
+	}
+	if( item_cache != NULL )
+	{
+		libmsiecf_item_cache_free(
+		 &item_cache,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libmsiecf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -68,9 +1645,23 @@ int main(
 
 	/* TODO: add tests for libmsiecf_url_get_location */
 
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_url_get_location_view",
+	 msiecf_test_url_get_location_view );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
 	/* TODO: add tests for libmsiecf_url_get_utf8_location_size */
 
-	/* TODO: add tests for libmsiecf_url_get_utf8_location */
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) && defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_url_get_utf8_location",
+	 msiecf_test_url_get_utf8_location_threads );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) && defined( HAVE_LIBMSIECF_MULTI_THREAD_SUPPORT ) */
 
 	/* TODO: add tests for libmsiecf_url_get_utf16_location_size */
 
@@ -80,6 +1671,14 @@ int main(
 
 	/* TODO: add tests for libmsiecf_url_get_filename */
 
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_url_get_filename_view",
+	 msiecf_test_url_get_filename_view );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
 	/* TODO: add tests for libmsiecf_url_get_utf8_filename_size */
 
 	/* TODO: add tests for libmsiecf_url_get_utf8_filename */
@@ -92,9 +1691,25 @@ int main(
 
 	/* TODO: add tests for libmsiecf_url_get_data */
 
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_url_get_data_view",
+	 msiecf_test_url_get_data_view );
+
+	MSIECF_TEST_RUN(
+	 "libmsiecf_internal_item_read_values",
+	 msiecf_test_url_read_values_cached );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
+
 	return( EXIT_SUCCESS );
 
+#if defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT )
+
 on_error:
 	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBMSIECF_DLL_IMPORT ) */
 }
 
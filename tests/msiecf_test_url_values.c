@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -307,16 +308,148 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libmsiecf_url_values_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_url_values_reference(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libmsiecf_url_values_t *url_values  = NULL;
+	libmsiecf_url_values_t *url_values2 = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_url_values_initialize(
+	          &url_values,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "url_values",
+	 url_values );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_url_values_reference(
+	          url_values,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT32(
+	 "url_values->reference_count",
+	 url_values->reference_count,
+	 (int32_t) 2 );
+
+	/* Releasing a reference does not free the values that are still referenced
+	 */
+	url_values2 = url_values;
+
+	result = libmsiecf_url_values_free(
+	          &url_values2,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "url_values2",
+	 url_values2 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT32(
+	 "url_values->reference_count",
+	 url_values->reference_count,
+	 (int32_t) 1 );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_url_values_reference(
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_url_values_free(
+	          &url_values,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "url_values",
+	 url_values );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( url_values != NULL )
+	{
+		libmsiecf_url_values_free(
+		 &url_values,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libmsiecf_url_values_read_data function
  * Returns 1 if successful or 0 if not
  */
 int msiecf_test_url_values_read_data(
      void )
 {
-	libcerror_error_t *error           = NULL;
-	libmsiecf_io_handle_t *io_handle   = NULL;
-	libmsiecf_url_values_t *url_values = NULL;
-	int result                         = 0;
+	libcerror_error_t *error                   = NULL;
+	libmsiecf_io_handle_t *io_handle           = NULL;
+	libmsiecf_url_strings_t *first_url_strings = NULL;
+	libmsiecf_url_strings_t *url_strings       = NULL;
+	libmsiecf_url_values_t *url_values         = NULL;
+	int result                                 = 0;
 
 	/* Initialize test
 	 */
@@ -377,8 +510,137 @@ int msiecf_test_url_values_read_data(
 	 "error",
 	 error );
 
+	MSIECF_TEST_ASSERT_EQUAL_UINT8(
+	 "url_values->type",
+	 url_values->type,
+	 (uint8_t) LIBMSIECF_URL_ITEM_TYPE_CACHE );
+
+	/* The location references a copy of the record data owned by the URL values
+	 */
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "url_values->record_data",
+	 url_values->record_data );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "url_values->record_data_size",
+	 url_values->record_data_size,
+	 (size_t) 512 );
+
+	/* The location and filename strings are read on demand
+	 */
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "url_values->strings",
+	 url_values->strings );
+
+	result = libmsiecf_url_values_read_strings(
+	          url_values,
+	          &first_url_strings,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "first_url_strings",
+	 first_url_strings );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "url_values->strings",
+	 ( url_values->strings == first_url_strings ),
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "first_url_strings->location",
+	 first_url_strings->location );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "first_url_strings->filename",
+	 first_url_strings->filename );
+
+	/* Reading the strings a second time returns the published strings
+	 */
+	result = libmsiecf_url_values_read_strings(
+	          url_values,
+	          &url_strings,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "url_strings",
+	 ( url_strings == first_url_strings ),
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "url_strings->location_data",
+	 ( url_strings->location_data == &( url_values->record_data[ 104 ] ) ),
+	 1 );
+
+	result = memory_compare(
+	          url_strings->location_data,
+	          "https://www.google.com/chart?",
+	          29 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "url_values->data",
+	 ( ( url_values->data >= url_values->record_data )
+	  && ( url_values->data < &( url_values->record_data[ 512 ] ) ) ),
+	 1 );
+
 	/* Test error cases
 	 */
+	result = libmsiecf_url_values_read_strings(
+	          NULL,
+	          &url_strings,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_url_values_read_strings(
+	          url_values,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	result = libmsiecf_url_values_read_data(
 	          NULL,
 	          io_handle,
@@ -538,6 +800,314 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libmsiecf_url_values_get_record_string function
+ * Returns 1 if successful or 0 if not
+ */
+int msiecf_test_url_values_get_record_string(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libmsiecf_io_handle_t *io_handle   = NULL;
+	libmsiecf_url_values_t *url_values = NULL;
+	const uint8_t *string              = NULL;
+	size_t string_size                 = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libmsiecf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->ascii_codepage = LIBMSIECF_CODEPAGE_WINDOWS_1252;
+	io_handle->major_version  = 5;
+	io_handle->minor_version  = 2;
+
+	result = libmsiecf_url_values_initialize(
+	          &url_values,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "url_values",
+	 url_values );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_url_values_read_data(
+	          url_values,
+	          io_handle,
+	          msiecf_test_url_values_data1,
+	          512,
+	          0,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libmsiecf_url_values_get_record_string(
+	          url_values,
+	          url_values->location_offset,
+	          &string,
+	          &string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "string",
+	 ( string == &( url_values->record_data[ 104 ] ) ),
+	 1 );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 142 );
+
+	result = libmsiecf_url_values_get_record_string(
+	          url_values,
+	          url_values->filename_offset,
+	          &string,
+	          &string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	MSIECF_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 13 );
+
+	result = memory_compare(
+	          string,
+	          "chart[1].png",
+	          13 );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Retrieving the strings does not decode them
+	 */
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "url_values->strings",
+	 url_values->strings );
+
+	/* Test with a string offset that is not set or out of bounds
+	 */
+	result = libmsiecf_url_values_get_record_string(
+	          url_values,
+	          0,
+	          &string,
+	          &string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_url_values_get_record_string(
+	          url_values,
+	          512,
+	          &string,
+	          &string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libmsiecf_url_values_get_record_string(
+	          NULL,
+	          url_values->location_offset,
+	          &string,
+	          &string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_url_values_get_record_string(
+	          url_values,
+	          url_values->location_offset,
+	          NULL,
+	          &string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libmsiecf_url_values_get_record_string(
+	          url_values,
+	          url_values->location_offset,
+	          &string,
+	          NULL,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an unterminated string
+	 */
+	result = libmsiecf_url_values_get_record_string(
+	          url_values,
+	          500,
+	          &string,
+	          &string_size,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	MSIECF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libmsiecf_url_values_free(
+	          &url_values,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "url_values",
+	 url_values );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libmsiecf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	MSIECF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	MSIECF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( url_values != NULL )
+	{
+		libmsiecf_url_values_free(
+		 &url_values,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libmsiecf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libmsiecf_url_values_read_file_io_handle function
  * Returns 1 if successful or 0 if not
  */
@@ -879,10 +1449,18 @@ int main(
 	 "libmsiecf_url_values_free",
 	 msiecf_test_url_values_free );
 
+	MSIECF_TEST_RUN(
+	 "libmsiecf_url_values_reference",
+	 msiecf_test_url_values_reference );
+
 	MSIECF_TEST_RUN(
 	 "libmsiecf_url_values_read_data",
 	 msiecf_test_url_values_read_data );
 
+	MSIECF_TEST_RUN(
+	 "libmsiecf_url_values_get_record_string",
+	 msiecf_test_url_values_get_record_string );
+
 	MSIECF_TEST_RUN(
 	 "libmsiecf_url_values_read_file_io_handle",
 	 msiecf_test_url_values_read_file_io_handle );
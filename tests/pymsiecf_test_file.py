@@ -22,6 +22,7 @@
 import argparse
 import os
 import sys
+import tempfile
 import unittest
 
 import pymsiecf
@@ -148,6 +149,121 @@ class FileTypeTests(unittest.TestCase):
       with self.assertRaises(RuntimeError):
         msiecf_file.set_ascii_codepage(codepage)
 
+  def test_set_access_pattern(self):
+    """Tests the set_access_pattern function."""
+    msiecf_file = pymsiecf.file()
+
+    msiecf_file.set_access_pattern(pymsiecf.access_patterns.SEQUENTIAL)
+
+    access_pattern = msiecf_file.get_access_pattern()
+    self.assertEqual(access_pattern, pymsiecf.access_patterns.SEQUENTIAL)
+
+    msiecf_file.set_access_pattern(pymsiecf.access_patterns.NO_REUSE)
+
+    with self.assertRaises(IOError):
+      msiecf_file.set_access_pattern(-1)
+
+  def test_set_maximum_block_cache_size(self):
+    """Tests the set_maximum_block_cache_size function."""
+    msiecf_file = pymsiecf.file()
+
+    self.assertEqual(msiecf_file.get_maximum_block_cache_size(), 0)
+
+    msiecf_file.set_maximum_block_cache_size(1024 * 1024)
+
+    maximum_cache_size = msiecf_file.get_maximum_block_cache_size()
+    self.assertEqual(maximum_cache_size, 1024 * 1024)
+
+    with self.assertRaises(ValueError):
+      msiecf_file.set_maximum_block_cache_size(-1)
+
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      return
+
+    if not os.path.isfile(test_source):
+      return
+
+    with open(test_source, "rb") as file_object:
+      msiecf_file.open_file_object(file_object)
+
+      number_of_items = msiecf_file.get_number_of_items()
+
+      offsets = [
+          msiecf_file.get_item(item_index).offset
+          for item_index in range(number_of_items)]
+
+      msiecf_file.set_maximum_block_cache_size(0)
+
+      for item_index, offset in enumerate(offsets):
+        item = msiecf_file.get_item(item_index)
+        self.assertEqual(item.offset, offset)
+
+      msiecf_file.close()
+
+  def test_set_index_filename(self):
+    """Tests the set_index_filename function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    with tempfile.TemporaryDirectory() as temporary_directory:
+      index_filename = os.path.join(temporary_directory, "index.idx")
+
+      msiecf_file = pymsiecf.file()
+      msiecf_file.set_index_filename(index_filename)
+
+      msiecf_file.open(test_source)
+
+      number_of_items = msiecf_file.get_number_of_items()
+      number_of_recovered_items = msiecf_file.get_number_of_recovered_items()
+
+      with self.assertRaises(IOError):
+        msiecf_file.set_index_filename(index_filename)
+
+      msiecf_file.close()
+
+      self.assertTrue(os.path.isfile(index_filename))
+
+      # The second open reads the items from the index file.
+      msiecf_file = pymsiecf.file()
+      msiecf_file.set_index_filename(index_filename)
+
+      msiecf_file.open(test_source)
+
+      self.assertEqual(msiecf_file.get_number_of_items(), number_of_items)
+      self.assertEqual(
+          msiecf_file.get_number_of_recovered_items(),
+          number_of_recovered_items)
+
+      msiecf_file.close()
+
+  def test_refresh(self):
+    """Tests the refresh function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    msiecf_file = pymsiecf.file()
+
+    msiecf_file.open(test_source)
+
+    number_of_items = msiecf_file.get_number_of_items()
+    number_of_recovered_items = msiecf_file.get_number_of_recovered_items()
+
+    # Refreshing an unmodified file does not add items.
+    msiecf_file.refresh()
+
+    self.assertEqual(msiecf_file.get_number_of_items(), number_of_items)
+    self.assertEqual(
+        msiecf_file.get_number_of_recovered_items(),
+        number_of_recovered_items)
+
+    msiecf_file.close()
+
+    with self.assertRaises(IOError):
+      msiecf_file.refresh()
+
   def test_get_size(self):
     """Tests the get_size function and size property."""
     test_source = getattr(unittest, "source", None)
@@ -216,6 +332,59 @@ class FileTypeTests(unittest.TestCase):
 
     msiecf_file.close()
 
+  def test_get_items_by_range(self):
+    """Tests the get_items_by_range function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    msiecf_file = pymsiecf.file()
+
+    msiecf_file.open(test_source)
+
+    number_of_items = msiecf_file.get_number_of_items()
+
+    items = msiecf_file.get_items_by_range(0, number_of_items)
+    self.assertEqual(len(items), number_of_items)
+
+    for item_index, item in enumerate(items):
+      offset = msiecf_file.get_item(item_index).offset
+      self.assertEqual(item.offset, offset)
+
+    with self.assertRaises(IOError):
+      msiecf_file.get_items_by_range(0, number_of_items + 1)
+
+    msiecf_file.close()
+
+  def test_get_items_by_indexes(self):
+    """Tests the get_items_by_indexes function."""
+    test_source = getattr(unittest, "source", None)
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    msiecf_file = pymsiecf.file()
+
+    msiecf_file.open(test_source)
+
+    number_of_items = msiecf_file.get_number_of_items()
+
+    item_indexes = list(reversed(range(number_of_items)))
+
+    items = msiecf_file.get_items_by_indexes(item_indexes)
+    self.assertEqual(len(items), number_of_items)
+
+    for item_index, item in zip(item_indexes, items):
+      offset = msiecf_file.get_item(item_index).offset
+      self.assertEqual(item.offset, offset)
+
+    with self.assertRaises(IOError):
+      msiecf_file.get_items_by_indexes([number_of_items])
+
+    with self.assertRaises(ValueError):
+      msiecf_file.get_items_by_indexes([-1])
+
+    msiecf_file.close()
+
   def test_get_number_of_recovered_items(self):
     """Tests the get_number_of_recovered_items function and number_of_recovered_items property."""
     test_source = getattr(unittest, "source", None)
@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "allocation_table cache_directory_table directory_descriptor error file_header hash_table io_handle item item_descriptor leak_values notify property_type redirected_values url_values"
+$LibraryTests = "allocation_map allocation_table block_cache cache_directory_table directory_descriptor error file_header file_io_handle_pool hash_map hash_table index_file io_handle item item_cache item_descriptor item_descriptor_arena item_view leak_values notify property_type read_batch record_decoders record_scan_chunk redirected_values signature string url_columns url_values"
 $LibraryTestsWithInput = "file support"
 $OptionSets = ""
 
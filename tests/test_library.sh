@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="allocation_table cache_directory_table directory_descriptor error file_header hash_table io_handle item item_descriptor leak_values notify property_type redirected_values url_values";
+LIBRARY_TESTS="allocation_map allocation_table block_cache cache_directory_table directory_descriptor error file_header file_io_handle_pool hash_map hash_table index_file io_handle item item_cache item_descriptor item_descriptor_arena item_view leak_values notify property_type read_batch record_decoders record_scan_chunk redirected_values signature string url_columns url_values";
 LIBRARY_TESTS_WITH_INPUT="file support";
 OPTION_SETS=();
 